@@ -0,0 +1,3 @@
+#version 450
+#extension GL_ARB_bindless_texture : require
+#define BINDLESS_TEXTURES
\ No newline at end of file
@@ -0,0 +1,33 @@
+#version 450
+
+layout (local_size_x = 16, local_size_y = 16) in;
+
+layout (location = 0) uniform int radius; //!< How many texels either side of the centre the box filter covers.
+
+layout (binding = 0, rgba32f) uniform restrict readonly image2D horizontal; //!< The horizontally blurred moments.
+layout (binding = 1, rgba32f) uniform restrict writeonly image2D moments;   //!< The layer of the moments to write to.
+
+
+/**
+    Completes the separable box filter of WarpShadowMoments.cs by blurring vertically into the layer of the moments 
+    which belongs to the shadow map.
+*/
+void main()
+{
+    const ivec2 texel   = ivec2 (gl_GlobalInvocationID.xy);
+    const ivec2 size    = imageSize (horizontal);
+
+    if (any (greaterThanEqual (texel, size)))
+    {
+        return;
+    }
+
+    vec4 sum = vec4 (0.0);
+    for (int y = -radius; y <= radius; ++y)
+    {
+        const int row   = clamp (texel.y + y, 0, size.y - 1);
+        sum             += imageLoad (horizontal, ivec2 (texel.x, row));
+    }
+
+    imageStore (moments, texel, sum / (2 * radius + 1));
+}
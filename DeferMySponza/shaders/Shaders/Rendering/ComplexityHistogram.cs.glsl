@@ -0,0 +1,53 @@
+#version 450
+
+layout (local_size_x = 16, local_size_y = 16) in;
+
+const uint binCount = 64; //!< Must match ComplexityCounter::binCount, the last bin contains every larger count.
+
+layout (binding = 0, r32ui) uniform restrict readonly uimage2DRect overdraw;    //!< How many geometry fragments were shaded per pixel.
+layout (binding = 1, r32ui) uniform restrict readonly uimage2DRect lights;      //!< How many light volumes were shaded per pixel.
+
+layout (location = 0) uniform ivec2 region; //!< The size of the rendered region, it may be smaller than the counters.
+
+layout (std430, binding = 0) restrict buffer Histograms
+{
+    uint overdrawBins[binCount];    //!< How many pixels were shaded a given number of times by the geometry pass.
+    uint lightBins[binCount];       //!< How many pixels were shaded by a given number of light volumes.
+} histograms;
+
+shared uint localOverdraw[binCount];    //!< The overdraw histogram of the work group.
+shared uint localLights[binCount];      //!< The light histogram of the work group.
+
+
+/**
+    Reduces the per-pixel counters into histograms. Each work group builds a histogram in shared memory before adding
+    it to the global histogram so that only a few global atomics are performed per group.
+*/
+void main()
+{
+    const uint index = gl_LocalInvocationIndex;
+
+    if (index < binCount)
+    {
+        localOverdraw[index]    = 0U;
+        localLights[index]      = 0U;
+    }
+
+    barrier();
+
+    const ivec2 pixel = ivec2 (gl_GlobalInvocationID.xy);
+
+    if (all (lessThan (pixel, min (region, imageSize (overdraw)))))
+    {
+        atomicAdd (localOverdraw[min (imageLoad (overdraw, pixel).r, binCount - 1U)], 1U);
+        atomicAdd (localLights[min (imageLoad (lights, pixel).r, binCount - 1U)], 1U);
+    }
+
+    barrier();
+
+    if (index < binCount)
+    {
+        atomicAdd (histograms.overdrawBins[index], localOverdraw[index]);
+        atomicAdd (histograms.lightBins[index], localLights[index]);
+    }
+}
\ No newline at end of file
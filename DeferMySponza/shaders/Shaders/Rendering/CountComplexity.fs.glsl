@@ -0,0 +1,16 @@
+#version 450
+
+// Measuring complexity requires counting the fragments which pass the depth and stencil tests, not every fragment.
+layout (early_fragment_tests) in;
+
+layout (binding = 0, r32ui) uniform restrict coherent uimage2DRect complexity; //!< Counts how many times each pixel has been shaded.
+
+
+/**
+    Increments the counter of the current pixel. Linked in place of IgnoreComplexity.fs when measuring overdraw or
+    light complexity.
+*/
+void recordComplexity()
+{
+    imageAtomicAdd (complexity, ivec2 (gl_FragCoord.xy), 1U);
+}
\ No newline at end of file
@@ -10,6 +10,10 @@ layout (location = 1)   out vec3    normal;         //!< The normal of the fragm
 layout (location = 2)   out vec3    materialInfo;   //!< The texture co-ordinates and material ID of the fragment in the Gbuffer.
 
 
+// External functions.
+void recordComplexity();
+
+
 /**
     Simply outputs the position, normal and material properties of the current fragment.
 */
@@ -23,4 +27,7 @@ void main()
 
     // For materials, the XY channels are texture co-ordintes and Z is the material ID.
     materialInfo = vec3 (texturePoint, materialID);
+
+    // Count the fragment if overdraw is being measured.
+    recordComplexity();
 }
\ No newline at end of file
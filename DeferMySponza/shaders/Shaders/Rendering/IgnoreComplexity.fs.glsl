@@ -0,0 +1,8 @@
+#version 450
+
+/**
+    Does nothing, linked in place of CountComplexity.fs when complexity isn't being measured.
+*/
+void recordComplexity()
+{
+}
\ No newline at end of file
@@ -1,4 +1,4 @@
-﻿#version 450
+#version 450
 
 layout (std140) uniform Scene
 {
@@ -23,15 +23,20 @@ void setFragmentMaterial (const in vec2 uvCoordinates, const in int materialID);
 vec3 directionalLightContributions (const in vec3 normal, const in vec3 view);
 vec3 pointLightContribution (const in uint index, const in vec3 position, const in vec3 normal, const in vec3 view);
 vec3 spotlightContribution (const in uint index, const in vec3 position, const in vec3 normal, const in vec3 view);
+vec3 spotlightContribution (const in uint index, const in vec3 position, const in vec3 normal, const in vec3 view,
+    const in bool castsShadow);
+void recordComplexity();
 
 
 // Forward declarations.
 vec3 viewDirection (const in vec3 position);
 
 
-// Subroutines.
+// Subroutines, lighting permutations perform a single pass chosen at compile time instead.
+#ifndef LIGHTING_PERMUTATION
 subroutine vec3 LightingPass (const in vec3 position, const in vec3 normal);
 layout (location = 0) subroutine uniform LightingPass lightingPass; //!< Determines whether global, point or spot lighting calculations will occur.
+#endif
 
 
 /**
@@ -50,15 +55,30 @@ void main()
     const vec3 material = texelFetch (gbufferMaterials, fragment).rgb;
     setFragmentMaterial (material.xy, int (material.z));
     
-    // Apply lighting.
-    reflectedLight = lightingPass (q, n);
+    // Apply lighting. Unshadowed spotlights are drawn separately so their indices follow the shadow casters.
+    #if defined GLOBAL_LIGHT_PASS
+        reflectedLight = scene.ambience + directionalLightContributions (n, viewDirection (q));
+    #elif defined POINT_LIGHT_PASS
+        reflectedLight = pointLightContribution (lightIndex, q, n, viewDirection (q));
+    #elif defined SHADOWED_SPOTLIGHT_PASS
+        reflectedLight = spotlightContribution (lightIndex, q, n, viewDirection (q), true);
+    #elif defined UNSHADOWED_SPOTLIGHT_PASS
+        reflectedLight = spotlightContribution (lightIndex + SHADOWED_SPOTLIGHT_COUNT, q, n, viewDirection (q), false);
+    #else
+        reflectedLight = lightingPass (q, n);
+    #endif
+
+    // Count the light if light complexity is being measured.
+    recordComplexity();
 }
 
 
 /**
     Calculates the ambient and directional light contributions.
 */
+#ifndef LIGHTING_PERMUTATION
 layout (index = 0) subroutine (LightingPass)
+#endif
 vec3 globalLightPass (const in vec3 position, const in vec3 normal)
 {
     // Calculate the direction from the fragment to the viewer.
@@ -69,7 +89,9 @@ vec3 globalLightPass (const in vec3 position, const in vec3 normal)
 /**
     Calculates the lighting contribution of a point light.
 */
+#ifndef LIGHTING_PERMUTATION
 layout (index = 1) subroutine (LightingPass)
+#endif
 vec3 pointLightPass (const in vec3 position, const in vec3 normal)
 {
     return pointLightContribution (lightIndex, position, normal, viewDirection (position));
@@ -79,7 +101,9 @@ vec3 pointLightPass (const in vec3 position, const in vec3 normal)
 /**
     Calculates the lighting contribution of a point light.
 */
+#ifndef LIGHTING_PERMUTATION
 layout (index = 2) subroutine (LightingPass)
+#endif
 vec3 spotlightPass (const in vec3 position, const in vec3 normal)
 {
     return spotlightContribution (lightIndex, position, normal, viewDirection (position));
@@ -84,30 +84,128 @@ layout (std140) uniform Scene
 // Uniforms.
 uniform sampler2DArrayShadow shadowMaps; //!< Contains shadow maps for every spotlight in the scene.
 
+#ifdef SHADOW_FILTER_EVSM
+    uniform sampler2DArray shadowMoments; //!< Blurred and mipmapped exponential moments of every shadow map.
+#endif
+
+
+// Lighting permutations define how many lights exist so every loop has a constant bound. Spotlights which cast shadows
+// are stored first so a permutation also knows which spotlights sample the shadow maps without reading their view index.
+#ifdef SPOTLIGHT_COUNT
+    #define directionalLightCount   DIRECTIONAL_LIGHT_COUNT
+    #define pointLightCount         POINT_LIGHT_COUNT
+    #define spotlightCount          SPOTLIGHT_COUNT
+#else
+    #define directionalLightCount   directionalLights.count
+    #define pointLightCount         pointLights.count
+    #define spotlightCount          spotlights.count
+#endif
+
+// How many texels wide the percentage-closer filter is, this should be odd so the filter is centred. Lighting
+// permutations may also define SHADOW_FILTER_GATHER or SHADOW_FILTER_EVSM to replace the individual filter taps.
+#ifndef SHADOW_FILTER_SIZE
+    #define SHADOW_FILTER_SIZE 5
+#endif
+
+const vec2  evsmExponents       = vec2 (40.0, 5.0); //!< Warps depth for moments, must match WarpShadowMoments.cs.
+const float evsmBleedReduction  = 0.3;              //!< How much of the tail of the Chebyshev bound is cut off.
+const float evsmVarianceBias    = 0.0001;           //!< Scales the minimum variance to avoid acne on flat surfaces.
+
 
 // Externals.
 vec3 calculateReflectance (const in vec3 l, const in vec3 n, const in vec3 v, const in vec3 e);
 
 
+#if defined SHADOW_FILTER_GATHER
+
 /**
-    Calculates a shadowing factor to apply to the light at the current pixel.
-    http://ogldev.atspace.co.uk/www/tutorial42/tutorial42.html
+    Weights a column or row of the texels covered by the filter. Each tap of the percentage-closer filter blends two 
+    texels so the outermost texels are only partially covered and every texel between them is fully covered.
 */
-float spotlightShadow (const in vec3 position, const in int viewIndex)
+float gatherWeight (const in int index, const in float fraction)
 {
-    // Determine the position in light-space.
-    const vec4 lightSpace   = lightViews.transforms[viewIndex] * vec4 (position, 1.0);
-    const vec3 projection   = lightSpace.xyz / lightSpace.w;
-    const vec3 samplePoint  = vec3 (0.5 * projection.x + 0.5, 0.5 * projection.y + 0.5, viewIndex);
+    return index == 0 ? 1.0 - fraction : index == SHADOW_FILTER_SIZE ? fraction : 1.0;
+}
 
-    // Now we can determine the depth of the surface
-    const float bias    = 0.00001;
-    const float depth   = 0.5 * projection.z + 0.5 - bias;
-    
-    // Finally we can use percentage-closer filtering to create a shadow gradient. We use 16 sample points.
+
+/**
+    Produces exactly the same result as the percentage-closer filter but each gather compares four texels at once, so
+    a filter five texels wide needs nine fetches instead of twenty-five.
+*/
+float filterShadow (const in vec3 samplePoint, const in float depth)
+{
+    const float size    = 1.0 / scene.shadowMapRes;
+    const vec2  texel   = samplePoint.xy * scene.shadowMapRes - 0.5;
+    const vec2  first   = floor (texel) - float (SHADOW_FILTER_SIZE / 2);
+    const vec2  f       = texel - floor (texel);
+    const int   blocks  = SHADOW_FILTER_SIZE / 2;
+
+    float edgeFiltering = 0.0;
+    for (int y = 0; y <= blocks; y++)
+    {
+        const float lower = gatherWeight (2 * y, f.y);
+        const float upper = gatherWeight (2 * y + 1, f.y);
+
+        for (int x = 0; x <= blocks; x++)
+        {
+            const float left    = gatherWeight (2 * x, f.x);
+            const float right   = gatherWeight (2 * x + 1, f.x);
+
+            // A gather at the corner of four texels returns upper-left, upper-right, lower-right then lower-left.
+            const vec2 corner   = (first + vec2 (2 * x + 1, 2 * y + 1)) * size;
+            const vec4 weights  = vec4 (left * upper, right * upper, right * lower, left * lower);
+            const vec4 visible  = textureGather (shadowMaps, vec3 (corner, samplePoint.z), depth);
+            edgeFiltering       += dot (visible, weights);
+        }
+    }
+
+    return edgeFiltering / (SHADOW_FILTER_SIZE * SHADOW_FILTER_SIZE);
+}
+
+#elif defined SHADOW_FILTER_EVSM
+
+/**
+    Estimates how much of the filtered region is visible from the mean and mean square of a warped depth.
+    http://www.punkuser.net/vsm/vsm_paper.pdf
+*/
+float chebyshevUpperBound (const in vec2 moments, const in float mean, const in float minVariance)
+{
+    const float variance    = max (moments.y - moments.x * moments.x, minVariance);
+    const float difference  = mean - moments.x;
+    const float bound       = variance / (variance + difference * difference);
+    const float reduced     = clamp ((bound - evsmBleedReduction) / (1.0 - evsmBleedReduction), 0.0, 1.0);
+
+    return mean <= moments.x ? 1.0 : reduced;
+}
+
+
+/**
+    Samples moments which were blurred by the same box filter as the percentage-closer filter, so a single trilinear
+    fetch gives the same softness. Both a positive and negative exponential warp are tested to reduce light bleeding.
+*/
+float filterShadow (const in vec3 samplePoint, const in float depth)
+{
+    const float ndc         = 2.0 * depth - 1.0;
+    const vec2  warped      = vec2 (exp (evsmExponents.x * ndc), -exp (-evsmExponents.y * ndc));
+    const vec2  scale       = evsmVarianceBias * evsmExponents * warped;
+    const vec2  minVariance = scale * scale;
+    const vec4  moments     = texture (shadowMoments, samplePoint);
+
+    const float positive = chebyshevUpperBound (moments.xy, warped.x, minVariance.x);
+    const float negative = chebyshevUpperBound (moments.zw, warped.y, minVariance.y);
+    return min (positive, negative);
+}
+
+#else
+
+/**
+    Uses percentage-closer filtering to create a shadow gradient, each tap compares and blends four texels.
+*/
+float filterShadow (const in vec3 samplePoint, const in float depth)
+{
     const float offset  = 1.0 / scene.shadowMapRes;
-    const int   samples = 16;
-    const int   start   = -(samples / 4 - 2);
+    const int   samples = SHADOW_FILTER_SIZE * SHADOW_FILTER_SIZE;
+    const int   start   = -(SHADOW_FILTER_SIZE / 2);
     const int   end     = -start;
 
     float edgeFiltering = 0.0;
@@ -121,8 +219,30 @@ float spotlightShadow (const in vec3 position, const in int viewIndex)
         }
     }
 
+    return edgeFiltering / samples;
+}
+
+#endif
+
+
+/**
+    Calculates a shadowing factor to apply to the light at the current pixel.
+    http://ogldev.atspace.co.uk/www/tutorial42/tutorial42.html
+*/
+float spotlightShadow (const in vec3 position, const in int viewIndex)
+{
+    // Determine the position in light-space.
+    const vec4 lightSpace   = lightViews.transforms[viewIndex] * vec4 (position, 1.0);
+    const vec3 projection   = lightSpace.xyz / lightSpace.w;
+    const vec3 samplePoint  = vec3 (0.5 * projection.x + 0.5, 0.5 * projection.y + 0.5, viewIndex);
+
+    // Now we can determine the depth of the surface
+    const float bias    = 0.00001;
+    const float depth   = 0.5 * projection.z + 0.5 - bias;
+    
+    // Finally the filter creates a shadow gradient.
     const float shadowStrength = 0.2;
-    return shadowStrength + (edgeFiltering / (samples * 2));
+    return shadowStrength + (1.0 - shadowStrength) * filterShadow (samplePoint, depth);
 }
 
 
@@ -166,9 +286,11 @@ vec3 pointLightContribution (const in uint index, const in vec3 position, const
 
 
 /**
-    Calculates the lighting contribution of a spotlight at the given index.
+    Calculates the lighting contribution of a spotlight at the given index. Whether it casts a shadow is given so callers
+    which know at compile time can have the shadow sampling removed entirely.
 */
-vec3 spotlightContribution (const in uint index, const in vec3 position, const in vec3 normal, const in vec3 view)
+vec3 spotlightContribution (const in uint index, const in vec3 position, const in vec3 normal, const in vec3 view,
+    const in bool castsShadow)
 {
     // Spotlights require a special luminance attenuation and cone attenuation.
     const Spotlight light = spotlights.lights[index];
@@ -191,7 +313,7 @@ vec3 spotlightContribution (const in uint index, const in vec3 position, const i
     const float coneCutOff  = lightAngle <= halfAngle ? smoothstep (1.0, 0.75, lightAngle / halfAngle) : 0.0;
 
     // We need some shadow attenuation.
-    const float shadowing = light.viewIndex > -1 ? spotlightShadow (position, light.viewIndex) : 1.0;
+    const float shadowing = castsShadow ? spotlightShadow (position, light.viewIndex) : 1.0;
 
     // Scale the intensity accordingly.
     const vec3 E = light.intensity * luminance * coneCutOff * shadowing;
@@ -200,6 +322,15 @@ vec3 spotlightContribution (const in uint index, const in vec3 position, const i
 }
 
 
+/**
+    Calculates the lighting contribution of a spotlight at the given index, checking whether it casts a shadow.
+*/
+vec3 spotlightContribution (const in uint index, const in vec3 position, const in vec3 normal, const in vec3 view)
+{
+    return spotlightContribution (index, position, normal, view, spotlights.lights[index].viewIndex > -1);
+}
+
+
 /**
     Calculates the lighting contribution of every directional light in the scene.
 */
@@ -207,7 +338,7 @@ vec3 directionalLightContributions (const in vec3 normal, const in vec3 view)
 {
     vec3 lighting = vec3 (0.0);
 
-    for (uint i = 0; i < directionalLights.count; ++i)
+    for (uint i = 0; i < directionalLightCount; ++i)
     {
         lighting += directionalLightContribution (i, normal, view);
     }
@@ -223,7 +354,7 @@ vec3 pointLightContributions (const in vec3 position, const in vec3 normal, cons
 {
     vec3 lighting = vec3 (0.0);
 
-    for (uint i = 0; i < pointLights.count; ++i)
+    for (uint i = 0; i < pointLightCount; ++i)
     {
         lighting += pointLightContribution (i, position, normal, view);
     }
@@ -239,10 +370,26 @@ vec3 spotlightContributions (const in vec3 position, const in vec3 normal, const
 {
     vec3 lighting = vec3 (0.0);
 
-    for (uint i = 0; i < spotlights.count; ++i)
-    {
-        lighting += spotlightContribution (i, position, normal, view);
-    }
+    #ifdef SHADOWED_SPOTLIGHT_COUNT
+
+        for (uint i = 0; i < SHADOWED_SPOTLIGHT_COUNT; ++i)
+        {
+            lighting += spotlightContribution (i, position, normal, view, true);
+        }
+
+        for (uint i = SHADOWED_SPOTLIGHT_COUNT; i < spotlightCount; ++i)
+        {
+            lighting += spotlightContribution (i, position, normal, view, false);
+        }
+
+    #else
+
+        for (uint i = 0; i < spotlightCount; ++i)
+        {
+            lighting += spotlightContribution (i, position, normal, view);
+        }
+
+    #endif
 
     return lighting;
 }
\ No newline at end of file
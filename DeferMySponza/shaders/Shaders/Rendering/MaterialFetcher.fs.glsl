@@ -12,24 +12,64 @@ struct Material
     vec3    normalMap;      //!< The normal map of the material.
 };
 
-uniform usamplerBuffer  materials;      //!< Contains every material in the scene.
-uniform sampler2DArray  textures[16];   //!< An array of samplers containing different texture formats.
+/// Locates a map inside a texture array, this must match Material::Map.
+struct MaterialMap
+{
+    uint    array;  //!< The index of the texture array containing the map.
+    uint    layer;  //!< The layer of the array containing the map.
+    uvec2   rect;   //!< The packed UV scale and offset of the map inside its layer.
+};
+
+/// The maps of a material, this must match the Material struct.
+struct MaterialRecord
+{
+    MaterialMap properties; //!< The physical properties of the material.
+    MaterialMap albedo;     //!< The albedo of the material.
+    MaterialMap normal;     //!< The normal map of the material.
+};
+
+layout (std430, binding = 1) restrict readonly buffer Materials
+{
+    MaterialRecord records[];   //!< Contains every material in the scene.
+} materials;
+
+#ifdef BINDLESS_TEXTURES
+layout (std430, binding = 2) restrict readonly buffer TextureHandles
+{
+    uvec2 handles[];    //!< A resident bindless handle for each texture array, indexed like the samplers would be.
+} textureHandles;
+#else
+uniform sampler2DArray  textures[23];   //!< An array of samplers containing different texture formats, including BC7 arrays.
+#endif
+
+
+/// Samples a map which may only cover part of its layer. The rectangle contains a packed UV scale and offset.
+vec4 sampleMap (const in MaterialMap map, const in vec2 uvCoordinates)
+{
+    const vec2 scale    = unpackUnorm2x16 (map.rect.x);
+    const vec2 offset   = unpackUnorm2x16 (map.rect.y);
+
+    // Gradients are taken before wrapping so the seam between repeats doesn't select the smallest mipmap.
+    const vec3 location = vec3 (fract (uvCoordinates) * scale + offset, map.layer);
+    const vec2 dx       = dFdx (uvCoordinates) * scale;
+    const vec2 dy       = dFdy (uvCoordinates) * scale;
+
+#ifdef BINDLESS_TEXTURES
+    return textureGrad (sampler2DArray (textureHandles.handles[map.array]), location, dx, dy);
+#else
+    return textureGrad (textures[map.array], location, dx, dy);
+#endif
+}
 
 
 Material fetchMaterialProperties (const in vec2 uvCoordinates, const in int materialID)
 {
-    // Materials can contain up to three maps, requiring two texel fetches.
-    const int texelCount    = 2;
-    const int materialIndex = materialID * texelCount;
-
-    // Now we can fetch each component.
-    const uvec4 propertiesAndAlbedo = texelFetch (materials, materialIndex);
-    const uvec2 normal              = texelFetch (materials, materialIndex + 1).xy;
-
-    // Components are array-depth pairs, this allows us to retrieve the correct map.
-    const vec3 properties   = texture (textures[propertiesAndAlbedo.x], vec3 (uvCoordinates, propertiesAndAlbedo.y)).xyz;
-    const vec4 albedo       = texture (textures[propertiesAndAlbedo.z], vec3 (uvCoordinates, propertiesAndAlbedo.w));
-    const vec3 normalMap    = texture (textures[normal.x], vec3 (uvCoordinates, normal.y)).rgb;
+    // Each record locates up to three maps.
+    const MaterialRecord record = materials.records[materialID];
+
+    const vec3 properties   = sampleMap (record.properties, uvCoordinates).xyz;
+    const vec4 albedo       = sampleMap (record.albedo, uvCoordinates);
+    const vec3 normalMap    = sampleMap (record.normal, uvCoordinates).rgb;
 
     // Reflectance controls the fresnel effect of a material. Here we restrict the F0 co-efficient based conductivity.
     const float dielecticReflectance = 0.2;
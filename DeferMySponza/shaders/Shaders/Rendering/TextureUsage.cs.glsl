@@ -0,0 +1,140 @@
+#version 450
+
+layout (local_size_x = 16, local_size_y = 16) in;
+
+const uint  arrayCount      = 23;   //!< Must match TextureStreamer::arrayCount and the texture arrays in MaterialFetcher.fs.
+const int   sampleSpacing   = 4;    //!< Must match TextureStreamer::sampleSpacing, one pixel in each 4x4 block is sampled.
+
+uniform sampler2DRect   gbufferMaterials;   //!< Contains the texture co-ordinate and material ID of objects at every pixel.
+uniform sampler2D       gbufferDepth;       //!< The depth of the gbuffer, the far plane means nothing was drawn.
+
+/// Locates a map inside a texture array, this must match Material::Map.
+struct MaterialMap
+{
+    uint    array;  //!< The index of the texture array containing the map.
+    uint    layer;  //!< The layer of the array containing the map.
+    uvec2   rect;   //!< The packed UV scale and offset of the map inside its layer.
+};
+
+/// The maps of a material, this must match the Material struct.
+struct MaterialRecord
+{
+    MaterialMap properties; //!< The physical properties of the material.
+    MaterialMap albedo;     //!< The albedo of the material.
+    MaterialMap normal;     //!< The normal map of the material.
+};
+
+layout (std430, binding = 1) restrict readonly buffer Materials
+{
+    MaterialRecord records[];   //!< Contains every material in the scene.
+} materials;
+
+layout (std430, binding = 0) restrict buffer Usage
+{
+    uint footprints[arrayCount];    //!< The smallest UV distance between neighbouring pixels of each array as float bits.
+    uint pixels[arrayCount];        //!< How many sampled pixels used each array.
+} usage;
+
+shared uint localFootprints[arrayCount];    //!< The footprints of the work group.
+shared uint localPixels[arrayCount];        //!< The pixel counts of the work group.
+
+
+/// Checks whether the given pixel contains geometry with the given material, returning its texture co-ordinates.
+bool neighbour (const in ivec2 pixel, const in float materialID, out vec2 uvCoordinates)
+{
+    const ivec2 size = textureSize (gbufferDepth, 0);
+
+    if (any (lessThan (pixel, ivec2 (0))) || any (greaterThanEqual (pixel, size)) || 
+        texelFetch (gbufferDepth, pixel, 0).r >= 1.0)
+    {
+        return false;
+    }
+
+    const vec3 material = texelFetch (gbufferMaterials, pixel).rgb;
+    uvCoordinates       = material.xy;
+    return material.z == materialID;
+}
+
+
+/// Finds the change in texture co-ordinates along one axis, preferring the next pixel and falling back to the previous.
+vec2 derivative (const in ivec2 pixel, const in ivec2 step, const in vec3 material)
+{
+    vec2 uvCoordinates;
+
+    if (neighbour (pixel + step, material.z, uvCoordinates))
+    {
+        return uvCoordinates - material.xy;
+    }
+
+    if (neighbour (pixel - step, material.z, uvCoordinates))
+    {
+        return material.xy - uvCoordinates;
+    }
+
+    return vec2 (0.0);
+}
+
+
+/// Records the footprint of a map in its array, the rectangle scales the footprint into the layer.
+void recordMap (const in MaterialMap map, const in vec2 dx, const in vec2 dy)
+{
+    if (map.array >= arrayCount)
+    {
+        return;
+    }
+
+    const vec2  scale       = unpackUnorm2x16 (map.rect.x);
+    const float footprint   = max (length (dx * scale), length (dy * scale));
+
+    // Footprints are positive so their bits can be compared as unsigned integers.
+    if (footprint > 0.0)
+    {
+        atomicMin (localFootprints[map.array], floatBitsToUint (footprint));
+    }
+
+    atomicAdd (localPixels[map.array], 1U);
+}
+
+
+/**
+    Measures which texture arrays are visible and how fine a mipmap level they need. The texture co-ordinates of
+    neighbouring pixels give the same derivatives the lighting pass would use, so the smallest footprint decides the
+    finest level which can be sampled. Only one pixel in each block is sampled to keep the pass cheap.
+*/
+void main()
+{
+    const uint index = gl_LocalInvocationIndex;
+
+    if (index < arrayCount)
+    {
+        localFootprints[index]  = 0xFFFFFFFFU;
+        localPixels[index]      = 0U;
+    }
+
+    barrier();
+
+    const ivec2 pixel       = ivec2 (gl_GlobalInvocationID.xy) * sampleSpacing;
+    const vec3  material    = texelFetch (gbufferMaterials, pixel).rgb;
+    vec2 uvCoordinates;
+
+    if (neighbour (pixel, material.z, uvCoordinates))
+    {
+        const vec2  dx          = derivative (pixel, ivec2 (1, 0), material);
+        const vec2  dy          = derivative (pixel, ivec2 (0, 1), material);
+
+        // Each map of the material is recorded separately as they may be stored in different arrays.
+        const MaterialRecord record = materials.records[int (material.z)];
+
+        recordMap (record.properties, dx, dy);
+        recordMap (record.albedo, dx, dy);
+        recordMap (record.normal, dx, dy);
+    }
+
+    barrier();
+
+    if (index < arrayCount)
+    {
+        atomicMin (usage.footprints[index], localFootprints[index]);
+        atomicAdd (usage.pixels[index], localPixels[index]);
+    }
+}
\ No newline at end of file
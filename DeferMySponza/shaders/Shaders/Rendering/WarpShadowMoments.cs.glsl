@@ -0,0 +1,47 @@
+#version 450
+
+layout (local_size_x = 16, local_size_y = 16) in;
+
+const vec2 exponents = vec2 (40.0, 5.0); //!< Must match evsmExponents in Lights.fs, larger values overflow.
+
+layout (location = 0) uniform int radius;   //!< How many texels either side of the centre the box filter covers.
+layout (location = 1) uniform int layer;    //!< The shadow map to warp.
+
+uniform sampler2DArray shadowMaps; //!< Contains shadow maps for every spotlight, depth comparisons must be disabled.
+
+layout (binding = 0, rgba32f) uniform restrict writeonly image2D horizontal; //!< Receives the blurred moments.
+
+
+/// Warps a depth value exponentially, storing the positive and negative warps followed by their squares.
+vec4 warpDepth (const in float depth)
+{
+    const float ndc         = 2.0 * depth - 1.0;
+    const float positive    = exp (exponents.x * ndc);
+    const float negative    = -exp (-exponents.y * ndc);
+    return vec4 (positive, positive * positive, negative, negative * negative);
+}
+
+
+/**
+    Converts a layer of the shadow maps into exponential variance shadow map moments and blurs them horizontally. The
+    moments of each texel are averaged rather than the depth so filtering them remains correct.
+*/
+void main()
+{
+    const ivec2 texel   = ivec2 (gl_GlobalInvocationID.xy);
+    const ivec2 size    = imageSize (horizontal);
+
+    if (any (greaterThanEqual (texel, size)))
+    {
+        return;
+    }
+
+    vec4 moments = vec4 (0.0);
+    for (int x = -radius; x <= radius; ++x)
+    {
+        const int column    = clamp (texel.x + x, 0, size.x - 1);
+        moments             += warpDepth (texelFetch (shadowMaps, ivec3 (column, texel.y, layer), 0).r);
+    }
+
+    imageStore (horizontal, texel, moments / (2 * radius + 1));
+}
@@ -1,5 +1,7 @@
 layout (location = 0) in vec2 position; //!< The position of the current vertex.
 
+layout (location = 8) uniform vec2 textureScale;    //!< How much of the input textures was rendered to.
+
 out vec2 textureCoordinate;
 out vec2 pixelCoordinate;
 out vec4 offsets[3];
@@ -9,7 +11,7 @@ out vec4 offsets[3];
 */
 void main()
 {
-    textureCoordinate = position * 0.5 + 0.5;
+    textureCoordinate = (position * 0.5 + 0.5) * textureScale;
     SMAABlendingWeightCalculationVS (textureCoordinate, pixelCoordinate, offsets);
     gl_Position = vec4 (position, 1.0, 1.0);
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 layout (location = 0) uniform sampler2D aliasedInput;           //!< The texture containing an aliased image.
 layout (location = 1) uniform sampler2D blendWeightingResult;   //!< The results of the previous pass.
+layout (location = 9) uniform vec2      textureLimit;           //!< Half a texel inside the far edges of the region.
 
 in vec2 textureCoordinate;
 in vec4 offset;
@@ -12,5 +13,6 @@ out vec4 aliasedFragment;
 void main()
 {
     // Perform 1x SMAA by passing 0 as the subsample indices parameter.
-    aliasedFragment = SMAANeighborhoodBlendingPS (textureCoordinate, offset, aliasedInput, blendWeightingResult);
+    aliasedFragment = SMAANeighborhoodBlendingPS (min (textureCoordinate, textureLimit), offset, aliasedInput, 
+        blendWeightingResult);
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 layout (location = 0) in vec2 position; //!< The position of the current vertex.
 
+layout (location = 8) uniform vec2 textureScale;    //!< How much of the input textures was rendered to.
+
 out vec2 textureCoordinate;
 out vec4 offset;
 
@@ -8,7 +10,7 @@ out vec4 offset;
 */
 void main()
 {
-    textureCoordinate = position * 0.5 + 0.5;
+    textureCoordinate = (position * 0.5 + 0.5) * textureScale;
     SMAANeighborhoodBlendingVS (textureCoordinate, offset);
     gl_Position = vec4 (position, 1.0, 1.0);
 }
\ No newline at end of file
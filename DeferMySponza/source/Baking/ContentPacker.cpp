@@ -0,0 +1,159 @@
+#include "ContentPacker.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+
+// Engine headers.
+#include <tygra/ContentPack.hpp>
+
+
+// Platform headers.
+#if defined _WIN32
+    #if !defined NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <Windows.h>
+#else
+    #include <dirent.h>
+    #include <sys/stat.h>
+#endif
+
+
+bool ContentPacker::parseArguments (int argc, char* argv[], Settings& settings) noexcept
+{
+    for (int i { 1 }; i < argc; ++i)
+    {
+        const auto argument = argv[i];
+        const auto value    = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (std::strcmp (argument, "--pack") == 0)
+        {
+            continue;
+        }
+
+        // Every other argument requires a value.
+        if (value == nullptr)
+        {
+            std::cerr << "ContentPacker: missing value for '" << argument << "'." << std::endl;
+            return false;
+        }
+
+        if (std::strcmp (argument, "--content") == 0)       settings.contentDirectory = value;
+        else if (std::strcmp (argument, "--output") == 0)   settings.output = value;
+        else
+        {
+            std::cerr << "ContentPacker: unknown argument '" << argument << "'." << std::endl;
+            return false;
+        }
+
+        ++i;
+    }
+
+    return true;
+}
+
+
+bool ContentPacker::initialise (const Settings& settings) noexcept
+{
+    m_settings = settings;
+    m_files.clear();
+
+    if (!collect (""))
+    {
+        std::cerr << "ContentPacker: unable to read '" << m_settings.contentDirectory << "'." << std::endl;
+        return false;
+    }
+
+    std::sort (std::begin (m_files), std::end (m_files));
+    return true;
+}
+
+
+bool ContentPacker::run() noexcept
+{
+    if (!tygra::ContentPack::build (m_settings.output, m_settings.contentDirectory, m_files))
+    {
+        std::cerr << "ContentPacker: unable to write '" << m_settings.output << "'." << std::endl;
+        return false;
+    }
+
+    std::cout << "ContentPacker: packed " << m_files.size() << " files into '" << m_settings.output << "'." << std::endl;
+    return true;
+}
+
+
+bool ContentPacker::collect (const std::string& directory) noexcept
+{
+    // The scene file is opened by path inside the tcf library so packing it would only waste space.
+    const auto add = [&] (const std::string& name, const bool isDirectory)
+    {
+        if (name == "." || name == "..")
+        {
+            return true;
+        }
+
+        const auto file = directory.empty() ? name : directory + "/" + name;
+
+        if (isDirectory)
+        {
+            return collect (file);
+        }
+
+        if (name.size() < 4 || name.compare (name.size() - 4, 4, ".tcf") != 0)
+        {
+            m_files.push_back (file);
+        }
+
+        return true;
+    };
+
+    const auto path = directory.empty() ? m_settings.contentDirectory : m_settings.contentDirectory + "/" + directory;
+
+    #if defined _WIN32
+
+        auto data       = WIN32_FIND_DATAA { };
+        const auto find = FindFirstFileA ((path + "/*").c_str(), &data);
+
+        if (find == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        auto success = true;
+
+        do
+        {
+            success = add (data.cFileName, (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0);
+        }
+        while (success && FindNextFileA (find, &data));
+
+        FindClose (find);
+        return success;
+
+    #else
+
+        const auto handle = opendir (path.c_str());
+
+        if (!handle)
+        {
+            return false;
+        }
+
+        auto success = true;
+
+        for (auto entry = readdir (handle); success && entry; entry = readdir (handle))
+        {
+            struct stat status;
+            const auto name = std::string { entry->d_name };
+            success = stat ((path + "/" + name).c_str(), &status) == 0 && add (name, S_ISDIR (status.st_mode));
+        }
+
+        closedir (handle);
+        return success;
+
+    #endif
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#if !defined    _BAKING_CONTENT_PACKER_
+#define         _BAKING_CONTENT_PACKER_
+
+// STL headers.
+#include <string>
+#include <vector>
+
+
+/// <summary>
+/// Builds a tygra::ContentPack offline from every file in the content directory. The renderer mounts the pack at
+/// startup so shaders, images and baked textures are resolved with a single open and read sequentially from one
+/// mapping, which avoids a round trip per file on network-mounted storage.
+/// </summary>
+class ContentPacker final
+{
+    public:
+
+        constexpr static auto defaultPack = "content.pak";  //!< Where the pack is written and where the renderer looks for it.
+
+        /// <summary> Controls which directory is packed and where the pack is written. </summary>
+        struct Settings final
+        {
+            std::string contentDirectory    { "content" };      //!< The file system location which "content:///" refers to.
+            std::string output              { defaultPack };    //!< Where the pack is written.
+        };
+
+        ContentPacker() noexcept                                = default;
+        ContentPacker (ContentPacker&&) noexcept                = default;
+        ContentPacker& operator= (ContentPacker&&) noexcept     = default;
+        ~ContentPacker()                                        = default;
+
+        ContentPacker (const ContentPacker&)                    = delete;
+        ContentPacker& operator= (const ContentPacker&)         = delete;
+
+
+        /// <summary> Parses command line arguments into packer settings. Supported arguments are --content DIR and --output FILE. </summary>
+        /// <param name="argc"> The number of arguments. </param>
+        /// <param name="argv"> The arguments, including the executable name and --pack flag. </param>
+        /// <param name="settings"> Where the parsed values will be written. </param>
+        /// <returns> Whether every argument was understood. </returns>
+        static bool parseArguments (int argc, char* argv[], Settings& settings) noexcept;
+
+
+        /// <summary> Collects every file in the content directory. </summary>
+        /// <param name="settings"> The settings to pack with. </param>
+        /// <returns> Whether the directory could be read. </returns>
+        bool initialise (const Settings& settings) noexcept;
+
+        /// <summary> Writes every collected file into the pack. </summary>
+        /// <returns> Whether the pack was written successfully. </returns>
+        bool run() noexcept;
+
+    private:
+
+        using Files = std::vector<std::string>;
+
+        Settings    m_settings  { };    //!< Controls where the pack is written.
+        Files       m_files     { };    //!< Every file to pack relative to the content directory, sorted for stable output.
+
+    private:
+
+        /// <summary> Adds every file below the given directory, which is relative to the content directory. </summary>
+        bool collect (const std::string& directory) noexcept;
+};
+
+#endif // _BAKING_CONTENT_PACKER_
\ No newline at end of file
@@ -0,0 +1,286 @@
+#include "TextureBaker.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+
+
+// Engine headers.
+#include <scene/scene.hpp>
+#include <tygra/FileHelper.hpp>
+#include <tygra/Image.hpp>
+
+
+// Personal headers.
+#include <Rendering/Objects/Texture.hpp>
+#include <Rendering/State/StateCache.hpp>
+#include <Utility/OpenGL/Textures.hpp>
+#include <Utility/Scene.hpp>
+
+
+bool TextureBaker::parseArguments (int argc, char* argv[], Settings& settings) noexcept
+{
+    for (int i { 1 }; i < argc; ++i)
+    {
+        const auto argument = argv[i];
+        const auto value    = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (std::strcmp (argument, "--bake") == 0)
+        {
+            continue;
+        }
+
+        // Every other argument requires a value.
+        if (value == nullptr)
+        {
+            std::cerr << "TextureBaker: missing value for '" << argument << "'." << std::endl;
+            printUsage();
+            return false;
+        }
+
+        auto valid = true;
+
+        if (std::strcmp (argument, "--content") == 0)           settings.contentDirectory = value;
+        else if (std::strcmp (argument, "--overwrite") == 0)
+        {
+            auto enabled        = 0U;
+            valid               = std::sscanf (value, "%u", &enabled) == 1 && enabled <= 1;
+            settings.overwrite  = enabled == 1;
+        }
+        else
+        {
+            std::cerr << "TextureBaker: unknown argument '" << argument << "'." << std::endl;
+            printUsage();
+            return false;
+        }
+
+        if (!valid)
+        {
+            std::cerr << "TextureBaker: invalid value '" << value << "' for '" << argument << "'." << std::endl;
+            printUsage();
+            return false;
+        }
+
+        ++i;
+    }
+
+    return true;
+}
+
+
+bool TextureBaker::initialise (const Settings& settings) noexcept
+{
+    // The context must exist before any GL objects are created, the default framebuffer is never drawn to.
+    m_context.clean();
+    m_files.clear();
+    m_normals.clear();
+
+    if (!m_context.initialise (1, 1))
+    {
+        std::cerr << "TextureBaker: unable to create an offscreen OpenGL 4.5 context." << std::endl;
+        return false;
+    }
+
+    // The scene throws if the data file can't be read.
+    auto scene = std::unique_ptr<scene::Context> { };
+
+    try
+    {
+        scene = std::make_unique<scene::Context>();
+    }
+
+    catch (...)
+    {
+        std::cerr << "TextureBaker: unable to load the scene." << std::endl;
+        m_context.clean();
+        return false;
+    }
+
+    // Only the texture maps which the renderer would load are baked.
+    const auto addIfNotEmpty = [&] (const auto& file) { if (!file.empty()) m_files.emplace (file); };
+
+    for (const auto& material : util::getAllMaterials (*scene))
+    {
+        addIfNotEmpty (material.physicsMap);
+        addIfNotEmpty (material.albedoMap);
+        addIfNotEmpty (material.normalMap);
+
+        if (!material.normalMap.empty())
+        {
+            m_normals.emplace (material.normalMap);
+        }
+    }
+
+    // Compression quality depends entirely on the driver so make it clear which one produced the output.
+    std::cout << "TextureBaker: compressing to BC7 with the encoder of '" << glGetString (GL_RENDERER) << "'." 
+        << std::endl;
+
+    m_settings = settings;
+    return true;
+}
+
+
+bool TextureBaker::run() noexcept
+{
+    if (!m_context.isInitialised())
+    {
+        return false;
+    }
+
+    auto baked = size_t { 0 };
+
+    for (const auto& file : m_files)
+    {
+        if (bake (file))
+        {
+            ++baked;
+        }
+    }
+
+    std::cout << "TextureBaker: baked " << baked << " of " << m_files.size() << " textures." << std::endl;
+    return baked == m_files.size();
+}
+
+
+void TextureBaker::printUsage() noexcept
+{
+    std::cerr << "Usage: --bake [--content DIR] [--overwrite 0|1]" << std::endl
+        << "  --content DIR    The directory which content:/// refers to, defaults to 'content'." << std::endl
+        << "  --overwrite 0|1  Whether existing baked textures are replaced, defaults to 1." << std::endl
+        << "BC7 blocks are produced by the OpenGL driver's encoder. Its quality varies between drivers and some don't"
+        << std::endl << "compress BPTC at all, in which case baking fails. Bake on a driver known to encode BC7 well."
+        << std::endl;
+}
+
+
+bool TextureBaker::bake (const std::string& file) const noexcept
+{
+    const auto output = toPath (BakedTexture::locationOf (file));
+
+    if (!m_settings.overwrite && std::ifstream { output, std::ios::binary }.good())
+    {
+        std::cout << "TextureBaker: skipping '" << file << "', '" << output << "' already exists." << std::endl;
+        return true;
+    }
+
+    const auto image = tygra::createImageFromPngFile (file);
+
+    if (!image.doesContainData())
+    {
+        std::cerr << "TextureBaker: unable to decode '" << file << "'." << std::endl;
+        return false;
+    }
+
+    // The loader only accepts square power-of-two textures and BC7 requires at least one whole block.
+    const auto width    = static_cast<GLsizei> (image.width());
+    const auto height   = static_cast<GLsizei> (image.height());
+
+    if (width != height || width < 4 || (width & (width - 1)) != 0)
+    {
+        std::cerr << "TextureBaker: '" << file << "' must be square, a power of two and at least 4x4." << std::endl;
+        return false;
+    }
+
+    auto texture = Texture2D { };
+
+    if (!texture.initialise (0))
+    {
+        return false;
+    }
+
+    // Mutable storage is used so the driver compresses the uncompressed data given to each level.
+    StateCache::bindTextureUnit (0, texture.getID());
+
+    auto levels         = BakedTexture::Levels { };
+    auto texels         = util::toTexels8 (image.pixelData(), image.width() * image.height(), 
+                            image.componentsPerPixel(), image.bytesPerComponent(), 4);
+    auto levelWidth     = width;
+    auto levelHeight    = height;
+    const auto isNormal = m_normals.find (file) != std::end (m_normals);
+
+    for (GLint level { 0 }; levelWidth >= 1 && levelHeight >= 1; ++level)
+    {
+        auto blocks = compress (texture.getID(), level, texels, levelWidth, levelHeight);
+
+        if (blocks.empty())
+        {
+            std::cerr << "TextureBaker: the driver didn't compress level " << level << " of '" << file 
+                << "' to BC7, it may not provide a BPTC encoder." << std::endl;
+            return false;
+        }
+
+        levels.emplace_back (std::move (blocks));
+
+        if (levelWidth == 1 && levelHeight == 1)
+        {
+            break;
+        }
+
+        texels      = util::downsample (texels, levelWidth, levelHeight, 4);
+        levelWidth  = std::max (levelWidth / 2, 1);
+        levelHeight = std::max (levelHeight / 2, 1);
+
+        // Averaging normals shortens them which would dull the lighting of distant surfaces.
+        if (isNormal)
+        {
+            util::renormalise (texels, 4);
+        }
+    }
+
+    StateCache::bindTextureUnit (0, 0);
+
+    auto baked = BakedTexture { };
+
+    if (!baked.assign (format, width, height, image.componentsPerPixel(), levels) || !baked.save (output))
+    {
+        std::cerr << "TextureBaker: unable to write '" << output << "'." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+std::string TextureBaker::toPath (const std::string& uri) const noexcept
+{
+    constexpr auto scheme       = "content:///";
+    const auto schemeLength     = std::strlen (scheme);
+
+    if (uri.compare (0, schemeLength, scheme) != 0)
+    {
+        return uri;
+    }
+
+    return m_settings.contentDirectory + "/" + uri.substr (schemeLength);
+}
+
+
+BakedTexture::Bytes TextureBaker::compress (const GLuint texture, const GLint level, const Texels& texels,
+    const GLsizei width, const GLsizei height) noexcept
+{
+    glPixelStorei (GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D (GL_TEXTURE_2D, level, format, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, texels.data());
+
+    // Drivers are allowed to silently fall back to an uncompressed format.
+    auto compressed     = GLint { GL_FALSE };
+    auto internalFormat = GLint { 0 };
+    auto size           = GLint { 0 };
+    glGetTextureLevelParameteriv (texture, level, GL_TEXTURE_COMPRESSED, &compressed);
+    glGetTextureLevelParameteriv (texture, level, GL_TEXTURE_INTERNAL_FORMAT, &internalFormat);
+    glGetTextureLevelParameteriv (texture, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size);
+
+    if (compressed != GL_TRUE || static_cast<GLenum> (internalFormat) != format ||
+        size != BakedTexture::compressedSize (format, width, height))
+    {
+        return { };
+    }
+
+    auto blocks = BakedTexture::Bytes (static_cast<size_t> (size));
+    glGetCompressedTextureImage (texture, level, size, blocks.data());
+    return blocks;
+}
\ No newline at end of file
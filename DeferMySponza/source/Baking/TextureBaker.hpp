@@ -0,0 +1,97 @@
+#pragma once
+
+#if !defined    _BAKING_TEXTURE_BAKER_
+#define         _BAKING_TEXTURE_BAKER_
+
+// STL headers.
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+
+// Personal headers.
+#include <Benchmark/HeadlessContext.hpp>
+#include <Utility/BakedTexture.hpp>
+
+
+/// <summary>
+/// Converts every texture map used by the scene into a BakedTexture offline so the renderer can upload compressed
+/// blocks directly at startup. A full mipmap chain is generated on the CPU with a box filter, normal maps have each
+/// filtered texel renormalised, and each level is then compressed to BC7 by the driver of a headless context and read
+/// back. BC7 keeps 4 components at 8 bits per texel so RGB and RGBA maps share a single format. The driver's encoder
+/// is usually tuned for speed rather than quality and some drivers don't provide one at all, so the output varies with
+/// the machine which baked it and should be baked on a desktop driver known to compress BPTC well.
+/// </summary>
+class TextureBaker final
+{
+    public:
+
+        constexpr static auto format = GLenum { GL_COMPRESSED_RGBA_BPTC_UNORM };   //!< The format every texture is baked to.
+
+        /// <summary> Controls where baked textures are written. </summary>
+        struct Settings final
+        {
+            std::string contentDirectory    { "content" };  //!< The file system location which "content:///" refers to.
+            bool        overwrite           { true };       //!< Whether existing baked textures are replaced.
+        };
+
+        TextureBaker() noexcept                                 = default;
+        TextureBaker (TextureBaker&&) noexcept                  = default;
+        TextureBaker& operator= (TextureBaker&&) noexcept       = default;
+        ~TextureBaker() { m_context.clean(); }
+
+        TextureBaker (const TextureBaker&)                      = delete;
+        TextureBaker& operator= (const TextureBaker&)           = delete;
+
+
+        /// <summary>
+        /// Parses command line arguments into baker settings. Supported arguments are --content DIR and
+        /// --overwrite 0|1. Usage is printed when an argument isn't understood.
+        /// </summary>
+        /// <param name="argc"> The number of arguments. </param>
+        /// <param name="argv"> The arguments, including the executable name and --bake flag. </param>
+        /// <param name="settings"> Where the parsed values will be written. </param>
+        /// <returns> Whether every argument was understood. </returns>
+        static bool parseArguments (int argc, char* argv[], Settings& settings) noexcept;
+
+
+        /// <summary> Creates the offscreen context and collects the texture maps of every material in the scene. </summary>
+        /// <param name="settings"> The settings to bake with. </param>
+        /// <returns> Whether initialisation was successful. </returns>
+        bool initialise (const Settings& settings) noexcept;
+
+        /// <summary> Bakes every collected texture map, reporting each failure. </summary>
+        /// <returns> Whether every texture was baked successfully. </returns>
+        bool run() noexcept;
+
+    private:
+
+        using Files     = std::set<std::string>;
+        using Texels    = std::vector<std::uint8_t>;
+
+        Settings        m_settings  { };    //!< Controls where baked textures are written.
+        HeadlessContext m_context   { };    //!< The offscreen context used to compress each level.
+        Files           m_files     { };    //!< Every texture map referenced by the scene, sorted for stable output.
+        Files           m_normals   { };    //!< The texture maps which are used as normal maps.
+
+    private:
+
+        /// <summary> Prints the supported arguments and the limitations of the driver's BC7 encoder. </summary>
+        static void printUsage() noexcept;
+
+        /// <summary> Decodes, compresses and writes a single texture map. </summary>
+        bool bake (const std::string& file) const noexcept;
+
+        /// <summary> Converts the given location from a "content:///" URI to a file system location. </summary>
+        std::string toPath (const std::string& uri) const noexcept;
+
+        /// <summary>
+        /// Compresses a single RGBA8 level using the driver and reads the compressed blocks back. The texture must be
+        /// bound to GL_TEXTURE_2D of the active texture unit. An empty result is returned if the driver didn't compress.
+        /// </summary>
+        static BakedTexture::Bytes compress (const GLuint texture, const GLint level, const Texels& texels,
+            const GLsizei width, const GLsizei height) noexcept;
+};
+
+#endif // _BAKING_TEXTURE_BAKER_
\ No newline at end of file
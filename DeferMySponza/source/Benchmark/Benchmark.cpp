@@ -0,0 +1,660 @@
+#include "Benchmark.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+
+// Engine headers.
+#include <scene/scene.hpp>
+
+
+// Personal headers.
+#include <Utility/Profiler.hpp>
+
+
+bool Benchmark::parseArguments (int argc, char* argv[], Settings& settings) noexcept
+{
+    // Resolutions, AA, lighting and shadow modes given on the command line replace the defaults rather than adding
+    // to them.
+    auto resolutions    = Settings::Resolutions { };
+    auto aaModes        = Settings::AntiAliasingModes { };
+    auto lightingModes  = Settings::LightingModes { };
+    auto shadowFilters  = Settings::ShadowFilters { };
+
+    const auto parseResolution = [] (const char* text, glm::ivec2& resolution)
+    {
+        return std::sscanf (text, "%dx%d", &resolution.x, &resolution.y) == 2 && resolution.x > 0 && resolution.y > 0;
+    };
+
+    const auto parseQuality = [] (const char* text, SMAA::Quality& quality)
+    {
+        for (const auto option : { SMAA::Quality::None, SMAA::Quality::Low, SMAA::Quality::Medium,
+            SMAA::Quality::High, SMAA::Quality::Ultra })
+        {
+            if (std::strcmp (text, toString (option)) == 0)
+            {
+                quality = option;
+                return true;
+            }
+        }
+
+        return false;
+    };
+
+    const auto parseFilter = [] (const char* text, ShadowMaps::Filter& filter)
+    {
+        for (const auto option : { ShadowMaps::Filter::PCF, ShadowMaps::Filter::Gather, ShadowMaps::Filter::EVSM })
+        {
+            if (std::strcmp (text, toString (option)) == 0)
+            {
+                filter = option;
+                return true;
+            }
+        }
+
+        return false;
+    };
+
+    for (int i { 1 }; i < argc; ++i)
+    {
+        const auto argument = argv[i];
+        const auto value    = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (std::strcmp (argument, "--benchmark") == 0)
+        {
+            continue;
+        }
+
+        // Every other argument requires a value.
+        if (value == nullptr)
+        {
+            std::cerr << "Benchmark: missing value for '" << argument << "'." << std::endl;
+            return false;
+        }
+
+        auto resolution = glm::ivec2 { };
+        auto quality    = SMAA::Quality::None;
+        auto filter     = ShadowMaps::Filter::PCF;
+        auto valid      = true;
+
+        if (std::strcmp (argument, "--frames") == 0)            valid = std::sscanf (value, "%u", &settings.frames) == 1;
+        else if (std::strcmp (argument, "--warmup") == 0)       valid = std::sscanf (value, "%u", &settings.warmupFrames) == 1;
+        else if (std::strcmp (argument, "--timestep") == 0)     valid = std::sscanf (value, "%f", &settings.timeStep) == 1;
+        else if (std::strcmp (argument, "--display") == 0)      valid = parseResolution (value, settings.displayResolution);
+        else if (std::strcmp (argument, "--csv") == 0)          settings.csvFile = value;
+        else if (std::strcmp (argument, "--json") == 0)         settings.jsonFile = value;
+        else if (std::strcmp (argument, "--trace") == 0)        settings.traceFile = value;
+        else if (std::strcmp (argument, "--complexity") == 0)
+        {
+            auto enabled                = 0U;
+            valid                       = std::sscanf (value, "%u", &enabled) == 1 && enabled <= 1;
+            settings.measureComplexity  = enabled == 1;
+        }
+        else if (std::strcmp (argument, "--texture-budget") == 0)
+        {
+            valid = std::sscanf (value, "%u", &settings.textureBudget) == 1;
+        }
+        else if (std::strcmp (argument, "--dynamic-resolution") == 0)
+        {
+            valid = std::sscanf (value, "%f", &settings.dynamicResolution) == 1 && settings.dynamicResolution >= 0.f;
+        }
+        else if (std::strcmp (argument, "--program-cache") == 0)
+        {
+            settings.programCache = value;
+        }
+        else if (std::strcmp (argument, "--resolution") == 0)
+        {
+            valid = parseResolution (value, resolution);
+            resolutions.push_back (resolution);
+        }
+        else if (std::strcmp (argument, "--smaa") == 0)
+        {
+            valid = parseQuality (value, quality);
+            aaModes.push_back (quality);
+        }
+        else if (std::strcmp (argument, "--lighting") == 0)
+        {
+            const auto specialised = std::strcmp (value, lightingName (true)) == 0;
+            valid = specialised || std::strcmp (value, lightingName (false)) == 0;
+            lightingModes.push_back (specialised);
+        }
+        else if (std::strcmp (argument, "--shadows") == 0)
+        {
+            valid = parseFilter (value, filter);
+            shadowFilters.push_back (filter);
+        }
+        else
+        {
+            std::cerr << "Benchmark: unknown argument '" << argument << "'." << std::endl;
+            return false;
+        }
+
+        if (!valid)
+        {
+            std::cerr << "Benchmark: invalid value '" << value << "' for '" << argument << "'." << std::endl;
+            return false;
+        }
+
+        ++i;
+    }
+
+    if (!resolutions.empty())
+    {
+        settings.internalResolutions = std::move (resolutions);
+    }
+
+    if (!aaModes.empty())
+    {
+        settings.antiAliasingModes = std::move (aaModes);
+    }
+
+    if (!lightingModes.empty())
+    {
+        settings.lightingModes = std::move (lightingModes);
+    }
+
+    if (!shadowFilters.empty())
+    {
+        settings.shadowFilters = std::move (shadowFilters);
+    }
+
+    return true;
+}
+
+
+bool Benchmark::initialise (const Settings& settings) noexcept
+{
+    // The context must exist before any GL objects are created.
+    clean();
+    if (!m_context.initialise (settings.displayResolution.x, settings.displayResolution.y))
+    {
+        std::cerr << "Benchmark: unable to create an offscreen OpenGL 4.5 context." << std::endl;
+        return false;
+    }
+
+    // The scene throws if the data file can't be read.
+    try
+    {
+        m_scene = std::make_unique<scene::Context>();
+    }
+
+    catch (...)
+    {
+        std::cerr << "Benchmark: unable to load the scene." << std::endl;
+        clean();
+        return false;
+    }
+
+    // Streaming must be chosen before the materials are built.
+    auto streaming      = TextureStreamer::Settings { };
+    streaming.enabled   = settings.textureBudget > 0;
+    streaming.budget    = static_cast<size_t> (settings.textureBudget) * 1024 * 1024;
+    m_renderer.setTextureStreaming (streaming);
+
+    // Programs are linked during initialisation so the cache must be chosen first.
+    ProgramCache::setDirectory (settings.programCache);
+
+    // The renderer starts at the display resolution, each configuration will change it as required.
+    if (!m_renderer.initialise (m_scene.get(), settings.displayResolution, settings.displayResolution))
+    {
+        std::cerr << "Benchmark: the renderer failed to initialise." << std::endl;
+        clean();
+        return false;
+    }
+
+    std::cout << "Benchmark: renderer initialised:" << std::endl;
+    m_renderer.getStartupTimer().report (std::cout);
+
+    m_settings = settings;
+    return true;
+}
+
+
+void Benchmark::clean() noexcept
+{
+    m_renderer.clean();
+    m_scene.reset();
+    m_context.clean();
+    m_results.clear();
+}
+
+
+bool Benchmark::run() noexcept
+{
+    if (!m_context.isInitialised())
+    {
+        return false;
+    }
+
+    // The profiler keeps the most recent zones of each thread so a trace covers the end of the run.
+    if (!m_settings.traceFile.empty())
+    {
+        Profiler::clear();
+        Profiler::setEnabled (true);
+    }
+
+    // Measure each configuration in turn.
+    const auto matrix = buildModeMatrix();
+    m_results.clear();
+    m_results.reserve (matrix.size());
+
+    for (const auto& configuration : matrix)
+    {
+        m_results.push_back (measure (configuration));
+
+        const auto& result  = m_results.back();
+        auto cpuTotal       = 0.f;
+        auto gpuTotal       = 0.f;
+
+        for (const auto& sample : result.samples)
+        {
+            cpuTotal += sample.cpuTime;
+            gpuTotal += sample.gpuTime;
+        }
+
+        const auto count = static_cast<float> (std::max (result.samples.size(), size_t { 1 }));
+
+        std::cout << "[" << m_results.size() << "/" << matrix.size() << "] "
+            << (configuration.deferredRender ? "deferred" : "forward") << ", "
+            << (configuration.multiThreaded ? "multi-threaded" : "single-threaded") << ", "
+            << (configuration.pbs ? "pbs" : "blinn-phong") << ", "
+            << lightingName (configuration.specialisedLighting) << " lighting, "
+            << toString (configuration.shadowFilter) << " shadows, "
+            << "smaa " << toString (configuration.smaaQuality) << ", "
+            << configuration.internalResolution.x << "x" << configuration.internalResolution.y << ": "
+            << "CPU " << cpuTotal / count << "ms, GPU " << gpuTotal / count << "ms" << std::endl;
+    }
+
+    // Finally write the results.
+    auto success = true;
+
+    if (!m_settings.csvFile.empty() && !writeCSV (m_settings.csvFile))
+    {
+        std::cerr << "Benchmark: unable to write '" << m_settings.csvFile << "'." << std::endl;
+        success = false;
+    }
+
+    if (!m_settings.jsonFile.empty() && !writeJSON (m_settings.jsonFile))
+    {
+        std::cerr << "Benchmark: unable to write '" << m_settings.jsonFile << "'." << std::endl;
+        success = false;
+    }
+
+    if (!m_settings.traceFile.empty())
+    {
+        Profiler::setEnabled (false);
+
+        if (!Profiler::writeChromeTrace (m_settings.traceFile))
+        {
+            std::cerr << "Benchmark: unable to write '" << m_settings.traceFile << "'." << std::endl;
+            success = false;
+        }
+    }
+
+    return success;
+}
+
+
+std::vector<Benchmark::Configuration> Benchmark::buildModeMatrix() const noexcept
+{
+    // Changing the resolution rebuilds the framebuffers so it's the outermost loop. Every shading, lighting, shadow
+    // and SMAA program is linked up front so the remaining modes are free to change. Only the lighting permutations
+    // use the shadow filter so subroutine lighting is measured once with PCF.
+    auto matrix = std::vector<Configuration> { };
+
+    for (const auto& resolution : m_settings.internalResolutions)
+    {
+        for (const auto pbs : { true, false })
+        {
+            for (const bool specialised : m_settings.lightingModes)
+            {
+                const auto filters = specialised ? m_settings.shadowFilters : 
+                    Settings::ShadowFilters { ShadowMaps::Filter::PCF };
+
+                for (const auto filter : filters)
+                {
+                    for (const auto quality : m_settings.antiAliasingModes)
+                    {
+                        for (const auto deferred : { true, false })
+                        {
+                            for (const auto multiThreaded : { true, false })
+                            {
+                                auto configuration                  = Configuration { };
+                                configuration.deferredRender        = deferred;
+                                configuration.multiThreaded         = multiThreaded;
+                                configuration.pbs                   = pbs;
+                                configuration.specialisedLighting   = specialised;
+                                configuration.shadowFilter          = filter;
+                                configuration.smaaQuality           = quality;
+                                configuration.internalResolution    = resolution;
+                                matrix.push_back (configuration);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return matrix;
+}
+
+
+Benchmark::Result Benchmark::measure (const Configuration& configuration) noexcept
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    // Apply the modes, the renderer avoids rebuilding anything which hasn't changed.
+    m_renderer.setInternalResolution (configuration.internalResolution);
+    m_renderer.setShadingMode (configuration.pbs);
+    m_renderer.setLightingMode (configuration.specialisedLighting);
+    m_renderer.setShadowFilter (configuration.shadowFilter);
+    m_renderer.setAntiAliasingMode (configuration.smaaQuality);
+    m_renderer.setRenderingMode (configuration.deferredRender);
+    m_renderer.setThreadingMode (configuration.multiThreaded);
+    m_renderer.setComplexityMode (m_settings.measureComplexity && configuration.deferredRender);
+
+    // Every configuration starts from the full internal resolution so the scale adapts to its own frame times.
+    auto dynamicResolution          = DynamicResolution::Settings { };
+    dynamicResolution.enabled       = m_settings.dynamicResolution > 0.f;
+    dynamicResolution.targetTime    = m_settings.dynamicResolution;
+    m_renderer.setDynamicResolution (dynamicResolution);
+    m_renderer.resetFrameTimings();
+    MemoryTracker::resetPeaks();
+
+    // GPU timings are read back non-blocking so they lag behind by the buffering depth. We render that many extra
+    // frames at the end so every recorded frame receives its GPU time.
+    constexpr auto lag  = static_cast<GLuint> (types::multiBuffering);
+    const auto warmup   = std::max (m_settings.warmupFrames, GLuint { 1 });
+    const auto recorded = m_settings.frames;
+    const auto total    = warmup + recorded + lag;
+
+    auto result             = Result { };
+    result.configuration    = configuration;
+    result.samples.resize (recorded);
+
+    auto syncsBeforeRecording = GLuint { 0 };
+
+    for (GLuint frame { 0 }; frame < total; ++frame)
+    {
+        // Advance the deterministic clock and move the camera along the path.
+        const auto time = frame * m_settings.timeStep;
+        m_scene->update (time);
+        m_path.apply (m_scene->getCamera(), time);
+
+        if (frame == warmup)
+        {
+            syncsBeforeRecording = m_renderer.getSyncCount();
+        }
+
+        const auto start = Clock::now();
+        m_renderer.render();
+        const auto end = Clock::now();
+
+        m_context.swapBuffers();
+
+        // Record the CPU time of the current frame.
+        if (frame >= warmup && frame < warmup + recorded)
+        {
+            auto& sample    = result.samples[frame - warmup];
+            sample.time     = time;
+            sample.cpuTime  = std::chrono::duration<float, std::milli> (end - start).count();
+        }
+
+        // The renderer only reads back a result once the buffering depth has been filled.
+        if (frame > lag && frame - lag >= warmup && frame - lag < warmup + recorded)
+        {
+            auto& sample    = result.samples[frame - lag - warmup];
+            sample.gpuTime  = m_renderer.getLastFrameTime();
+            sample.scale    = m_renderer.getLastRenderScale();
+        }
+
+        if (frame == warmup + recorded)
+        {
+            result.syncCount = m_renderer.getSyncCount() - syncsBeforeRecording;
+        }
+    }
+
+    // Complexity only depends on the camera so the final frame is representative of the end of the path.
+    const auto& complexity  = m_renderer.getComplexity();
+    result.complexityFrames = complexity.getCollectedFrames();
+    result.complexity       = complexity.getLastHistograms();
+    result.memory           = MemoryTracker::getTotal();
+
+    return result;
+}
+
+
+const char* Benchmark::toString (const SMAA::Quality quality) noexcept
+{
+    switch (quality)
+    {
+        case SMAA::Quality::None:   return "none";
+        case SMAA::Quality::Low:    return "low";
+        case SMAA::Quality::Medium: return "medium";
+        case SMAA::Quality::High:   return "high";
+        case SMAA::Quality::Ultra:  return "ultra";
+    }
+
+    return "unknown";
+}
+
+
+const char* Benchmark::toString (const ShadowMaps::Filter filter) noexcept
+{
+    switch (filter)
+    {
+        case ShadowMaps::Filter::PCF:       return "pcf";
+        case ShadowMaps::Filter::Gather:    return "gather";
+        case ShadowMaps::Filter::EVSM:      return "evsm";
+    }
+
+    return "unknown";
+}
+
+
+bool Benchmark::writeCSV (const std::string& file) const noexcept
+{
+    auto output = std::ofstream { file };
+
+    if (!output.is_open())
+    {
+        return false;
+    }
+
+    output << "configuration,rendering,threading,shading,lighting,shadows,smaa,internal_width,internal_height,frame,"
+        "time,cpu_ms,gpu_ms,render_scale\n";
+
+    for (size_t i { 0 }; i < m_results.size(); ++i)
+    {
+        const auto& result          = m_results[i];
+        const auto& configuration   = result.configuration;
+
+        for (size_t frame { 0 }; frame < result.samples.size(); ++frame)
+        {
+            const auto& sample = result.samples[frame];
+
+            output << i << ","
+                << (configuration.deferredRender ? "deferred" : "forward") << ","
+                << (configuration.multiThreaded ? "multi" : "single") << ","
+                << (configuration.pbs ? "pbs" : "blinn-phong") << ","
+                << lightingName (configuration.specialisedLighting) << ","
+                << toString (configuration.shadowFilter) << ","
+                << toString (configuration.smaaQuality) << ","
+                << configuration.internalResolution.x << "," << configuration.internalResolution.y << ","
+                << frame << "," << sample.time << "," << sample.cpuTime << "," << sample.gpuTime << "," 
+                << sample.scale << "\n";
+        }
+    }
+
+    return output.good();
+}
+
+
+bool Benchmark::writeJSON (const std::string& file) const noexcept
+{
+    auto output = std::ofstream { file };
+
+    if (!output.is_open())
+    {
+        return false;
+    }
+
+    // Summaries are included so the file is useful without post-processing.
+    const auto writeSummary = [&] (const char* name, const Result::Samples& samples, float FrameSample::* member)
+    {
+        auto minimum    = std::numeric_limits<float>::max();
+        auto maximum    = 0.f;
+        auto total      = 0.f;
+
+        for (const auto& sample : samples)
+        {
+            minimum = std::min (minimum, sample.*member);
+            maximum = std::max (maximum, sample.*member);
+            total   += sample.*member;
+        }
+
+        const auto mean = samples.empty() ? 0.f : total / samples.size();
+        minimum         = samples.empty() ? 0.f : minimum;
+
+        output << "\"" << name << "\": { \"min\": " << minimum << ", \"mean\": " << mean << ", \"max\": " << maximum << " }";
+    };
+
+    const auto writeHistogram = [&] (const char* name, const ComplexityCounter::Bins& bins)
+    {
+        output << "\"" << name << "\": { \"mean\": " << ComplexityCounter::mean (bins) 
+            << ", \"p50\": " << ComplexityCounter::percentile (bins, 0.5f)
+            << ", \"p95\": " << ComplexityCounter::percentile (bins, 0.95f)
+            << ", \"p99\": " << ComplexityCounter::percentile (bins, 0.99f) << ", \"bins\": [";
+
+        for (size_t bin { 0 }; bin < bins.size(); ++bin)
+        {
+            output << (bin == 0 ? "" : ", ") << bins[bin];
+        }
+
+        output << "] }";
+    };
+
+    output << "{\n";
+    output << "  \"display\": [" << m_settings.displayResolution.x << ", " << m_settings.displayResolution.y << "],\n";
+    output << "  \"warmupFrames\": " << m_settings.warmupFrames << ",\n";
+    output << "  \"frames\": " << m_settings.frames << ",\n";
+    output << "  \"timeStep\": " << m_settings.timeStep << ",\n";
+    output << "  \"dynamicResolution\": " << m_settings.dynamicResolution << ",\n";
+    output << "  \"sampleFormat\": [\"time\", \"cpu_ms\", \"gpu_ms\", \"render_scale\"],\n";
+
+    // Startup phases overlap so each is given its start and duration rather than just how long it took.
+    const auto& startup = m_renderer.getStartupTimer();
+    output << "  \"startup\": {\n    \"total\": " << startup.getTotalTime() << ",\n    \"phases\": {";
+
+    for (size_t i { 0 }, written { 0 }; i < StartupTimer::phaseCount; ++i)
+    {
+        const auto phase    = static_cast<StartupTimer::Phase> (i);
+        const auto& timing  = startup.getTiming (phase);
+
+        if (timing.recorded)
+        {
+            output << (written++ == 0 ? " " : ", ") << "\"" << StartupTimer::getName (phase) << "\": { \"start\": " 
+                << timing.start << ", \"duration\": " << timing.duration << ", \"worker\": " 
+                << (timing.worker ? "true" : "false") << " }";
+        }
+    }
+
+    output << " }\n  },\n";
+
+    // Switching modes links programs too so these cover the whole run, not just startup.
+    const auto programs = ProgramCache::getCounters();
+    output << "  \"programCache\": { \"hits\": " << programs.hits << ", \"misses\": " << programs.misses 
+        << ", \"rejected\": " << programs.rejected << ", \"stored\": " << programs.stored << " },\n";
+
+    // Memory is reported as it stands after the final configuration, peaks cover the whole of that configuration.
+    output << "  \"memory\": {\n    \"subsystems\": {";
+
+    for (size_t i { 0 }; i < MemoryTracker::subsystemCount; ++i)
+    {
+        const auto subsystem    = static_cast<MemoryTracker::Subsystem> (i);
+        const auto usage        = MemoryTracker::getUsage (subsystem);
+
+        output << (i == 0 ? " " : ", ") << "\"" << MemoryTracker::getName (subsystem) << "\": { \"bytes\": " 
+            << usage.bytes << ", \"peak\": " << usage.peak << ", \"allocations\": " << usage.allocations << " }";
+    }
+
+    output << " },\n    \"formats\": {";
+    auto firstFormat = true;
+
+    for (const auto& format : MemoryTracker::getFormats())
+    {
+        output << (firstFormat ? " " : ", ") << "\"" << MemoryTracker::getFormatName (format.first) << "\": { \"bytes\": " 
+            << format.second.bytes << ", \"peak\": " << format.second.peak << " }";
+        firstFormat = false;
+    }
+
+    output << " },\n    \"partitions\": [";
+    const auto partitions = MemoryTracker::getPartitions();
+
+    for (size_t i { 0 }; i < partitions.size(); ++i)
+    {
+        output << (i == 0 ? "" : ", ") << partitions[i];
+    }
+
+    output << "]\n  },\n";
+    output << "  \"configurations\": [\n";
+
+    for (size_t i { 0 }; i < m_results.size(); ++i)
+    {
+        const auto& result          = m_results[i];
+        const auto& configuration   = result.configuration;
+
+        output << "    {\n";
+        output << "      \"rendering\": \"" << (configuration.deferredRender ? "deferred" : "forward") << "\",\n";
+        output << "      \"threading\": \"" << (configuration.multiThreaded ? "multi" : "single") << "\",\n";
+        output << "      \"shading\": \"" << (configuration.pbs ? "pbs" : "blinn-phong") << "\",\n";
+        output << "      \"lighting\": \"" << lightingName (configuration.specialisedLighting) << "\",\n";
+        output << "      \"shadows\": \"" << toString (configuration.shadowFilter) << "\",\n";
+        output << "      \"smaa\": \"" << toString (configuration.smaaQuality) << "\",\n";
+        output << "      \"internalResolution\": [" << configuration.internalResolution.x << ", "
+            << configuration.internalResolution.y << "],\n";
+        output << "      \"syncCount\": " << result.syncCount << ",\n";
+        output << "      \"memory\": { \"bytes\": " << result.memory.bytes << ", \"peak\": " << result.memory.peak << " },\n";
+        output << "      ";
+        writeSummary ("cpu", result.samples, &FrameSample::cpuTime);
+        output << ",\n      ";
+        writeSummary ("gpu", result.samples, &FrameSample::gpuTime);
+        output << ",\n      ";
+        writeSummary ("renderScale", result.samples, &FrameSample::scale);
+        output << ",\n";
+
+        if (result.complexityFrames > 0)
+        {
+            output << "      \"complexity\": { \"frames\": " << result.complexityFrames << ", ";
+            writeHistogram ("overdraw", result.complexity.overdraw);
+            output << ", ";
+            writeHistogram ("lights", result.complexity.lights);
+            output << " },\n";
+        }
+
+        output << "      \"samples\": [";
+
+        for (size_t frame { 0 }; frame < result.samples.size(); ++frame)
+        {
+            const auto& sample = result.samples[frame];
+            output << (frame == 0 ? "" : ", ") << "[" << sample.time << ", " << sample.cpuTime << ", " 
+                << sample.gpuTime << ", " << sample.scale << "]";
+        }
+
+        output << "]\n";
+        output << "    }" << (i + 1 < m_results.size() ? "," : "") << "\n";
+    }
+
+    output << "  ]\n";
+    output << "}\n";
+
+    return output.good();
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+#if !defined    _BENCHMARK_
+#define         _BENCHMARK_
+
+// STL headers.
+#include <memory>
+#include <string>
+#include <vector>
+
+
+// Engine headers.
+#include <glm/vec2.hpp>
+#include <scene/scene_fwd.hpp>
+
+
+// Personal headers.
+#include <Benchmark/CameraPath.hpp>
+#include <Benchmark/HeadlessContext.hpp>
+#include <Rendering/Renderer/Renderer.hpp>
+#include <Rendering/State/MemoryTracker.hpp>
+#include <Rendering/State/ProgramCache.hpp>
+
+
+/// <summary>
+/// Drives the renderer without a window for a fixed number of frames along a scripted camera path. Every combination
+/// of rendering, threading, shading, lighting, shadow, antialiasing and internal resolution modes is measured and
+/// per-frame CPU and GPU timings are written out as CSV and JSON. The scene clock advances by a fixed time step so
+/// every run renders exactly the same frames.
+/// </summary>
+class Benchmark final
+{
+    public:
+
+        /// <summary> Controls the length, resolution and output of a benchmark run. </summary>
+        struct Settings final
+        {
+            using Resolutions       = std::vector<glm::ivec2>;
+            using AntiAliasingModes = std::vector<SMAA::Quality>;
+            using LightingModes     = std::vector<bool>;
+            using ShadowFilters     = std::vector<ShadowMaps::Filter>;
+
+            glm::ivec2          displayResolution   { 1280, 720 };          //!< The size of the default framebuffer.
+            Resolutions         internalResolutions { { 1280, 720 } };      //!< Each internal resolution to sweep.
+            AntiAliasingModes   antiAliasingModes   {                       //!< Each SMAA quality to sweep.
+                                                        SMAA::Quality::None, SMAA::Quality::Low, SMAA::Quality::Medium,
+                                                        SMAA::Quality::High, SMAA::Quality::Ultra
+                                                    };
+            LightingModes       lightingModes       { true, false };        //!< Whether lighting uses specialised programs or subroutines.
+            ShadowFilters       shadowFilters       { ShadowMaps::Filter::PCF };    //!< Filters swept with specialised lighting.
+            GLuint              warmupFrames        { 60 };                 //!< Frames rendered before recording starts.
+            GLuint              frames              { 600 };                //!< Frames recorded per configuration.
+            float               timeStep            { 1.f / 60.f };         //!< Seconds the scene clock advances each frame.
+            std::string         csvFile             { "benchmark.csv" };    //!< Where per-frame timings are written, empty to skip.
+            std::string         jsonFile            { "benchmark.json" };   //!< Where the full report is written, empty to skip.
+            std::string         traceFile           { };                    //!< Where CPU profiler zones are written, empty to skip.
+            std::string         programCache        { ProgramCache::defaultDirectory }; //!< Where linked programs are cached, empty to disable.
+            bool                measureComplexity   { false };              //!< Whether deferred runs record overdraw and light complexity.
+            GLuint              textureBudget       { 0 };                  //!< How many MB streamed material textures may use, zero uploads every level.
+            float               dynamicResolution   { 0.f };                //!< The GPU frame time dynamic resolution aims for (ms), zero renders every pixel.
+        };
+
+        /// <summary> A single point in the mode matrix. </summary>
+        struct Configuration final
+        {
+            bool            deferredRender      { true };                   //!< Deferred or forward rendering.
+            bool            multiThreaded       { true };                   //!< Whether uniform streaming uses worker threads.
+            bool            pbs                 { true };                   //!< Physically based or Blinn-Phong shading.
+            bool            specialisedLighting { true };                   //!< Lighting permutations or subroutines.
+            ShadowMaps::Filter shadowFilter     { ShadowMaps::Filter::PCF };    //!< How spotlight shadows are filtered.
+            SMAA::Quality   smaaQuality         { SMAA::Quality::Ultra };   //!< The antialiasing preset.
+            glm::ivec2      internalResolution  { 1280, 720 };              //!< The size of the off-screen buffers.
+        };
+
+        /// <summary> The timings recorded for a single frame. </summary>
+        struct FrameSample final
+        {
+            float   time    { 0.f };    //!< The scene time in seconds when the frame was rendered.
+            float   cpuTime { 0.f };    //!< How long Renderer::render() took on the CPU (ms).
+            float   gpuTime { 0.f };    //!< How long the GPU took to execute the frame (ms).
+            float   scale   { 1.f };    //!< The fraction of each internal dimension which was rendered.
+        };
+
+        /// <summary> Every frame recorded for a configuration. </summary>
+        struct Result final
+        {
+            using Samples = std::vector<FrameSample>;
+
+            Configuration                   configuration       { };    //!< The modes which were active.
+            Samples                         samples             { };    //!< Timings for each recorded frame.
+            GLuint                          syncCount           { 0 };  //!< How many times the CPU was forced to wait for the GPU.
+            GLuint                          complexityFrames    { 0 };  //!< How many frames had their complexity histograms collected.
+            ComplexityCounter::Histograms   complexity          { };    //!< The overdraw and light complexity of the last collected frame.
+            MemoryTracker::Usage            memory              { };    //!< GPU memory in use at the end of the run and its peak.
+        };
+
+        using Results = std::vector<Result>;
+
+        Benchmark() noexcept                            = default;
+        Benchmark (Benchmark&&) noexcept                = default;
+        Benchmark& operator= (Benchmark&&) noexcept     = default;
+        ~Benchmark() { clean(); }
+
+        Benchmark (const Benchmark&)                    = delete;
+        Benchmark& operator= (const Benchmark&)         = delete;
+
+
+        /// <summary>
+        /// Parses command line arguments into benchmark settings. Supported arguments are --frames N, --warmup N,
+        /// --timestep S, --display WxH, --resolution WxH (repeatable), --smaa none|low|medium|high|ultra (repeatable),
+        /// --lighting specialised|subroutines (repeatable), --shadows pcf|gather|evsm (repeatable), --csv FILE, 
+        /// --json FILE, --trace FILE, --complexity 0|1, --texture-budget MB, --dynamic-resolution MS and 
+        /// --program-cache DIR. Subroutine lighting always filters shadows with PCF so it's only measured once.
+        /// </summary>
+        /// <param name="argc"> The number of arguments. </param>
+        /// <param name="argv"> The arguments, including the executable name and --benchmark flag. </param>
+        /// <param name="settings"> Where the parsed values will be written. </param>
+        /// <returns> Whether every argument was understood. </returns>
+        static bool parseArguments (int argc, char* argv[], Settings& settings) noexcept;
+
+
+        /// <summary>
+        /// Attempts to create the offscreen context, load the scene and initialise the renderer. Upon failure the
+        /// object will be left in an uninitialised state.
+        /// </summary>
+        /// <param name="settings"> The settings to use for every run. </param>
+        /// <returns> Whether initialisation was successful. </returns>
+        bool initialise (const Settings& settings) noexcept;
+
+        /// <summary> Destroys the renderer, scene and context. </summary>
+        void clean() noexcept;
+
+        /// <summary> Renders every configuration in the mode matrix and writes the requested output files. </summary>
+        /// <returns> Whether every result was recorded and written successfully. </returns>
+        bool run() noexcept;
+
+        /// <summary> Gets the results of the most recent run. </summary>
+        const Results& getResults() const noexcept { return m_results; }
+
+    private:
+
+        using Scene = std::unique_ptr<scene::Context>;
+
+        Settings        m_settings  { };                                    //!< Controls the length and output of each run.
+        HeadlessContext m_context   { };                                    //!< The offscreen OpenGL context.
+        Scene           m_scene     { };                                    //!< The scene being rendered.
+        Renderer        m_renderer  { };                                    //!< The renderer being measured.
+        CameraPath      m_path      { CameraPath::sponzaFlythrough() };     //!< The camera path followed by every run.
+        Results         m_results   { };                                    //!< The timings of every configuration.
+
+    private:
+
+        /// <summary> Builds every combination of modes, ordered so expensive rebuilds happen least often. </summary>
+        std::vector<Configuration> buildModeMatrix() const noexcept;
+
+        /// <summary> Applies the given modes to the renderer and records the requested number of frames. </summary>
+        Result measure (const Configuration& configuration) noexcept;
+
+        /// <summary> Gets the name of an antialiasing preset as written in the output files. </summary>
+        static const char* toString (const SMAA::Quality quality) noexcept;
+
+        /// <summary> Gets the name of a shadow filter as written in the output files. </summary>
+        static const char* toString (const ShadowMaps::Filter filter) noexcept;
+
+        /// <summary> Gets the name of a lighting mode as written in the output files. </summary>
+        static const char* lightingName (const bool specialised) noexcept
+        {
+            return specialised ? "specialised" : "subroutines";
+        }
+
+        /// <summary> Writes one row per recorded frame to the given file. </summary>
+        bool writeCSV (const std::string& file) const noexcept;
+
+        /// <summary> Writes every configuration, its summary statistics and per-frame timings to the given file. </summary>
+        bool writeJSON (const std::string& file) const noexcept;
+};
+
+#endif // _BENCHMARK_
@@ -0,0 +1,73 @@
+#include "CameraPath.hpp"
+
+
+// STL headers.
+#include <cmath>
+
+
+// Engine headers.
+#include <glm/geometric.hpp>
+#include <scene/scene.hpp>
+
+
+CameraPath CameraPath::sponzaFlythrough() noexcept
+{
+    return
+    {
+        {
+            { 0.f,  { 80.f, 50.f, 0.f },        { 0.f, 30.f, 0.f } },
+            { 5.f,  { 100.f, 15.f, -30.f },     { -100.f, 20.f, 0.f } },
+            { 10.f, { 0.f, 20.f, 30.f },        { 0.f, 10.f, -40.f } },
+            { 15.f, { -100.f, 15.f, 0.f },      { 100.f, 40.f, 0.f } },
+            { 20.f, { -80.f, 70.f, 25.f },      { 0.f, 30.f, 0.f } }
+        },
+        25.f
+    };
+}
+
+
+void CameraPath::apply (scene::Camera& camera, const float time) const noexcept
+{
+    if (m_keyframes.empty())
+    {
+        return;
+    }
+
+    // Wrap the time so the path loops.
+    const auto count    = m_keyframes.size();
+    const auto looped   = m_duration > 0.f ? std::fmod (time, m_duration) : 0.f;
+
+    // Find the keyframe we're currently travelling from.
+    auto current = size_t { 0 };
+    while (current + 1 < count && m_keyframes[current + 1].time <= looped)
+    {
+        ++current;
+    }
+
+    const auto& previous    = m_keyframes[(current + count - 1) % count];
+    const auto& from        = m_keyframes[current];
+    const auto& to          = m_keyframes[(current + 1) % count];
+    const auto& next        = m_keyframes[(current + 2) % count];
+
+    // The final segment travels back to the first keyframe at the end of the loop.
+    const auto end      = current + 1 < count ? to.time : m_duration;
+    const auto length   = end - from.time;
+    const auto t        = length > 0.f ? (looped - from.time) / length : 0.f;
+
+    const auto position = catmullRom (previous.position, from.position, to.position, next.position, t);
+    const auto target   = catmullRom (previous.target, from.target, to.target, next.target, t);
+    const auto forward  = glm::normalize (target - position);
+
+    camera.setPosition ({ position.x, position.y, position.z });
+    camera.setDirection ({ forward.x, forward.y, forward.z });
+}
+
+
+glm::vec3 CameraPath::catmullRom (const glm::vec3& a, const glm::vec3& b, const glm::vec3& c, const glm::vec3& d, 
+    const float t) noexcept
+{
+    const auto t2 = t * t;
+    const auto t3 = t2 * t;
+
+    return 0.5f * ((2.f * b) + (c - a) * t + (2.f * a - 5.f * b + 4.f * c - d) * t2 + (3.f * b - a - 3.f * c + d) * t3);
+}
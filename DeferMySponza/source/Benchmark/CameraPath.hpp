@@ -0,0 +1,72 @@
+#pragma once
+
+#if !defined    _BENCHMARK_CAMERA_PATH_
+#define         _BENCHMARK_CAMERA_PATH_
+
+// STL headers.
+#include <utility>
+#include <vector>
+
+
+// Engine headers.
+#include <glm/vec3.hpp>
+#include <scene/scene_fwd.hpp>
+
+
+/// <summary>
+/// A looping, time-based path for the scene camera. Keyframes are interpolated with a Catmull-Rom spline so that
+/// benchmark runs see exactly the same views for any given time, regardless of the speed of the machine.
+/// </summary>
+class CameraPath final
+{
+    public:
+
+        /// <summary> A single point along the path. </summary>
+        struct Keyframe final
+        {
+            float       time        { 0.f };    //!< How many seconds into the path the keyframe occurs.
+            glm::vec3   position    { };        //!< Where the camera should be located.
+            glm::vec3   target      { };        //!< The location the camera should look at.
+        };
+
+        using Keyframes = std::vector<Keyframe>;
+
+        CameraPath() noexcept                               = default;
+        CameraPath (CameraPath&&) noexcept                  = default;
+        CameraPath (const CameraPath&)                      = default;
+        CameraPath& operator= (CameraPath&&) noexcept       = default;
+        CameraPath& operator= (const CameraPath&)           = default;
+        ~CameraPath()                                       = default;
+
+        /// <summary> Constructs a path from keyframes which must be sorted by time. </summary>
+        /// <param name="keyframes"> The points to move through. </param>
+        /// <param name="duration"> How long a full loop takes, must be greater than the final keyframe time. </param>
+        CameraPath (Keyframes&& keyframes, const float duration) noexcept
+            : m_keyframes (std::move (keyframes)), m_duration (duration) { }
+
+
+        /// <summary> Creates a fly-through of the Sponza atrium which covers the courtyard, arches and balconies. </summary>
+        static CameraPath sponzaFlythrough() noexcept;
+
+
+        /// <summary> Gets how many seconds it takes to complete the path. </summary>
+        float getDuration() const noexcept { return m_duration; }
+
+        /// <summary> Positions and orients the camera at the given time along the path. </summary>
+        /// <param name="camera"> The camera to modify. </param>
+        /// <param name="time"> The time in seconds, the path will loop when this exceeds the duration. </param>
+        void apply (scene::Camera& camera, const float time) const noexcept;
+
+    private:
+
+        Keyframes   m_keyframes { };        //!< The points along the path, sorted by time.
+        float       m_duration  { 0.f };    //!< How many seconds a full loop of the path takes.
+
+    private:
+
+        /// <summary> Evaluates a uniform Catmull-Rom spline between b and c at the given point. </summary>
+        static glm::vec3 catmullRom (const glm::vec3& a, const glm::vec3& b, const glm::vec3& c, const glm::vec3& d, 
+            const float t) noexcept;
+};
+
+#endif // _BENCHMARK_CAMERA_PATH_
@@ -0,0 +1,183 @@
+#include "DecodeBenchmark.hpp"
+
+
+// STL headers.
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <memory>
+
+
+// Engine headers.
+#include <scene/scene.hpp>
+#include <tygra/PngDecoder.hpp>
+
+
+// Personal headers.
+#include <Utility/Scene.hpp>
+
+
+bool DecodeBenchmark::parseArguments (int argc, char* argv[], Settings& settings) noexcept
+{
+    for (int i { 1 }; i < argc; ++i)
+    {
+        const auto argument = argv[i];
+        const auto value    = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (std::strcmp (argument, "--decode-benchmark") == 0)
+        {
+            continue;
+        }
+
+        // Every other argument requires a value.
+        if (value == nullptr)
+        {
+            std::cerr << "DecodeBenchmark: missing value for '" << argument << "'." << std::endl;
+            return false;
+        }
+
+        auto valid = true;
+
+        if (std::strcmp (argument, "--content") == 0)           settings.contentDirectory = value;
+        else if (std::strcmp (argument, "--file") == 0)         settings.files.emplace_back (value);
+        else if (std::strcmp (argument, "--iterations") == 0)
+        {
+            valid = std::sscanf (value, "%u", &settings.iterations) == 1 && settings.iterations > 0;
+        }
+        else
+        {
+            std::cerr << "DecodeBenchmark: unknown argument '" << argument << "'." << std::endl;
+            return false;
+        }
+
+        if (!valid)
+        {
+            std::cerr << "DecodeBenchmark: invalid value '" << value << "' for '" << argument << "'." << std::endl;
+            return false;
+        }
+
+        ++i;
+    }
+
+    return true;
+}
+
+
+bool DecodeBenchmark::initialise (const Settings& settings) noexcept
+{
+    m_files.clear();
+    m_files.insert (std::begin (settings.files), std::end (settings.files));
+
+    // Without explicit files we measure the texture maps which the renderer would load.
+    if (m_files.empty())
+    {
+        try
+        {
+            const auto scene            = std::make_unique<scene::Context>();
+            const auto addIfNotEmpty    = [&] (const auto& file) { if (!file.empty()) m_files.emplace (file); };
+
+            for (const auto& material : util::getAllMaterials (*scene))
+            {
+                addIfNotEmpty (material.physicsMap);
+                addIfNotEmpty (material.albedoMap);
+                addIfNotEmpty (material.normalMap);
+            }
+        }
+
+        catch (...)
+        {
+            std::cerr << "DecodeBenchmark: unable to load the scene, use --file to name textures instead." << std::endl;
+            return false;
+        }
+    }
+
+    m_settings = settings;
+    return !m_files.empty();
+}
+
+
+bool DecodeBenchmark::run() noexcept
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    const auto megabytesPerSecond = [] (const double bytes, const double seconds)
+    {
+        return seconds > 0.0 ? bytes / (1024.0 * 1024.0) / seconds : 0.0;
+    };
+
+    auto totalSeconds   = 0.0;
+    auto totalDecoded   = 0.0;
+    auto totalFile      = 0.0;
+    auto decoded        = size_t { 0 };
+
+    std::cout << std::fixed << std::setprecision (1);
+
+    for (const auto& file : m_files)
+    {
+        // Files are read up front so disk access isn't measured.
+        auto stream = std::ifstream { toPath (file), std::ios::binary };
+        const auto data = std::vector<char> { std::istreambuf_iterator<char> { stream }, std::istreambuf_iterator<char> { } };
+        
+        auto decoder = tygra::PngDecoder { };
+
+        if (!decoder.open (data.data(), data.size()))
+        {
+            std::cerr << "DecodeBenchmark: unable to open '" << file << "'." << std::endl;
+            continue;
+        }
+
+        // The destination is reused by every iteration, as a mapped pixel buffer would be.
+        auto pixels     = std::vector<char> (decoder.rowSize() * decoder.height());
+        auto success    = true;
+        const auto start = Clock::now();
+
+        for (unsigned i { 0 }; i < m_settings.iterations && success; ++i)
+        {
+            success = decoder.decode (pixels.data(), decoder.rowSize(), true);
+        }
+
+        const auto seconds = std::chrono::duration<double> (Clock::now() - start).count();
+
+        if (!success)
+        {
+            std::cerr << "DecodeBenchmark: unable to decode '" << file << "'." << std::endl;
+            continue;
+        }
+
+        const auto decodedBytes = static_cast<double> (pixels.size()) * m_settings.iterations;
+        const auto fileBytes    = static_cast<double> (data.size()) * m_settings.iterations;
+
+        std::cout << "DecodeBenchmark: '" << file << "' " << decoder.width() << "x" << decoder.height() 
+            << "x" << decoder.componentsPerPixel() << ", " << megabytesPerSecond (decodedBytes, seconds) 
+            << " MB/s decoded, " << megabytesPerSecond (fileBytes, seconds) << " MB/s compressed." << std::endl;
+
+        totalSeconds += seconds;
+        totalDecoded += decodedBytes;
+        totalFile    += fileBytes;
+        ++decoded;
+    }
+
+    std::cout << "DecodeBenchmark: decoded " << decoded << " of " << m_files.size() << " textures, " 
+        << megabytesPerSecond (totalDecoded, totalSeconds) << " MB/s decoded, " 
+        << megabytesPerSecond (totalFile, totalSeconds) << " MB/s compressed." << std::endl;
+
+    return decoded == m_files.size();
+}
+
+
+std::string DecodeBenchmark::toPath (const std::string& uri) const noexcept
+{
+    constexpr auto scheme       = "content:///";
+    const auto schemeLength     = std::strlen (scheme);
+
+    if (uri.compare (0, schemeLength, scheme) != 0)
+    {
+        return uri;
+    }
+
+    return m_settings.contentDirectory + "/" + uri.substr (schemeLength);
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#if !defined    _BENCHMARK_DECODE_BENCHMARK_
+#define         _BENCHMARK_DECODE_BENCHMARK_
+
+// STL headers.
+#include <set>
+#include <string>
+#include <vector>
+
+
+/// <summary>
+/// Measures the throughput of the PNG decoder behind tygra::createImageFromPngFile(). Every file is read into memory
+/// once and then decoded repeatedly into a preallocated buffer, so only inflating and unfiltering are timed. Results
+/// are reported in MB/s of decoded pixels and of compressed file data.
+/// </summary>
+class DecodeBenchmark final
+{
+    public:
+
+        /// <summary> Controls which files are decoded and how many times. </summary>
+        struct Settings final
+        {
+            using Files = std::vector<std::string>;
+
+            std::string contentDirectory    { "content" };  //!< The file system location which "content:///" refers to.
+            Files       files               { };            //!< The files to decode, every texture map in the scene when empty.
+            unsigned    iterations          { 10 };         //!< How many times each file is decoded.
+        };
+
+        DecodeBenchmark() noexcept                                  = default;
+        DecodeBenchmark (DecodeBenchmark&&) noexcept                = default;
+        DecodeBenchmark& operator= (DecodeBenchmark&&) noexcept     = default;
+        ~DecodeBenchmark()                                          = default;
+
+        DecodeBenchmark (const DecodeBenchmark&)                    = delete;
+        DecodeBenchmark& operator= (const DecodeBenchmark&)         = delete;
+
+
+        /// <summary>
+        /// Parses command line arguments into benchmark settings. Supported arguments are --content DIR,
+        /// --iterations N and --file URI, which may be given multiple times.
+        /// </summary>
+        /// <param name="argc"> The number of arguments. </param>
+        /// <param name="argv"> The arguments, including the executable name and --decode-benchmark flag. </param>
+        /// <param name="settings"> Where the parsed values will be written. </param>
+        /// <returns> Whether every argument was understood. </returns>
+        static bool parseArguments (int argc, char* argv[], Settings& settings) noexcept;
+
+
+        /// <summary> Collects the files to decode, loading the scene if none were given. </summary>
+        /// <param name="settings"> The settings to measure with. </param>
+        /// <returns> Whether there's anything to decode. </returns>
+        bool initialise (const Settings& settings) noexcept;
+
+        /// <summary> Decodes every file, reporting the throughput of each and the total. </summary>
+        /// <returns> Whether every file was decoded successfully. </returns>
+        bool run() noexcept;
+
+    private:
+
+        using Files = std::set<std::string>;
+
+        Settings    m_settings  { };    //!< Controls how many times each file is decoded.
+        Files       m_files     { };    //!< Every file to decode, sorted for stable output.
+
+    private:
+
+        /// <summary> Converts the given location from a "content:///" URI to a file system location. </summary>
+        std::string toPath (const std::string& uri) const noexcept;
+};
+
+#endif // _BENCHMARK_DECODE_BENCHMARK_
\ No newline at end of file
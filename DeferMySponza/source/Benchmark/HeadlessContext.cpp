@@ -0,0 +1,232 @@
+#include "HeadlessContext.hpp"
+
+
+// STL headers.
+#include <utility>
+
+
+// Engine headers.
+#if defined TGL_PLATFORM_EGL
+    #define EGL_NO_X11
+    #define MESA_EGL_NO_X11_HEADERS
+    #include <EGL/egl.h>
+    #include <EGL/eglext.h>
+
+    #if !defined EGL_PLATFORM_SURFACELESS_MESA
+        #define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+    #endif
+#else
+    #include <GLFW/glfw3.h>
+#endif
+
+
+HeadlessContext::HeadlessContext (HeadlessContext&& move) noexcept
+{
+    *this = std::move (move);
+}
+
+
+HeadlessContext& HeadlessContext::operator= (HeadlessContext&& move) noexcept
+{
+    if (this != &move)
+    {
+        clean();
+
+        #if defined TGL_PLATFORM_EGL
+            m_display       = move.m_display;
+            m_surface       = move.m_surface;
+            m_context       = move.m_context;
+            move.m_display  = nullptr;
+            move.m_surface  = nullptr;
+            move.m_context  = nullptr;
+        #else
+            m_window        = move.m_window;
+            move.m_window   = nullptr;
+        #endif
+    }
+
+    return *this;
+}
+
+
+#if defined TGL_PLATFORM_EGL
+
+bool HeadlessContext::isInitialised() const noexcept
+{
+    return m_context != nullptr;
+}
+
+
+bool HeadlessContext::initialise (const GLsizei width, const GLsizei height) noexcept
+{
+    // Only one context can be current so the previous one must be destroyed first.
+    clean();
+
+    // Prefer the surfaceless platform as it doesn't need a GPU or display server, otherwise use the default display.
+    const auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC) eglGetProcAddress ("eglGetPlatformDisplayEXT");
+
+    auto display = getPlatformDisplay ?
+        getPlatformDisplay (EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr) :
+        eglGetDisplay (EGL_DEFAULT_DISPLAY);
+
+    if (display == EGL_NO_DISPLAY || eglInitialize (display, nullptr, nullptr) == EGL_FALSE)
+    {
+        return false;
+    }
+
+    // The renderer expects the same default framebuffer format as tygra::Window provides.
+    const EGLint configAttributes[] =
+    {
+        EGL_SURFACE_TYPE,       EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE,    EGL_OPENGL_BIT,
+        EGL_RED_SIZE,           8,
+        EGL_GREEN_SIZE,         8,
+        EGL_BLUE_SIZE,          8,
+        EGL_DEPTH_SIZE,         24,
+        EGL_STENCIL_SIZE,       8,
+        EGL_NONE
+    };
+
+    auto config = EGLConfig { };
+    auto count  = EGLint { 0 };
+
+    if (eglChooseConfig (display, configAttributes, &config, 1, &count) == EGL_FALSE || count == 0 ||
+        eglBindAPI (EGL_OPENGL_API) == EGL_FALSE)
+    {
+        eglTerminate (display);
+        return false;
+    }
+
+    // Create the surface and context.
+    const EGLint surfaceAttributes[] = { EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE };
+    const EGLint contextAttributes[] =
+    {
+        EGL_CONTEXT_MAJOR_VERSION,          4,
+        EGL_CONTEXT_MINOR_VERSION,          5,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK,    EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+
+    auto surface = eglCreatePbufferSurface (display, config, surfaceAttributes);
+    auto context = eglCreateContext (display, config, EGL_NO_CONTEXT, contextAttributes);
+
+    if (surface == EGL_NO_SURFACE || context == EGL_NO_CONTEXT ||
+        eglMakeCurrent (display, surface, surface, context) == EGL_FALSE)
+    {
+        eglDestroyContext (display, context);
+        eglDestroySurface (display, surface);
+        eglTerminate (display);
+        return false;
+    }
+
+    // Finally load the GL functions.
+    tglInit();
+    if (tglIsAvailable (TGL_EXTENSION_GL_4_5) != GL_TRUE)
+    {
+        eglMakeCurrent (display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext (display, context);
+        eglDestroySurface (display, surface);
+        eglTerminate (display);
+        return false;
+    }
+
+    m_display   = display;
+    m_surface   = surface;
+    m_context   = context;
+    return true;
+}
+
+
+void HeadlessContext::clean() noexcept
+{
+    if (isInitialised())
+    {
+        eglMakeCurrent (m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext (m_display, m_context);
+        eglDestroySurface (m_display, m_surface);
+        eglTerminate (m_display);
+        m_display   = nullptr;
+        m_surface   = nullptr;
+        m_context   = nullptr;
+    }
+}
+
+
+void HeadlessContext::swapBuffers() const noexcept
+{
+    eglSwapBuffers (m_display, m_surface);
+}
+
+#else
+
+bool HeadlessContext::isInitialised() const noexcept
+{
+    return m_window != nullptr;
+}
+
+
+bool HeadlessContext::initialise (const GLsizei width, const GLsizei height) noexcept
+{
+    // Only one context can be current so the previous one must be destroyed first.
+    clean();
+
+    if (glfwInit() != GL_TRUE)
+    {
+        return false;
+    }
+
+    // Match the context tygra::Window creates but never show the window.
+    glfwWindowHint (GLFW_VISIBLE, GL_FALSE);
+    glfwWindowHint (GLFW_RED_BITS, 8);
+    glfwWindowHint (GLFW_GREEN_BITS, 8);
+    glfwWindowHint (GLFW_BLUE_BITS, 8);
+    glfwWindowHint (GLFW_ALPHA_BITS, 0);
+    glfwWindowHint (GLFW_DEPTH_BITS, 24);
+    glfwWindowHint (GLFW_STENCIL_BITS, 8);
+    glfwWindowHint (GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint (GLFW_CONTEXT_VERSION_MINOR, 5);
+    glfwWindowHint (GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint (GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+    auto window = glfwCreateWindow (width, height, "Benchmark", nullptr, nullptr);
+
+    if (window == nullptr)
+    {
+        glfwTerminate();
+        return false;
+    }
+
+    glfwMakeContextCurrent (window);
+    glfwSwapInterval (0);
+
+    // Load the GL functions.
+    tglInit();
+    if (tglIsAvailable (TGL_EXTENSION_GL_4_5) != GL_TRUE)
+    {
+        glfwDestroyWindow (window);
+        glfwTerminate();
+        return false;
+    }
+
+    m_window = window;
+    return true;
+}
+
+
+void HeadlessContext::clean() noexcept
+{
+    if (isInitialised())
+    {
+        glfwDestroyWindow (m_window);
+        glfwTerminate();
+        m_window = nullptr;
+    }
+}
+
+
+void HeadlessContext::swapBuffers() const noexcept
+{
+    glfwSwapBuffers (m_window);
+}
+
+#endif
@@ -0,0 +1,69 @@
+#pragma once
+
+#if !defined    _BENCHMARK_HEADLESS_CONTEXT_
+#define         _BENCHMARK_HEADLESS_CONTEXT_
+
+// Engine headers.
+#include <tgl/tgl.h>
+
+
+// Forward declarations.
+typedef struct GLFWwindow GLFWwindow;
+
+
+/// <summary>
+/// An RAII encapsulation of an OpenGL 4.5 core context which doesn't require a visible window. On Linux a surfaceless
+/// EGL display is used with a pbuffer surface so the renderer can be driven on machines without a display server,
+/// such as Mesa's llvmpipe on render nodes. Other platforms fall back to a hidden GLFW window. The solution only
+/// builds for Windows, so the EGL path has only been exercised by compiling tgl and this class by hand.
+/// </summary>
+class HeadlessContext final
+{
+    public:
+
+        HeadlessContext() noexcept                          = default;
+        HeadlessContext (HeadlessContext&& move) noexcept;
+        HeadlessContext& operator= (HeadlessContext&& move) noexcept;
+
+        HeadlessContext (const HeadlessContext&)            = delete;
+        HeadlessContext& operator= (const HeadlessContext&) = delete;
+
+        ~HeadlessContext() { clean(); }
+
+
+        /// <summary> Check if the context has been created and made current. </summary>
+        bool isInitialised() const noexcept;
+
+
+        /// <summary>
+        /// Attempts to create an OpenGL 4.5 core context with a default framebuffer of the given size, make it current
+        /// on the calling thread and load every GL function pointer. Successive calls will destroy the existing context
+        /// before creating a new one.
+        /// </summary>
+        /// <param name="width"> The width of the default framebuffer. </param>
+        /// <param name="height"> The height of the default framebuffer. </param>
+        /// <returns> Whether the context was successfully created or not. </returns>
+        bool initialise (const GLsizei width, const GLsizei height) noexcept;
+
+        /// <summary> Destroys the context and its surface, the context will no longer be current. </summary>
+        void clean() noexcept;
+
+        /// <summary> Presents the default framebuffer, this is a no-op for pbuffer surfaces. </summary>
+        void swapBuffers() const noexcept;
+
+    private:
+
+        #if defined TGL_PLATFORM_EGL
+
+            void*       m_display   { nullptr };    //!< The EGLDisplay which owns the surface and context.
+            void*       m_surface   { nullptr };    //!< The EGLSurface pbuffer acting as the default framebuffer.
+            void*       m_context   { nullptr };    //!< The EGLContext the renderer will use.
+
+        #else
+
+            GLFWwindow* m_window    { nullptr };    //!< A hidden window which owns the context.
+
+        #endif
+};
+
+#endif // _BENCHMARK_HEADLESS_CONTEXT_
@@ -1,5 +1,6 @@
 #include "MyController.hpp"
 #include <MyView/MyView.hpp>
+#include <Utility/Profiler.hpp>
 
 #include <scene/scene.hpp>
 #include <tygra/Window.hpp>
@@ -44,6 +45,15 @@ void MyController::windowControlWillStart(tygra::Window * window)
     std::cout << "  Press F11 to activate single-threaded mode" << std::endl;
     std::cout << "  Press F12 to activate multi-threaded mode (default)" << std::endl;
     std::cout << "  Press Tab to toggle the display of frame timings" << std::endl;
+    std::cout << "  Press P to start/stop profiling, stopping writes profile.json" << std::endl;
+    std::cout << "  Press H to write frame time histograms to frametimes.json" << std::endl;
+    std::cout << "  Press O to toggle overdraw and light complexity measurement" << std::endl;
+    std::cout << "  Press L to toggle specialised lighting programs and subroutines" << std::endl;
+    std::cout << "  Press K to cycle the shadow filter between PCF, gather and EVSM" << std::endl;
+    std::cout << "  Press R to toggle dynamic resolution, aiming for the frame budget" << std::endl;
+#ifdef TGL_INSTRUMENT
+    std::cout << "  Press G to trace the GL calls of the next frame to gltrace.bin" << std::endl;
+#endif
     scene_->toggleCameraAnimation();
 }
 
@@ -161,6 +171,41 @@ void MyController::windowControlKeyboardChanged(tygra::Window * window,
     case tygra::kWindowKeyTab:
         view_->toggleFPSDisplay();
         break;
+    case 'H':
+        view_->exportFrameTimings();
+        break;
+    case 'O':
+        view_->toggleComplexityMode();
+        break;
+    case 'L':
+        view_->toggleLightingMode();
+        break;
+    case 'K':
+        view_->cycleShadowFilter();
+        break;
+    case 'R':
+        view_->toggleDynamicResolution();
+        break;
+    case 'P':
+        if (Profiler::isEnabled()) {
+            Profiler::setEnabled(false);
+            if (Profiler::writeChromeTrace("profile.json")) {
+                std::cout << "Profile written to profile.json" << std::endl;
+            }
+        }
+        else {
+            Profiler::clear();
+            Profiler::setEnabled(true);
+            std::cout << "Profiling started" << std::endl;
+        }
+        break;
+#ifdef TGL_INSTRUMENT
+    case 'G':
+        if (tglInstrumentTraceNextFrame("gltrace.bin") == GL_TRUE) {
+            std::cout << "GL calls of the next frame will be written to gltrace.bin" << std::endl;
+        }
+        break;
+#endif
     }
 }
 
@@ -2,7 +2,15 @@
 
 
 // STL headers.
+#include <algorithm>
 #include <iostream>
+#include <numeric>
+#include <vector>
+
+
+// Personal headers.
+#include <Rendering/State/MemoryTracker.hpp>
+#include <Rendering/State/ProgramCache.hpp>
 
 
 // Namespaces
@@ -40,6 +48,43 @@ void MyView::setAntiAliasingMode (SMAA::Quality quality) noexcept
     m_renderer.resetFrameTimings();
 }
 
+
+
+void MyView::toggleComplexityMode() noexcept
+{
+    m_renderer.setComplexityMode (!m_renderer.isMeasuringComplexity());
+    m_lastFPSDisplay = std::chrono::high_resolution_clock::now();
+    m_renderer.resetFrameTimings();
+}
+
+
+void MyView::toggleLightingMode() noexcept
+{
+    m_renderer.setLightingMode (!m_renderer.isUsingSpecialisedLighting());
+    m_lastFPSDisplay = std::chrono::high_resolution_clock::now();
+    m_renderer.resetFrameTimings();
+}
+
+
+void MyView::cycleShadowFilter() noexcept
+{
+    const auto next = (static_cast<unsigned int> (m_renderer.getShadowFilter()) + 1) % ShadowMaps::filterCount;
+    m_renderer.setShadowFilter (static_cast<ShadowMaps::Filter> (next));
+    m_lastFPSDisplay = std::chrono::high_resolution_clock::now();
+    m_renderer.resetFrameTimings();
+}
+
+
+void MyView::toggleDynamicResolution() noexcept
+{
+    auto settings       = m_renderer.getDynamicResolution().getSettings();
+    settings.enabled    = !settings.enabled;
+    settings.targetTime = m_renderer.getFrameRecorder().getBudget();
+    m_renderer.setDynamicResolution (settings);
+    m_lastFPSDisplay = std::chrono::high_resolution_clock::now();
+    m_renderer.resetFrameTimings();
+}
+
         
 void MyView::syncResolutions (bool shouldSyncResolutions) noexcept
 {
@@ -67,6 +112,22 @@ void MyView::setInternalResolution (int width, int height) noexcept
 }
 
 
+void MyView::exportFrameTimings() const noexcept
+{
+    constexpr auto file = "frametimes.json";
+
+    if (m_renderer.getFrameRecorder().writeReport (file))
+    {
+        std::cout << "Frame timings written to " << file << std::endl;
+    }
+
+    else
+    {
+        std::cerr << "Unable to write frame timings to " << file << std::endl;
+    }
+}
+
+
 void MyView::windowViewWillStart (tygra::Window*) noexcept
 {
     assert (m_scene != nullptr);
@@ -76,6 +137,15 @@ void MyView::windowViewWillStart (tygra::Window*) noexcept
         std::cerr << "Renderer failed to initialise." << std::endl;
     }
 
+    else
+    {
+        const auto programs = ProgramCache::getCounters();
+        std::cout << "Renderer initialised:" << std::endl;
+        m_renderer.getStartupTimer().report (std::cout);
+        std::cout << "Program cache: " << programs.hits << " loaded, " << programs.misses + programs.rejected 
+            << " compiled" << std::endl;
+    }
+
     GLint test;
     glGetIntegerv (GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &test);
     std::cout << "GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS: " << test << std::endl;
@@ -119,6 +189,34 @@ void MyView::windowViewRender (tygra::Window*) noexcept
     // Lolrandom render.
     m_renderer.render();
 
+    // Log any stutters which have occurred since we last checked, timings may have been reset in the meantime.
+    const auto& recorder    = m_renderer.getFrameRecorder();
+    const auto& stutters    = recorder.getStutters();
+    m_reportedStutters      = std::min (m_reportedStutters, recorder.getStutterCount());
+
+    if (m_displayFPS && recorder.getStutterCount() > m_reportedStutters)
+    {
+        const auto unreported = std::min (static_cast<size_t> (recorder.getStutterCount() - m_reportedStutters), stutters.size());
+
+        for (auto i = stutters.size() - unreported; i < stutters.size(); ++i)
+        {
+            const auto& stutter = stutters[i];
+            std::cout << "Stutter on frame " << stutter.frame << ": CPU " << stutter.cpuTime << "ms, GPU " 
+                << stutter.gpuTime << "ms, Sync " << stutter.syncTime << "ms" << std::endl;
+
+            for (size_t pass { 1 }; pass < PassTimer::passCount; ++pass)
+            {
+                if (stutter.passes[pass] > 0.f)
+                {
+                    std::cout << "    " << PassTimer::getName (static_cast<PassTimer::Pass> (pass)) << ": " 
+                        << stutter.passes[pass] << "ms" << std::endl;
+                }
+            }
+        }
+    }
+
+    m_reportedStutters = recorder.getStutterCount();
+
     // Check if we should display the FPS.
     const auto now          = std::chrono::high_resolution_clock::now();
     const auto difference   = std::chrono::duration_cast<std::chrono::seconds> (now - m_lastFPSDisplay);
@@ -133,7 +231,212 @@ void MyView::windowViewRender (tygra::Window*) noexcept
         std::cout << "Min Time:    " << m_renderer.getMinFrameTime() << "ms" << std::endl;
         std::cout << "Mean Time:   " << m_renderer.getTotalFrameTime() / m_renderer.getFrameCount() << "ms" << std::endl;
         std::cout << "Max Time:    " << m_renderer.getMaxFrameTime() << "ms" << std::endl;
+
+        if (m_renderer.getDynamicResolution().getSettings().enabled)
+        {
+            const auto& resolution = m_renderer.getResolution();
+            std::cout << "Render Res:  " << resolution.renderWidth << "x" << resolution.renderHeight << " (" 
+                << m_renderer.getDynamicResolution().getScale() * 100.f << "%)" << std::endl;
+        }
+
+        std::cout << std::endl;
+
+        // Percentiles reveal the hitches which averages hide.
+        const auto& recorder = m_renderer.getFrameRecorder();
+        const auto printPercentiles = [] (const char* name, const Histogram& histogram)
+        {
+            std::cout << name << "p50 " << histogram.getPercentile (0.5f) << "ms, p95 " << histogram.getPercentile (0.95f)
+                << "ms, p99 " << histogram.getPercentile (0.99f) << "ms, p99.9 " << histogram.getPercentile (0.999f) 
+                << "ms" << std::endl;
+        };
+
+        printPercentiles ("CPU Time:    ", recorder.getCPUTimes());
+        printPercentiles ("GPU Time:    ", recorder.getGPUTimes());
+        printPercentiles ("Sync Time:   ", recorder.getSyncTimes());
+        std::cout << "Over Budget: " << recorder.getFramesOverBudget() << " (" << recorder.getBudget() << "ms)" << std::endl;
+        std::cout << "Stutters:    " << recorder.getStutterCount() << std::endl;
+
+        const auto stateCounters = m_renderer.getStateCounters();
+        std::cout << "GL State:    " << stateCounters.issued << " issued, " << stateCounters.filtered
+            << " filtered per frame" << std::endl;
+        std::cout << std::endl;
+
+        // Show what the CPU submitted, averaged over every frame since timings were reset along with the worst frame.
+        const auto& renderStatistics    = m_renderer.getRenderStatistics();
+        const auto& totals              = renderStatistics.getTotals();
+        const auto& peaks               = renderStatistics.getPeaks();
+        const auto frames               = std::max (renderStatistics.getFrameCount(), 1U);
+
+        for (size_t i { 0 }; i < PassTimer::passCount; ++i)
+        {
+            const auto& total   = totals.passes[i];
+            const auto& peak    = peaks.passes[i];
+
+            if (total.calls > 0)
+            {
+                std::cout << PassTimer::getName (static_cast<PassTimer::Pass> (i)) << ": "
+                    << total.calls / frames << " draws, " << total.commands / frames << " commands, "
+                    << total.instances / frames << " instances, " << total.triangles / frames << " triangles (peak "
+                    << peak.triangles << ")" << std::endl;
+            }
+        }
+
+        for (size_t i { 0 }; i < RenderStatistics::lightCount; ++i)
+        {
+            std::cout << RenderStatistics::getName (static_cast<RenderStatistics::Light> (i)) << " Lights: "
+                << totals.lights[i].uploaded / frames << " uploaded" << std::endl;
+        }
+
+        for (size_t i { 0 }; i < RenderStatistics::streamCount; ++i)
+        {
+            const auto& streaming = totals.streams[i];
+            std::cout << RenderStatistics::getName (static_cast<RenderStatistics::Stream> (i)) << ": "
+                << streaming.bytes / frames << " bytes, " << streaming.flushes / frames << " flushes (peak "
+                << peaks.streams[i].bytes << " bytes)" << std::endl;
+        }
+
+        std::cout << "Shadow Maps: " << totals.shadowLayers / frames << " layers" << std::endl;
+        std::cout << "Sync Stalls: " << totals.syncStalls << " (" << totals.syncTime << "ms, peak "
+            << peaks.syncTime << "ms)" << std::endl;
         std::cout << std::endl;
+
+        // Show how many times each pixel was shaded in the most recently measured frame.
+        const auto& complexity = m_renderer.getComplexity();
+
+        if (complexity.getCollectedFrames() > 0)
+        {
+            const auto& histograms = complexity.getLastHistograms();
+
+            std::cout << "Overdraw:    " << ComplexityCounter::mean (histograms.overdraw) << " mean, "
+                << ComplexityCounter::percentile (histograms.overdraw, 0.95f) << " p95" << std::endl;
+            std::cout << "Lights:      " << ComplexityCounter::mean (histograms.lights) << " mean, "
+                << ComplexityCounter::percentile (histograms.lights, 0.95f) << " p95" << std::endl;
+            std::cout << std::endl;
+        }
+
+        // Show where GPU memory is going, sizes are calculated so they exclude any driver padding.
+        constexpr auto megabyte = 1024.f * 1024.f;
+        const auto total        = MemoryTracker::getTotal();
+
+        std::cout << "GPU Memory:  " << total.bytes / megabyte << "MB in " << total.allocations << " objects (peak "
+            << total.peak / megabyte << "MB)" << std::endl;
+
+        for (size_t i { 0 }; i < MemoryTracker::subsystemCount; ++i)
+        {
+            const auto subsystem    = static_cast<MemoryTracker::Subsystem> (i);
+            const auto usage        = MemoryTracker::getUsage (subsystem);
+
+            if (usage.allocations > 0)
+            {
+                std::cout << MemoryTracker::getName (subsystem) << ": " << usage.bytes / megabyte << "MB (peak "
+                    << usage.peak / megabyte << "MB)" << std::endl;
+            }
+        }
+
+        for (const auto& format : MemoryTracker::getFormats())
+        {
+            if (format.second.allocations > 0)
+            {
+                std::cout << MemoryTracker::getFormatName (format.first) << ": " << format.second.bytes / megabyte 
+                    << "MB" << std::endl;
+            }
+        }
+
+        const auto partitions = MemoryTracker::getPartitions();
+
+        for (size_t i { 0 }; i < partitions.size(); ++i)
+        {
+            std::cout << "Partition " << i << ": " << partitions[i] / megabyte << "MB" << std::endl;
+        }
+
+        std::cout << std::endl;
+
+        // Show how close streamed textures are to the resolution the visible pixels need.
+        const auto& textures = m_renderer.getTextureStreaming();
+
+        if (textures.allocatedBytes > 0)
+        {
+            std::cout << "Streamed Textures: " << textures.allocatedBytes / megabyte << "MB allocated, "
+                << textures.residentBytes / megabyte << "MB resident, " << textures.requestedBytes / megabyte 
+                << "MB requested" << std::endl;
+            std::cout << "Texture Uploads: " << textures.uploadedBytes << " bytes, " << textures.pendingLevels 
+                << " levels pending, " << textures.upgrades << " upgrades, " << textures.evictions << " evictions"
+                << std::endl;
+            std::cout << std::endl;
+        }
+
+#ifdef TGL_INSTRUMENT
+        // Show where the driver spent the most CPU time during the last frame.
+        std::cout << "GL Calls:    " << tglInstrumentTotalCalls() << " (" << tglInstrumentTotalTime() << "ms)" << std::endl;
+
+        auto functions = std::vector<unsigned int> (tglInstrumentFunctionCount());
+        std::iota (std::begin (functions), std::end (functions), 0U);
+        std::sort (std::begin (functions), std::end (functions), [] (const unsigned int a, const unsigned int b)
+        {
+            return tglInstrumentCallTime (a) > tglInstrumentCallTime (b);
+        });
+
+        for (size_t i { 0 }; i < std::min (functions.size(), size_t { 5 }); ++i)
+        {
+            const auto function = functions[i];
+
+            if (tglInstrumentCallCount (function) > 0)
+            {
+                std::cout << "    " << tglInstrumentFunctionName (function) << ": " << tglInstrumentCallCount (function)
+                    << " calls, " << tglInstrumentCallTime (function) << "ms" << std::endl;
+            }
+        }
+
+        std::cout << std::endl;
+#endif
+
+        // Break the GPU time down by pass, skipping any which haven't been executed.
+        for (size_t i { 0 }; i < PassTimer::passCount; ++i)
+        {
+            const auto pass         = static_cast<PassTimer::Pass> (i);
+            const auto statistics   = m_renderer.getPassStatistics (pass);
+
+            if (statistics.samples > 0)
+            {
+                std::cout << PassTimer::getName (pass) << ": " 
+                    << "mean " << statistics.mean << "ms, p95 " << statistics.p95 << "ms, p99 " << statistics.p99 
+                    << "ms, max " << statistics.max << "ms" << std::endl;
+            }
+        }
+
+        std::cout << std::endl;
+
+        // Show the work each pass gave the GPU, these are all zero if pipeline statistics aren't supported.
+        using Statistic = PipelineStatistics::Statistic;
+        const auto& frameCounts = m_renderer.getPipelineStatistics (PassTimer::Pass::Frame);
+
+        if (frameCounts[static_cast<size_t> (Statistic::PrimitivesSubmitted)] > 0)
+        {
+            const auto& resolution  = m_renderer.getResolution();
+            const auto pixels       = static_cast<double> (resolution.renderWidth) * resolution.renderHeight;
+
+            for (size_t i { 0 }; i < PassTimer::passCount; ++i)
+            {
+                const auto pass     = static_cast<PassTimer::Pass> (i);
+                const auto& counts  = m_renderer.getPipelineStatistics (pass);
+                const auto vertices = counts[static_cast<size_t> (Statistic::VertexShaderInvocations)];
+                const auto clipIn   = counts[static_cast<size_t> (Statistic::ClippingInputPrimitives)];
+                const auto clipOut  = counts[static_cast<size_t> (Statistic::ClippingOutputPrimitives)];
+                const auto frags    = counts[static_cast<size_t> (Statistic::FragmentShaderInvocations)];
+
+                if (vertices > 0 || frags > 0)
+                {
+                    // Fragments per pixel show overdraw and light coverage, clipping ratios show how much was culled.
+                    std::cout << PassTimer::getName (pass) << ": " << vertices << " vertices, "
+                        << counts[static_cast<size_t> (Statistic::PrimitivesSubmitted)] << " primitives, "
+                        << clipOut << "/" << clipIn << " clipped primitives, " << frags << " fragments ("
+                        << (pixels > 0.0 ? frags / pixels : 0.0) << " per pixel)" << std::endl;
+                }
+            }
+
+            std::cout << std::endl;
+        }
+
         m_lastFPSDisplay = now;
     }
 }
\ No newline at end of file
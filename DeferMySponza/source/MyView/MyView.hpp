@@ -50,11 +50,26 @@ class MyView final : public tygra::WindowViewDelegate
         /// <summary> Sets the quality setting of the antialiasing to be performed. </summary>
         void setAntiAliasingMode (SMAA::Quality quality) noexcept;
 
+        /// <summary> Toggles whether the deferred passes measure overdraw and light complexity. </summary>
+        void toggleComplexityMode() noexcept;
+
+        /// <summary> Toggles whether lighting uses the specialised lighting permutations or subroutines. </summary>
+        void toggleLightingMode() noexcept;
+
+        /// <summary> Switches to the next shadow filter, only the lighting permutations use it. </summary>
+        void cycleShadowFilter() noexcept;
+
+        /// <summary> Toggles whether the render resolution adapts so the GPU frame time meets the frame budget. </summary>
+        void toggleDynamicResolution() noexcept;
+
         /// <summary> Sets the internal resolution of the renderer, independent of the display window. </summary>
         void setInternalResolution (int width, int height) noexcept;
 
         /// <summary> Toggles the display of frame timings. </summary>
         void toggleFPSDisplay () noexcept { m_displayFPS = !m_displayFPS; }
+
+        /// <summary> Writes the frame time histograms and detected stutters to frametimes.json. </summary>
+        void exportFrameTimings() const noexcept;
 		
     private:
 
@@ -67,6 +82,7 @@ class MyView final : public tygra::WindowViewDelegate
         Time            m_lastFPSDisplay    { };            //!< When the FPS was last displayed.
         int             m_displayWidth      { 640 };        //!< The amount of pixels wide for the display resolution.
         int             m_displayHeight     { 480 };        //!< The amount of pixels tall for the display resolution.
+        GLuint          m_reportedStutters  { 0 };          //!< How many stutters have been logged to the console.
 
     private:
 		
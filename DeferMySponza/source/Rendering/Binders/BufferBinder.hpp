@@ -5,6 +5,7 @@
 
 // Personal headers.
 #include <Rendering/Objects/Buffer.hpp>
+#include <Rendering/State/StateCache.hpp>
 
 
 /// <summary>
@@ -32,17 +33,17 @@ struct BufferBinder final
 
     static inline void bind (const Buffer& buffer) noexcept
     {
-        glBindBuffer (Target, buffer.getID());
+        StateCache::bindBuffer (Target, buffer.getID());
     }
 
     static inline void bind (const GLuint buffer) noexcept
     {
-        glBindBuffer (Target, buffer);
+        StateCache::bindBuffer (Target, buffer);
     }
 
     static inline void unbind() noexcept
     {
-        glBindBuffer (Target, 0);
+        StateCache::bindBuffer (Target, 0);
     }
 };
 
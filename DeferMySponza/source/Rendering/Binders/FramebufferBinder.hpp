@@ -5,6 +5,7 @@
 
 // Personal headers.
 #include <Rendering/Objects/Framebuffer.hpp>
+#include <Rendering/State/StateCache.hpp>
 
 
 /// <summary>
@@ -35,17 +36,17 @@ struct FramebufferBinder final
 
     static inline void bind (const Framebuffer& buffer) noexcept
     {
-        glBindFramebuffer (Target, buffer.getID());
+        StateCache::bindFramebuffer (Target, buffer.getID());
     }
 
     static inline void bind (const GLuint buffer) noexcept
     {
-        glBindFramebuffer (Target, buffer);
+        StateCache::bindFramebuffer (Target, buffer);
     }
 
     static inline void unbind() noexcept
     {
-        glBindFramebuffer (Target, 0);
+        StateCache::bindFramebuffer (Target, 0);
     }
 };
 
@@ -5,6 +5,7 @@
 
 // Personal headers.
 #include <Rendering/Objects/Program.hpp>
+#include <Rendering/State/StateCache.hpp>
 
 
 /// <summary>
@@ -31,17 +32,17 @@ struct ProgramBinder final
 
     static inline void bind (const Program& program) noexcept
     {
-        glUseProgram (program.getID());
+        StateCache::useProgram (program.getID());
     }
 
     static inline void bind (const GLuint program) noexcept
     {
-        glUseProgram (program);
+        StateCache::useProgram (program);
     }
 
     static inline void unbind() noexcept
     {
-        glUseProgram (0);
+        StateCache::useProgram (0);
     }
 };
 
@@ -5,6 +5,7 @@
 
 // Personal headers.
 #include <Rendering/Objects/Renderbuffer.hpp>
+#include <Rendering/State/StateCache.hpp>
 
 
 /// <summary>
@@ -34,17 +35,17 @@ struct RenderbufferBinder final
 
     static inline void bind (const Renderbuffer& buffer) noexcept
     {
-        glBindRenderbuffer (Target, buffer.getID());
+        StateCache::bindRenderbuffer (buffer.getID());
     }
 
     static inline void bind (const GLuint buffer) noexcept
     {
-        glBindRenderbuffer (Target, buffer);
+        StateCache::bindRenderbuffer (buffer);
     }
 
     static inline void unbind() noexcept
     {
-        glBindRenderbuffer (Target, 0);
+        StateCache::bindRenderbuffer (0);
     }
 };
 
@@ -5,6 +5,7 @@
 
 // Personal headers.
 #include <Rendering/Objects/Texture.hpp>
+#include <Rendering/State/StateCache.hpp>
 
 
 /// <summary>
@@ -50,16 +51,12 @@ struct TextureBinder final
 
     inline void bind (const GLuint texture) const noexcept
     {
-        glBindTextureUnit (m_unit, texture);
+        StateCache::bindTextureUnit (m_unit, texture);
     }
 
     inline void unbind() const noexcept
     {
-        // Nvidia drivers claim giving the value 0 to this function is invalid. The OpenGL spec disagrees, still we
-        // must use the old method because the target hardware is an Nvidia card.
-        //glBindTextureUnit (m_unit, 0);
-
-        glBindTextures (m_unit, 1, 0);
+        StateCache::bindTextureUnit (m_unit, 0);
     }
 
     inline GLuint getTextureUnit() const noexcept 
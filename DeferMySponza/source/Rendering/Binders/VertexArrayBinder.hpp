@@ -5,6 +5,7 @@
 
 // Personal headers.
 #include <Rendering/Objects/VertexArray.hpp>
+#include <Rendering/State/StateCache.hpp>
 
 
 /// <summary>
@@ -31,17 +32,17 @@ struct VertexArrayBinder final
 
     static inline void bind (const VertexArray& array) noexcept
     {
-        glBindVertexArray (array.getID());
+        StateCache::bindVertexArray (array.getID());
     }
 
     static inline void bind (const GLuint array) noexcept
     {
-        glBindVertexArray (array);
+        StateCache::bindVertexArray (array);
     }
 
     static inline void unbind() noexcept
     {
-        glBindVertexArray (0);
+        StateCache::bindVertexArray (0);
     }
 };
 
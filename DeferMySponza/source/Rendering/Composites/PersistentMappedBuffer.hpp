@@ -70,6 +70,19 @@ class PersistentMappedBuffer final
 
         /// <summary> Gets the size of the buffer in bytes. </summary>
         inline GLsizeiptr getSize() const noexcept        { return m_size; }
+
+        /// <summary> Gets how many bytes have been reported as modified since the counters were last reset. </summary>
+        inline GLsizeiptr getBytesModified() const noexcept { return m_bytesModified; }
+
+        /// <summary> Gets how many ranges have been explicitly flushed since the counters were last reset. </summary>
+        inline GLuint getRangesFlushed() const noexcept     { return m_rangesFlushed; }
+
+        /// <summary> Resets the modified byte and flushed range counters, useful for gathering per-frame statistics. </summary>
+        inline void resetModificationCounters() noexcept
+        {
+            m_bytesModified = 0;
+            m_rangesFlushed = 0;
+        }
         
 
         /// <summary> 
@@ -160,6 +173,9 @@ class PersistentMappedBuffer final
         GLsizeiptr  m_size      { 0 };          //!< How large the buffer is.
         bool        m_flushable { false };      //!< If the PMB is not coherent but is writable we need to support flushing.
 
+        GLsizeiptr  m_bytesModified { 0 };      //!< How many bytes have been reported as modified.
+        GLuint      m_rangesFlushed { 0 };      //!< How many modified ranges have been flushed to the GPU.
+
     private:
         
         /// <summary> Gets the necessary map buffer access flags for the given access rights. </summary>
@@ -197,9 +213,13 @@ PersistentMappedBuffer<Partitions>& PersistentMappedBuffer<Partitions>::operator
         m_size      = move.m_size;
         m_flushable = move.m_flushable;
 
+        m_bytesModified = move.m_bytesModified;
+        m_rangesFlushed = move.m_rangesFlushed;
+
         move.m_mapping      = nullptr;
         move.m_size         = 0U;
         move.m_flushable    = false;
+        move.resetModificationCounters();
     }
 
     return *this;
@@ -232,6 +252,7 @@ bool PersistentMappedBuffer<Partitions>::initialise (const GLintptr size, const
     // Next we can allocate the storage with the correct bits.
     const auto totalSize = size * Partitions;
     buffer.allocateImmutableStorage (totalSize, storageFlags);
+    MemoryTracker::partitionBuffer (buffer.getID(), static_cast<GLuint> (Partitions));
 
     // Ensure we can map the buffer.
     auto pointer = buffer.mapRange (0, totalSize, access);
@@ -281,6 +302,7 @@ bool PersistentMappedBuffer<Partitions>::initialise (const T& data, const bool r
 
     // Next we can fill the buffer with data.
     const auto size = buffer.immutablyFillWith (data, storageFlags);
+    MemoryTracker::partitionBuffer (buffer.getID(), static_cast<GLuint> (Partitions));
 
     // Check the size is valid.
     if (size % Partitions != 0 || size == 0)
@@ -322,6 +344,7 @@ void PersistentMappedBuffer<Partitions>::clean() noexcept
         m_mapping   = nullptr;
         m_size      = 0U;
         m_flushable = false;
+        resetModificationCounters();
     }
 }
 
@@ -329,9 +352,12 @@ void PersistentMappedBuffer<Partitions>::clean() noexcept
 template <size_t Partitions>
 void PersistentMappedBuffer<Partitions>::notifyModifiedDataRange (const size_t partition, const ModifiedRange& range) noexcept
 {
+    m_bytesModified += range.length;
+
     if (m_flushable)
     {
         glFlushMappedNamedBufferRange (getID(), partitionOffset (partition) + range.offset, range.length);
+        ++m_rangesFlushed;
     }
 }
 
@@ -339,9 +365,12 @@ void PersistentMappedBuffer<Partitions>::notifyModifiedDataRange (const size_t p
 template <size_t Partitions>
 void PersistentMappedBuffer<Partitions>::notifyModifiedDataRange (ModifiedRange range) noexcept
 {
+    m_bytesModified += range.length;
+
     if (m_flushable)
     {
         glFlushMappedNamedBufferRange (getID(), range.offset, range.length);
+        ++m_rangesFlushed;
     }
 }
 
@@ -0,0 +1,296 @@
+#include "UploadService.hpp"
+
+
+// STL headers.
+#include <cstring>
+#include <utility>
+
+
+// Personal headers.
+#include <Rendering/Binders/BufferBinder.hpp>
+
+
+bool UploadService::initialise (const GLsizeiptr capacity) noexcept
+{
+    // Half of the ring must be aligned too, otherwise the largest reservations might never fit.
+    if (capacity <= 0 || capacity % (alignment * 2) != 0)
+    {
+        return false;
+    }
+
+    // The GPU only reads the ring and coherency means the writing threads never need to flush.
+    auto ring = PersistentMappedBuffer<1> { };
+
+    if (!ring.initialise (capacity, false, true))
+    {
+        return false;
+    }
+
+    clean();
+    m_ring  = std::move (ring);
+    m_owner = std::this_thread::get_id();
+
+    return true;
+}
+
+
+void UploadService::clean() noexcept
+{
+    if (!isInitialised())
+    {
+        return;
+    }
+
+    // Queued commands read from the ring, OpenGL keeps the ring alive until the GPU has finished with it.
+    pump();
+    m_ring.clean();
+
+    const std::lock_guard<std::mutex> lock { m_mutex };
+    m_commands.clear();
+    m_reservations.clear();
+    m_fences.clear();
+    m_first         = 1;
+    m_reserved      = 0;
+    m_freedBytes    = 0;
+    m_batch         = 0;
+    m_completed     = 0;
+    m_uploaded      = 0;
+}
+
+
+bool UploadService::uploadToBuffer (const Buffer& buffer, const GLintptr offset, const GLsizeiptr size,
+    const void* data) noexcept
+{
+    return writeToBuffer (buffer, offset, size, [=] (void* destination)
+    {
+        std::memcpy (destination, data, static_cast<size_t> (size));
+        return true;
+    });
+}
+
+
+bool UploadService::uploadToTexture (const Texture2DArray& texture, const TextureRegion& region,
+    const GLsizeiptr size, const void* texels) noexcept
+{
+    return writeToTexture (texture, region, size, [=] (void* destination)
+    {
+        std::memcpy (destination, texels, static_cast<size_t> (size));
+        return true;
+    });
+}
+
+
+void UploadService::pump() noexcept
+{
+    auto commands = Commands { };
+    {
+        const std::lock_guard<std::mutex> lock { m_mutex };
+        commands.swap (m_commands);
+    }
+
+    if (!commands.empty())
+    {
+        // Rows of arbitrary widths aren't guaranteed to be aligned.
+        glPixelStorei (GL_UNPACK_ALIGNMENT, 1);
+        {
+            const auto unpackBuffer = BufferBinder<GL_PIXEL_UNPACK_BUFFER> { m_ring.getBuffer() };
+
+            for (const auto& command : commands)
+            {
+                const auto& region = command.region;
+
+                if (!command.overflow.empty())
+                {
+                    continue;
+                }
+
+                if (command.buffer != 0)
+                {
+                    glCopyNamedBufferSubData (m_ring.getID(), command.buffer, command.source, command.offset,
+                        command.size);
+                }
+
+                else if (command.texture != 0)
+                {
+                    glTextureSubImage3D (command.texture, 0, region.x, region.y, region.layer, region.width,
+                        region.height, 1, region.format, region.type, reinterpret_cast<const void*> (command.source));
+                }
+            }
+        }
+
+        // Overflowing data is read from system memory so it's uploaded once the ring is no longer bound.
+        for (const auto& command : commands)
+        {
+            const auto& region = command.region;
+
+            if (command.overflow.empty())
+            {
+                continue;
+            }
+
+            if (command.buffer != 0)
+            {
+                glNamedBufferSubData (command.buffer, command.offset, command.size, command.overflow.data());
+            }
+
+            else if (command.texture != 0)
+            {
+                glTextureSubImage3D (command.texture, 0, region.x, region.y, region.layer, region.width,
+                    region.height, 1, region.format, region.type, command.overflow.data());
+            }
+        }
+
+        glPixelStorei (GL_UNPACK_ALIGNMENT, 4);
+
+        // The fence follows every copy in the batch, without one we have to wait for the GPU straight away.
+        auto fence = Sync { };
+
+        if (!fence.initialise())
+        {
+            glFinish();
+        }
+
+        const std::lock_guard<std::mutex> lock { m_mutex };
+        const auto batch = ++m_batch;
+
+        for (const auto& command : commands)
+        {
+            if (command.sequence != 0)
+            {
+                m_reservations[static_cast<size_t> (command.sequence - m_first)].batch = batch;
+            }
+
+            if (command.buffer != 0 || command.texture != 0)
+            {
+                m_uploaded += command.size;
+            }
+        }
+
+        if (fence.isInitialised())
+        {
+            m_fences.push_back ({ std::move (fence), batch });
+        }
+
+        else
+        {
+            m_fences.clear();
+            m_completed = batch;
+        }
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock { m_mutex };
+        retire();
+    }
+
+    m_freed.notify_all();
+}
+
+
+UploadService::Staging UploadService::reserve (const GLsizeiptr size) noexcept
+{
+    const auto capacity = static_cast<std::uint64_t> (m_ring.getSize());
+    const auto aligned  = static_cast<std::uint64_t> ((size + alignment - 1) / alignment * alignment);
+    const auto owner    = std::this_thread::get_id() == m_owner;
+
+    std::unique_lock<std::mutex> lock { m_mutex };
+
+    while (true)
+    {
+        // Reservations never wrap around the end of the ring, the remainder is skipped and freed along with them.
+        const auto position = m_reserved % capacity;
+        const auto skipped  = position + aligned > capacity ? capacity - position : 0;
+        const auto used     = m_reserved - m_freedBytes;
+
+        if (used + skipped + aligned <= capacity)
+        {
+            auto staging        = Staging { };
+            staging.offset      = static_cast<GLintptr> ((m_reserved + skipped) % capacity);
+            staging.pointer     = m_ring.pointer() + staging.offset;
+            staging.sequence    = m_first + m_reservations.size();
+
+            m_reserved += skipped + aligned;
+            m_reservations.push_back ({ m_reserved, 0 });
+
+            return staging;
+        }
+
+        // Nobody else can issue uploads or check fences so the owning thread must make progress itself.
+        if (owner)
+        {
+            lock.unlock();
+            pump();
+            waitForProgress();
+            lock.lock();
+        }
+
+        else
+        {
+            m_freed.wait (lock);
+        }
+    }
+}
+
+
+void UploadService::submit (Command&& command, const bool written) noexcept
+{
+    // Reservations are freed in order so failed writes are still queued, just without a destination.
+    if (!written)
+    {
+        if (command.sequence == 0)
+        {
+            return;
+        }
+
+        command.buffer  = 0;
+        command.texture = 0;
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock { m_mutex };
+        m_commands.push_back (std::move (command));
+    }
+
+    m_queued.notify_one();
+}
+
+
+void UploadService::retire() noexcept
+{
+    while (!m_fences.empty() && m_fences.front().sync.checkIfSignalled())
+    {
+        m_completed = m_fences.front().batch;
+        m_fences.pop_front();
+    }
+
+    // A reservation still being written holds back every reservation after it.
+    while (!m_reservations.empty() && m_reservations.front().batch != 0 &&
+        m_reservations.front().batch <= m_completed)
+    {
+        m_freedBytes = m_reservations.front().end;
+        m_reservations.pop_front();
+        ++m_first;
+    }
+}
+
+
+void UploadService::waitForProgress() noexcept
+{
+    constexpr auto timeout = std::chrono::milliseconds { 1 };
+
+    std::unique_lock<std::mutex> lock { m_mutex };
+
+    // Only this thread modifies the fences so the oldest one can be waited on without holding the lock.
+    if (!m_fences.empty())
+    {
+        const auto& oldest = m_fences.front().sync;
+        lock.unlock();
+
+        oldest.waitForSignal (true, static_cast<GLuint64> (std::chrono::nanoseconds { timeout }.count()));
+    }
+
+    else if (m_commands.empty())
+    {
+        m_queued.wait_for (lock, timeout);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,339 @@
+#pragma once
+
+#if !defined    _RENDERING_COMPOSITES_UPLOAD_SERVICE_
+#define         _RENDERING_COMPOSITES_UPLOAD_SERVICE_
+
+// STL headers.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+// Personal headers.
+#include <Rendering/Composites/PersistentMappedBuffer.hpp>
+#include <Rendering/Objects/Sync.hpp>
+#include <Rendering/Objects/Texture.hpp>
+
+
+/// <summary>
+/// Uploads buffer and texture data whilst it's still being loaded and decoded. Any thread can reserve space in a
+/// persistently mapped staging ring, write its data straight into the reservation and queue a copy. Only the thread
+/// which initialised the service talks to OpenGL, it issues glCopyNamedBufferSubData() or glTextureSubImage3D() from
+/// the ring and follows each batch with a fence. Space is reused once the fence of every copy before it has been
+/// signalled, threads which run out of space wait until then. Data larger than half of the ring is kept in system
+/// memory and uploaded directly instead.
+/// </summary>
+class UploadService final
+{
+    public:
+
+        constexpr static auto defaultCapacity   = GLsizeiptr { 64 * 1024 * 1024 };  //!< Fits two 2048x2048 RGBA layers, or one with 16-bit components.
+        constexpr static auto alignment         = GLsizeiptr { 16 };                //!< The alignment of every reservation, enough for any texel or vertex type.
+
+        /// <summary> Where texels are uploaded to in a texture array and the format they're staged in. </summary>
+        struct TextureRegion final
+        {
+            GLint   x       { 0 };  //!< The left edge of the region.
+            GLint   y       { 0 };  //!< The bottom edge of the region.
+            GLint   layer   { 0 };  //!< The layer of the array.
+            GLsizei width   { 0 };  //!< How many texels wide the region is.
+            GLsizei height  { 0 };  //!< How many texels tall the region is.
+            GLenum  format  { 0 };  //!< The format of the staged texels, e.g. GL_RGB.
+            GLenum  type    { 0 };  //!< The type of each staged component, e.g. GL_UNSIGNED_BYTE.
+        };
+
+    public:
+
+        UploadService() noexcept                        = default;
+        ~UploadService() { clean(); }
+
+        UploadService (UploadService&&)                 = delete;
+        UploadService& operator= (UploadService&&)      = delete;
+        UploadService (const UploadService&)            = delete;
+        UploadService& operator= (const UploadService&) = delete;
+
+
+        /// <summary> Check if the staging ring has been created. </summary>
+        bool isInitialised() const noexcept { return m_ring.isInitialised(); }
+
+        /// <summary> Gets how many bytes have been uploaded since the service was initialised. </summary>
+        GLsizeiptr getBytesUploaded() const noexcept { return m_uploaded; }
+
+
+        /// <summary>
+        /// Creates the staging ring, the calling thread becomes the only thread which issues OpenGL commands. Upon
+        /// failure the object will not be modified.
+        /// </summary>
+        /// <param name="capacity"> How many bytes the staging ring holds. </param>
+        /// <returns> Whether the ring was successfully created. </returns>
+        bool initialise (const GLsizeiptr capacity = defaultCapacity) noexcept;
+
+        /// <summary> Issues any queued uploads and then deletes the staging ring. </summary>
+        void clean() noexcept;
+
+
+        /// <summary>
+        /// Queues data to be copied into a buffer. This may be called from any thread, the buffer must have storage
+        /// and outlive the upload.
+        /// </summary>
+        /// <param name="buffer"> The buffer to copy the data into. </param>
+        /// <param name="offset"> How many bytes into the buffer the data should be written. </param>
+        /// <param name="size"> How many bytes will be written. </param>
+        /// <param name="write"> Writes the data to the given memory, returning whether it was successful. </param>
+        /// <returns> Whether the data was written and queued. </returns>
+        template <typename Writer>
+        bool writeToBuffer (const Buffer& buffer, const GLintptr offset, const GLsizeiptr size,
+            const Writer& write) noexcept;
+
+        /// <summary> Queues a copy of the given data to be copied into a buffer, see writeToBuffer(). </summary>
+        bool uploadToBuffer (const Buffer& buffer, const GLintptr offset, const GLsizeiptr size,
+            const void* data) noexcept;
+
+        /// <summary>
+        /// Queues texels to be placed in the first level of a texture array. This may be called from any thread, the
+        /// array must have storage and outlive the upload. Rows are tightly packed.
+        /// </summary>
+        /// <param name="texture"> The texture array to place the texels in. </param>
+        /// <param name="region"> Where the texels will be placed and the format they're written in. </param>
+        /// <param name="size"> How many bytes will be written. </param>
+        /// <param name="write"> Writes the texels to the given memory, returning whether it was successful. </param>
+        /// <returns> Whether the texels were written and queued. </returns>
+        template <typename Writer>
+        bool writeToTexture (const Texture2DArray& texture, const TextureRegion& region, const GLsizeiptr size,
+            const Writer& write) noexcept;
+
+        /// <summary> Queues a copy of the given texels to be placed in a texture array, see writeToTexture(). </summary>
+        bool uploadToTexture (const Texture2DArray& texture, const TextureRegion& region, const GLsizeiptr size,
+            const void* texels) noexcept;
+
+
+        /// <summary>
+        /// Runs the given task for every index from zero to count across worker threads. The calling thread must be
+        /// the thread which initialised the service, it takes part in the work and issues the queued uploads whilst
+        /// the workers run. Every upload is issued before returning.
+        /// </summary>
+        /// <param name="count"> How many times the task should be run. </param>
+        /// <param name="task"> Takes the index to process and returns whether it was successful. </param>
+        /// <returns> Whether every task was successful. </returns>
+        template <typename Task>
+        bool run (const size_t count, const Task& task) noexcept;
+
+        /// <summary>
+        /// Issues every queued upload and frees any space the GPU has finished with. This must only be called by the
+        /// thread which initialised the service.
+        /// </summary>
+        void pump() noexcept;
+
+    private:
+
+        /// <summary> A queued copy from the staging ring, or from system memory when the data didn't fit. </summary>
+        struct Command final
+        {
+            GLuint                      buffer      { 0 };  //!< The destination buffer, zero when uploading to a texture.
+            GLuint                      texture     { 0 };  //!< The destination texture array, zero when uploading to a buffer.
+            GLintptr                    offset      { 0 };  //!< How many bytes into the destination buffer to write.
+            TextureRegion               region      { };    //!< Where the texels are placed in the destination texture.
+            GLintptr                    source      { 0 };  //!< Where the data is stored in the staging ring.
+            GLsizeiptr                  size        { 0 };  //!< How many bytes are copied.
+            std::uint64_t               sequence    { 0 };  //!< The reservation which holds the data, zero for overflowing data.
+            std::vector<std::uint8_t>   overflow    { };    //!< Data which was too large for the ring.
+        };
+
+        /// <summary> Space in the ring which is being written or is waiting for the GPU to finish reading it. </summary>
+        struct Reservation final
+        {
+            std::uint64_t   end     { 0 };  //!< The total number of bytes reserved once the reservation is freed.
+            std::uint64_t   batch   { 0 };  //!< The batch which read the reservation, zero until it's issued.
+        };
+
+        /// <summary> Signalled once the GPU has finished reading the ring for every batch up to and including this one. </summary>
+        struct Fence final
+        {
+            Sync            sync    { };    //!< The fence following the batch.
+            std::uint64_t   batch   { 0 };  //!< The batch the fence follows.
+        };
+
+        /// <summary> Where data should be written for a reservation. </summary>
+        struct Staging final
+        {
+            GLbyte*         pointer     { nullptr };    //!< Where the data should be written.
+            GLintptr        offset      { 0 };          //!< The offset of the pointer in the ring.
+            std::uint64_t   sequence    { 0 };          //!< Identifies the reservation.
+        };
+
+        using Commands      = std::vector<Command>;
+        using Reservations  = std::deque<Reservation>;
+        using Fences        = std::deque<Fence>;
+
+        PersistentMappedBuffer<1>   m_ring          { };    //!< Data is written here by any thread and then copied by the GPU.
+        std::thread::id             m_owner         { };    //!< The only thread which may issue OpenGL commands.
+
+        std::mutex                  m_mutex         { };    //!< Guards every member below.
+        std::condition_variable     m_freed         { };    //!< Notified when space in the ring has been freed.
+        std::condition_variable     m_queued        { };    //!< Notified when a command has been queued.
+        Commands                    m_commands      { };    //!< Uploads waiting to be issued.
+        Reservations                m_reservations  { };    //!< Every reservation which hasn't been freed, in order.
+        Fences                      m_fences        { };    //!< Every fence which hasn't been signalled, in order.
+        std::uint64_t               m_first         { 1 };  //!< The sequence of the first reservation, sequences start at one.
+        std::uint64_t               m_reserved      { 0 };  //!< The total number of bytes which have been reserved.
+        std::uint64_t               m_freedBytes    { 0 };  //!< The total number of bytes which have been freed.
+        std::uint64_t               m_batch         { 0 };  //!< The most recently issued batch.
+        std::uint64_t               m_completed     { 0 };  //!< The most recent batch which the GPU has finished.
+        GLsizeiptr                  m_uploaded      { 0 };  //!< How many bytes have been uploaded.
+
+    private:
+
+        /// <summary> Checks whether data of the given size must be uploaded from system memory. </summary>
+        bool overflows (const GLsizeiptr size) const noexcept { return size > m_ring.getSize() / 2; }
+
+        /// <summary> Reserves contiguous space in the ring, waiting for the GPU if there isn't enough. </summary>
+        Staging reserve (const GLsizeiptr size) noexcept;
+
+        /// <summary>
+        /// Queues the given command, the command is discarded when the data couldn't be written but the reservation
+        /// will still be freed.
+        /// </summary>
+        void submit (Command&& command, const bool written) noexcept;
+
+        /// <summary> Stages data for the given command by writing it into the ring or system memory. </summary>
+        template <typename Writer>
+        bool stage (Command&& command, const Writer& write) noexcept;
+
+        /// <summary> Frees every reservation which the GPU has finished with. The mutex must be locked. </summary>
+        void retire() noexcept;
+
+        /// <summary> Blocks the owning thread until the GPU or a worker has made progress, or a short time passes. </summary>
+        void waitForProgress() noexcept;
+};
+
+
+template <typename Writer>
+bool UploadService::writeToBuffer (const Buffer& buffer, const GLintptr offset, const GLsizeiptr size,
+    const Writer& write) noexcept
+{
+    auto command    = Command { };
+    command.buffer  = buffer.getID();
+    command.offset  = offset;
+    command.size    = size;
+
+    return stage (std::move (command), write);
+}
+
+
+template <typename Writer>
+bool UploadService::writeToTexture (const Texture2DArray& texture, const TextureRegion& region,
+    const GLsizeiptr size, const Writer& write) noexcept
+{
+    auto command    = Command { };
+    command.texture = texture.getID();
+    command.region  = region;
+    command.size    = size;
+
+    return stage (std::move (command), write);
+}
+
+
+template <typename Writer>
+bool UploadService::stage (Command&& command, const Writer& write) noexcept
+{
+    if (command.size <= 0)
+    {
+        return command.size == 0;
+    }
+
+    // Huge uploads would leave too little room for everything else.
+    if (overflows (command.size))
+    {
+        try
+        {
+            command.overflow.resize (static_cast<size_t> (command.size));
+        }
+
+        catch (...)
+        {
+            return false;
+        }
+
+        const auto written = write (static_cast<void*> (command.overflow.data()));
+        submit (std::move (command), written);
+        return written;
+    }
+
+    const auto staging  = reserve (command.size);
+    command.source      = staging.offset;
+    command.sequence    = staging.sequence;
+
+    const auto written = write (static_cast<void*> (staging.pointer));
+    submit (std::move (command), written);
+    return written;
+}
+
+
+template <typename Task>
+bool UploadService::run (const size_t count, const Task& task) noexcept
+{
+    auto next       = std::atomic<size_t> { 0 };
+    auto succeeded  = std::atomic<bool> { true };
+
+    const auto work = [&] (const bool owner)
+    {
+        for (auto i = next++; i < count; i = next++)
+        {
+            if (!task (i))
+            {
+                succeeded = false;
+            }
+
+            // Uploads are issued between tasks so workers don't run out of space whilst this thread is busy.
+            if (owner)
+            {
+                pump();
+            }
+        }
+    };
+
+    // The calling thread counts as one of the workers.
+    const auto threads      = static_cast<size_t> (std::max (std::thread::hardware_concurrency(), 1U));
+    const auto workerCount  = count == 0 ? size_t { 0 } : std::min (threads, count) - 1;
+    auto workers            = std::vector<std::future<void>> { };
+    workers.reserve (workerCount);
+
+    try
+    {
+        for (size_t i { 0 }; i < workerCount; ++i)
+        {
+            workers.push_back (std::async (std::launch::async, work, false));
+        }
+    }
+
+    catch (...)
+    {
+        // Any tasks which the launched workers don't claim will be run by this thread.
+    }
+
+    work (true);
+
+    // Keep issuing uploads until every worker has finished.
+    const auto isRunning = [] (const std::future<void>& worker)
+    {
+        return worker.wait_for (std::chrono::seconds { 0 }) != std::future_status::ready;
+    };
+
+    while (std::any_of (std::begin (workers), std::end (workers), isRunning))
+    {
+        pump();
+        waitForProgress();
+    }
+
+    pump();
+    return succeeded;
+}
+
+#endif // _RENDERING_COMPOSITES_UPLOAD_SERVICE_
\ No newline at end of file
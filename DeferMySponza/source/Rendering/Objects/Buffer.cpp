@@ -5,6 +5,10 @@
 #include <utility>
 
 
+// Personal headers.
+#include <Rendering/State/StateCache.hpp>
+
+
 Buffer::Buffer (Buffer&& move) noexcept
 {
     *this = std::move (move);
@@ -51,6 +55,8 @@ void Buffer::clean() noexcept
     if (isInitialised())
     {
         glDeleteBuffers (1, &m_buffer);
+        StateCache::forgetBuffer (m_buffer);
+        MemoryTracker::release (MemoryTracker::Object::Buffer, m_buffer);
         m_buffer = 0U;
     }
 }
@@ -7,6 +7,10 @@
 #include <tgl/tgl.h>
 
 
+// Personal headers.
+#include <Rendering/State/MemoryTracker.hpp>
+
+
 /// <summary>
 /// Manages an OpenGL buffer. This is a general purpose RAII encapsulation with the expectation of being used in
 /// the composition of more complex object types.
@@ -58,6 +62,7 @@ class Buffer final
         void allocateImmutableStorage (const GLsizeiptr size, const GLbitfield flags = GL_DYNAMIC_STORAGE_BIT) noexcept
         {
             glNamedBufferStorage (m_buffer, size, nullptr, flags);
+            MemoryTracker::allocateBuffer (m_buffer, size);
         }
 
         /// <summary> 
@@ -76,6 +81,7 @@ class Buffer final
         {
             const auto size = data.size() * sizeof (Data);
             glNamedBufferStorage (m_buffer, size, data.data(), flags);
+            MemoryTracker::allocateBuffer (m_buffer, size);
             return size;
         }
 
@@ -87,6 +93,7 @@ class Buffer final
         GLsizeiptr immutablyFillWith (const Data* data, const GLbitfield flags = 0) noexcept
         {
             glNamedBufferStorage (m_buffer, sizeof (Data), data, flags);
+            MemoryTracker::allocateBuffer (m_buffer, sizeof (Data));
             return sizeof (Data);
         }
 
@@ -100,6 +107,7 @@ class Buffer final
         void allocateMutableStorage (const GLsizeiptr size, const GLenum usage) noexcept
         {
             glNamedBufferData (m_buffer, size, nullptr, usage);
+            MemoryTracker::allocateBuffer (m_buffer, size);
         }
 
         /// <summary> 
@@ -113,6 +121,7 @@ class Buffer final
         {
             const auto size = data.size() * sizeof (Data);
             glNamedBufferData (m_buffer, data.size() * sizeof (Data), data.data(), usage);
+            MemoryTracker::allocateBuffer (m_buffer, size);
             return size;
         }
 
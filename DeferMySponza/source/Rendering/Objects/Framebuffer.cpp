@@ -8,6 +8,7 @@
 // Personal headers.
 #include <Rendering/Objects/Renderbuffer.hpp>
 #include <Rendering/Objects/Texture.hpp>
+#include <Rendering/State/StateCache.hpp>
 
 
 Framebuffer::Framebuffer (Framebuffer&& move) noexcept
@@ -58,6 +59,7 @@ void Framebuffer::clean() noexcept
     if (isInitialised())
     {
         glDeleteFramebuffers (1, &m_buffer);
+        StateCache::forgetFramebuffer (m_buffer);
         m_buffer = 0U;
         m_drawBuffers.clear();
     }
@@ -2,7 +2,9 @@
 
 
 // STL headers.
+#include <algorithm>
 #include <iostream>
+#include <thread>
 #include <utility>
 
 
@@ -12,6 +14,8 @@
 
 // Personal headers.
 #include <Rendering/Objects/Shader.hpp>
+#include <Rendering/State/ProgramCache.hpp>
+#include <Rendering/State/StateCache.hpp>
 
 
 Program::Program (Program&& move) noexcept
@@ -28,7 +32,11 @@ Program& Program::operator= (Program&& move) noexcept
         clean();
 
         m_program       = move.m_program;
+        m_shaders       = std::move (move.m_shaders);
+        m_key           = move.m_key;
+        m_linking       = move.m_linking;
         move.m_program  = 0U;
+        move.m_linking  = false;
     }
 
     return *this;
@@ -59,31 +67,93 @@ void Program::clean() noexcept
     if (isInitialised())
     {            
         glDeleteProgram (m_program);
+        StateCache::forgetProgram (m_program);
         m_program = 0U;
     }
+
+    m_shaders.clear();
+    m_linking = false;
 }
 
 
-void Program::attachShader (const Shader& shader) const noexcept
+void Program::attachShader (const Shader& shader) noexcept
 {
     if (shader.isInitialised())
     {
         glAttachShader (m_program, shader.getID());
+        m_shaders.push_back (&shader);
     }
 }
 
 
-bool Program::link() const noexcept
+bool Program::isLinkComplete() const noexcept
+{
+    // Without the extension every query waits for the driver so there's nothing to gain from asking.
+    if (!m_linking || tglIsAvailable (TGL_EXTENSION_KHR_PARALLEL_SHADER_COMPILE) != GL_TRUE)
+    {
+        return true;
+    }
+
+    auto complete = GLint { GL_TRUE };
+    glGetProgramiv (m_program, GL_COMPLETION_STATUS_KHR, &complete);
+    return complete == GL_TRUE;
+}
+
+
+bool Program::link() noexcept
+{
+    beginLink();
+    return finishLink();
+}
+
+
+void Program::beginLink() noexcept
 {
-    // Attempt to link the program.
+    // A cached binary means nothing needs compiling at all.
+    m_key = ProgramCache::key (m_shaders);
+
+    if (ProgramCache::load (*this, m_key))
+    {
+        m_shaders.clear();
+        return;
+    }
+
+    // Shaders are shared between programs so they may have been submitted for a previous one.
+    for (const auto shader : m_shaders)
+    {
+        if (!shader->isSubmitted())
+        {
+            shader->submit();
+        }
+    }
+
+    // The binary is only retrievable if we ask for it before linking.
+    glProgramParameteri (m_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
     glLinkProgram (m_program);
+    m_linking = true;
+}
+
+
+bool Program::finishLink() noexcept
+{
+    // The shaders may not outlive this call so they're forgotten whatever happens.
+    auto shaders    = Shaders { };
+    const auto link = m_linking;
+    shaders.swap (m_shaders);
+    m_linking = false;
 
-    // Test the status for any errors.
+    // Test the status for any errors, this also covers programs loaded from the cache.
     auto linkStatus = GLint { 0 };
     glGetProgramiv (m_program, GL_LINK_STATUS, &linkStatus);
 
     if (linkStatus != GL_TRUE) 
     {
+        // Compilation errors are more useful than the link error they cause so they're output first.
+        for (const auto shader : shaders)
+        {
+            shader->compile();
+        }
+
         // Output error information.
         const auto stringLength = 1024U;
         GLchar log[stringLength];
@@ -94,5 +164,38 @@ bool Program::link() const noexcept
         return false;
     }
 
+    if (link)
+    {
+        ProgramCache::store (*this, m_key);
+    }
+
     return true;
 }
+
+
+bool Program::linkAll (const std::vector<Program*>& programs) noexcept
+{
+    std::for_each (std::begin (programs), std::end (programs), [] (Program* program) { program->beginLink(); });
+
+    // Binaries are written whilst the driver is still working on the remaining programs.
+    auto pending    = programs;
+    auto success    = true;
+
+    while (!pending.empty())
+    {
+        const auto complete = std::stable_partition (std::begin (pending), std::end (pending), 
+            [] (const Program* program) { return !program->isLinkComplete(); });
+
+        if (complete == std::end (pending))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::for_each (complete, std::end (pending), 
+            [&] (Program* program) { success = program->finishLink() && success; });
+        pending.erase (complete, std::end (pending));
+    }
+
+    return success;
+}
\ No newline at end of file
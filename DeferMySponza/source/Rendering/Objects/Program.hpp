@@ -3,8 +3,13 @@
 #if !defined    _RENDERING_PROGRAM_
 #define         _RENDERING_PROGRAM_
 
+// STL headers.
+#include <vector>
+
+
 // Personal headers.
 #include <Rendering/Objects/Shader.hpp>
+#include <Rendering/State/ProgramCache.hpp>
 
 
 /// <summary>
@@ -31,6 +36,12 @@ class Program final
         /// <summary> Gets the OpenGL ID of the stored program. </summary>
         inline GLuint getID() const noexcept        { return m_program; }
 
+        /// <summary> 
+        /// Checks whether the driver has finished linking without waiting for it. This is always true unless
+        /// GL_KHR_parallel_shader_compile is available, in which case finishLink() won't stall once it's true.
+        /// </summary>
+        bool isLinkComplete() const noexcept;
+
 
         /// <summary> 
         /// Attempt to initialise the program. Successive calls will delete the old program and create a new one.
@@ -43,16 +54,41 @@ class Program final
         /// <summary> Detaches all shaders and deletes each program. </summary>
         void clean() noexcept;
 
-        /// <summary> Attaches the given shader to the program. </summary>
-        void attachShader (const Shader& shader) const noexcept;
+        /// <summary> Attaches the given shader to the program, it must outlive the call to link(). </summary>
+        void attachShader (const Shader& shader) noexcept;
+
+        /// <summary> 
+        /// Attempts to link the program, created a fully compiled program. A binary from the program cache is used when
+        /// one matches the attached shaders, otherwise any uncompiled shaders are compiled and the result is cached.
+        /// </summary>
+        /// <returns> Whether the program could be linked. </returns>
+        bool link() noexcept;
+
+        /// <summary> 
+        /// Starts linking the program without waiting for the result. The attached shaders must outlive the call to
+        /// finishLink(), which must follow before the program is used.
+        /// </summary>
+        void beginLink() noexcept;
 
-        /// <summary> Attempts to link the program, created a fully compiled program. </summary>
+        /// <summary> Waits for linking to finish, reports any errors and caches the binary if successful. </summary>
         /// <returns> Whether the program could be linked. </returns>
-        bool link() const noexcept;
+        bool finishLink() noexcept;
+
+        /// <summary> 
+        /// Links every given program at once. Each is begun before any result is queried so the driver can compile and
+        /// link them concurrently, they're then finished in the order they complete.
+        /// </summary>
+        /// <returns> Whether every program could be linked. </returns>
+        static bool linkAll (const std::vector<Program*>& programs) noexcept;
 
     private:
 
-        GLuint m_program { 0 }; //!< The OpenGL ID representing a program. 0 means null.
+        using Shaders = std::vector<const Shader*>;
+
+        GLuint              m_program   { 0 };      //!< The OpenGL ID representing a program. 0 means null.
+        Shaders             m_shaders   { };        //!< The shaders attached since the program was last linked.
+        ProgramCache::Key   m_key       { 0 };      //!< Identifies the binary of the program being linked.
+        bool                m_linking   { false };  //!< Whether the driver is linking the attached shaders.
 };
 
 #endif // _RENDERING_PROGRAM_
\ No newline at end of file
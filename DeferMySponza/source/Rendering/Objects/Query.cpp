@@ -66,6 +66,20 @@ void Query::end() const noexcept
 }
 
 
+void Query::recordTimestamp() const noexcept
+{
+    glQueryCounter (m_query, GL_TIMESTAMP);
+}
+
+
+bool Query::isResultAvailable() const noexcept
+{
+    auto available = GLint { GL_FALSE };
+    glGetQueryObjectiv (m_query, GL_QUERY_RESULT_AVAILABLE, &available);
+    return available == GL_TRUE;
+}
+
+
 GLuint Query::resultAsUInt (const bool flushGPU) const noexcept
 {
     const auto param    = flushGPU ? GL_QUERY_RESULT : GL_QUERY_RESULT_NO_WAIT;
@@ -73,4 +87,14 @@ GLuint Query::resultAsUInt (const bool flushGPU) const noexcept
 
     glGetQueryObjectuiv (m_query, param, &result);
     return result;
+}
+
+
+GLuint64 Query::resultAsUInt64 (const bool flushGPU) const noexcept
+{
+    const auto param    = flushGPU ? GL_QUERY_RESULT : GL_QUERY_RESULT_NO_WAIT;
+    auto result         = GLuint64 { 0 };
+
+    glGetQueryObjectui64v (m_query, param, &result);
+    return result;
 }
\ No newline at end of file
@@ -51,10 +51,22 @@ class Query final
         /// <summary> Flags the query to end. </summary>
         void end() const noexcept;
 
+        /// <summary> 
+        /// Records the GPU time once every previous command has completed. Only valid for GL_TIMESTAMP queries.
+        /// </summary>
+        void recordTimestamp() const noexcept;
+
+        /// <summary> Checks if the result of the query can be retrieved without waiting for the GPU. </summary>
+        bool isResultAvailable() const noexcept;
+
         /// <summary> Retrieves the result of the query. </summary>
         /// <param name="flushGPU"> Whether the commands on the GPU should be flushed to force the result. </param>
         GLuint resultAsUInt (const bool flushGPU) const noexcept;
 
+        /// <summary> Retrieves the 64-bit result of the query, this is required for timestamps. </summary>
+        /// <param name="flushGPU"> Whether the commands on the GPU should be flushed to force the result. </param>
+        GLuint64 resultAsUInt64 (const bool flushGPU) const noexcept;
+
     private:
 
         GLuint m_query  { 0 };  //!< An OpenGL query object.
@@ -7,6 +7,7 @@
 
 // Personal headers.
 #include <Rendering/Binders/RenderbufferBinder.hpp>
+#include <Rendering/State/StateCache.hpp>
 
 
 Renderbuffer::Renderbuffer (Renderbuffer&& move) noexcept
@@ -54,6 +55,8 @@ void Renderbuffer::clean() noexcept
     if (isInitialised())
     {
         glDeleteRenderbuffers (1, &m_buffer);
+        StateCache::forgetRenderbuffer (m_buffer);
+        MemoryTracker::release (MemoryTracker::Object::Renderbuffer, m_buffer);
         m_buffer = 0U;
     }
 }
\ No newline at end of file
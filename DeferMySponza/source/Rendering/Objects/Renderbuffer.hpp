@@ -7,6 +7,10 @@
 #include <tgl/tgl.h>
 
 
+// Personal headers.
+#include <Rendering/State/MemoryTracker.hpp>
+
+
 /// <summary>
 /// An RAII encapsulation of an OpenGL renderbuffer object. It can be attached to framebuffer objects and drawn to.
 /// </summary>
@@ -62,6 +66,8 @@ class Renderbuffer final
             {
                 glNamedRenderbufferStorage (m_buffer, internalFormat, width, height);
             }
+
+            MemoryTracker::allocateRenderbuffer (m_buffer, internalFormat, width, height, samples);
         }
 
     private:
@@ -4,6 +4,8 @@
 // STL headers.
 #include <array>
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 
 
@@ -16,6 +18,22 @@
 #include <Utility/Algorithm.hpp>
 
 
+/// <summary> Source files read ahead of compilation by Shader::cacheSources(), keyed by their location. </summary>
+struct SourceCache final
+{
+    std::mutex                                      mutex   { };    //!< Files may be cached whilst others are attached.
+    std::unordered_map<std::string, std::string>    files   { };    //!< The text of each cached file.
+};
+
+
+/// <summary> Gets the cache shared by every shader. </summary>
+static SourceCache& sourceCache() noexcept
+{
+    static auto cache = SourceCache { };
+    return cache;
+}
+
+
 Shader::Shader (Shader&& move) noexcept
 {
     *this = std::move (move);
@@ -32,9 +50,11 @@ Shader& Shader::operator= (Shader&& move) noexcept
         m_shader    = move.m_shader;
         m_type      = move.m_type;
         m_source    = std::move (move.m_source);
+        m_submitted = move.m_submitted;
 
-        move.m_shader   = 0U;
-        move.m_type     = 0U;
+        move.m_shader       = 0U;
+        move.m_type         = 0U;
+        move.m_submitted    = false;
     }
 
     return *this;
@@ -71,14 +91,31 @@ void Shader::clean() noexcept
         m_source.clear();
         m_shader    = 0U;
         m_type      = 0U;
+        m_submitted = false;
     }
 }
 
 
 bool Shader::attachSource (const std::string& fileLocation) noexcept
 {
+    auto string = std::string { };
+    {
+        // Files are often shared between shaders so cached text is copied rather than moved.
+        auto& cache = sourceCache();
+        const std::lock_guard<std::mutex> lock { cache.mutex };
+        const auto file = cache.files.find (fileLocation);
+
+        if (file != std::end (cache.files))
+        {
+            string = file->second;
+        }
+    }
+
     // Use the tygra library to read the entire file.
-    auto string = tygra::createStringFromFile (fileLocation);
+    if (string.empty())
+    {
+        string = tygra::createStringFromFile (fileLocation);
+    }
     
     // Ensure it's valid.
     if (string.empty())
@@ -103,17 +140,52 @@ bool Shader::attachSource (RawSource source) noexcept
 }
 
 
-bool Shader::compile() noexcept
+void Shader::cacheSources (const std::vector<std::string>& fileLocations) noexcept
+{
+    for (const auto& fileLocation : fileLocations)
+    {
+        // The lock isn't held whilst reading so shaders can still be attached in the meantime.
+        auto string = tygra::createStringFromFile (fileLocation);
+
+        if (!string.empty())
+        {
+            auto& cache = sourceCache();
+            const std::lock_guard<std::mutex> lock { cache.mutex };
+            cache.files[fileLocation] = std::move (string);
+        }
+    }
+}
+
+
+void Shader::clearSourceCache() noexcept
+{
+    auto& cache = sourceCache();
+    const std::lock_guard<std::mutex> lock { cache.mutex };
+    cache.files.clear();
+}
+
+
+void Shader::submit() const noexcept
 {
     // Construct an array of strings for OpenGL to read from.
     auto strings = std::vector<const GLchar*> { };
     strings.reserve (m_source.size());
 
-    std::for_each (m_source, [&] (std::string& string) { strings.push_back (string.c_str()); });
+    std::for_each (m_source, [&] (const std::string& string) { strings.push_back (string.c_str()); });
 
-    // Attempt to compile the shader.
+    // Querying anything about the shader would wait for the compiler so that's left to compile().
     glShaderSource (m_shader, static_cast<GLsizei> (strings.size()), strings.data(), nullptr);
     glCompileShader (m_shader);
+    m_submitted = true;
+}
+
+
+bool Shader::compile() const noexcept
+{
+    if (!m_submitted)
+    {
+        submit();
+    }
 
     // Check whether compilation was successful.
     auto compileStatus = GLint { 0 };
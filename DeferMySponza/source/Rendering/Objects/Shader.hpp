@@ -50,6 +50,12 @@ class Shader final
         /// <summary> Gets the GLenum representing the type of the shader. </summary>
         inline GLenum getType() const noexcept      { return m_type; }
 
+        /// <summary> Gets every piece of source code attached to the shader, in the order they're compiled. </summary>
+        inline const std::vector<std::string>& getSource() const noexcept { return m_source; }
+
+        /// <summary> Checks whether the source has been handed to the driver, it may still be compiling. </summary>
+        inline bool isSubmitted() const noexcept    { return m_submitted; }
+
 
         /// <summary>
         /// Creates a blank, uncompiled shader. This will replace the currently stored shader unless initialisation
@@ -72,17 +78,38 @@ class Shader final
         /// <param name="source"> A string representation of some source code. </param>
         bool attachSource (RawSource source) noexcept;
 
-        /// <summary> Compile the shader as the given shader type with the attached source code files. </summary>
+        /// <summary> 
+        /// Reads the given files into a cache shared by every shader so attaching them later doesn't wait on the file
+        /// system. This doesn't touch OpenGL so it can run on any thread whilst other shaders are being compiled.
+        /// </summary>
+        /// <param name="fileLocations"> The location of every file which should be cached. </param>
+        static void cacheSources (const std::vector<std::string>& fileLocations) noexcept;
+
+        /// <summary> Discards every cached source file, later attachments will read from the file system again. </summary>
+        static void clearSourceCache() noexcept;
+
+        /// <summary> 
+        /// Hands the attached source code to the driver and returns without waiting for the result, drivers which
+        /// support GL_KHR_parallel_shader_compile compile on their own threads until the status is queried.
+        /// </summary>
+        void submit() const noexcept;
+
+        /// <summary> 
+        /// Compile the shader as the given shader type with the attached source code files. This may be deferred until
+        /// a program needs it, programs loaded from a binary never need their shaders compiling. A shader which has
+        /// already been submitted isn't compiled again, the result of the submission is checked instead.
+        /// </summary>
         /// <returns> Whether the shader was successfully compiled. </returns>
-        bool compile() noexcept;
+        bool compile() const noexcept;
 
     private:
 
         using Source = std::vector<std::string>;
 
-        GLuint m_shader { 0 };  //!< The OpenGL ID of a shader, 0 means null.
-        GLenum m_type   { 0 };  //!< Represents the type of shader, e.g. GL_VERTEX_SHADER.
-        Source m_source { };    //!< Contains each source file that will be used to compile the shader.
+        GLuint          m_shader    { 0 };      //!< The OpenGL ID of a shader, 0 means null.
+        GLenum          m_type      { 0 };      //!< Represents the type of shader, e.g. GL_VERTEX_SHADER.
+        Source          m_source    { };        //!< Contains each source file that will be used to compile the shader.
+        mutable bool    m_submitted { false };  //!< Whether compilation has been requested, it's shared by programs.
 };
 
 #endif // _RENDERING_SHADER_
\ No newline at end of file
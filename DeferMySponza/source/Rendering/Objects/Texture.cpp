@@ -5,6 +5,10 @@
 #include <utility>
 
 
+// Personal headers.
+#include <Rendering/State/StateCache.hpp>
+
+
 Texture::Texture (Texture&& move) noexcept
 {
     *this = std::move (move);
@@ -32,6 +36,8 @@ void Texture::clean() noexcept
     if (isInitialised())
     {
         glDeleteTextures (1, &m_texture);
+        StateCache::forgetTexture (m_texture);
+        MemoryTracker::release (MemoryTracker::Object::Texture, m_texture);
         m_texture   = 0U;
         m_unit      = 0U;
     }
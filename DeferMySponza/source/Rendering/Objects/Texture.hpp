@@ -7,6 +7,10 @@
 #include <tgl/tgl.h>
 
 
+// Personal headers.
+#include <Rendering/State/MemoryTracker.hpp>
+
+
 // Forward declarations.
 template <GLenum target>
 class TextureT;
@@ -119,6 +123,7 @@ class TextureT final : public Texture
             GLsizei levels = 1) noexcept
         {
             glTextureStorage2D (m_texture, levels, internalFormat, width, height);
+            MemoryTracker::allocateTexture (m_texture, Target, internalFormat, width, height, 1, levels);
         }
 
         /// <summary> 
@@ -135,6 +140,7 @@ class TextureT final : public Texture
             GLsizei levels = 1) noexcept
         {
             glTextureStorage3D (m_texture, levels, internalFormat, width, height, depth);
+            MemoryTracker::allocateTexture (m_texture, Target, internalFormat, width, height, depth, levels);
         }
 
         /// <summary> 
@@ -178,6 +184,28 @@ class TextureT final : public Texture
                 width, height, depth, pixelFormat, pixelType, pixelData);
         }
 
+        /// <summary>
+        /// Places pre-compressed data at the given location inside the texture. The offsets and sizes must be aligned
+        /// to the block size of the compressed format unless the region reaches the edge of the level.
+        /// </summary>
+        /// <param name="xOffset"> The number of texels to offset into the image on the X axis. </param>
+        /// <param name="yOffset"> The number of texels to offset into the image on the Y axis. </param>
+        /// <param name="zOffset"> The number of texels to offset into the image on the Z axis. </param>
+        /// <param name="width"> How many texels wide the data is. </param>
+        /// <param name="height"> How many texels tall the data is. </param>
+        /// <param name="depth"> How many texels deep the data is. </param>
+        /// <param name="compressedFormat"> The format the data is compressed with, this must match the storage. </param>
+        /// <param name="size"> How many bytes of compressed data are given. </param>
+        /// <param name="data"> The compressed blocks to upload to the allocated storage. </param>
+        /// <param name="level"> The mipmap level of the image to set the data for, 0 is the base image. </param>
+        template <typename = std::enable_if_t<Target == GL_TEXTURE_2D_ARRAY || Target == GL_TEXTURE_3D || Target == GL_TEXTURE_CUBE_MAP_ARRAY>>
+        void placeCompressedAt (GLint xOffset, GLint yOffset, GLint zOffset, GLsizei width, GLsizei height,
+            GLsizei depth, GLenum compressedFormat, GLsizei size, const GLvoid* data, GLsizei level = 0) noexcept
+        {
+            glCompressedTextureSubImage3D (m_texture, level, xOffset, yOffset, zOffset,
+                width, height, depth, compressedFormat, size, data);
+        }
+
         /// <summary> Tells OpenGL to generate mipmaps based on the data currently stored by the texture. </summary>
         template <typename = std::enable_if_t<Target == GL_TEXTURE_1D || Target == GL_TEXTURE_2D || Target == GL_TEXTURE_3D || Target == GL_TEXTURE_1D_ARRAY || Target == GL_TEXTURE_2D_ARRAY || Target == GL_TEXTURE_CUBE_MAP || Target == GL_TEXTURE_CUBE_MAP_ARRAY>>
         void generateMipmap() noexcept
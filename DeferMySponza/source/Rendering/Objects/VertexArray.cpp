@@ -7,6 +7,7 @@
 
 // Personal headers.
 #include <Rendering/Objects/Buffer.hpp>
+#include <Rendering/State/StateCache.hpp>
 
 
 VertexArray::VertexArray (VertexArray&& move) noexcept
@@ -55,6 +56,7 @@ void VertexArray::clean() noexcept
     if (isInitialised())
     {
         glDeleteVertexArrays (1, &m_array);
+        StateCache::forgetVertexArray (m_array);
         m_array = 0U;
     }
 }
@@ -0,0 +1,44 @@
+#include "DynamicResolution.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <cmath>
+
+
+void DynamicResolution::setSettings (const Settings& settings) noexcept
+{
+    m_settings              = settings;
+    m_settings.targetTime   = std::max (settings.targetTime, 0.1f);
+    m_settings.minimumScale = std::min (std::max (settings.minimumScale, 0.1f), 1.f);
+    reset();
+}
+
+
+void DynamicResolution::update (const float gpuTime, const float renderedScale) noexcept
+{
+    if (!m_settings.enabled || gpuTime <= 0.f || renderedScale <= 0.f)
+    {
+        return;
+    }
+
+    // Shaded pixels grow with the square of the scale so this is the scale which would have met the target. Each
+    // estimate uses the scale its frame was rendered at, so the latency of the timer queries doesn't compound.
+    const auto ideal    = std::min (std::max (renderedScale * std::sqrt (m_settings.targetTime / gpuTime),
+        m_settings.minimumScale), 1.f);
+    const auto change   = ideal - m_scale;
+
+    if (std::abs (change) < deadband)
+    {
+        return;
+    }
+
+    m_scale = change < 0.f ? ideal : m_scale + change * increaseRate;
+}
+
+
+GLsizei DynamicResolution::scale (const GLsizei dimension) const noexcept
+{
+    const auto scaled = static_cast<GLsizei> (std::lround (dimension * getScale()));
+    return std::min (std::max (scaled, 1), dimension);
+}
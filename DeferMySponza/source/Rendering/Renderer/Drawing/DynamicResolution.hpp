@@ -0,0 +1,67 @@
+#pragma once
+
+#if !defined    _RENDERING_RENDERER_DYNAMIC_RESOLUTION_
+#define         _RENDERING_RENDERER_DYNAMIC_RESOLUTION_
+
+// Engine headers.
+#include <tgl/tgl.h>
+
+
+/// <summary>
+/// Chooses how much of the internal resolution is rendered each frame so the GPU frame time meets a target. Render
+/// targets stay allocated at the internal resolution and only the viewport shrinks, so the scale can change every frame
+/// without reallocating anything. The cost of a frame is assumed to grow with the number of pixels shaded, so each
+/// measured frame gives an estimate of the scale which would have met the target. Reductions are applied immediately
+/// to absorb spikes whilst increases are damped to stop the scale oscillating around the target.
+/// </summary>
+class DynamicResolution final
+{
+    public:
+
+        /// <summary> Controls whether the scale adapts and what it aims for. </summary>
+        struct Settings final
+        {
+            bool    enabled         { false };  //!< Whether the scale adapts rather than rendering at full resolution.
+            float   targetTime      { 16.f };   //!< The GPU frame time to aim for (ms).
+            float   minimumScale    { 0.5f };   //!< The smallest fraction of each dimension which may be rendered.
+        };
+
+        DynamicResolution() noexcept                                        = default;
+        DynamicResolution (DynamicResolution&&) noexcept                    = default;
+        DynamicResolution (const DynamicResolution&) noexcept               = default;
+        DynamicResolution& operator= (const DynamicResolution&) noexcept    = default;
+        DynamicResolution& operator= (DynamicResolution&&) noexcept         = default;
+        ~DynamicResolution()                                                = default;
+
+
+        /// <summary> Gets the current settings. </summary>
+        const Settings& getSettings() const noexcept    { return m_settings; }
+
+        /// <summary> Gets the fraction of each dimension of the internal resolution to render next. </summary>
+        float getScale() const noexcept                 { return m_settings.enabled ? m_scale : 1.f; }
+
+
+        /// <summary> Applies the given settings, the scale restarts from the full internal resolution. </summary>
+        void setSettings (const Settings& settings) noexcept;
+
+        /// <summary> Returns to the full internal resolution. </summary>
+        void reset() noexcept { m_scale = 1.f; }
+
+        /// <summary> Chooses the scale of the next frame from the GPU time of a finished frame. </summary>
+        /// <param name="gpuTime"> How long the GPU took to render the finished frame (ms). </param>
+        /// <param name="renderedScale"> The scale the finished frame was rendered at. </param>
+        void update (const float gpuTime, const float renderedScale) noexcept;
+
+        /// <summary> Scales a dimension of the internal resolution, at least one pixel is always rendered. </summary>
+        GLsizei scale (const GLsizei dimension) const noexcept;
+
+    private:
+
+        constexpr static auto increaseRate  = 0.1f;     //!< How much of the way to a larger scale is moved each frame.
+        constexpr static auto deadband      = 0.01f;    //!< Smaller changes are ignored so the image doesn't shimmer.
+
+        Settings    m_settings  { };        //!< Whether the scale adapts and what it aims for.
+        float       m_scale     { 1.f };    //!< The fraction of each dimension to render next.
+};
+
+#endif // _RENDERING_RENDERER_DYNAMIC_RESOLUTION_
@@ -38,3 +38,26 @@ void LightBuffer::clean() noexcept
     m_fbo.clean();
     m_colour.clean();
 }
+
+
+void LightBuffer::replicateRegionBorder (const Resolution& resolution) const noexcept
+{
+    const auto colour   = m_colour.getID();
+    const auto width    = resolution.renderWidth;
+    const auto height   = resolution.renderHeight;
+    const auto column   = width < resolution.internalWidth;
+    const auto row      = height < resolution.internalHeight;
+
+    // The column is copied first so the row can carry the corner texel with it.
+    if (column)
+    {
+        glCopyImageSubData (colour, Texture2D::target, 0, width - 1, 0, 0, 
+            colour, Texture2D::target, 0, width, 0, 0, 1, height, 1);
+    }
+
+    if (row)
+    {
+        glCopyImageSubData (colour, Texture2D::target, 0, 0, height - 1, 0, 
+            colour, Texture2D::target, 0, 0, height, 0, column ? width + 1 : width, 1, 1);
+    }
+}
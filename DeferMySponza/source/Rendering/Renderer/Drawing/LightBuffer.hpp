@@ -6,6 +6,7 @@
 // Personal headers.
 #include <Rendering/Objects/Framebuffer.hpp>
 #include <Rendering/Objects/Texture.hpp>
+#include <Rendering/Renderer/Drawing/Resolution.hpp>
 
 
 /// <summary>
@@ -53,6 +54,13 @@ class LightBuffer final
         /// <summary> Deletes the Gbuffer, freeing memory to the GPU. </summary>
         void clean() noexcept;
 
+        /// <summary>
+        /// Copies the last column and row of the rendered region into the texels just beyond it. Linear filtering
+        /// reads those texels when the region is upscaled and they would otherwise hold stale colour from a previous,
+        /// larger region, which shows as a fringe along the right and top edges of the display.
+        /// </summary>
+        void replicateRegionBorder (const Resolution& resolution) const noexcept;
+
     private:
 
         Framebuffer     m_fbo       { };    //!< The drawable framebuffer.
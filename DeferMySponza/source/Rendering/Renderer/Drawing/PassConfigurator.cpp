@@ -1,27 +1,31 @@
 #include "PassConfigurator.hpp"
 
 
+// Personal headers.
+#include <Rendering/State/StateCache.hpp>
+
+
 void PassConfigurator::forwardRender() noexcept
 {
     // We need to perform the depth test and write the result to the buffer.
-    glEnable (GL_DEPTH_TEST);
-    glDepthMask (GL_TRUE);
-    glDepthFunc (GL_LEQUAL);
+    StateCache::enable (GL_DEPTH_TEST);
+    StateCache::depthMask (GL_TRUE);
+    StateCache::depthFunc (GL_LEQUAL);
 
     // We don't need the stencil test at all.
-    glDisable (GL_STENCIL_TEST);
+    StateCache::disable (GL_STENCIL_TEST);
 
     // We don't need blending at all.
-    glDisable (GL_BLEND);
-    glColorMask (GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    StateCache::disable (GL_BLEND);
+    StateCache::colorMask (GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 
     // Ensure we only draw the front faces of objects.
-    glEnable (GL_CULL_FACE);
-    glCullFace (GL_BACK);
+    StateCache::enable (GL_CULL_FACE);
+    StateCache::cullFace (GL_BACK);
 
     // Finally clear the frame.
-    glClearDepth (GLdouble { 1 });
-    glClearColor (0.f, 0.f, tyroneBlue, 0.f);
+    StateCache::clearDepth (GLdouble { 1 });
+    StateCache::clearColor (0.f, 0.f, tyroneBlue, 0.f);
     glClear (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 }
 
@@ -29,35 +33,35 @@ void PassConfigurator::forwardRender() noexcept
 void PassConfigurator::shadowMapPass() noexcept
 {
     // We need to perform the depth test and write the data.
-    glEnable (GL_DEPTH_TEST);
-    glDepthMask (GL_TRUE);
-    glDepthFunc (GL_LEQUAL);
-    glClearDepth (GLdouble { 1 });
+    StateCache::enable (GL_DEPTH_TEST);
+    StateCache::depthMask (GL_TRUE);
+    StateCache::depthFunc (GL_LEQUAL);
+    StateCache::clearDepth (GLdouble { 1 });
 
     // Cull the back faces of rendered geometry.
-    glEnable (GL_CULL_FACE);
-    glCullFace (GL_BACK);
+    StateCache::enable (GL_CULL_FACE);
+    StateCache::cullFace (GL_BACK);
 
     // We don't need anything else.
-    glDisable (GL_STENCIL_TEST);
-    glDisable (GL_BLEND);
-    glColorMask (GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    StateCache::disable (GL_STENCIL_TEST);
+    StateCache::disable (GL_BLEND);
+    StateCache::colorMask (GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
 }
 
 
 void PassConfigurator::geometryPass() noexcept
 {
     // Ensure we always draw.
-    glEnable (GL_STENCIL_TEST);
-    glStencilFunc (GL_ALWAYS, 0, ~0);
-    glStencilOp (GL_KEEP, GL_KEEP, GL_REPLACE);
+    StateCache::enable (GL_STENCIL_TEST);
+    StateCache::stencilFunc (GL_ALWAYS, 0, ~0);
+    StateCache::stencilOp (GL_KEEP, GL_KEEP, GL_REPLACE);
 
     // Disable blending but allow Gbuffer data to be written.
-    glDisable (GL_BLEND);
-    glColorMask (GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    StateCache::disable (GL_BLEND);
+    StateCache::colorMask (GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 
     // Clear the stored depth and stencil values.
-    glClearStencil (skyStencilValue);
+    StateCache::clearStencil (skyStencilValue);
     glClear (GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 }
 
@@ -65,15 +69,15 @@ void PassConfigurator::geometryPass() noexcept
 void PassConfigurator::globalLightPass() noexcept
 {
     // We don't need the depth test for global light.
-    glDisable (GL_DEPTH_TEST);
-    glDepthMask (GL_FALSE);
+    StateCache::disable (GL_DEPTH_TEST);
+    StateCache::depthMask (GL_FALSE);
 
     // We should ignore the background and only shade geometry.
-    glStencilFunc (GL_NOTEQUAL, skyStencilValue, ~0);
-    glStencilOp (GL_KEEP, GL_KEEP, GL_KEEP);
+    StateCache::stencilFunc (GL_NOTEQUAL, skyStencilValue, ~0);
+    StateCache::stencilOp (GL_KEEP, GL_KEEP, GL_KEEP);
 
     // Ensure we clear the previously stored colour data.
-    glClearColor (0.f, 0.f, tyroneBlue, 0.f);
+    StateCache::clearColor (0.f, 0.f, tyroneBlue, 0.f);
     glClear (GL_COLOR_BUFFER_BIT);
 }
 
@@ -81,14 +85,14 @@ void PassConfigurator::globalLightPass() noexcept
 void PassConfigurator::lightVolumePass() noexcept
 {
     // We need to enable the depth test again but keep writing false.
-    glEnable (GL_DEPTH_TEST);
-    glDepthFunc (GL_GREATER);
+    StateCache::enable (GL_DEPTH_TEST);
+    StateCache::depthFunc (GL_GREATER);
 
     // We need culling again for the light volumes.
-    glCullFace (GL_FRONT);
+    StateCache::cullFace (GL_FRONT);
 
     // We use blending to add the extra lighting to the scene.
-    glEnable (GL_BLEND);
-    glBlendFunc (GL_ONE, GL_ONE);
-    glBlendEquation (GL_FUNC_ADD);
+    StateCache::enable (GL_BLEND);
+    StateCache::blendFunc (GL_ONE, GL_ONE);
+    StateCache::blendEquation (GL_FUNC_ADD);
 }
\ No newline at end of file
@@ -7,7 +7,10 @@
 #include <tgl/tgl.h>
 
 
-/// <summary> Contains the internal and display resolution of the renderer. </summary>
+/// <summary>
+/// Contains the internal and display resolution of the renderer. The render resolution is the region of the internal
+/// buffers which is drawn to this frame, it only differs from the internal resolution when dynamic resolution is used.
+/// </summary>
 struct Resolution final
 {
     Resolution() noexcept                               = default;
@@ -21,6 +24,8 @@ struct Resolution final
     GLsizei internalHeight  { 0 };  //!< How many pixels tall the off-screen buffers should be.
     GLsizei displayWidth    { 0 };  //!< The target width of the display resolution.
     GLsizei displayHeight   { 0 };  //!< The target height of the display resolution.
+    GLsizei renderWidth     { 0 };  //!< How many pixels wide the region of the off-screen buffers drawn to is.
+    GLsizei renderHeight    { 0 };  //!< How many pixels tall the region of the off-screen buffers drawn to is.
 };
 
 #endif // _RENDERING_RENDERER_RESOLUTION
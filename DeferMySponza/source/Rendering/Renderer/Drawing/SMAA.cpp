@@ -1,6 +1,11 @@
 #include "SMAA.hpp"
 
 
+// STL headers.
+#include <algorithm>
+#include <vector>
+
+
 // Engine headers.
 #include <smaa/Textures/AreaTex.h>
 #include <smaa/Textures/SearchTex.h>
@@ -12,28 +17,27 @@
 #include <Rendering/Binders/TextureBinder.hpp>
 #include <Rendering/Binders/VertexArrayBinder.hpp>
 #include <Rendering/Renderer/Programs/HardCodedShaders.hpp>
+#include <Rendering/State/StateCache.hpp>
 
 
 bool SMAA::isInitialised() const noexcept
 {
-    return m_edgeDetectionPass.isInitialised() && m_edgeDetectionFBO.fbo.isInitialised() && 
-        m_edgeDetectionFBO.output.isInitialised() && m_weightingPass.isInitialised() && 
-        m_weightingFBO.fbo.isInitialised() && m_weightingFBO.output.isInitialised() &&
-        m_blendingPass.isInitialised() && m_areaTexture.isInitialised() && m_searchTexture.isInitialised() &&
+    const auto presetsInitialised = std::all_of (std::begin (m_presets), std::end (m_presets), 
+        [] (const Preset& preset)
+        {
+            return preset.edgeDetectionPass.isInitialised() && preset.weightingPass.isInitialised() && 
+                preset.blendingPass.isInitialised();
+        });
+
+    return presetsInitialised && m_edgeDetectionFBO.fbo.isInitialised() && 
+        m_edgeDetectionFBO.output.isInitialised() && m_weightingFBO.fbo.isInitialised() && 
+        m_weightingFBO.output.isInitialised() && m_areaTexture.isInitialised() && m_searchTexture.isInitialised() &&
         m_stencil.isInitialised();
 }
 
 
-bool SMAA::initialise (Quality quality, GLsizei width, GLsizei height, GLuint startingTextureUnit,
-    bool usePredication) noexcept
+bool SMAA::initialise (GLsizei width, GLsizei height, GLuint startingTextureUnit, bool usePredication) noexcept
 {
-    // Clean the object if no antialiasing is to be performed.
-    if (quality == Quality::None)
-    {
-        clean();   
-        return false;
-    }
-
     // Ensure the width and height are valid.
     if (width < 1 || height < 1)
     {
@@ -41,13 +45,18 @@ bool SMAA::initialise (Quality quality, GLsizei width, GLsizei height, GLuint st
     }
 
     // Create temporary objects.
-    decltype (m_edgeDetectionPass)  edgeProg, weightProg, blendProg;
+    decltype (m_presets)            presets;
     decltype (m_edgeDetectionFBO)   edgeFBO, weightFBO;
     decltype (m_areaTexture)        areaTex, searchTex, stencil;
 
+    const auto presetsInitialised = std::all_of (std::begin (presets), std::end (presets), [] (Preset& preset)
+    {
+        return preset.edgeDetectionPass.initialise() && preset.weightingPass.initialise() && 
+            preset.blendingPass.initialise();
+    });
+
     // Initialise objects.
-    if (!(edgeProg.initialise() && weightProg.initialise() && blendProg.initialise() &&
-        edgeFBO.fbo.initialise() && edgeFBO.output.initialise (startingTextureUnit) &&
+    if (!(presetsInitialised && edgeFBO.fbo.initialise() && edgeFBO.output.initialise (startingTextureUnit) &&
         weightFBO.fbo.initialise() && weightFBO.output.initialise (startingTextureUnit) &&
         areaTex.initialise (startingTextureUnit + 1), searchTex.initialise (startingTextureUnit + 2) &&
         stencil.initialise (startingTextureUnit)))
@@ -59,8 +68,7 @@ bool SMAA::initialise (Quality quality, GLsizei width, GLsizei height, GLuint st
     loadTextures (areaTex, searchTex);
 
     // Compile each program.
-    if (!compilePrograms (edgeProg, weightProg, blendProg, areaTex, searchTex, 
-        quality, width, height, startingTextureUnit, usePredication))
+    if (!linkPresets (presets, areaTex, searchTex, width, height, startingTextureUnit, usePredication))
     {
         return false;
     }
@@ -72,11 +80,9 @@ bool SMAA::initialise (Quality quality, GLsizei width, GLsizei height, GLuint st
     }
 
     // Finally make the temporary objects permanent.
-    m_edgeDetectionPass = std::move (edgeProg);
+    m_presets           = std::move (presets);
     m_edgeDetectionFBO  = std::move (edgeFBO);
-    m_weightingPass     = std::move (weightProg);
     m_weightingFBO      = std::move (weightFBO);
-    m_blendingPass      = std::move (blendProg);
     m_areaTexture       = std::move (areaTex);
     m_searchTexture     = std::move (searchTex);
     m_stencil           = std::move (stencil);
@@ -88,13 +94,17 @@ void SMAA::clean() noexcept
 {
     if (isInitialised())
     {
-        m_edgeDetectionPass.clean();
+        for (auto& preset : m_presets)
+        {
+            preset.edgeDetectionPass.clean();
+            preset.weightingPass.clean();
+            preset.blendingPass.clean();
+        }
+
         m_edgeDetectionFBO.fbo.clean();
         m_edgeDetectionFBO.output.clean();
-        m_weightingPass.clean();
         m_weightingFBO.fbo.clean();
         m_weightingFBO.output.clean();
-        m_blendingPass.clean();
         m_areaTexture.clean();
         m_searchTexture.clean();
         m_stencil.clean();
@@ -102,30 +112,49 @@ void SMAA::clean() noexcept
 }
 
 
-void SMAA::run (const FullScreenTriangleVAO& triangle, const Texture2D& aliasedTexture, 
-    const Texture2D* predication, const Framebuffer* output) noexcept
+void SMAA::run (Quality quality, const FullScreenTriangleVAO& triangle, const Texture2D& aliasedTexture, 
+    const Resolution& resolution, const Texture2D* predication, const Framebuffer* output) noexcept
 {   
+    if (quality == Quality::None)
+    {
+        return;
+    }
+
     // Perform the edge detection pass.
+    const auto& preset      = m_presets[presetIndex (quality)];
     const auto vaoBinder    = VertexArrayBinder { triangle.vao };
     const auto inputBinder  = TextureBinder { aliasedTexture };
-    const auto progBinder   = ProgramBinder { m_edgeDetectionPass };
+    const auto progBinder   = ProgramBinder { preset.edgeDetectionPass };
     const auto fboBinder    = FramebufferBinder<GL_FRAMEBUFFER> { m_edgeDetectionFBO.fbo };
 
     // Start by setting the program uniforms for the input. The input should always be bound to zero.
-    glProgramUniform1i (m_edgeDetectionPass.getID(), 0, inputBinder.getTextureUnit());
-    glProgramUniform1i (m_blendingPass.getID(), 0, inputBinder.getTextureUnit());
+    glProgramUniform1i (preset.edgeDetectionPass.getID(), 0, inputBinder.getTextureUnit());
+    glProgramUniform1i (preset.blendingPass.getID(), 0, inputBinder.getTextureUnit());
+
+    // Only the rendered region of the inputs is read so texture co-ordinates are scaled to cover it.
+    const auto scaleX = resolution.renderWidth / static_cast<GLfloat> (resolution.internalWidth);
+    const auto scaleY = resolution.renderHeight / static_cast<GLfloat> (resolution.internalHeight);
+    glProgramUniform2f (preset.edgeDetectionPass.getID(), scaleLocation, scaleX, scaleY);
+    glProgramUniform2f (preset.weightingPass.getID(), scaleLocation, scaleX, scaleY);
+    glProgramUniform2f (preset.blendingPass.getID(), scaleLocation, scaleX, scaleY);
+
+    // Upscaling samples between texel centres so the blending pass stays half a texel inside the region.
+    const auto limitX = scaleX - 0.5f / resolution.internalWidth;
+    const auto limitY = scaleY - 0.5f / resolution.internalHeight;
+    glProgramUniform2f (preset.blendingPass.getID(), limitLocation, limitX, limitY);
+    StateCache::viewport (0, 0, resolution.renderWidth, resolution.renderHeight);
     
     // Antialiasing only needs access to the stencil buffer.
-    glDisable (GL_DEPTH_TEST);
-    glDisable (GL_BLEND);
-    glCullFace (GL_BACK);
+    StateCache::disable (GL_DEPTH_TEST);
+    StateCache::disable (GL_BLEND);
+    StateCache::cullFace (GL_BACK);
 
-    glEnable (GL_STENCIL_TEST);
-    glStencilFunc (GL_ALWAYS, 1, ~0);
-    glStencilOp (GL_ZERO, GL_ZERO, GL_REPLACE);
+    StateCache::enable (GL_STENCIL_TEST);
+    StateCache::stencilFunc (GL_ALWAYS, 1, ~0);
+    StateCache::stencilOp (GL_ZERO, GL_ZERO, GL_REPLACE);
 
-    glClearColor (0.f, 0.f, 0.f, 0.f);
-    glClearStencil (0);
+    StateCache::clearColor (0.f, 0.f, 0.f, 0.f);
+    StateCache::clearStencil (0);
     glClear (GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 
     // Enable predication thresholding if necessary.
@@ -133,7 +162,7 @@ void SMAA::run (const FullScreenTriangleVAO& triangle, const Texture2D& aliasedT
     {
         // The predication buffer should always be in location 1.
         const auto binder = TextureBinder { *predication };
-        glProgramUniform1i (m_edgeDetectionPass.getID(), 1, binder.getTextureUnit());
+        glProgramUniform1i (preset.edgeDetectionPass.getID(), 1, binder.getTextureUnit());
         glDrawArrays (GL_TRIANGLES, 0, triangle.vertexCount);
     }
 
@@ -146,19 +175,19 @@ void SMAA::run (const FullScreenTriangleVAO& triangle, const Texture2D& aliasedT
     const auto resultBinder = TextureBinder { m_edgeDetectionFBO.output };
     const auto areaBinder   = TextureBinder { m_areaTexture };
     const auto searchBinder = TextureBinder { m_searchTexture };
-    progBinder.bind (m_weightingPass);
+    progBinder.bind (preset.weightingPass);
     fboBinder.bind (m_weightingFBO.fbo);
 
     // Here we only execute when the pixel is an edge.
-    glStencilFunc (GL_NOTEQUAL, 0, ~0);
-    glStencilOp (GL_KEEP, GL_KEEP, GL_KEEP);
+    StateCache::stencilFunc (GL_NOTEQUAL, 0, ~0);
+    StateCache::stencilOp (GL_KEEP, GL_KEEP, GL_KEEP);
 
     glClear (GL_COLOR_BUFFER_BIT);
     glDrawArrays (GL_TRIANGLES, 0, triangle.vertexCount);
 
     // Finally perform the blending pass.
     resultBinder.bind (m_weightingFBO.output);
-    progBinder.bind (m_blendingPass);
+    progBinder.bind (preset.blendingPass);
     
     if (output)
     {
@@ -170,7 +199,9 @@ void SMAA::run (const FullScreenTriangleVAO& triangle, const Texture2D& aliasedT
         fboBinder.unbind();
     }
 
-    glDisable (GL_STENCIL_TEST);
+    // The blending pass upscales the region as it writes to the output.
+    StateCache::disable (GL_STENCIL_TEST);
+    StateCache::viewport (0, 0, resolution.displayWidth, resolution.displayHeight);
     glDrawArrays (GL_TRIANGLES, 0, triangle.vertexCount);
 }
 
@@ -217,44 +248,79 @@ void SMAA::flipAndLoadTexture (Texture2D& texture, GLsizei width, GLsizei height
 }
 
 
-bool SMAA::compilePrograms (Program& edge, Program& weight, Program& blend, const Texture& areaTex, 
-    const Texture& searchTex, Quality quality, GLsizei width, GLsizei height, GLuint outputTextureUnit, 
-    bool usePredication) const noexcept
+size_t SMAA::presetIndex (Quality quality) noexcept
 {
-    // We need to compile shaders before we can link the programs together.
-    const auto shaders = compileShaders (calculateDefines (quality, width, height, usePredication));
+    switch (quality)
+    {
+        case Quality::Ultra:
+            return 3;
+        case Quality::High:
+            return 2;
+        case Quality::Medium:
+            return 1;
+        default:
+            return 0;
+    }
+}
 
-    // Attach the shaders.
-    edge.attachShader (shaders.find (edgeDetectionVS));
-    edge.attachShader (shaders.find (edgeDetectionFS));
-    weight.attachShader (shaders.find (blendingWeightVS));
-    weight.attachShader (shaders.find (blendingWeightFS));
-    blend.attachShader (shaders.find (neighborhoodBlendingVS));
-    blend.attachShader (shaders.find (neighborhoodBlendingFS));
+
+bool SMAA::linkPresets (Presets& presets, const Texture& areaTex, const Texture& searchTex, GLsizei width, 
+    GLsizei height, GLuint outputTextureUnit, bool usePredication) const noexcept
+{
+    // We need to load shaders before we can link the programs together, they must live until linking finishes.
+    constexpr Quality qualities[presetCount] = { Quality::Low, Quality::Medium, Quality::High, Quality::Ultra };
+    auto shaders    = std::array<Shaders, presetCount> { };
+    auto programs   = std::vector<Program*> { };
+
+    for (const auto quality : qualities)
+    {
+        const auto index    = presetIndex (quality);
+        auto& preset        = presets[index];
+        shaders[index]      = loadShaders (calculateDefines (quality, width, height, usePredication));
+
+        // Attach the shaders.
+        preset.edgeDetectionPass.attachShader (shaders[index].find (edgeDetectionVS));
+        preset.edgeDetectionPass.attachShader (shaders[index].find (edgeDetectionFS));
+        preset.weightingPass.attachShader (shaders[index].find (blendingWeightVS));
+        preset.weightingPass.attachShader (shaders[index].find (blendingWeightFS));
+        preset.blendingPass.attachShader (shaders[index].find (neighborhoodBlendingVS));
+        preset.blendingPass.attachShader (shaders[index].find (neighborhoodBlendingFS));
+
+        programs.push_back (&preset.edgeDetectionPass);
+        programs.push_back (&preset.weightingPass);
+        programs.push_back (&preset.blendingPass);
+    }
 
     // Ensure they all link together.
-    if (!(edge.link() && weight.link() && blend.link()))
+    if (!Program::linkAll (programs))
     {
         return false;
     }
 
-    // Attempt to find uniform locations for each texture.
-    const auto edgeResultLocation       = glGetUniformLocation (weight.getID(), "edgeDetectionResult");
-    const auto areaTextureLocation      = glGetUniformLocation (weight.getID(), "areaTexture");
-    const auto searchTextureLocation    = glGetUniformLocation (weight.getID(), "searchTexture");
-    const auto weightResultLocation     = glGetUniformLocation (blend.getID(), "blendWeightingResult");
-
-    // Use a fallback if necessary.
-    const auto edgeResultIndex      = edgeResultLocation != -1 ? edgeResultLocation : 0;
-    const auto areaTextureIndex     = areaTextureLocation != -1 ? areaTextureLocation : 1;
-    const auto searchTextureIndex   = searchTextureLocation != -1 ? searchTextureLocation : 2;
-    const auto weightResultIndex    = weightResultLocation != -1 ? weightResultLocation : 1;
+    for (const auto& preset : presets)
+    {
+        const auto& weight  = preset.weightingPass;
+        const auto& blend   = preset.blendingPass;
+
+        // Attempt to find uniform locations for each texture.
+        const auto edgeResultLocation       = glGetUniformLocation (weight.getID(), "edgeDetectionResult");
+        const auto areaTextureLocation      = glGetUniformLocation (weight.getID(), "areaTexture");
+        const auto searchTextureLocation    = glGetUniformLocation (weight.getID(), "searchTexture");
+        const auto weightResultLocation     = glGetUniformLocation (blend.getID(), "blendWeightingResult");
+
+        // Use a fallback if necessary.
+        const auto edgeResultIndex      = edgeResultLocation != -1 ? edgeResultLocation : 0;
+        const auto areaTextureIndex     = areaTextureLocation != -1 ? areaTextureLocation : 1;
+        const auto searchTextureIndex   = searchTextureLocation != -1 ? searchTextureLocation : 2;
+        const auto weightResultIndex    = weightResultLocation != -1 ? weightResultLocation : 1;
     
-    // Finish up and we're done!
-    glProgramUniform1i (weight.getID(), edgeResultIndex, outputTextureUnit);
-    glProgramUniform1i (weight.getID(), areaTextureIndex, areaTex.getDesiredTextureUnit());
-    glProgramUniform1i (weight.getID(), searchTextureIndex, searchTex.getDesiredTextureUnit());
-    glProgramUniform1i (blend.getID(), weightResultIndex, outputTextureUnit);
+        // Finish up and we're done!
+        glProgramUniform1i (weight.getID(), edgeResultIndex, outputTextureUnit);
+        glProgramUniform1i (weight.getID(), areaTextureIndex, areaTex.getDesiredTextureUnit());
+        glProgramUniform1i (weight.getID(), searchTextureIndex, searchTex.getDesiredTextureUnit());
+        glProgramUniform1i (blend.getID(), weightResultIndex, outputTextureUnit);
+    }
+
     return true;
 }
 
@@ -307,21 +373,21 @@ Shader::RawSource SMAA::calculateDefines (Quality quality, GLsizei width, GLsize
 }
 
 
-Shaders SMAA::compileShaders (Shader::RawSource extraDefines) const noexcept
+Shaders SMAA::loadShaders (Shader::RawSource extraDefines) const noexcept
 {
-    // We need to manually compile each shader.
+    // We need to manually load each shader, they're compiled when linking unless the programs are cached.
     auto shaders = Shaders { };
 
     // Start with the vertex shaders. Ensure we add the uber shader after every definition.
-    shaders.compile (GL_VERTEX_SHADER, edgeDetectionVS,         SMAAVSDefines, extraDefines, SMAAUberShader);
-    shaders.compile (GL_VERTEX_SHADER, blendingWeightVS,        SMAAVSDefines, extraDefines, SMAAUberShader);
-    shaders.compile (GL_VERTEX_SHADER, neighborhoodBlendingVS,  SMAAVSDefines, extraDefines, SMAAUberShader);
+    shaders.load (GL_VERTEX_SHADER, edgeDetectionVS,         SMAAVSDefines, extraDefines, SMAAUberShader);
+    shaders.load (GL_VERTEX_SHADER, blendingWeightVS,        SMAAVSDefines, extraDefines, SMAAUberShader);
+    shaders.load (GL_VERTEX_SHADER, neighborhoodBlendingVS,  SMAAVSDefines, extraDefines, SMAAUberShader);
 
-    // Now we can compile the fragment shaders.
-    shaders.compile (GL_FRAGMENT_SHADER, edgeDetectionFS,           SMAAFSDefines, extraDefines, SMAAUberShader);
-    shaders.compile (GL_FRAGMENT_SHADER, blendingWeightFS,          SMAAFSDefines, extraDefines, SMAAUberShader);
-    shaders.compile (GL_FRAGMENT_SHADER, neighborhoodBlendingFS,    SMAAFSDefines, extraDefines, SMAAUberShader);
+    // Now we can load the fragment shaders.
+    shaders.load (GL_FRAGMENT_SHADER, edgeDetectionFS,           SMAAFSDefines, extraDefines, SMAAUberShader);
+    shaders.load (GL_FRAGMENT_SHADER, blendingWeightFS,          SMAAFSDefines, extraDefines, SMAAUberShader);
+    shaders.load (GL_FRAGMENT_SHADER, neighborhoodBlendingFS,    SMAAFSDefines, extraDefines, SMAAUberShader);
 
-    // Finally return the compiled shaders.
+    // Finally return the loaded shaders.
     return shaders;
 }
\ No newline at end of file
@@ -3,10 +3,15 @@
 #if !defined    _RENDERING_RENDERER_DRAWING_SMAA_
 #define	        _RENDERING_RENDERER_DRAWING_SMAA_
 
+// STL headers.
+#include <array>
+
+
 // Personal headers.
 #include <Rendering/Objects/Framebuffer.hpp>
 #include <Rendering/Objects/Program.hpp>
 #include <Rendering/Objects/Texture.hpp>
+#include <Rendering/Renderer/Drawing/Resolution.hpp>
 #include <Rendering/Renderer/Geometry/FullScreenTriangleVAO.hpp>
 #include <Rendering/Renderer/Programs/Shaders.hpp>
 
@@ -29,6 +34,9 @@ class SMAA final
             Ultra   //!< 99% of the quality.
         };
 
+        constexpr static auto passCount     = 3U;   //!< How many full-screen passes are drawn when running.
+        constexpr static auto presetCount   = 4U;   //!< How many qualities have programs, Quality::None has none.
+
         SMAA() noexcept                         = default;
         SMAA (SMAA&&) noexcept                  = default;
         SMAA (const SMAA&) noexcept             = default;
@@ -40,33 +48,40 @@ class SMAA final
         bool isInitialised() const noexcept;
 
         /// <summary> 
-        /// Builds the shaders and textures required to perform subpixel morphological antialiasing. The object won't
-        /// be modified if initialisation fails.
+        /// Builds the shaders and textures required to perform subpixel morphological antialiasing. The programs of
+        /// every quality preset are linked at once so the quality can be changed without compiling anything. The
+        /// object won't be modified if initialisation fails.
         /// </summary>
-        /// <param name="quality"> 
-        /// The quality preset to use. If Quality::None is passed then the object will be cleaned and return false. 
-        /// </param>
         /// <param name="width"> How many pixels wide the internal render targets should be. </param>
         /// <param name="height"> How many pixels tall the internal render targets should be. </param>
         /// <param name="startingTextureUnit"> Initial texture unit for textures, requires three units. </param>
         /// <param name="usePredication"> Will a predication texture be provided when running? </param>
         /// <returns> Whether the initialisation was successful. </returns>
-        bool initialise (Quality quality, GLsizei width, GLsizei height, GLuint startingTextureUnit, 
+        bool initialise (GLsizei width, GLsizei height, GLuint startingTextureUnit, 
             bool usePredication = false) noexcept;
 
         /// <summary> Deletes every stored object. </summary>
         void clean() noexcept;
 
-        /// <summary> Performs subpixel morphological antialiasing on the given texture. </summary>
+        /// <summary> 
+        /// Performs subpixel morphological antialiasing on the rendered region of the given texture, the result is
+        /// upscaled to the display resolution by the final pass.
+        /// </summary>
+        /// <param name="quality"> The quality preset to use, nothing is drawn for Quality::None. </param>
         /// <param name="vao"> The vao containing a full-screen triangle. </param>
         /// <param name="aliasedTexture"> The input texture to antialias. </param>
+        /// <param name="resolution"> The size of the input textures, the region rendered to and the display. </param>
         /// <param name="predication"> A texture to be supplied for predicated thresholding. </param>
         /// <param name="output"> The framebuffer to output to, if null then the output will be the screen. </param>
-        void run (const FullScreenTriangleVAO& triangle, const Texture2D& aliasedTexture, 
-            const Texture2D* predication = nullptr, const Framebuffer* output = nullptr) noexcept;
+        void run (Quality quality, const FullScreenTriangleVAO& triangle, const Texture2D& aliasedTexture, 
+            const Resolution& resolution, const Texture2D* predication = nullptr, 
+            const Framebuffer* output = nullptr) noexcept;
 
     private:
 
+        constexpr static auto scaleLocation = GLint { 8 };  //!< The location of the texture scale in every vertex shader.
+        constexpr static auto limitLocation = GLint { 9 };  //!< The location of the co-ordinate limit of the blending pass.
+
         /// <summary> A framebuffer where each pass can be drawn into. </summary>
         struct RenderTarget final
         {
@@ -74,13 +89,19 @@ class SMAA final
             Texture2D   output  { };    //!< The texture to output data from a rendering pass to.
         };
         
-        Program         m_edgeDetectionPass { };    //!< The initial edge detection pass through the scene.
-        RenderTarget    m_edgeDetectionFBO  { };    //!< The render target for the edge detection pass.
+        /// <summary> The programs for each pass, compiled for a particular quality preset. </summary>
+        struct Preset final
+        {
+            Program edgeDetectionPass   { };    //!< The initial edge detection pass through the scene.
+            Program weightingPass       { };    //!< The second rendering pass which calculates blending weightings.
+            Program blendingPass        { };    //!< The final blending pass where the aliased edges are blurred.
+        };
 
-        Program         m_weightingPass     { };    //!< The second rendering pass which calculates blending weightings.
-        RenderTarget    m_weightingFBO      { };    //!< The render target for calculating blending weightings.
+        using Presets = std::array<Preset, presetCount>;
 
-        Program         m_blendingPass      { };    //!< The final blending pass where the aliased edges are blurred.
+        Presets         m_presets           { };    //!< The programs of every quality, indexed by presetIndex().
+        RenderTarget    m_edgeDetectionFBO  { };    //!< The render target for the edge detection pass.
+        RenderTarget    m_weightingFBO      { };    //!< The render target for calculating blending weightings.
 
         Texture2D       m_areaTexture       { };    //!< A precalculated texture required for blending.
         Texture2D       m_searchTexture     { };    //!< A precalculated texture required for blending.
@@ -97,10 +118,12 @@ class SMAA final
         void flipAndLoadTexture (Texture2D& texture, GLsizei width, GLsizei height, GLsizei pitch, GLsizei size, 
             GLenum pixelFormat, const GLubyte* pixels) const noexcept;
 
-        /// <summary> Attempts to compile the three required programs based on the given quality preset. </summary>
-        bool compilePrograms (Program& edge, Program& weight, Program& blend, const Texture& areaTex, 
-            const Texture& searchTex, Quality quality, GLsizei width, GLsizei height, 
-            GLuint outputTextureUnit, bool usePredication) const noexcept;
+        /// <summary> Gets the index of the preset for the given quality, Quality::None must not be given. </summary>
+        static size_t presetIndex (Quality quality) noexcept;
+
+        /// <summary> Attempts to link the three required programs for every quality preset at once. </summary>
+        bool linkPresets (Presets& presets, const Texture& areaTex, const Texture& searchTex, GLsizei width, 
+            GLsizei height, GLuint outputTextureUnit, bool usePredication) const noexcept;
 
         /// <summary> Allocates memory and configures each render target with the given parameters. </summary>
         bool configureRenderTargets (RenderTarget& edge, RenderTarget& weight, Texture2D& stencil,
@@ -114,9 +137,9 @@ class SMAA final
         Shader::RawSource calculateDefines (Quality quality, GLsizei width, GLsizei height, 
             bool usePredication) const noexcept;
 
-        /// <summary> Compiles the shaders required to perform SMAA. </summary>
+        /// <summary> Loads the shaders required to perform SMAA, they're compiled when the programs are linked. </summary>
         /// <param name="extraDefines"> Any additional defines that are determined at run-time. </param>
-        Shaders compileShaders (Shader::RawSource extraDefines) const noexcept;
+        Shaders loadShaders (Shader::RawSource extraDefines) const noexcept;
 };
 
 #endif // _RENDERING_RENDERER_DRAWING_SMAA_
@@ -7,6 +7,9 @@
 
 
 // Personal headers.
+#include <Rendering/Binders/ProgramBinder.hpp>
+#include <Rendering/Binders/TextureBinder.hpp>
+#include <Rendering/Objects/Program.hpp>
 #include <Utility/Scene.hpp>
 
 
@@ -29,7 +32,8 @@ bool ShadowMaps::isInitialised() const noexcept
 }
 
 
-bool ShadowMaps::initialise (const std::vector<scene::SpotLight>& spotlights, const GLuint textureUnit) noexcept
+bool ShadowMaps::initialise (const std::vector<scene::SpotLight>& spotlights, const GLuint textureUnit, 
+    const GLuint momentsTextureUnit) noexcept
 {
     // Create temporary objects.
     auto fbo    = decltype (m_fbo) { };
@@ -75,6 +79,49 @@ bool ShadowMaps::initialise (const std::vector<scene::SpotLight>& spotlights, co
     m_lights    = std::move (lights);
     m_ids       = std::move (ids);
     m_res       = resolution;
+
+    // The moments depend on the number of maps so they're prepared again when needed.
+    m_moments.clean();
+    m_blurred.clean();
+    m_momentsUnit = momentsTextureUnit;
+    return true;
+}
+
+
+bool ShadowMaps::prepareMoments() noexcept
+{
+    if (hasMoments())
+    {
+        return true;
+    }
+
+    // Create temporary objects.
+    auto moments    = decltype (m_moments) { };
+    auto blurred    = decltype (m_blurred) { };
+    const auto maps = getMapCount();
+
+    if (maps == 0 || !(moments.initialise (m_momentsUnit) && blurred.initialise (m_momentsUnit)))
+    {
+        return false;
+    }
+
+    // Every level is needed so surfaces far from the light can sample a wider region of the moments.
+    auto levels = GLsizei { 1 };
+    for (auto size = m_res; size > 1; size /= 2)
+    {
+        ++levels;
+    }
+
+    // Exponents large enough to remove most light bleeding would overflow half-precision floats.
+    moments.allocateImmutableStorage (GL_RGBA32F, m_res, m_res, maps, levels);
+    moments.setParameter (GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    moments.setParameter (GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    moments.setParameter (GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    moments.setParameter (GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    blurred.allocateImmutableStorage (GL_RGBA32F, m_res, m_res);
+
+    m_moments = std::move (moments);
+    m_blurred = std::move (blurred);
     return true;
 }
 
@@ -83,6 +130,8 @@ void ShadowMaps::clean() noexcept
 {
     m_fbo.clean();
     m_maps.clean();
+    m_moments.clean();
+    m_blurred.clean();
     m_lights.clear();
     m_ids.clear();
     m_res = 0;
@@ -132,4 +181,45 @@ ModifiedRange ShadowMaps::setUniforms (const scene::Context* scene, FullBlock<gl
 
     block->count = static_cast<GLuint> (shadowCasters);
     return { start, static_cast<GLsizei> (sizeof (block->count) + sizeof (glm::mat4x4) * currentIndex) };
-}
\ No newline at end of file
+}
+
+
+void ShadowMaps::generateMoments (const Program& warp, const Program& blur, const GLuint filterSize) noexcept
+{
+    assert (hasMoments());
+
+    // The depth is read directly so comparisons are disabled until every layer has been warped.
+    m_maps.setParameter (GL_TEXTURE_COMPARE_MODE, GL_NONE);
+
+    const auto depth    = TextureBinder { m_maps };
+    const auto radius   = static_cast<GLint> (filterSize / 2);
+    const auto groups   = static_cast<GLuint> ((m_res + workGroupSize - 1) / workGroupSize);
+    const auto mapCount = getMapCount();
+
+    for (GLint i { 0 }; i < mapCount; ++i)
+    {
+        ProgramBinder::bind (warp);
+        glUniform1i (0, radius);
+        glUniform1i (1, i);
+        glBindImageTexture (0, m_blurred.getID(), 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA32F);
+        glDispatchCompute (groups, groups, 1);
+        glMemoryBarrier (GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+
+        ProgramBinder::bind (blur);
+        glUniform1i (0, radius);
+        glBindImageTexture (0, m_blurred.getID(), 0, GL_FALSE, 0, GL_READ_ONLY, GL_RGBA32F);
+        glBindImageTexture (1, m_moments.getID(), 0, GL_FALSE, i, GL_WRITE_ONLY, GL_RGBA32F);
+        glDispatchCompute (groups, groups, 1);
+
+        // The next layer overwrites the horizontally blurred moments so they must have been read first.
+        glMemoryBarrier (GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+    }
+
+    glBindImageTexture (0, 0, 0, GL_FALSE, 0, GL_READ_ONLY, GL_RGBA32F);
+    glBindImageTexture (1, 0, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA32F);
+    m_maps.setParameter (GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+
+    // Mipmaps are built from the written images and then sampled by the lighting passes.
+    glMemoryBarrier (GL_TEXTURE_UPDATE_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT);
+    m_moments.generateMipmap();
+}
@@ -18,15 +18,31 @@
 #include <Rendering/Objects/Framebuffer.hpp>
 #include <Rendering/Objects/Texture.hpp>
 #include <Rendering/Renderer/Uniforms/Blocks/FullBlock.hpp>
+#include <Rendering/State/StateCache.hpp>
+
+
+// Forward declarations.
+class Program;
 
 
 /// <summary> 
-/// Stores and produces shadow maps for spotlights.
+/// Stores and produces shadow maps for spotlights. When exponential variance shadow mapping is used the moments of
+/// each map are also stored, these are only allocated once they're first needed as they're over five times larger.
 /// </summary>
 class ShadowMaps final
 {
     public:
 
+        /// <summary> How the edges of shadows are softened, each filter covers the same number of texels. </summary>
+        enum class Filter
+        {
+            PCF,    //!< Percentage-closer filtering with a bilinear comparison per tap.
+            Gather, //!< The same filter but four texels are compared by each gather.
+            EVSM    //!< Exponential variance shadow maps, blurred once per frame and sampled once with mipmapping.
+        };
+
+        constexpr static auto filterCount = 3U; //!< How many filters exist.
+
         ShadowMaps() noexcept { };
         ShadowMaps (ShadowMaps&&) noexcept;
         ShadowMaps (const ShadowMaps&) noexcept             = default;
@@ -44,10 +60,22 @@ class ShadowMaps final
 
         /// <summary> Gets the 2D array containing shadow maps. </summary>
         const Texture& getShadowMaps() const noexcept   { return m_maps; };
+
+        /// <summary> Returns the texture unit used for the moments of the shadow maps. </summary>
+        GLuint getMomentsTextureUnit() const noexcept   { return m_momentsUnit; }
+
+        /// <summary> Gets the 2D array containing the filtered moments of each shadow map, if prepared. </summary>
+        const Texture& getMoments() const noexcept      { return m_moments; }
+
+        /// <summary> Checks whether memory has been allocated for the moments of the shadow maps. </summary>
+        bool hasMoments() const noexcept                { return m_moments.isInitialised(); }
         
         /// <summary> Gets the resolution of the shadow maps. </summary>
         GLsizei getResolution() const noexcept          { return m_res; };
 
+        /// <summary> Gets how many shadow maps are rendered each time maps are generated. </summary>
+        GLsizei getMapCount() const noexcept            { return static_cast<GLsizei> (m_lights.size()); }
+
         /// <summary> Checkes if the object is initialised. </summary>
         bool isInitialised() const noexcept;
 
@@ -58,8 +86,17 @@ class ShadowMaps final
         /// </summary>
         /// <param name="spotlights"> A collection of spotlights to produce shadow maps for. </param>
         /// <param name="textureUnit"> The texture unit to use for storing shadow maps. </param>
+        /// <param name="momentsTextureUnit"> The texture unit to use for the moments, if they're prepared. </param>
         /// <returns> Whether initialisation was successful. </returns>
-        bool initialise (const std::vector<scene::SpotLight>& spotlights, const GLuint textureUnit) noexcept;
+        bool initialise (const std::vector<scene::SpotLight>& spotlights, const GLuint textureUnit, 
+            const GLuint momentsTextureUnit) noexcept;
+
+        /// <summary> 
+        /// Allocates a mipmapped RGBA32F array for the moments of every shadow map along with a single layer to blur 
+        /// into. This does nothing if the moments have already been prepared.
+        /// </summary>
+        /// <returns> Whether the moments can be generated. </returns>
+        bool prepareMoments() noexcept;
 
         /// <summary> Deletes every stored object. </summary>
         void clean() noexcept;
@@ -81,15 +118,28 @@ class ShadowMaps final
         template <typename RenderFunc>
         void generateMaps (const bool clearDepth, const RenderFunc& renderFunction) noexcept;
 
+        /// <summary>
+        /// Converts each shadow map into exponentially warped moments, blurs them with a separable box filter and
+        /// generates their mipmaps. The moments must have been prepared.
+        /// </summary>
+        /// <param name="warp"> A compute program which warps depth and blurs it horizontally. </param>
+        /// <param name="blur"> A compute program which blurs vertically into a layer of the moments. </param>
+        /// <param name="filterSize"> How many texels wide the box filter is, this should be odd. </param>
+        void generateMoments (const Program& warp, const Program& blur, const GLuint filterSize) noexcept;
+
     private:
 
         constexpr static auto maxResolution = 2048; //!< The maximum resolution of the shadow maps.
+        constexpr static auto workGroupSize = 16;   //!< Must match the local size of the moment compute shaders.
 
         using Spotlights    = std::vector<scene::LightId>;
         using MapIDs        = std::unordered_map<scene::LightId, GLint>;
 
         Framebuffer     m_fbo       { };    //!< A framebuffer containing a depth attachment to render with.
         Texture2DArray  m_maps      { };    //!< Contains every shadow map in the scene.
+        Texture2DArray  m_moments   { };    //!< Contains the filtered moments of every shadow map, if prepared.
+        Texture2D       m_blurred   { };    //!< Holds the horizontally blurred moments of a single shadow map.
+        GLuint          m_momentsUnit { 0 };//!< The texture unit the moments are bound to.
         Spotlights      m_lights    { };    //!< Contains every shadow-casting light in the scene.
         MapIDs          m_ids       { };    //!< Maps LightIDs to an index in the maps sampler for the shadow map.
         GLsizei         m_res       { 0 };  //!< The resolution of the shadow maps.
@@ -102,7 +152,7 @@ void ShadowMaps::generateMaps (const bool clearDepth, const RenderFunc& renderFu
     // We must go through each light, setting the index of the view matrix to use and render the scene.
     const auto fbo      = FramebufferBinder<GL_FRAMEBUFFER> { m_fbo };
     const auto mapCount = static_cast<GLint> (m_lights.size());
-    glViewport (0, 0, m_res, m_res);
+    StateCache::viewport (0, 0, m_res, m_res);
 
     for (GLint i { 0 }; i < mapCount; ++i)
     {
@@ -12,6 +12,7 @@
 
 
 // Personal headers.
+#include <Rendering/Composites/UploadService.hpp>
 #include <Rendering/Renderer/Geometry/Internals/Vertex.hpp>
 #include <Rendering/Renderer/Materials/Materials.hpp>
 #include <Rendering/Renderer/Types.hpp>
@@ -68,56 +69,81 @@ void Geometry::clean() noexcept
 }
 
 
-void Geometry::buildMeshData (Internals& internals) const noexcept
+Geometry::Preparation Geometry::prepare (const scene::Context& scene) noexcept
 {
     // Begin to construct the scene. We take a copy of the meshes data so we can sort it.
-    auto meshes = scene::GeometryBuilder().getAllMeshes();
+    auto prepared   = Preparation { };
+    auto& meshes    = prepared.meshes;
+    meshes          = scene::GeometryBuilder().getAllMeshes();
 
     // Ensure the meshes are sorted in order of their ID.
     std::sort (std::begin (meshes), std::end (meshes), 
         [] (const auto& a, const auto& b) { return a.getId() < b.getId(); });
 
-    // We'll need a temporary vectors to store the vertex and element data. 
-    auto vertices       = std::vector<Vertex> { };
-    auto elements       = std::vector<Element> { };
-    auto vertexCount    = size_t { 0 };
-    auto elementCount   = size_t { 0 };
+    // We need to know how much memory each buffer needs.
+    util::calculateSceneSize (meshes, prepared.vertexCount, prepared.elementCount);
+    prepared.placements.reserve (meshes.size());
 
-    // Start by allocating enough memory in each container to store the scene.
-    util::calculateSceneSize (meshes, vertexCount, elementCount);
-    internals.sceneMeshes.reserve (meshes.size());
-    vertices.reserve (vertexCount);
-    elements.reserve (elementCount);
-
-    // Iterate through each mesh adding the vertices, elements and mapping to their corresponding container.
+    // Every mesh is given its place in the buffers first so the vertices can be assembled on any thread.
     auto mesh           = Mesh { };
     auto vertexIndex    = GLuint { 0 };
     auto elementsIndex  = GLuint { 0 };
     
-	for (const auto& sceneMesh : meshes)
+    for (const auto& sceneMesh : meshes)
     {
-        // Retrieve the required mesh data.
-        const auto meshVertices     = util::assembleVertices (sceneMesh);
-        const auto& meshElements    = sceneMesh.getElementArray();
-        
         // Set the mesh parameters, the element offset must be a pointer type.
         mesh.verticesIndex  = vertexIndex;
         mesh.elementsIndex  = elementsIndex;
-        mesh.elementCount   = static_cast<GLuint> (meshElements.size());
+        mesh.elementCount   = static_cast<GLuint> (sceneMesh.getElementArray().size());
 
-        // Now we can add the mesh to the map and the vertices/elements to the vectors.
-        internals.sceneMeshes[sceneMesh.getId()] = mesh;
-        vertices.insert (std::end (vertices), std::begin (meshVertices), std::end (meshVertices));
-        elements.insert (std::end (elements), std::begin (meshElements), std::end (meshElements));
+        prepared.placements[sceneMesh.getId()] = mesh;
 
         // The vertexIndex needs an actual index value whereas elementOffset needs to be in bytes.
-        vertexIndex     += static_cast<GLuint> (meshVertices.size());
+        vertexIndex     += static_cast<GLuint> (sceneMesh.getPositionArray().size());
         elementsIndex   += mesh.elementCount;
     }
 
-    // Now we can fill the mesh and element buffer. We will leave them with no access flags so they can be static.
-    internals.buffers[internals.sceneVerticesIndex].immutablyFillWith (vertices);
-    internals.buffers[internals.sceneElementsIndex].immutablyFillWith (elements);
+    // Static instances are collated so static batching can draw each mesh with a single command.
+    for (const auto& instance : scene.getAllInstances())
+    {
+        if (instance.isStatic())
+        {
+            prepared.staticInstances[instance.getMeshId()].push_back (instance);
+        }
+    }
+
+    return prepared;
+}
+
+
+bool Geometry::buildMeshData (Internals& internals, UploadService& uploads, const Preparation& prepared) const noexcept
+{
+    // Each mesh was given its place whilst preparing so only the buffers need allocating.
+    const auto& meshes      = prepared.meshes;
+    internals.sceneMeshes   = prepared.placements;
+
+    // The data is copied in by the GPU so the buffers can be left without any access flags, keeping them static.
+    auto& vertices = internals.buffers[internals.sceneVerticesIndex];
+    auto& elements = internals.buffers[internals.sceneElementsIndex];
+    vertices.allocateImmutableStorage (static_cast<GLsizeiptr> (prepared.vertexCount * sizeof (Vertex)), 0);
+    elements.allocateImmutableStorage (static_cast<GLsizeiptr> (prepared.elementCount * sizeof (Element)), 0);
+
+    // Now each mesh can be assembled whilst the previous ones are uploaded.
+    return uploads.run (meshes.size(), [&] (const size_t index)
+    {
+        const auto& sceneMesh       = meshes[index];
+        const auto& placement       = internals.sceneMeshes.find (sceneMesh.getId())->second;
+        const auto meshVertices     = util::assembleVertices (sceneMesh);
+        const auto meshElements     = sceneMesh.getElementArray();
+
+        const auto vertexOffset     = static_cast<GLintptr> (placement.verticesIndex * sizeof (Vertex));
+        const auto elementOffset    = static_cast<GLintptr> (placement.elementsIndex * sizeof (Element));
+        const auto vertexSize       = static_cast<GLsizeiptr> (meshVertices.size() * sizeof (Vertex));
+        const auto elementSize      = static_cast<GLsizeiptr> (meshElements.size() * sizeof (Element));
+
+        return  uploads.uploadToBuffer (vertices, vertexOffset, vertexSize, meshVertices.data()) &&
+                uploads.uploadToBuffer (elements, elementOffset, elementSize, meshElements.data());
+    });
 }
 
 
@@ -178,8 +204,8 @@ void Geometry::buildLighting (Internals& internals, Mesh& quad, Mesh& sphere, Me
 }
 
 
-void Geometry::fillStaticBuffers (Internals& internals, DrawCommands& drawCommands, const Materials& materials,
-            const std::map<scene::MeshId, std::vector<scene::Instance>>& staticInstances) const noexcept
+bool Geometry::fillStaticBuffers (Internals& internals, UploadService& uploads, DrawCommands& drawCommands, 
+    const Materials& materials, const StaticInstances& staticInstances) const noexcept
 {
     // We'll need vectors to store each piece of data that needs buffering.
     auto commands       = std::vector<MultiDrawElementsIndirectCommand> { };
@@ -223,8 +249,19 @@ void Geometry::fillStaticBuffers (Internals& internals, DrawCommands& drawComman
     drawCommands.count      = static_cast<GLsizei> (commands.size());
     drawCommands.capacity   = drawCommands.count;
 
-    // Finally fill the buffers.
+    // Finally fill the buffers, the instance data is staged so it's copied alongside the mesh data.
+    auto& materialIDBuffer  = internals.buffers[internals.materialIDsIndex];
+    auto& transformBuffer   = internals.buffers[internals.transformsIndex];
+    const auto materialIDSize   = static_cast<GLsizeiptr> (materialIDs.size() * sizeof (MaterialID));
+    const auto transformSize    = static_cast<GLsizeiptr> (transforms.size() * sizeof (ModelTransform));
+
     drawCommands.buffer.immutablyFillWith (commands);
-    internals.buffers[internals.materialIDsIndex].immutablyFillWith (materialIDs);
-    internals.buffers[internals.transformsIndex].immutablyFillWith (transforms);
+    materialIDBuffer.allocateImmutableStorage (materialIDSize, 0);
+    transformBuffer.allocateImmutableStorage (transformSize, 0);
+
+    const auto uploaded =   uploads.uploadToBuffer (materialIDBuffer, 0, materialIDSize, materialIDs.data()) &&
+                            uploads.uploadToBuffer (transformBuffer, 0, transformSize, transforms.data());
+
+    uploads.pump();
+    return uploaded;
 }
\ No newline at end of file
@@ -12,6 +12,8 @@
 
 // Engine headers.
 #include <scene/scene_fwd.hpp>
+#include <scene/Instance.hpp>
+#include <scene/Mesh.hpp>
 
 
 // Personal headers.
@@ -25,6 +27,7 @@
 
 // Forward declarations.
 class Materials;
+class UploadService;
 
 
 /// <summary>
@@ -36,7 +39,18 @@ class Geometry final
     public:
 
         // Aliases.
-        using DrawCommands = MultiDrawCommands<Buffer>;
+        using DrawCommands      = MultiDrawCommands<Buffer>;
+        using StaticInstances   = std::map<scene::MeshId, std::vector<scene::Instance>>;
+
+        /// <summary> Everything initialise() needs from the scene, created by prepare() without touching OpenGL. </summary>
+        struct Preparation final
+        {
+            std::vector<scene::Mesh>                meshes          { };    //!< Every mesh in the scene in order of their ID.
+            std::unordered_map<scene::MeshId, Mesh> placements      { };    //!< Where each mesh will be stored in the buffers.
+            StaticInstances                         staticInstances { };    //!< Every static instance grouped by mesh.
+            size_t                                  vertexCount     { 0 };  //!< The total number of vertices in every mesh.
+            size_t                                  elementCount    { 0 };  //!< The total number of elements in every mesh.
+        };
 
     public:
 
@@ -87,21 +101,28 @@ class Geometry final
         inline const Mesh& getCone() const noexcept                             { return m_cone; }
 
 
+        /// <summary> 
+        /// Collects every mesh from scene::GeometryBuilder, assigns each its place in the buffers and groups the static
+        /// instances of the scene. This doesn't touch OpenGL so it may be called from any thread.
+        /// </summary>
+        /// <param name="scene"> Contains every instance in the scene. </param>
+        static Preparation prepare (const scene::Context& scene) noexcept;
+
         /// <summary> 
         /// Constructs geometry from scene::GeometryBuilder class as well and building the required shapes to perform
         /// deferred lighting. Along with this, VAOs within the scene are built and static object optimisation is
         /// performed by creating instancing buffers for static objects and by creating draw calls for indirect
         /// rendering. Successive calls will not change the object unless initialisation is successful.
         /// </summary>
+        /// <param name="uploads"> Uploads the mesh and instance data, every upload is issued before returning. </param>
         /// <param name="materials"> The object containing material information. </param>
-        /// <param name="staticInstances"> Contains every static instance which will be loaded into memory. </param> 
+        /// <param name="prepared"> The meshes and static instances collected by prepare(). </param>
         /// <param name="dynamicMaterialIDs"> The buffer to use for the material IDs of dynamic objects. </param>
         /// <param name="dynamicTransforms"> The buffer to use for the model transforms of dynamic objects. </param>
         /// <param name="lightingTransforms"> The buffer to use for the model transforms of light volumes. </param>
         /// <returns> Whether initialisation was successful or not. </returns>
         template <size_t MaterialIDPartitions, size_t TransformPartitions, size_t LightingPartitions>
-        bool initialise (const Materials& materials, 
-            const std::map<scene::MeshId, std::vector<scene::Instance>>& staticInstances,
+        bool initialise (UploadService& uploads, const Materials& materials, const Preparation& prepared,
             const PersistentMappedBuffer<MaterialIDPartitions>& dynamicMaterialIDs, 
             const PersistentMappedBuffer<TransformPartitions>& dynamicTransforms,
             const PersistentMappedBuffer<LightingPartitions>& lightingTransforms) noexcept;
@@ -142,11 +163,14 @@ class Geometry final
             const LightingPMB& lightingTransforms) const noexcept;
 
         /// <summary> 
-        /// Fills the mesh vertex and elements data in the given Internals object with data retrieved contained by
-        /// scene::GeometryBuilder. Data will be stored by the GPU in scene::MeshId order.
+        /// Fills the mesh vertex and elements data in the given Internals object with the prepared meshes. Data will
+        /// be stored by the GPU in scene::MeshId order.
         /// </summary>
         /// <param name="internals"> Where the data should be stored. </param>
-        void buildMeshData (Internals& internals) const noexcept;
+        /// <param name="uploads"> Uploads each mesh as soon as it has been assembled. </param>
+        /// <param name="prepared"> The meshes and where each of them should be placed. </param>
+        /// <returns> Whether every mesh was uploaded. </returns>
+        bool buildMeshData (Internals& internals, UploadService& uploads, const Preparation& prepared) const noexcept;
 
         /// <summary> Constructs an oversized full-screen triangle, useful for full-screen shading. </summary>
         void buildFullScreenTriangle (Internals& internals) const noexcept;
@@ -165,11 +189,13 @@ class Geometry final
         /// Fills the static instancing and draw command buffers with data to draw every static object in the scene.
         /// </summary>
         /// <param name="internals"> Where the static buffers are stored. </param>
+        /// <param name="uploads"> Uploads the instancing data. </param>
         /// <param name="drawCommands"> Where the list of indirect draw commands should be stored. </param>
         /// <param name="materials"> Material information for the material ID buffer. </param>
         /// <param name="instances"> Each instance that will be added to the static buffers. </param>
-        void fillStaticBuffers (Internals& internals, DrawCommands& drawCommands, const Materials& materials,
-            const std::map<scene::MeshId, std::vector<scene::Instance>>& instances) const noexcept;
+        /// <returns> Whether the instancing data was uploaded. </returns>
+        bool fillStaticBuffers (Internals& internals, UploadService& uploads, DrawCommands& drawCommands, 
+            const Materials& materials, const StaticInstances& instances) const noexcept;
 };
 
 
@@ -178,8 +204,7 @@ class Geometry final
 
 
 template <size_t MaterialIDPartitions, size_t TransformPartitions, size_t LightingPartitions>
-bool Geometry::initialise (const Materials& materials, 
-    const std::map<scene::MeshId, std::vector<scene::Instance>>& staticInstances,
+bool Geometry::initialise (UploadService& uploads, const Materials& materials, const Preparation& prepared,
     const PersistentMappedBuffer<MaterialIDPartitions>& dynamicMaterialIDs,
     const PersistentMappedBuffer<TransformPartitions>& dynamicTransforms,
     const PersistentMappedBuffer<LightingPartitions>& lightingTransforms) noexcept
@@ -205,12 +230,19 @@ bool Geometry::initialise (const Materials& materials,
     configureVAOs (scene, triangle, lighting, *internals, dynamicMaterialIDs, dynamicTransforms, lightingTransforms);
 
     // Construct the required geometry.
-    buildMeshData (*internals);
+    if (!buildMeshData (*internals, uploads, prepared))
+    {
+        return false;
+    }
+
     buildFullScreenTriangle (*internals);
     buildLighting (*internals, quad, sphere, cone);
 
     // Allow for static batching by filling the static buffers with instance information and draw commands.
-    fillStaticBuffers (*internals, drawCommands, materials, staticInstances);
+    if (!fillStaticBuffers (*internals, uploads, drawCommands, materials, prepared.staticInstances))
+    {
+        return false;
+    }
 
     // Finally we can make use of the successfully created data.
     m_scene         = std::move (scene);
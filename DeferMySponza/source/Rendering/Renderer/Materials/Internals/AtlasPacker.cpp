@@ -0,0 +1,41 @@
+#include "AtlasPacker.hpp"
+
+
+std::pair<bool, AtlasPacker::Placement> AtlasPacker::pack (const GLsizei width, const GLsizei height) noexcept
+{
+    if (width < 1 || height < 1 || width > m_dimensions || height > m_dimensions)
+    {
+        return { false, Placement { } };
+    }
+
+    // Try to fit the rectangle on an existing shelf first.
+    for (auto& shelf : m_shelves)
+    {
+        if (height <= shelf.height && shelf.used + width <= m_dimensions)
+        {
+            const auto placement = Placement { shelf.layer, shelf.used, shelf.y };
+            shelf.used += width;
+            return { true, placement };
+        }
+    }
+
+    // Open a new shelf in the first layer with enough vertical space.
+    for (size_t layer { 0 }; layer < m_heights.size(); ++layer)
+    {
+        auto& used = m_heights[layer];
+
+        if (used + height <= m_dimensions)
+        {
+            const auto placement = Placement { static_cast<GLint> (layer), 0, used };
+            m_shelves.push_back ({ placement.layer, used, height, width });
+            used += height;
+            return { true, placement };
+        }
+    }
+
+    // Every layer is full so a new one must be opened.
+    const auto placement = Placement { getLayerCount(), 0, 0 };
+    m_shelves.push_back ({ placement.layer, 0, height, width });
+    m_heights.push_back (height);
+    return { true, placement };
+}
\ No newline at end of file
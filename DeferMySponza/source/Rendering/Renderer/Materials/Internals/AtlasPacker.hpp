@@ -0,0 +1,69 @@
+#pragma once
+
+#if !defined    _RENDERING_RENDERER_MATERIALS_INTERNAL_ATLAS_PACKER_
+#define         _RENDERING_RENDERER_MATERIALS_INTERNAL_ATLAS_PACKER_
+
+// STL headers.
+#include <utility>
+#include <vector>
+
+
+// Engine headers.
+#include <tgl/tgl.h>
+
+
+/// <summary>
+/// Packs rectangles into square layers using shelves. Each layer is divided into horizontal shelves as tall as the
+/// first rectangle placed on them, later rectangles use the first shelf with enough room before a new shelf or layer is
+/// opened. Packing is tightest when rectangles are given tallest first.
+/// </summary>
+class AtlasPacker final
+{
+    public:
+
+        /// <summary> The location of a packed rectangle. </summary>
+        struct Placement final
+        {
+            GLint   layer   { 0 };  //!< The layer the rectangle was placed in.
+            GLint   x       { 0 };  //!< The left edge of the rectangle.
+            GLint   y       { 0 };  //!< The bottom edge of the rectangle.
+        };
+
+        AtlasPacker (const GLsizei dimensions) noexcept : m_dimensions (dimensions) { }
+
+        AtlasPacker (AtlasPacker&&) noexcept                    = default;
+        AtlasPacker (const AtlasPacker&) noexcept               = default;
+        AtlasPacker& operator= (const AtlasPacker&) noexcept    = default;
+        AtlasPacker& operator= (AtlasPacker&&) noexcept         = default;
+        ~AtlasPacker()                                          = default;
+
+
+        /// <summary> Gets the width and height of each layer. </summary>
+        GLsizei getDimensions() const noexcept  { return m_dimensions; }
+
+        /// <summary> Gets how many layers have been opened. </summary>
+        GLsizei getLayerCount() const noexcept  { return static_cast<GLsizei> (m_heights.size()); }
+
+        /// <summary> Finds space for a rectangle, opening a new shelf or layer if none of the existing ones fit. </summary>
+        /// <param name="width"> How many texels wide the rectangle is. </param>
+        /// <param name="height"> How many texels tall the rectangle is. </param>
+        /// <returns> Whether the rectangle fits within a layer and where it was placed. </returns>
+        std::pair<bool, Placement> pack (const GLsizei width, const GLsizei height) noexcept;
+
+    private:
+
+        /// <summary> A row of rectangles which share the same vertical space. </summary>
+        struct Shelf final
+        {
+            GLint   layer   { 0 };  //!< The layer containing the shelf.
+            GLint   y       { 0 };  //!< The bottom edge of the shelf.
+            GLsizei height  { 0 };  //!< How tall the shelf is.
+            GLsizei used    { 0 };  //!< How much of the width has been filled.
+        };
+
+        GLsizei                 m_dimensions    { 0 };  //!< The width and height of each layer.
+        std::vector<Shelf>      m_shelves       { };    //!< Every shelf across every layer.
+        std::vector<GLsizei>    m_heights       { };    //!< How much of the height of each layer has been given to shelves.
+};
+
+#endif // _RENDERING_RENDERER_MATERIALS_INTERNAL_ATLAS_PACKER_
\ No newline at end of file
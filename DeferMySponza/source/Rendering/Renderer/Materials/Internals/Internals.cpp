@@ -1,6 +1,14 @@
 #include "Internals.hpp"
 
 
+// STL headers.
+#include <algorithm>
+
+
+// Personal headers.
+#include <Rendering/State/StateCache.hpp>
+
+
 GLuint Materials::Internals::maxTexture = 0;
 GLuint Materials::Internals::maxArrayDepth = 0;
 
@@ -26,18 +34,27 @@ bool Materials::Internals::isInitialised() const noexcept
         }
     }
 
+    for (const auto& array : bc7)
+    {
+        if (!array.isInitialised())
+        {
+            return false;
+        }
+    }
+
     return true;
 }
 
 
 bool Materials::Internals::initialise (const GLuint startingIndex) noexcept
 {
-    if (!materials.initialise (startingIndex))
+    if (!materials.initialise())
     {
         return false;
     }
 
-    const auto start = startingIndex + 1;
+    // Materials are read from a storage buffer so the arrays occupy every unit.
+    const auto start = startingIndex;
 
     for (GLuint i { 0 }; i < supportedResolutionCount; ++i)
     {
@@ -48,6 +65,14 @@ bool Materials::Internals::initialise (const GLuint startingIndex) noexcept
         }
     }
 
+    for (GLuint i { 0 }; i < bc7.size(); ++i)
+    {
+        if (!bc7[i].initialise (start + supportedResolutionCount * 2 + i))
+        {
+            return false;
+        }
+    }
+
     auto integer = GLint { };
     glGetIntegerv (GL_MAX_TEXTURE_SIZE, &integer);
     maxTexture = static_cast<GLuint> (integer);
@@ -60,6 +85,17 @@ bool Materials::Internals::initialise (const GLuint startingIndex) noexcept
 
 void Materials::Internals::clean() noexcept
 {
+    // Handles must be made non-resident before their arrays are deleted.
+    for (const auto handle : resident)
+    {
+        if (handle != 0)
+        {
+            glMakeTextureHandleNonResidentARB (handle);
+        }
+    }
+
+    resident.clear();
+    handles.clean();
     materials.clean();
 
     for (GLuint i { 0 }; i < supportedResolutionCount; ++i)
@@ -67,31 +103,83 @@ void Materials::Internals::clean() noexcept
         rgb[i].clean();
         rgba[i].clean();
     }
+
+    for (auto& array : bc7)
+    {
+        array.clean();
+    }
 }
 
 
 void Materials::Internals::bind() const noexcept
 {
-    glBindTextureUnit (materials.texture.getDesiredTextureUnit(), materials.texture.getID());
+    // Shaders don't use texture units when sampling through handles.
+    if (bindless)
+    {
+        return;
+    }
 
     for (size_t i { 0 }; i < supportedResolutionCount; ++i)
     {
         const auto& rgbTexture = rgb[i];
-        glBindTextureUnit (rgbTexture.getDesiredTextureUnit(), rgbTexture.getID());
+        StateCache::bindTextureUnit (rgbTexture.getDesiredTextureUnit(), rgbTexture.getID());
                 
         const auto& rgbaTexture = rgba[i];
-        glBindTextureUnit (rgbaTexture.getDesiredTextureUnit(), rgbaTexture.getID());
+        StateCache::bindTextureUnit (rgbaTexture.getDesiredTextureUnit(), rgbaTexture.getID());
+    }
+
+    for (const auto& bc7Texture : bc7)
+    {
+        StateCache::bindTextureUnit (bc7Texture.getDesiredTextureUnit(), bc7Texture.getID());
     }
 }
 
 
 void Materials::Internals::unbind() const noexcept
 {
-    constexpr auto arrays   = GLsizei { supportedResolutionCount * 2 };
-    constexpr auto extra    = GLsizei { 1 };
-    constexpr auto count    = arrays + extra;
+    constexpr auto count = GLsizei { supportedResolutionCount * 2 + std::tuple_size<Compressed>::value };
+
+    if (!bindless)
+    {
+        StateCache::bindTextures (rgb.front().getDesiredTextureUnit(), count, nullptr);
+    }
+}
+
+
+void Materials::Internals::makeHandlesResident() noexcept
+{
+    // The handle buffer is indexed like the texture units so materials are identical in both modes.
+    auto handleData = Handles { };
 
-    glBindTextures (materials.texture.getDesiredTextureUnit(), count, nullptr);
+    for (GLuint index { 0 }; at (index); ++index)
+    {
+        // Arrays which were never allocated can't provide a handle, nothing will ever sample them.
+        auto immutable      = GLint { GL_FALSE };
+        const auto texture  = at (index)->getID();
+        glGetTextureParameteriv (texture, GL_TEXTURE_IMMUTABLE_FORMAT, &immutable);
+
+        const auto handle = immutable == GL_TRUE ? glGetTextureHandleARB (texture) : GLuint64 { 0 };
+
+        if (handle != 0)
+        {
+            glMakeTextureHandleResidentARB (handle);
+        }
+
+        handleData.push_back (handle);
+    }
+
+    handles.initialise();
+    handles.immutablyFillWith (handleData);
+    resident = std::move (handleData);
+}
+
+
+void Materials::Internals::bindStorage() const noexcept
+{
+    const GLuint buffers[] = { materials.getID(), handles.getID() };
+    const auto count = GLsizei { handles.isInitialised() ? 2 : 1 };
+
+    StateCache::bindBuffersBase (GL_SHADER_STORAGE_BUFFER, materialsBinding, count, buffers);
 }
 
 
@@ -111,6 +199,44 @@ bool Materials::Internals::areDimensionsSupported (const size_t width, const siz
 }
 
 
+bool Materials::Internals::canBeAtlased (const size_t width, const size_t height) noexcept
+{
+    // The padding must fit within the largest atlas layer too.
+    const auto paddedWidth  = width + atlasPadding * 2;
+    const auto paddedHeight = height + atlasPadding * 2;
+    const auto largest      = std::min (maximumDimensions, static_cast<size_t> (maxTexture));
+
+    return width > 0 && height > 0 && paddedWidth <= largest && paddedHeight <= largest;
+}
+
+
+size_t Materials::Internals::atlasDimensionsFor (const size_t largestSide, const size_t area) noexcept
+{
+    auto dimensions = minimumDimensions;
+
+    // Larger layers waste less space at the edges so keep growing until everything fits on a single layer.
+    while (dimensions < maximumDimensions && (dimensions < largestSide || dimensions * dimensions < area))
+    {
+        dimensions *= 2;
+    }
+
+    return dimensions;
+}
+
+
+GLsizei Materials::Internals::mipLevelCount (const size_t dimensions) noexcept
+{
+    auto levels = GLsizei { 1 };
+
+    while ((dimensions >> levels) > 0)
+    {
+        ++levels;
+    }
+
+    return levels;
+}
+
+
 std::pair<GLuint, Texture2DArray*> Materials::Internals::get (const size_t components, const size_t dimensions) noexcept
 {
     auto index  = size_t { 0 };
@@ -133,4 +259,42 @@ std::pair<GLuint, Texture2DArray*> Materials::Internals::get (const size_t compo
     }
 
     return { 0, nullptr };
+}
+
+
+std::pair<GLuint, Texture2DArray*> Materials::Internals::getCompressed (const size_t dimensions) noexcept
+{
+    auto index  = size_t { 0 };
+    auto size   = minimumDimensions;
+
+    // The compressed arrays start at the minimum dimensions as there is no 1x1 array.
+    while (size < dimensions)
+    {
+        size *= 2;
+        ++index;
+    }
+
+    if (dimensions < minimumDimensions || index >= bc7.size())
+    {
+        return { 0, nullptr };
+    }
+
+    return { static_cast<GLuint> (supportedResolutionCount * 2 + index), &bc7[index] };
+}
+
+
+Texture2DArray* Materials::Internals::at (const GLuint index) noexcept
+{
+    if (index < supportedResolutionCount)
+    {
+        return &rgb[index];
+    }
+
+    if (index < supportedResolutionCount * 2)
+    {
+        return &rgba[index - supportedResolutionCount];
+    }
+
+    const auto compressed = index - supportedResolutionCount * 2;
+    return compressed < bc7.size() ? &bc7[compressed] : nullptr;
 }
\ No newline at end of file
@@ -6,14 +6,16 @@
 // STL headers.
 #include <array>
 #include <string>
+#include <vector>
 
 
 // Engine headers.
 #include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
 
 
 // Personal headers.
-#include <Rendering/Composites/SamplerBuffer.hpp>
+#include <Rendering/Objects/Buffer.hpp>
 #include <Rendering/Renderer/Materials/Materials.hpp>
 
 
@@ -32,19 +34,35 @@ class Materials::Internals final
         constexpr static auto supportedResolutionCount = size_t { 8 };  //!< We store an initial texture array for 1x1 textures and 7 for dimensions between 64x64 and 2048x2048.
 
         using Textures      = std::array<Texture2DArray, supportedResolutionCount>;
+        using Compressed    = std::array<Texture2DArray, supportedResolutionCount - 1>;
         using TextureIDs    = std::unordered_map<std::string, glm::uvec2>;
+        using TextureRects  = std::unordered_map<std::string, glm::vec4>;
         using Counts        = std::unordered_map<size_t, std::unordered_map<size_t, size_t>>;
+        using Sources       = std::unordered_map<GLuint, TextureStreamer::Source>;
+        using Handles       = std::vector<GLuint64>;
 
         static GLuint maxTexture;       //!< Tracks the maximum size a texture can be on the current GPU.
         static GLuint maxArrayDepth;    //!< Tracks the maximum depth of 2D texture arrays on the current GPU.
 
     public:
+
+        constexpr static auto atlasPadding      = size_t { 8 };     //!< Texels of wrapped border around each atlased image so filtering doesn't bleed between neighbours.
+        constexpr static auto materialsBinding  = GLuint { 1 };     //!< The storage buffer binding of the material records, must match MaterialFetcher.fs and TextureUsage.cs.
+        constexpr static auto handlesBinding    = GLuint { 2 };     //!< The storage buffer binding of the bindless handles, must match MaterialFetcher.fs.
     
-        SamplerBuffer   materials   { };    //!< The texture buffer which provides access to materials in shaders.
+        Buffer          materials   { };    //!< The storage buffer which provides access to material records in shaders.
+        Buffer          handles     { };    //!< A bindless handle for each texture array, only created when bindless textures are used.
+        Handles         resident    { };    //!< Every handle which has been made resident, zero for arrays without storage.
         Textures        rgb         { };    //!< Contains a 2D texture array for each supported texture resolution in the RGB format.
         Textures        rgba        { };    //!< Contains a 2D texture array for each supported texture resolution in the RGBA format.
+        Compressed      bc7         { };    //!< Contains a 2D texture array for each baked texture resolution, 1x1 textures are never compressed.
         TextureIDs      ids         { };    //!< Maps: File location -> texture unit index & array index.
+        TextureRects    rects       { };    //!< Maps: File location -> UV scale & offset inside its layer, only atlased textures are present.
         Counts          counts      { };    //!< Maps: Dimensions -> Components -> number of textures.
+        Counts          layers      { };    //!< Maps: Dimensions -> Components -> number of layers allocated, as planned before uploading.
+        Sources         sources     { };    //!< Maps: Texture unit index -> every level of an array which will be streamed instead of uploaded.
+        bool            streamed    { false }; //!< Whether arrays larger than 1x1 are kept in system memory for the streamer.
+        bool            bindless    { false }; //!< Whether shaders sample the arrays through bindless handles instead of texture units.
 
 
         Internals() noexcept { }
@@ -62,14 +80,45 @@ class Materials::Internals final
         void clean() noexcept;
         void bind() const noexcept;
         void unbind() const noexcept;
+
+        /// <summary> 
+        /// Creates a handle for every array with storage, makes them resident and stores them in the handles buffer.
+        /// The arrays can't be modified afterwards. 
+        /// </summary>
+        void makeHandlesResident() noexcept;
+
+        /// <summary> Binds the material records, and handles if they exist, to their storage buffer bindings. </summary>
+        void bindStorage() const noexcept;
+
         bool contains (const std::string& file) const noexcept;
 
         static bool areDimensionsSupported (const size_t width, const size_t height) noexcept;
 
+        /// <summary> Checks whether an image which doesn't fill a whole layer can be packed into an atlas. </summary>
+        static bool canBeAtlased (const size_t width, const size_t height) noexcept;
+
+        /// <summary> Chooses the dimensions of the atlas layers given the largest padded image and the total area. </summary>
+        static size_t atlasDimensionsFor (const size_t largestSide, const size_t area) noexcept;
+
+        /// <summary> Gets the component count of the uncompressed array which stores images with the given components. </summary>
+        static size_t arrayComponentsFor (const size_t components) noexcept { return components <= 3 ? 3 : 4; }
+
+        /// <summary> Calculates how many levels a full mipmap chain of the given dimensions contains. </summary>
+        static GLsizei mipLevelCount (const size_t dimensions) noexcept;
+
         /// <summary> 
         /// Retrieves the texture unit index and texture array for the given component and dimension count. 
         /// </summary>
         std::pair<GLuint, Texture2DArray*> get (const size_t components, const size_t dimensions) noexcept;
+
+        /// <summary>
+        /// Retrieves the texture unit index and BC7 texture array for the given dimension count, 1x1 textures aren't
+        /// supported.
+        /// </summary>
+        std::pair<GLuint, Texture2DArray*> getCompressed (const size_t dimensions) noexcept;
+
+        /// <summary> Retrieves the texture array at the given texture unit index, returns nullptr if invalid. </summary>
+        Texture2DArray* at (const GLuint index) noexcept;
 };
 
 #endif
\ No newline at end of file
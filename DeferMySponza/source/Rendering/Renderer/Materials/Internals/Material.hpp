@@ -5,18 +5,31 @@
 
 // Engine headers.
 #include <glm/vec2.hpp>
+#include <tgl/tgl.h>
 
 
 /// <summary>
-/// Contains the sampler index and physics properties, albedo and normal map of a material. The default material
-/// properties should link to default texture maps.
+/// Contains the physics properties, albedo and normal map of a material as a record in the materials storage buffer.
+/// The default material properties should link to default texture maps. Records use the std430 layout and must match
+/// MaterialFetcher.fs and TextureUsage.cs.
 /// </summary>
 struct Material final
 {
-    glm::uvec2  properties  { 0 };  //!< The sampler index and depth to use when looking up the physical properties of the material.
-    glm::uvec2  albedo      { 0 };  //!< The sampler index and depth to use when looking up the albedo of the material.
-    glm::uvec2  normal      { 0 };  //!< The sampler index and depth to use when looking up the normal map of the material.
-    glm::uvec2  unused      { 0 };  //!< Currently unused.
+    /// <summary>
+    /// Locates a map. The array index selects a sampler, or a bindless handle when they're supported. The rectangle
+    /// locates the map inside its layer, stored as a packUnorm2x16() UV scale followed by a packUnorm2x16() UV
+    /// offset. Maps which fill their layer use the default scale of one and no offset.
+    /// </summary>
+    struct Map final
+    {
+        GLuint      array   { 0 };              //!< The index of the texture array containing the map.
+        GLuint      layer   { 0 };              //!< The layer of the array containing the map.
+        glm::uvec2  rect    { 0xFFFFFFFF, 0 };  //!< The packed UV scale and offset of the map inside its layer.
+    };
+
+    Map properties  { };    //!< The physical properties of the material.
+    Map albedo      { };    //!< The albedo of the material.
+    Map normal      { };    //!< The normal map of the material.
     
     Material() noexcept                             = default;
     Material (Material&&) noexcept                  = default;
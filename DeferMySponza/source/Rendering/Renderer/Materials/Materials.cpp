@@ -2,14 +2,21 @@
 
 
 // STL headers.
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <future>
+#include <thread>
 #include <utility>
 
 
 // Engine headers.
+#include <glm/packing.hpp>
 #include <tygra/FileHelper.hpp>
 
 
 // Personal headers.
+#include <Rendering/Renderer/Materials/Internals/AtlasPacker.hpp>
 #include <Rendering/Renderer/Materials/Internals/Internals.hpp>
 #include <Utility/OpenGL/Textures.hpp>
 #include <Utility/Algorithm.hpp>
@@ -46,29 +53,59 @@ MaterialID Materials::operator[] (const scene::MaterialId sceneID) const noexcep
 }
 
 
-GLint Materials::getMaterialTextureUnit() const noexcept
+GLint Materials::getTextureArrayStartingUnit() const noexcept
 {
-    return m_internals->materials.texture.getDesiredTextureUnit();
+    return m_internals->rgb.front().getDesiredTextureUnit();
 }
 
 
-GLint Materials::getTextureArrayStartingUnit() const noexcept
+GLint Materials::getTextureArrayCount() const noexcept
 {
-    return m_internals->rgb.front().getDesiredTextureUnit();
+    return static_cast<GLint> (m_internals->rgb.size() + m_internals->rgba.size() + m_internals->bc7.size());
 }
 
 
-GLint Materials::getTextureArrayCount() const noexcept
+bool Materials::usesBindlessTextures() const noexcept
 {
-    return static_cast<GLint> (m_internals->rgb.size() + m_internals->rgba.size());
+    return m_internals->bindless;
+}
+
+
+std::pair<bool, Materials::Preparation> Materials::prepare (const scene::Context& scene) const noexcept
+{
+    // First we must obtain every material available in the scene.
+    auto prepared       = Preparation { };
+    prepared.materials  = util::getAllMaterials (scene);
+
+    // Then parse the materials to retrieve unique file locations.
+    auto files = collectFileLocations (prepared.materials);
+
+    // Using these files we can attempt to open them and sort them by format.
+    auto textureResult = openTextures (files);
+
+    if (!textureResult.first)
+    {
+        return { false, Preparation { } };
+    }
+
+    prepared.textures = std::move (textureResult.second);
+    return { true, std::move (prepared) };
 }
 
 
-bool Materials::initialise (const scene::Context& scene, const GLuint startingTextureUnit) noexcept
+bool Materials::initialise (const Preparation& prepared, const GLuint startingTextureUnit, 
+    const TextureStreamer::Settings& streaming, const bool bindless, UploadService& uploads) noexcept
 {
+    // Streamed arrays are reallocated whilst frames are in flight which would invalidate their handles.
+    if (bindless && streaming.enabled)
+    {
+        return false;
+    }
+
     // Create new objects.
     auto ids        = MaterialIDs { };
     auto internals  = std::make_unique<Internals>();
+    auto streamer   = TextureStreamer { };
 
     // Ensure initialisation works.
     if (!internals->initialise (startingTextureUnit))
@@ -76,8 +113,18 @@ bool Materials::initialise (const scene::Context& scene, const GLuint startingTe
         return false;
     }
 
+    // Streamed arrays are filled in system memory rather than allocated.
+    internals->streamed = streaming.enabled;
+    internals->bindless = bindless;
+
     // We need to determine how much memory to allocate for the texture arrays.
-    if (!generateMaterials (ids, *internals, scene))
+    if (!generateMaterials (ids, *internals, uploads, prepared))
+    {
+        return false;
+    }
+
+    // The arrays live in the internals so the streamer can keep pointing to them after the move below.
+    if (streaming.enabled && !startStreaming (streamer, *internals, streaming))
     {
         return false;
     }
@@ -85,6 +132,10 @@ bool Materials::initialise (const scene::Context& scene, const GLuint startingTe
     // Finally make use of the new data.
     m_materialIDs   = std::move (ids);
     m_internals     = std::move (internals);
+    m_streamer      = std::move (streamer);
+
+    // The storage bindings are never used by anything else so they only need binding once.
+    m_internals->bindStorage();
 
     return true;
 }
@@ -92,6 +143,7 @@ bool Materials::initialise (const scene::Context& scene, const GLuint startingTe
 
 void Materials::clean() noexcept
 {
+    m_streamer.clean();
     m_materialIDs.clear();
     m_internals->clean();
 }
@@ -109,14 +161,13 @@ void Materials::unbindTextures() const noexcept
 }
 
 
-bool Materials::generateMaterials (MaterialIDs& materialIDs, Internals& internals, 
-            const scene::Context& scene) const noexcept
+bool Materials::generateMaterials (MaterialIDs& materialIDs, Internals& internals, UploadService& uploads,
+            const Preparation& prepared) const noexcept
 {
-    // First we must obtain every material available in the scene.
-    const auto sceneMaterials = util::getAllMaterials (scene);
-
     // Ensure textures load successfully before constructing the materials.
-    if (!loadTextures (internals, sceneMaterials))
+    const auto& sceneMaterials = prepared.materials;
+
+    if (!loadTextures (internals, uploads, prepared))
     {
         return false;
     }
@@ -141,30 +192,34 @@ bool Materials::generateMaterials (MaterialIDs& materialIDs, Internals& internal
     }
 
     // Fill the materials buffer with data.
-    internals.materials.buffer.immutablyFillWith (materials);
+    internals.materials.immutablyFillWith (materials);
+
+    // The arrays are complete so handles can be created without them becoming invalid.
+    if (internals.bindless)
+    {
+        internals.makeHandlesResident();
+    }
 
-    // Now we must inform the materials buffer that it contains data.
-    internals.materials.specifyBufferFormat (GL_RGBA32UI);
     return true;
 }
 
 
-bool Materials::loadTextures (Internals& internals, const std::vector<PBSMaterial>& materials) const noexcept
+bool Materials::loadTextures (Internals& internals, UploadService& uploads, const Preparation& prepared) const noexcept
 {
-    // Firstly we need to parse the materials to retrieve unique file locations.
-    auto files = collectFileLocations (materials);
-
-    // Using these files we can attempt to open them and sort them by format.
-    auto textureResult = openTextures (files);
+    // Every array is sized from the plan so no memory is allocated for layers which will never be filled.
+    const auto& opened  = prepared.textures;
+    auto planResult     = planLayout (prepared.materials, opened.encoded, opened.atlased);
 
-    // Ensure all textures loaded successfully.
-    if (textureResult.first)
+    if (!planResult.first)
     {
-        // Now we can load the textures into the GPU.
-        return bufferTextures (internals, textureResult.second);
+        return false;
     }
 
-    return false;
+    internals.layers = std::move (planResult.second.layout);
+
+    // Now we can load the textures into the GPU.
+    return  bufferTextures (internals, uploads, opened.encoded, opened.atlased, planResult.second.placements) &&
+            bufferBakedTextures (internals, opened.baked);
 }
 
 
@@ -188,34 +243,131 @@ Materials::FileLocations Materials::collectFileLocations (const std::vector<PBSM
 }
 
 
-std::pair<bool, Materials::TexturesToBuffer> Materials::openTextures (FileLocations& files) const noexcept
+std::pair<bool, Materials::OpenedTextures> Materials::openTextures (FileLocations& files) const noexcept
 {
     // We'll need to store and modify the result.
-    auto result = std::pair<bool, TexturesToBuffer> { };
+    auto result = std::pair<bool, OpenedTextures> { };
 
     // Default the result to represent failure.
     result.first = false;
 
-    // We need to interate through each file.
-    for (auto& file : files)
+    // Reading each PNG is independent so the work is spread across worker threads. Each worker claims the next file
+    // until none remain, the calling thread also takes part so reading continues if threads can't launch. Images which
+    // fill a whole layer are only opened, they're decoded straight into the staging ring once their layer is known.
+    const auto locations    = std::vector<std::string> (std::begin (files), std::end (files));
+    auto encoded            = std::vector<EncodedImage> (locations.size());
+    auto decoded            = std::vector<std::unique_ptr<tygra::Image>> (locations.size());
+    auto opened             = std::vector<std::uint8_t> (locations.size());
+    auto baked              = std::vector<BakedTexture> (locations.size());
+    auto next               = std::atomic<size_t> { 0 };
+
+    const auto decode = [&]
+    {
+        for (auto i = next++; i < locations.size(); i = next++)
+        {
+            // Baked textures skip decoding entirely, the PNG is only used when they're missing or unusable.
+            if (baked[i].load (BakedTexture::locationOf (locations[i])) && isBakedTextureSupported (baked[i]))
+            {
+                continue;
+            }
+
+            baked[i].clean();
+
+            // Packed files are viewed in the mapping rather than copied.
+            auto& image = encoded[i];
+            image.view  = tygra::createViewFromFile (locations[i]);
+
+            if (!image.view.data)
+            {
+                image.file = tygra::createBufferFromFile (locations[i]);
+            }
+
+            const auto data = image.view.data ? image.view.data : image.file.data();
+            const auto size = image.view.data ? image.view.size : image.file.size();
+
+            if (!image.decoder.open (data, size))
+            {
+                continue;
+            }
+
+            const auto width    = image.decoder.width();
+            const auto height   = image.decoder.height();
+
+            if (Internals::areDimensionsSupported (width, height))
+            {
+                opened[i] = true;
+            }
+
+            // Atlased images must be decoded now because they're padded before uploading.
+            else if (Internals::canBeAtlased (width, height))
+            {
+                auto atlased = std::make_unique<tygra::Image> (width, height, image.decoder.componentsPerPixel(), 
+                    image.decoder.bytesPerComponent());
+
+                if (image.decoder.decode (atlased->pixelData(), image.decoder.rowSize(), true))
+                {
+                    decoded[i]  = std::move (atlased);
+                    opened[i]   = true;
+                }
+
+                image = EncodedImage { };
+            }
+        }
+    };
+
+    // The calling thread counts as one of the workers.
+    const auto threads      = static_cast<size_t> (std::max (std::thread::hardware_concurrency(), 1U));
+    const auto workerCount  = locations.empty() ? size_t { 0 } : std::min (threads, locations.size()) - 1;
+    auto workers            = std::vector<std::future<void>> { };
+    workers.reserve (workerCount);
+
+    try
     {
-        // Attempt to load it.
-        auto image = tygra::createImageFromPngFile (file);
+        for (size_t i { 0 }; i < workerCount; ++i)
+        {
+            workers.push_back (std::async (std::launch::async, decode));
+        }
+    }
+
+    catch (...)
+    {
+        // Any files which the launched workers don't claim will be decoded by this thread.
+    }
 
-        // Cache the format of the image.
-        const auto width        = image.width();
-        const auto height       = image.height();
-        const auto components   = image.componentsPerPixel();
+    decode();
+    std::for_each (workers, [] (auto& worker) { worker.wait(); });
 
-        // Ensure the image loaded properly and is a valid resolution.
-        if (!(image.doesContainData() && Internals::areDimensionsSupported (width, height)))
+    // Images are sorted on this thread so the order matches the set of files, regardless of which worker opened it.
+    for (size_t i { 0 }; i < locations.size(); ++i)
+    {
+        const auto& file = locations[i];
+
+        // Baked textures have already been validated.
+        if (baked[i].isLoaded())
+        {
+            const auto dimensions = static_cast<size_t> (baked[i].getWidth());
+            result.second.baked[dimensions].vector.emplace_back (file, std::move (baked[i]));
+            continue;
+        }
+
+        // Ensure the image opened properly and has a supported size.
+        if (!opened[i])
         {
             return result;
         }
 
+        // Any size which doesn't fill a whole layer has already been decoded to be packed into an atlas.
+        if (decoded[i])
+        {
+            result.second.atlased.vector.emplace_back (file, std::move (*decoded[i]));
+            continue;
+        }
+
         // Map it based on it's dimensions and then component count.
-        auto pair = std::make_pair (file, std::move (image));
-        result.second[width][components].vector.emplace_back (std::move (pair));
+        const auto width        = encoded[i].decoder.width();
+        const auto components   = encoded[i].decoder.componentsPerPixel();
+        auto pair               = std::make_pair (file, std::move (encoded[i]));
+        result.second.encoded[width][components].vector.emplace_back (std::move (pair));
     }
 
     // We've succeeded.
@@ -224,119 +376,615 @@ std::pair<bool, Materials::TexturesToBuffer> Materials::openTextures (FileLocati
 }
 
 
-bool Materials::bufferTextures (Internals& internals, TexturesToBuffer& textures) const noexcept
+std::pair<bool, Materials::Plan> Materials::planLayout (const std::vector<PBSMaterial>& materials, 
+    const TexturesToBuffer& textures, const Images& atlased) const noexcept
 {
-    // Start by ensuring we allocate the maximum amount 1x1 textures that we can.
+    auto result = std::pair<bool, Plan> { false, Plan { } };
+    auto& layout = result.second.layout;
+
+    // Images with fewer than 3 components are stored in the RGB arrays, as in bufferTextures().
+    for (const auto& dimensionMap : textures)
+    {
+        for (const auto& componentMap : dimensionMap.second)
+        {
+            const auto components = Internals::arrayComponentsFor (componentMap.first);
+            layout[dimensionMap.first][components] += componentMap.second.vector.size();
+        }
+    }
+
+    // Atlased images are grouped by the array they'll be stored in, then packed tallest first.
+    auto groups = std::unordered_map<Components, std::vector<size_t>> { };
+
+    for (size_t i { 0 }; i < atlased.vector.size(); ++i)
+    {
+        groups[Internals::arrayComponentsFor (atlased.vector[i].second.componentsPerPixel())].push_back (i);
+    }
+
+    const auto padded = [] (const size_t size) { return size + Internals::atlasPadding * 2; };
+
+    for (auto& group : groups)
+    {
+        const auto components   = group.first;
+        auto& indices           = group.second;
+
+        const auto& image = [&] (const size_t index) -> const tygra::Image& { return atlased.vector[index].second; };
+
+        std::sort (std::begin (indices), std::end (indices), [&] (const size_t a, const size_t b)
+        {
+            return image (a).height() != image (b).height() ? image (a).height() > image (b).height() : 
+                image (a).width() > image (b).width();
+        });
+
+        // The layers are sized so that every image would fit on one if packing were perfect.
+        auto largestSide    = size_t { 0 };
+        auto area           = size_t { 0 };
+
+        for (const auto index : indices)
+        {
+            const auto width    = padded (image (index).width());
+            const auto height   = padded (image (index).height());
+            largestSide         = std::max (largestSide, std::max (width, height));
+            area                += width * height;
+        }
+
+        const auto dimensions   = Internals::atlasDimensionsFor (largestSide, area);
+        const auto firstLayer   = static_cast<GLint> (layout[dimensions][components]);
+        auto packer             = AtlasPacker { static_cast<GLsizei> (dimensions) };
+
+        for (const auto index : indices)
+        {
+            const auto width    = static_cast<GLsizei> (padded (image (index).width()));
+            const auto height   = static_cast<GLsizei> (padded (image (index).height()));
+            const auto packed   = packer.pack (width, height);
+
+            if (!packed.first)
+            {
+                return result;
+            }
+
+            const auto& placement = packed.second;
+            result.second.placements.push_back ({ index, dimensions, components, 
+                firstLayer + placement.layer, placement.x, placement.y });
+        }
+
+        layout[dimensions][components] += static_cast<size_t> (packer.getLayerCount());
+    }
+
+    // Constant colours are shared between materials so only unique values require a layer.
+    auto constants = std::unordered_map<Components, std::unordered_set<std::string>> { };
+
+    const auto addIfConstant = [&] (const auto& map, const auto& uniform)
+    {
+        if (map.empty())
+        {
+            constants[uniform.size()].emplace (constantID (uniform));
+        }
+    };
+
+    for (const auto& material : materials)
+    {
+        addIfConstant (material.physicsMap, material.physics);
+        addIfConstant (material.albedoMap, material.albedo);
+        addIfConstant (material.normalMap, material.normal);
+    }
+
+    for (const auto& pair : constants)
+    {
+        layout[1][pair.first] += pair.second.size();
+    }
+
+    // Finally ensure every array can actually be allocated.
+    const auto maxDepth = static_cast<size_t> (Internals::getMaxArrayDepth());
+
+    for (const auto& dimensionMap : layout)
+    {
+        for (const auto& componentMap : dimensionMap.second)
+        {
+            if (componentMap.second > maxDepth)
+            {
+                return result;
+            }
+        }
+    }
+
+    result.first = true;
+    return result;
+}
+
+
+bool Materials::bufferTextures (Internals& internals, UploadService& uploads, const TexturesToBuffer& textures, 
+    const Images& atlased, const AtlasPlacements& placements) const noexcept
+{
+    // Start by allocating every array with exactly the number of layers which were planned.
     prepare1x1TextureArrays (internals);
 
-    // We only support 3 and 4 channels right now so other images have to converted.
-    auto extra = Images { };
+    if (!prepareSizedTextureArrays (internals))
+    {
+        return false;
+    }
+
+    // Whole images come first in each array. We only support 3 and 4 channels right now, OpenGL fills the missing
+    // channels of other images when they're uploaded.
+    auto layers = LayerPlacements { };
 
-    for (auto& dimensionMap : textures)
+    for (const auto& dimensionMap : textures)
     {
         const auto dimensions = dimensionMap.first;
 
-        for (size_t components { 1 }; components <= 4; ++components)
+        for (const auto& componentMap : dimensionMap.second)
+        {
+            const auto components       = Internals::arrayComponentsFor (componentMap.first);
+            const auto indexAndArray    = internals.get (components, dimensions);
+
+            if (!indexAndArray.second)
+            {
+                return false;
+            }
+
+            addTexturesToArray (internals, layers, indexAndArray, dimensions, components, componentMap.second);
+        }
+    }
+
+    if (!addAtlasedTextures (internals, atlased, placements))
+    {
+        return false;
+    }
+
+    // Every destination is known so decoding, padding and conversion can happen on any thread. The largest work
+    // is claimed first so a single huge image doesn't leave the other threads idle at the end.
+    std::sort (std::begin (layers), std::end (layers), [] (const auto& a, const auto& b)
+    {
+        return a.image->decoder.width() > b.image->decoder.width();
+    });
+
+    const auto uploaded = uploads.run (layers.size() + placements.size(), [&] (const size_t index)
+    {
+        return index < layers.size() ? uploadLayer (internals, uploads, layers[index]) :
+            uploadAtlasedTexture (internals, uploads, atlased, placements[index - layers.size()]);
+    });
+
+    if (!uploaded)
+    {
+        return false;
+    }
+
+    // Now generate mipmaps, streamed arrays need every level in system memory so they're filtered on the CPU.
+    for (const auto& dimensionMap : internals.layers)
+    {
+        for (const auto& componentMap : dimensionMap.second)
         {
-            // Cache the image array.
-            auto& images            = dimensionMap.second[components];
-            const auto imageCount   = extra.vector.size() + images.vector.size();
+            const auto indexAndArray    = internals.get (componentMap.first, dimensionMap.first);
+            const auto source           = internals.sources.find (indexAndArray.first);
 
-            if (imageCount == 0)
+            if (dimensionMap.first == 1 || !indexAndArray.second)
             {
                 continue;
             }
 
-            // Check whether the current configuration has a dedicated texture unit.
-            const auto indexAndArray    = internals.get (components, dimensions);
-            const auto index            = indexAndArray.first;
-            const auto textureArray     = indexAndArray.second;
-            const auto format           = util::internalFormat (components);
-            const auto levels           = static_cast<GLsizei> (5);
+            if (source != std::end (internals.sources))
+            {
+                generateMipmaps (source->second);
+            }
 
-            if (textureArray)
+            else
             {
-                // Allocate enough data if the textures aren't 1x1.
-                if (dimensions != 1)
+                indexAndArray.second->generateMipmap();
+            }
+        }
+    }
+
+    return true;
+}
+
+
+bool Materials::bufferBakedTextures (Internals& internals, const BakedToBuffer& textures) const noexcept
+{
+    for (const auto& dimensionMap : textures)
+    {
+        const auto dimensions   = dimensionMap.first;
+        const auto& images      = dimensionMap.second;
+
+        if (images.vector.empty())
+        {
+            continue;
+        }
+
+        const auto indexAndArray    = internals.getCompressed (dimensions);
+        const auto index            = indexAndArray.first;
+        const auto textureArray     = indexAndArray.second;
+
+        if (!textureArray)
+        {
+            return false;
+        }
+
+        // Every baked texture contains a full mipmap chain so no mipmaps need generating.
+        const auto format   = GLenum { GL_COMPRESSED_RGBA_BPTC_UNORM };
+        const auto dim      = static_cast<GLsizei> (dimensions);
+        const auto count    = static_cast<GLsizei> (images.vector.size());
+        const auto levels   = images.vector.front().second.getLevelCount();
+
+        // Streamed arrays keep each level with every layer in order, the blocks are already in the final format.
+        if (internals.streamed)
+        {
+            auto source = TextureStreamer::Source { format, 0, dim, count, 
+                TextureStreamer::Source::Levels (static_cast<size_t> (levels)) };
+
+            for (GLsizei level { 0 }; level < levels; ++level)
+            {
+                auto& destination = source.levels[static_cast<size_t> (level)];
+
+                for (const auto& image : images.vector)
                 {
-                    const auto dim      = static_cast<GLsizei> (dimensions);
-                    const auto count    = static_cast<GLsizei> (imageCount); 
-                    textureArray->allocateImmutableStorage (format, dim, dim, count, levels);
-                    textureArray->setParameter (GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-                    textureArray->setParameter (GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-                    textureArray->setParameter (GL_TEXTURE_WRAP_S, GL_REPEAT);
-                    textureArray->setParameter (GL_TEXTURE_WRAP_T, GL_REPEAT);
+                    const auto data = static_cast<const std::uint8_t*> (image.second.getLevelData (level));
+                    destination.insert (std::end (destination), data, data + image.second.getLevelSize (level));
                 }
-                    
-                addTexturesToArray (internals, *textureArray, index, dimensions, components, images);
-                addTexturesToArray (internals, *textureArray, index, dimensions, components, extra);
-                extra.vector.clear();
+            }
 
-                // Now generate mipmaps.
-                textureArray->generateMipmap();
+            for (GLint layer { 0 }; layer < count; ++layer)
+            {
+                internals.ids[images.vector[static_cast<size_t> (layer)].first] = { index, static_cast<GLuint> (layer) };
             }
 
-            // If we don't have a texture array for this configuration then use the next.
-            else
+            internals.sources[index] = std::move (source);
+            continue;
+        }
+
+        textureArray->allocateImmutableStorage (format, dim, dim, count, levels);
+        textureArray->setParameter (GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        textureArray->setParameter (GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        textureArray->setParameter (GL_TEXTURE_WRAP_S, GL_REPEAT);
+        textureArray->setParameter (GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+        for (GLint layer { 0 }; layer < count; ++layer)
+        {
+            const auto& fileLocation    = images.vector[static_cast<size_t> (layer)].first;
+            const auto& texture         = images.vector[static_cast<size_t> (layer)].second;
+
+            // The compressed blocks of each level are uploaded straight from the loaded file.
+            for (GLsizei level { 0 }; level < levels; ++level)
             {
-                extra.vector.reserve (imageCount);
-                std::for_each (images.vector, [&] (auto& a) { extra.vector.emplace_back (std::move (a)); });
-                images.vector.clear();
+                const auto size = std::max (dim >> level, 1);
+                textureArray->placeCompressedAt (0, 0, layer, size, size, 1, format,
+                    texture.getLevelSize (level), texture.getLevelData (level), level);
             }
+
+            internals.ids[fileLocation] = { index, static_cast<GLuint> (layer) };
         }
+    }
+
+    return true;
+}
+
+
+bool Materials::startStreaming (TextureStreamer& streamer, Internals& internals, 
+    const TextureStreamer::Settings& settings) const noexcept
+{
+    if (!streamer.initialise (settings))
+    {
+        return false;
+    }
+
+    // The streamer takes ownership of every level, the sources aren't needed once the arrays are added.
+    for (auto& pair : internals.sources)
+    {
+        const auto textureArray = internals.at (pair.first);
 
-        // Some unsupported images slipped through the cracks, this should never happen.
-        if (extra.vector.size() > 0)
+        if (!textureArray || !streamer.add (*textureArray, pair.first, std::move (pair.second)))
         {
             return false;
         }
     }
 
+    internals.sources.clear();
     return true;
 }
 
 
+bool Materials::isBakedTextureSupported (const BakedTexture& texture) noexcept
+{
+    const auto width    = static_cast<size_t> (texture.getWidth());
+    const auto height   = static_cast<size_t> (texture.getHeight());
+
+    // Storage is allocated per array so every texture must have a full mipmap chain to share the level count.
+    return  texture.getFormat() == GL_COMPRESSED_RGBA_BPTC_UNORM &&
+            width > 1 && Internals::areDimensionsSupported (width, height) &&
+            texture.getLevelCount() == Internals::mipLevelCount (width);
+}
+
+
 void Materials::prepare1x1TextureArrays (Internals& internals) const noexcept
 {
-    // Firstly, we need to find out how many items we can store.
-    const auto depth = Internals::getMaxArrayDepth();
+    // The layout accounts for both 1x1 images and constant colours.
+    const auto rgbDepth     = static_cast<GLsizei> (internals.layers[1][3]);
+    const auto rgbaDepth    = static_cast<GLsizei> (internals.layers[1][4]);
+
+    // Empty arrays are left without storage as nothing will ever sample them.
+    if (rgbDepth > 0)
+    {
+        internals.rgb.front().allocateImmutableStorage (util::internalFormat (3), 1, 1, rgbDepth, 1);
+    }
 
-    // Now allocate memory.
-    internals.rgb.front().allocateImmutableStorage (util::internalFormat (3), 1, 1, depth, 1);
-    internals.rgba.front().allocateImmutableStorage (util::internalFormat (4), 1, 1, depth, 1);
+    if (rgbaDepth > 0)
+    {
+        internals.rgba.front().allocateImmutableStorage (util::internalFormat (4), 1, 1, rgbaDepth, 1);
+    }
 }
 
 
-void Materials::addTexturesToArray (Internals& internals, Texture2DArray& array, const GLuint arrayIndex, 
-            const size_t dimensions, const size_t components, const Images& images) const noexcept
+bool Materials::prepareSizedTextureArrays (Internals& internals) const noexcept
 {
-    // We need to increment the count once we've uploaded the images.
+    for (const auto& dimensionMap : internals.layers)
+    {
+        const auto dimensions = dimensionMap.first;
+
+        if (dimensions == 1)
+        {
+            continue;
+        }
+
+        for (const auto& componentMap : dimensionMap.second)
+        {
+            const auto components       = componentMap.first;
+            const auto indexAndArray    = internals.get (components, dimensions);
+            const auto textureArray     = indexAndArray.second;
+
+            if (!textureArray)
+            {
+                return false;
+            }
+
+            const auto dim      = static_cast<GLsizei> (dimensions);
+            const auto count    = static_cast<GLsizei> (componentMap.second);
+            const auto levels   = Internals::mipLevelCount (dimensions);
+
+            // Streamed arrays start with only the first level, the rest are generated once every image is placed.
+            if (internals.streamed)
+            {
+                const auto size = dimensions * dimensions * components * componentMap.second;
+                auto source     = TextureStreamer::Source { util::internalFormat (components), 
+                    static_cast<GLenum> (components == 4 ? GL_RGBA : GL_RGB), dim, count, 
+                    TextureStreamer::Source::Levels (static_cast<size_t> (levels)) };
+
+                source.levels.front().resize (size);
+                internals.sources[indexAndArray.first] = std::move (source);
+                continue;
+            }
+
+            textureArray->allocateImmutableStorage (util::internalFormat (components), dim, dim, count, levels);
+            textureArray->setParameter (GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            textureArray->setParameter (GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+            textureArray->setParameter (GL_TEXTURE_WRAP_S, GL_REPEAT);
+            textureArray->setParameter (GL_TEXTURE_WRAP_T, GL_REPEAT);
+        }
+    }
+
+    return true;
+}
+
+
+bool Materials::addAtlasedTextures (Internals& internals, const Images& images, 
+    const AtlasPlacements& placements) const noexcept
+{
+    for (const auto& placement : placements)
+    {
+        const auto indexAndArray = internals.get (placement.components, placement.dimensions);
+
+        if (!indexAndArray.second || placement.image >= images.vector.size())
+        {
+            return false;
+        }
+
+        const auto& fileLocation    = images.vector[placement.image].first;
+        const auto& image           = images.vector[placement.image].second;
+        const auto padding          = Internals::atlasPadding;
+
+        // Texture co-ordinates are mapped to the image inside the padding.
+        const auto layerSize    = static_cast<float> (placement.dimensions);
+        const auto scale        = glm::vec2 { image.width(), image.height() } / layerSize;
+        const auto offset       = glm::vec2 { placement.x + padding, placement.y + padding } / layerSize;
+
+        internals.ids[fileLocation]     = { indexAndArray.first, static_cast<GLuint> (placement.layer) };
+        internals.rects[fileLocation]   = { scale, offset };
+    }
+
+    return true;
+}
+
+
+bool Materials::uploadAtlasedTexture (Internals& internals, UploadService& uploads, const Images& images, 
+    const AtlasPlacement& placement) const noexcept
+{
+    // The placement was validated by addAtlasedTextures().
+    const auto indexAndArray    = internals.get (placement.components, placement.dimensions);
+    const auto& image           = images.vector[placement.image].second;
+    const auto padding          = Internals::atlasPadding;
+    const auto components       = image.componentsPerPixel();
+    const auto bytes            = image.bytesPerComponent();
+
+    const auto width    = static_cast<GLsizei> (image.width() + padding * 2);
+    const auto height   = static_cast<GLsizei> (image.height() + padding * 2);
+    const auto size     = static_cast<size_t> (width * height) * components * bytes;
+
+    // Arrays with storage have the padding written straight into the staging ring.
+    if (internals.sources.find (indexAndArray.first) == std::end (internals.sources))
+    {
+        const auto region = texelRegion (placement.x, placement.y, placement.layer, width, height, components, bytes);
+
+        return uploads.writeToTexture (*indexAndArray.second, region, static_cast<GLsizeiptr> (size), 
+            [&] (void* destination)
+            {
+                wrapPadding (image, padding, static_cast<std::uint8_t*> (destination));
+                return true;
+            });
+    }
+
+    auto texels = std::vector<std::uint8_t> (size);
+    wrapPadding (image, padding, texels.data());
+
+    return placeTexels (internals, uploads, indexAndArray, placement.x, placement.y, placement.layer, width, height, 
+        components, bytes, texels.data());
+}
+
+
+void Materials::wrapPadding (const tygra::Image& image, const size_t padding, std::uint8_t* texels) noexcept
+{
+    const auto width        = image.width();
+    const auto height       = image.height();
+    const auto texelSize    = image.componentsPerPixel() * image.bytesPerComponent();
+    const auto rowSize      = width * texelSize;
+    const auto source       = static_cast<const std::uint8_t*> (image.pixelData());
+
+    const auto paddedWidth  = width + padding * 2;
+    const auto paddedHeight = height + padding * 2;
+
+    // Adding a multiple of the size before wrapping avoids underflow when reading to the left of or below the image.
+    const auto wrap = [] (const size_t position, const size_t border, const size_t size)
+    {
+        return (position + size * (border / size + 1) - border) % size;
+    };
+
+    for (size_t y { 0 }; y < paddedHeight; ++y)
+    {
+        const auto sourceRow    = source + wrap (y, padding, height) * rowSize;
+        auto destination        = texels + y * paddedWidth * texelSize;
+
+        // The left border, the row itself and then the right border.
+        for (size_t x { 0 }; x < padding; ++x)
+        {
+            std::memcpy (destination + x * texelSize, sourceRow + wrap (x, padding, width) * texelSize, texelSize);
+        }
+
+        std::memcpy (destination + padding * texelSize, sourceRow, rowSize);
+
+        for (size_t x { padding + width }; x < paddedWidth; ++x)
+        {
+            std::memcpy (destination + x * texelSize, sourceRow + wrap (x, padding, width) * texelSize, texelSize);
+        }
+    }
+}
+
+
+bool Materials::placeTexels (Internals& internals, UploadService& uploads, 
+    const std::pair<GLuint, Texture2DArray*>& indexAndArray, const GLint x, const GLint y, const GLint layer, 
+    const GLsizei width, const GLsizei height, const size_t components, const size_t bytesPerComponent, 
+    const void* data) const noexcept
+{
+    const auto source = internals.sources.find (indexAndArray.first);
+
+    // Arrays which aren't streamed have storage so OpenGL can convert the texels.
+    if (source == std::end (internals.sources))
+    {
+        const auto region   = texelRegion (x, y, layer, width, height, components, bytesPerComponent);
+        const auto size     = static_cast<size_t> (width * height) * components * bytesPerComponent;
+
+        return uploads.uploadToTexture (*indexAndArray.second, region, static_cast<GLsizeiptr> (size), data);
+    }
+
+    // Otherwise we must convert to the format of the array and copy each row into the layer.
+    auto& level                 = source->second.levels.front();
+    const auto dimensions       = static_cast<size_t> (source->second.dimensions);
+    const auto arrayComponents  = source->second.pixelFormat == GL_RGBA ? size_t { 4 } : size_t { 3 };
+    const auto rowSize          = static_cast<size_t> (width) * arrayComponents;
+    const auto texels           = util::toTexels8 (data, static_cast<size_t> (width * height), components, 
+        bytesPerComponent, arrayComponents);
+
+    const auto left     = static_cast<size_t> (x);
+    const auto bottom   = static_cast<size_t> (layer) * dimensions + static_cast<size_t> (y);
+
+    for (size_t row { 0 }; row < static_cast<size_t> (height); ++row)
+    {
+        const auto offset = ((bottom + row) * dimensions + left) * arrayComponents;
+        std::memcpy (level.data() + offset, texels.data() + row * rowSize, rowSize);
+    }
+
+    return true;
+}
+
+
+UploadService::TextureRegion Materials::texelRegion (const GLint x, const GLint y, const GLint layer, 
+    const GLsizei width, const GLsizei height, const size_t components, const size_t bytesPerComponent) noexcept
+{
+    // Maps components to pixel formats.
+    constexpr GLenum pixelFormats[] = { 0, GL_RED, GL_RG, GL_RGB, GL_RGBA };
+
+    const auto format   = pixelFormats[components];
+    const auto type     = static_cast<GLenum> (bytesPerComponent == 1 ? GL_UNSIGNED_BYTE : GL_UNSIGNED_SHORT);
+
+    return { x, y, layer, width, height, format, type };
+}
+
+
+void Materials::generateMipmaps (TextureStreamer::Source& source) noexcept
+{
+    const auto components   = source.pixelFormat == GL_RGBA ? size_t { 4 } : size_t { 3 };
+    const auto layers       = static_cast<size_t> (source.layers);
+
+    for (size_t level { 1 }; level < source.levels.size(); ++level)
+    {
+        const auto& previous    = source.levels[level - 1];
+        auto& current           = source.levels[level];
+        const auto dimensions   = std::max (source.dimensions >> (level - 1), 1);
+        const auto layerSize    = previous.size() / layers;
+
+        // Each layer is filtered separately so texels never bleed between layers.
+        current.clear();
+
+        for (size_t layer { 0 }; layer < layers; ++layer)
+        {
+            const auto first    = std::begin (previous) + static_cast<std::ptrdiff_t> (layer * layerSize);
+            const auto filtered = util::downsample ({ first, first + static_cast<std::ptrdiff_t> (layerSize) }, 
+                dimensions, dimensions, components);
+            
+            current.insert (std::end (current), std::begin (filtered), std::end (filtered));
+        }
+    }
+}
+
+
+void Materials::addTexturesToArray (Internals& internals, LayerPlacements& placements, 
+    const std::pair<GLuint, Texture2DArray*>& indexAndArray, const size_t dimensions, 
+    const size_t components, const EncodedImages& images) const noexcept
+{
+    // Each image takes up an entire layer, the count tracks the next free layer.
     auto& count = internals.counts[dimensions][components];
 
-    for (const auto& loadedImage : images.vector)
+    for (const auto& encodedImage : images.vector)
     {
-        // Cache useful values.
-        const auto& fileLocation    = loadedImage.first;
-        const auto& image           = loadedImage.second;
+        const auto layer = static_cast<GLint> (count++);
 
-        // Maps components to pixel formats.
-        constexpr GLenum pixelFormats[] = { 0, GL_RED, GL_RG, GL_RGB, GL_RGBA };
+        placements.push_back ({ &encodedImage.second, indexAndArray, layer });
+        internals.ids[encodedImage.first] = { indexAndArray.first, static_cast<GLuint> (layer) };
+    }
+}
 
-        // Each image should take up an entire layer.
-        const auto x        = GLint { 0 };
-        const auto y        = GLint { 0 };
-        const auto z        = static_cast<GLint> (count);
-        const auto size     = static_cast<GLsizei> (dimensions);
-        const auto depth    = GLsizei { 1 };
-        const auto format   = pixelFormats[image.componentsPerPixel()];
-        const auto type     = image.bytesPerComponent() == 1 ? GL_UNSIGNED_BYTE : GL_UNSIGNED_SHORT;
 
-        // Upload the image data.
-        array.placeAt (x, y, z, size, size, depth, format, type, image.pixelData());
+bool Materials::uploadLayer (Internals& internals, UploadService& uploads, 
+    const LayerPlacement& placement) const noexcept
+{
+    const auto& decoder     = placement.image->decoder;
+    const auto dimensions   = static_cast<GLsizei> (decoder.width());
+    const auto components   = decoder.componentsPerPixel();
+    const auto bytes        = decoder.bytesPerComponent();
+    const auto size         = decoder.rowSize() * decoder.height();
+
+    // OpenGL expects the bottom row first.
+    const auto decode = [&] (void* destination) 
+    { 
+        return decoder.decode (destination, decoder.rowSize(), true); 
+    };
 
-        // Finally set the index of the image.
-        internals.ids[fileLocation] = { arrayIndex, static_cast<GLuint> (count++) };
+    if (internals.sources.find (placement.array.first) == std::end (internals.sources))
+    {
+        const auto region = texelRegion (0, 0, placement.layer, dimensions, dimensions, components, bytes);
+        return uploads.writeToTexture (*placement.array.second, region, static_cast<GLsizeiptr> (size), decode);
     }
+
+    // Streamed arrays are converted as they're copied into their source so the image is decoded into memory first.
+    auto texels = std::vector<std::uint8_t> (size);
+
+    return decode (texels.data()) && placeTexels (internals, uploads, placement.array, 0, 0, placement.layer, 
+        dimensions, dimensions, components, bytes, texels.data());
 }
 
 
@@ -346,28 +994,37 @@ std::pair<bool, Material> Materials::generateMaterial (Internals& internals, con
     auto material = Material { };
 
     // This is how properties will be set.
-    const auto setProperty = [&] (auto& set, const auto& map, const auto& uniform)
+    const auto setProperty = [&] (Material::Map& set, const auto& map, const auto& uniform)
     {
         // Use the map if one has been provided. If the map doesn't exist we wouldn't have made it to this point.
         if (!map.empty())
         {
-            set = internals.ids[map];
+            const auto& id  = internals.ids[map];
+            set.array       = id.x;
+            set.layer       = id.y;
+
+            // Atlased maps only cover part of their layer.
+            const auto atlased = internals.rects.find (map);
+
+            if (atlased != std::end (internals.rects))
+            {
+                const auto& value = atlased->second;
+                set.rect = { glm::packUnorm2x16 ({ value.x, value.y }), glm::packUnorm2x16 ({ value.z, value.w }) };
+            }
         }
 
         // We'll need to construct an ID for the uniform and potentially buffer the uniform.
         else
         {
             // The ID should be each component with a space between.
-            auto id = ""s;
-            for (const auto component : uniform)
-            {
-                id += std::to_string (component) + " ";
-            }
+            const auto id = constantID (uniform);
 
             // It's already been generated so use that index.
             if (internals.contains (id))
             {
-                set = internals.ids[id];
+                const auto& existing    = internals.ids[id];
+                set.array               = existing.x;
+                set.layer               = existing.y;
             }
 
             // Add the uniform value manually.
@@ -381,10 +1038,10 @@ std::pair<bool, Material> Materials::generateMaterial (Internals& internals, con
                 const auto index            = indexAndArray.first;
                 auto& array                 = *indexAndArray.second;
 
-                // Ensure we aren't going over the maximum depth.
+                // Ensure we aren't going over the planned depth, this only occurs if the plan missed a colour.
                 auto& count = internals.counts[1][uniform.size()];
 
-                if (count == Internals::getMaxArrayDepth())
+                if (count >= internals.layers[1][uniform.size()])
                 {
                     return false;
                 }
@@ -394,8 +1051,9 @@ std::pair<bool, Material> Materials::generateMaterial (Internals& internals, con
                     pixelFormats[uniform.size()], GL_UNSIGNED_BYTE, uniform.data());
 
                 // Finally add the ID.
-                set                 = { index, static_cast<GLuint> (count++) };
-                internals.ids[id]   = set;
+                set.array           = index;
+                set.layer           = static_cast<GLuint> (count++);
+                internals.ids[id]   = { set.array, set.layer };
             }
         }
 
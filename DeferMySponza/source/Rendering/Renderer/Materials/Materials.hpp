@@ -4,7 +4,9 @@
 #define         _RENDERING_RENDERER_MATERIALS_
 
 // STL headers.
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -13,17 +15,19 @@
 // Engine headers.
 #include <tgl/tgl.h>
 #include <scene/scene_fwd.hpp>
+#include <tygra/ContentPack.hpp>
 #include <tygra/Image.hpp>
+#include <tygra/PngDecoder.hpp>
 
 
 // Personal headers.
+#include <Rendering/Composites/UploadService.hpp>
 #include <Rendering/Renderer/Materials/Internals/Material.hpp>
+#include <Rendering/Renderer/Materials/TextureStreamer.hpp>
 #include <Rendering/Renderer/Types.hpp>
 #include <Rendering/Objects/Texture.hpp>
-
-
-// Forward declarations.
-struct PBSMaterial;
+#include <Utility/BakedTexture.hpp>
+#include <Utility/Scene.hpp>
 
 
 /// <summary>
@@ -48,30 +52,51 @@ class Materials final
         /// <returns> The material ID if successful, the maximum value if not found. </returns> 
         types::MaterialID operator[] (const scene::MaterialId sceneID) const noexcept;
 
-        /// <summary> Retrieves the texture unit of the material buffer. </summary>
-        GLint getMaterialTextureUnit() const noexcept;
-
         /// <summary> Retrieves the texture unit of the first texture array. </summary>
         GLint getTextureArrayStartingUnit() const noexcept;
 
         /// <summary> Retrieves the total number of texture arrays. </summary>
         GLint getTextureArrayCount() const noexcept;
 
+        /// <summary> Checks whether the arrays are sampled through bindless handles rather than texture units. </summary>
+        bool usesBindlessTextures() const noexcept;
+
+        /// <summary> Gets the object which streams texture levels, it's only initialised when streaming is enabled. </summary>
+        const TextureStreamer& getStreamer() const noexcept { return m_streamer; }
+
+        /// <summary> Gets the object which streams texture levels, it's only initialised when streaming is enabled. </summary>
+        TextureStreamer& getStreamer() noexcept             { return m_streamer; }
+
+
+        /// <summary> Everything initialise() needs from the scene, created by prepare() without touching OpenGL. </summary>
+        struct Preparation;
+
+        /// <summary> 
+        /// Reads every material in the scene and opens the textures they use. This doesn't touch OpenGL so it may be
+        /// called from any thread, allowing textures to be read whilst the context is busy with other work.
+        /// </summary>
+        /// <param name="scene"> Contains every material in the scene. </param>
+        /// <returns> Whether every texture could be opened and the prepared materials. </returns>
+        std::pair<bool, Preparation> prepare (const scene::Context& scene) const noexcept;
 
         /// <summary> 
         /// Constructs every material in the scene, including loading every texture and mapping scene::MaterialId 
         /// values to built-in values. Successive calls will not change the object unless initialisation is successful.
         /// </summary>
-        /// <param name="scene"> Contains every material in the scene. </param>
+        /// <param name="prepared"> Every material in the scene with its textures opened by prepare(). </param>
         /// <param name="startingTextureUnit"> The initial index to apply to stored textures. </param>
+        /// <param name="streaming"> Whether texture arrays should be streamed and the memory they may use. </param>
+        /// <param name="bindless"> Whether shaders sample through bindless handles, this can't be used with streaming. </param>
+        /// <param name="uploads"> Uploads texture layers as they're decoded, every upload is issued before returning. </param>
         /// <returns> Whether initialisation was successful or not. </returns>
-        bool initialise (const scene::Context& scene, const GLuint startingTextureUnit) noexcept;
+        bool initialise (const Preparation& prepared, const GLuint startingTextureUnit, 
+            const TextureStreamer::Settings& streaming, const bool bindless, UploadService& uploads) noexcept;
 
         /// <summary> Destroys every stored object and returns to a clean state. </summary>
         void clean() noexcept;
 
 
-        /// <summary> Binds every texture unit with its associated texture. </summary>
+        /// <summary> Binds every texture unit with its associated texture, nothing is bound with bindless textures. </summary>
         void bindTextures() const noexcept;
 
         /// <summary> Unbind every texture, leaving their associated texture units in a clean state. </summary>
@@ -86,6 +111,7 @@ class Materials final
 
         MaterialIDs     m_materialIDs   { };    //!< Maps scene material IDs to stored GPU material IDs.
         Pimpl           m_internals     { };    //!< A pointer to internal managed data.
+        TextureStreamer m_streamer      { };    //!< Streams the levels of texture arrays when enabled.
 
     private:
 
@@ -95,43 +121,217 @@ class Materials final
             using ImageWithID = std::pair<std::string, tygra::Image>;
             std::vector<ImageWithID> vector { };
         };
+
+        /// <summary> 
+        /// A PNG file which has been opened but not decoded, it's decoded straight into the staging ring when it's
+        /// uploaded. The decoder points into the file so this can only be moved.
+        /// </summary>
+        struct EncodedImage final
+        {
+            std::vector<unsigned char>  file    { };    //!< The contents of the file, empty when it's viewed in the content pack.
+            tygra::ContentView          view    { };    //!< The file in the mounted content pack, if it was found there.
+            tygra::PngDecoder           decoder { };    //!< Opened on the file so the format is known before decoding.
+
+            EncodedImage() noexcept                                 = default;
+            EncodedImage (EncodedImage&&) noexcept                  = default;
+            EncodedImage& operator= (EncodedImage&&) noexcept       = default;
+            ~EncodedImage()                                         = default;
+
+            EncodedImage (const EncodedImage&)                      = delete;
+            EncodedImage& operator= (const EncodedImage&)           = delete;
+        };
+
+        /// <summary> This can't be an alias because Visual Studio truncates long symbol names. </summary>
+        struct EncodedImages final
+        {
+            using EncodedWithID = std::pair<std::string, EncodedImage>;
+            std::vector<EncodedWithID> vector { };
+        };
+
+        /// <summary> Baked textures are kept apart from decoded images as they're uploaded without conversion. </summary>
+        struct BakedImages final
+        {
+            using BakedWithID = std::pair<std::string, BakedTexture>;
+            std::vector<BakedWithID> vector { };
+        };
         
         using FileLocations     = std::unordered_set<std::string>;
         using Dimensions        = size_t;
         using Components        = size_t;
-        using TexturesToBuffer  = std::unordered_map<Dimensions, std::unordered_map<Components, Images>>;
+        using TexturesToBuffer  = std::unordered_map<Dimensions, std::unordered_map<Components, EncodedImages>>;
+        using BakedToBuffer     = std::unordered_map<Dimensions, BakedImages>;
+        using Layout            = std::unordered_map<Dimensions, std::unordered_map<Components, size_t>>;
+
+        /// <summary> Every texture opened by openTextures(), sorted by whether it was baked or decoded. </summary>
+        struct OpenedTextures final
+        {
+            TexturesToBuffer    encoded { };    //!< PNG files which fill a whole layer, they're decoded whilst uploading.
+            Images              atlased { };    //!< Decoded PNG images of any other size which will be packed into atlas layers.
+            BakedToBuffer       baked   { };    //!< BC7 textures which contain every mipmap level.
+        };
+
+        /// <summary> Where an atlased image will be uploaded, the position is of the padding around the image. </summary>
+        struct AtlasPlacement final
+        {
+            size_t      image       { 0 };  //!< The index of the image in the atlased images.
+            Dimensions  dimensions  { 0 };  //!< The dimensions of the array containing the atlas.
+            Components  components  { 0 };  //!< The components of the array containing the atlas.
+            GLint       layer       { 0 };  //!< The layer of the array, this follows any whole images in the array.
+            GLint       x           { 0 };  //!< The left edge of the padded image.
+            GLint       y           { 0 };  //!< The bottom edge of the padded image.
+        };
+
+        using AtlasPlacements = std::vector<AtlasPlacement>;
+
+        /// <summary> An image which fills a whole layer and the layer it has been assigned. </summary>
+        struct LayerPlacement final
+        {
+            const EncodedImage*                 image   { nullptr };    //!< The image to decode into the layer.
+            std::pair<GLuint, Texture2DArray*>  array   { };            //!< The texture unit index and the array.
+            GLint                               layer   { 0 };          //!< The layer of the array.
+        };
+
+        using LayerPlacements = std::vector<LayerPlacement>;
+
+        /// <summary> The result of planning, how many layers each array needs and where atlased images are stored. </summary>
+        struct Plan final
+        {
+            Layout          layout      { };    //!< The number of layers needed by each uncompressed array.
+            AtlasPlacements placements  { };    //!< The location of every atlased image.
+        };
 
         /// <summary> Generates the material data in the scene. </summary>
-        bool generateMaterials (MaterialIDs& materialIDs, Internals& internals, 
-            const scene::Context& scene) const noexcept;
+        bool generateMaterials (MaterialIDs& materialIDs, Internals& internals, UploadService& uploads,
+            const Preparation& prepared) const noexcept;
 
         /// <summary> 
-        /// Performs a pass through the given materials list, loading all textures in the scene, allocating enough
-        /// memory in the texture arrays and finally loading the images into their respective arrays.
+        /// Plans the layout of the opened textures, allocating enough memory in the texture arrays and finally
+        /// loading the images into their respective arrays.
         /// </summary>
-        bool loadTextures (Internals& internals, const std::vector<PBSMaterial>& materials) const noexcept;
+        bool loadTextures (Internals& internals, UploadService& uploads, const Preparation& prepared) const noexcept;
 
         /// <summary> Iterates through the list of materials, collecting every texture map file location. </summary>
         FileLocations collectFileLocations (const std::vector<PBSMaterial>& materials) const noexcept;
 
         /// <summary> 
-        /// Goes through the given set of file locations, loading each into a tygra::Image and mapping it based on its
-        /// components and dimensions. 
+        /// Goes through the given set of file locations, opening each PNG and mapping it based on its components and
+        /// dimensions. Files are read in parallel across worker threads, only images which must be atlased are decoded
+        /// here. If a valid baked texture exists alongside an image it will be loaded instead and mapped based on its
+        /// dimensions.
+        /// </summary>
+        std::pair<bool, OpenedTextures> openTextures (FileLocations& files) const noexcept;
+
+        /// <summary>
+        /// Counts exactly how many layers each uncompressed texture array needs before anything is allocated. This
+        /// includes the 1x1 constant colours which generateMaterial() will create for materials without maps. Atlased
+        /// images are packed into layers which follow the whole images of the array they're assigned to.
+        /// </summary>
+        /// <returns> Whether every array fits within the maximum array depth of the GPU. </returns>
+        std::pair<bool, Plan> planLayout (const std::vector<PBSMaterial>& materials, 
+            const TexturesToBuffer& textures, const Images& atlased) const noexcept;
+
+        /// <summary> 
+        /// Loads the given textures into texture arrays stored on the GPU. Layers are assigned up front and then the
+        /// images are decoded, padded and converted across worker threads whilst this thread uploads them.
         /// </summary>
-        std::pair<bool, TexturesToBuffer> openTextures (FileLocations& files) const noexcept;
+        bool bufferTextures (Internals& internals, UploadService& uploads, const TexturesToBuffer& textures, 
+            const Images& atlased, const AtlasPlacements& placements) const noexcept;
+
+        /// <summary> 
+        /// Uploads every level of the given baked textures into the BC7 texture arrays. When streaming the levels are
+        /// copied into the sources of the arrays instead.
+        /// </summary>
+        bool bufferBakedTextures (Internals& internals, const BakedToBuffer& textures) const noexcept;
+
+        /// <summary> Hands the source of every streamed array to the given streamer, uploading the initial levels. </summary>
+        bool startStreaming (TextureStreamer& streamer, Internals& internals, 
+            const TextureStreamer::Settings& settings) const noexcept;
 
-        /// <summary> Loads the given textures into texture arrays stored on the GPU. </summary>
-        bool bufferTextures (Internals& internals, TexturesToBuffer& textures) const noexcept;
+        /// <summary> Checks whether a baked texture can be stored in the BC7 texture arrays. </summary>
+        static bool isBakedTextureSupported (const BakedTexture& texture) noexcept;
 
-        /// <summary> Allocates memory for 2048 textures in the 1x1 array and adds default data. </summary>
+        /// <summary> Allocates exactly as many layers in the 1x1 arrays as the planned layout requires. </summary>
         void prepare1x1TextureArrays (Internals& internals) const noexcept;
 
-        /// <summary> Adds all of the given images to the given texture array, also updates the texture IDs. </summary>
-        void addTexturesToArray (Internals& internals, Texture2DArray& array, const GLuint arrayIndex, 
-            const size_t dimensions, const size_t components, const Images& images) const noexcept;
+        /// <summary> 
+        /// Allocates every other array with the planned layers and a full mipmap chain. When streaming a source is
+        /// created in system memory instead, the streamer allocates the storage later.
+        /// </summary>
+        bool prepareSizedTextureArrays (Internals& internals) const noexcept;
+
+        /// <summary> 
+        /// Places texels into an array through the upload service, or into the source of the array when it's being
+        /// streamed. Streamed texels are converted to 8 bits with the component count of the array. This may be
+        /// called from any thread as long as each call writes to a different region.
+        /// </summary>
+        bool placeTexels (Internals& internals, UploadService& uploads, 
+            const std::pair<GLuint, Texture2DArray*>& indexAndArray, const GLint x, const GLint y, const GLint layer, 
+            const GLsizei width, const GLsizei height, const size_t components, const size_t bytesPerComponent, 
+            const void* data) const noexcept;
+
+        /// <summary> Describes where texels are uploaded to and the format OpenGL will convert them from. </summary>
+        static UploadService::TextureRegion texelRegion (const GLint x, const GLint y, const GLint layer, 
+            const GLsizei width, const GLsizei height, const size_t components, const size_t bytesPerComponent) noexcept;
+
+        /// <summary> Box filters the first level of the given source into a full mipmap chain. </summary>
+        static void generateMipmaps (TextureStreamer::Source& source) noexcept;
+
+        /// <summary> Records the texture ID and the UV rectangle of each atlased image inside its layer. </summary>
+        bool addAtlasedTextures (Internals& internals, const Images& images, 
+            const AtlasPlacements& placements) const noexcept;
+
+        /// <summary> 
+        /// Uploads an atlased image surrounded by a border of wrapped texels so repeating and filtering near the edges
+        /// matches an image which fills a whole layer.
+        /// </summary>
+        bool uploadAtlasedTexture (Internals& internals, UploadService& uploads, const Images& images, 
+            const AtlasPlacement& placement) const noexcept;
+
+        /// <summary> 
+        /// Copies an image into a larger region of memory, filling the border by wrapping around the image. The
+        /// texels must have room for the padded image.
+        /// </summary>
+        static void wrapPadding (const tygra::Image& image, const size_t padding, std::uint8_t* texels) noexcept;
+
+        /// <summary> 
+        /// Assigns each of the given images a layer of the given texture array and updates the texture IDs. The
+        /// images are decoded and uploaded later by uploadLayer().
+        /// </summary>
+        void addTexturesToArray (Internals& internals, LayerPlacements& placements, 
+            const std::pair<GLuint, Texture2DArray*>& indexAndArray, const size_t dimensions, 
+            const size_t components, const EncodedImages& images) const noexcept;
+
+        /// <summary> 
+        /// Decodes an image into its layer. Arrays with storage let OpenGL convert the texels so the image is decoded
+        /// straight into the staging ring.
+        /// </summary>
+        bool uploadLayer (Internals& internals, UploadService& uploads, const LayerPlacement& placement) const noexcept;
 
         /// <summary> Constructs a new material from the given scene material. </summary>
         std::pair<bool, Material> generateMaterial (Internals& internals, const PBSMaterial& sceneMaterial) const noexcept;
+
+        /// <summary> Constructs the ID of a constant colour, each component is followed by a space. </summary>
+        template <typename Uniform>
+        static std::string constantID (const Uniform& uniform) noexcept
+        {
+            auto id = std::string { };
+
+            for (const auto component : uniform)
+            {
+                id += std::to_string (component) + " ";
+            }
+
+            return id;
+        }
+
+    public:
+
+        /// <summary> The encoded images point into the files they were opened from so this can only be moved. </summary>
+        struct Preparation final
+        {
+            std::vector<PBSMaterial>    materials   { };    //!< Every material in the scene.
+            OpenedTextures              textures    { };    //!< Every texture used by the materials, opened and sorted.
+        };
 };
 
 #endif // _RENDERING_RENDERER_MATERIALS_
\ No newline at end of file
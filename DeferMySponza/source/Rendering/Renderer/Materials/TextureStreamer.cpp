@@ -0,0 +1,473 @@
+#include "TextureStreamer.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+
+// Personal headers.
+#include <Rendering/Binders/BufferBinder.hpp>
+#include <Rendering/Binders/ProgramBinder.hpp>
+#include <Rendering/State/StateCache.hpp>
+
+
+bool TextureStreamer::isInitialised() const noexcept
+{
+    return m_staging.isInitialised() && m_usage.isInitialised();
+}
+
+
+bool TextureStreamer::initialise (const Settings& settings) noexcept
+{
+    // Every row of the largest level must fit in a single partition.
+    if (settings.stagingSize < 2048 * 4 || settings.initialDimensions < 1)
+    {
+        return false;
+    }
+
+    // Create temporary objects so we don't modify the object on failure.
+    auto staging    = types::PMB { };
+    auto usage      = types::PMB { };
+
+    // Each feedback partition is bound as a shader storage range so it must respect the offset alignment.
+    auto alignment = GLint { 0 };
+    glGetIntegerv (GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    alignment = std::max (alignment, 1);
+
+    const auto usageSize = static_cast<GLsizeiptr> ((sizeof (Usage) + alignment - 1) / alignment * alignment);
+
+    if (!(staging.initialise (settings.stagingSize, false, false) && usage.initialise (usageSize, true, true)))
+    {
+        return false;
+    }
+
+    m_settings      = settings;
+    m_statistics    = Statistics { };
+    m_staging       = std::move (staging);
+    m_usage         = std::move (usage);
+    m_partition     = 0;
+    m_streams.clear();
+    m_recorded.fill (false);
+    return true;
+}
+
+
+void TextureStreamer::clean() noexcept
+{
+    m_staging.clean();
+    m_usage.clean();
+    m_streams.clear();
+    m_statistics    = Statistics { };
+    m_partition     = 0;
+    m_recorded.fill (false);
+}
+
+
+bool TextureStreamer::add (Texture2DArray& array, const GLuint index, Source&& source) noexcept
+{
+    const auto levelCount = static_cast<GLsizei> (source.levels.size());
+
+    if (!isInitialised() || index >= arrayCount || levelCount < 1 || source.layers < 1)
+    {
+        return false;
+    }
+
+    // Every level must contain each layer.
+    for (const auto& level : source.levels)
+    {
+        if (level.empty() || level.size() % static_cast<size_t> (source.layers) != 0)
+        {
+            return false;
+        }
+    }
+
+    // Start at the finest level which isn't larger than the initial dimensions.
+    auto initial = GLsizei { 0 };
+
+    while (initial < levelCount - 1 && static_cast<size_t> (levelDimensions (source, initial)) > m_settings.initialDimensions)
+    {
+        ++initial;
+    }
+
+    m_streams.emplace_back();
+    auto& stream        = m_streams.back();
+    stream.array        = &array;
+    stream.index        = index;
+    stream.source       = std::move (source);
+    stream.allocated    = levelCount;
+    stream.resident     = levelCount;
+    stream.initial      = initial;
+    stream.desired      = 0;
+
+    if (!reallocate (stream, initial))
+    {
+        m_streams.pop_back();
+        return false;
+    }
+
+    // The initial levels are small enough to upload directly from system memory.
+    const auto& data = stream.source;
+    glPixelStorei (GL_UNPACK_ALIGNMENT, 1);
+
+    for (auto level = initial; level < levelCount; ++level)
+    {
+        const auto size     = levelDimensions (data, level);
+        const auto& texels  = data.levels[static_cast<size_t> (level)];
+
+        if (data.pixelFormat == 0)
+        {
+            array.placeCompressedAt (0, 0, 0, size, size, data.layers, data.internalFormat,
+                static_cast<GLsizei> (texels.size()), texels.data(), level - initial);
+        }
+
+        else
+        {
+            array.placeAt (0, 0, 0, size, size, data.layers, data.pixelFormat, GL_UNSIGNED_BYTE,
+                texels.data(), level - initial);
+        }
+    }
+
+    glPixelStorei (GL_UNPACK_ALIGNMENT, 4);
+    stream.resident = initial;
+    array.setParameter (GL_TEXTURE_BASE_LEVEL, 0);
+    updateStatistics();
+    return true;
+}
+
+
+void TextureStreamer::beginFrame (const size_t partition) noexcept
+{
+    if (!isInitialised())
+    {
+        return;
+    }
+
+    // The fence of the partition has been signalled so the GPU has finished with the feedback and staged texels.
+    m_partition = partition % types::multiBuffering;
+    m_statistics.uploadedBytes = 0;
+
+    collectUsage();
+    upload();
+    updateStatistics();
+}
+
+
+void TextureStreamer::gatherUsage (const Program& usageProgram, const GLsizei width, const GLsizei height) noexcept
+{
+    if (!isInitialised() || m_streams.empty())
+    {
+        return;
+    }
+
+    const auto buffer   = m_usage.getID();
+    const auto offset   = m_usage.partitionOffset (m_partition);
+    const auto size     = static_cast<GLsizeiptr> (sizeof (Usage));
+    StateCache::bindBuffersRange (GL_SHADER_STORAGE_BUFFER, 0, 1, &buffer, &offset, &size);
+
+    const auto program  = ProgramBinder { usageProgram };
+    const auto samples  = workGroupSize * sampleSpacing;
+    const auto groupsX  = static_cast<GLuint> ((width + samples - 1) / samples);
+    const auto groupsY  = static_cast<GLuint> ((height + samples - 1) / samples);
+    glDispatchCompute (groupsX, groupsY, 1);
+
+    // The CPU reads the feedback through a persistent mapping once the frame's fence has been signalled.
+    glMemoryBarrier (GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT);
+    m_recorded[m_partition] = true;
+}
+
+
+void TextureStreamer::collectUsage() noexcept
+{
+    auto data = usage (m_partition);
+
+    // Frames without feedback, such as forward rendered frames, keep the previous requests.
+    if (m_recorded[m_partition])
+    {
+        for (auto& stream : m_streams)
+        {
+            const auto footprint    = data->footprints[stream.index];
+            stream.pixels           = data->pixels[stream.index];
+
+            // Arrays which weren't seen are allowed to fall back to their initial level.
+            if (stream.pixels == 0 || footprint == std::numeric_limits<GLuint>::max())
+            {
+                stream.desired = stream.initial;
+                continue;
+            }
+
+            // The footprint is the UV distance between neighbouring pixels, so the finest level needed is where each
+            // pixel covers a single texel.
+            auto distance = 0.f;
+            std::memcpy (&distance, &footprint, sizeof (distance));
+
+            const auto texels   = distance * stream.source.dimensions;
+            const auto level    = texels > 1.f ? static_cast<GLsizei> (std::floor (std::log2 (texels))) : 0;
+            stream.desired      = std::min (level, stream.initial);
+        }
+    }
+
+    // Footprints are reduced with atomicMin() so they must start at the largest value.
+    std::memset (data->footprints.data(), 0xFF, sizeof (data->footprints));
+    std::memset (data->pixels.data(), 0, sizeof (data->pixels));
+    m_recorded[m_partition] = false;
+}
+
+
+void TextureStreamer::upload() noexcept
+{
+    // Arrays which are partially uploaded are finished first so their allocated storage gets used, then the arrays
+    // covering the most pixels are upgraded.
+    auto candidates = std::vector<Stream*> { };
+
+    for (auto& stream : m_streams)
+    {
+        if (stream.resident > stream.desired)
+        {
+            candidates.push_back (&stream);
+        }
+    }
+
+    std::sort (std::begin (candidates), std::end (candidates), [] (const Stream* a, const Stream* b)
+    {
+        const auto aStarted = a->allocated < a->resident;
+        const auto bStarted = b->allocated < b->resident;
+
+        if (aStarted != bStarted)
+        {
+            return aStarted;
+        }
+
+        return a->pixels != b->pixels ? a->pixels > b->pixels : a->resident > b->resident;
+    });
+
+    if (candidates.empty())
+    {
+        return;
+    }
+
+    // Rows of arbitrary widths aren't guaranteed to be aligned.
+    const auto unpackBuffer = BufferBinder<GL_PIXEL_UNPACK_BUFFER> { m_staging.getBuffer() };
+    glPixelStorei (GL_UNPACK_ALIGNMENT, 1);
+
+    auto staged = GLsizeiptr { 0 };
+
+    for (auto stream : candidates)
+    {
+        // Keep upgrading the array until it reaches the requested level.
+        while (stream->resident > stream->desired)
+        {
+            const auto level = stream->resident - 1;
+
+            // Arrays which can't fit are skipped so smaller arrays can still be upgraded.
+            if (stream->allocated > level && !makeRoomFor (*stream, level))
+            {
+                break;
+            }
+
+            if (!uploadRows (*stream, staged))
+            {
+                glPixelStorei (GL_UNPACK_ALIGNMENT, 4);
+                return;
+            }
+        }
+    }
+
+    glPixelStorei (GL_UNPACK_ALIGNMENT, 4);
+}
+
+
+bool TextureStreamer::uploadRows (Stream& stream, GLsizeiptr& staged) noexcept
+{
+    const auto& source  = stream.source;
+    const auto level    = stream.resident - 1;
+    const auto& texels  = source.levels[static_cast<size_t> (level)];
+
+    const auto compressed   = source.pixelFormat == 0;
+    const auto size         = levelDimensions (source, level);
+    const auto rowHeight    = compressed ? GLsizei { 4 } : GLsizei { 1 };
+    const auto rows         = rowCount (source, level);
+    const auto layerSize    = texels.size() / static_cast<size_t> (source.layers);
+    const auto rowSize      = static_cast<GLsizeiptr> (layerSize / static_cast<size_t> (rows));
+
+    auto destination    = m_staging.pointer (m_partition);
+    const auto start    = m_staging.partitionOffset (m_partition);
+    const auto capacity = m_staging.partitionSize();
+
+    // Rows are uploaded in batches which never span more than a single layer.
+    while (stream.progress < rows * source.layers)
+    {
+        const auto layer    = stream.progress / rows;
+        const auto row      = stream.progress % rows;
+        const auto count    = std::min (static_cast<GLsizei> ((capacity - staged) / rowSize), rows - row);
+
+        if (count <= 0)
+        {
+            return false;
+        }
+
+        const auto bytes = rowSize * count;
+        std::memcpy (destination + staged, texels.data() + layer * layerSize + row * rowSize, static_cast<size_t> (bytes));
+        m_staging.notifyModifiedDataRange (m_partition, { staged, static_cast<GLsizei> (bytes) });
+
+        // The texture level is relative to the finest allocated level and the data is an offset into the buffer.
+        const auto y        = row * rowHeight;
+        const auto height   = std::min (count * rowHeight, size - y);
+        const auto offset   = reinterpret_cast<const GLvoid*> (start + staged);
+        const auto storage  = level - stream.allocated;
+
+        if (compressed)
+        {
+            stream.array->placeCompressedAt (0, y, layer, size, height, 1, source.internalFormat,
+                static_cast<GLsizei> (bytes), offset, storage);
+        }
+
+        else
+        {
+            stream.array->placeAt (0, y, layer, size, height, 1, source.pixelFormat, GL_UNSIGNED_BYTE, offset, storage);
+        }
+
+        staged                      += bytes;
+        stream.progress             += count;
+        m_statistics.uploadedBytes  += static_cast<size_t> (bytes);
+    }
+
+    // Every layer of the level has been uploaded so it can be sampled.
+    stream.resident = level;
+    stream.progress = 0;
+    stream.array->setParameter (GL_TEXTURE_BASE_LEVEL, stream.resident - stream.allocated);
+    ++m_statistics.upgrades;
+    return true;
+}
+
+
+bool TextureStreamer::makeRoomFor (Stream& stream, const GLsizei level) noexcept
+{
+    const auto growth = storageSize (stream.source, level) - storageSize (stream.source, stream.allocated);
+
+    while (m_statistics.allocatedBytes + growth > m_settings.budget)
+    {
+        // Arrays finer than requested are evicted first, then the arrays covering the fewest pixels. Arrays covering
+        // more pixels than the one being upgraded are left alone so residency doesn't oscillate.
+        auto victim = static_cast<Stream*> (nullptr);
+
+        for (auto& other : m_streams)
+        {
+            if (&other == &stream || other.allocated >= other.initial ||
+                (other.allocated >= other.desired && other.pixels >= stream.pixels))
+            {
+                continue;
+            }
+
+            const auto unwanted = other.allocated < other.desired;
+
+            if (!victim || unwanted > (victim->allocated < victim->desired) ||
+                (unwanted == (victim->allocated < victim->desired) && other.pixels < victim->pixels))
+            {
+                victim = &other;
+            }
+        }
+
+        if (!victim || !reallocate (*victim, victim->allocated + 1))
+        {
+            return false;
+        }
+
+        ++m_statistics.evictions;
+    }
+
+    return reallocate (stream, level);
+}
+
+
+bool TextureStreamer::reallocate (Stream& stream, const GLsizei level) noexcept
+{
+    const auto& source      = stream.source;
+    const auto levelCount   = static_cast<GLsizei> (source.levels.size());
+    const auto size         = levelDimensions (source, level);
+
+    auto replacement = Texture2DArray { };
+
+    if (!replacement.initialise (stream.array->getDesiredTextureUnit()))
+    {
+        return false;
+    }
+
+    replacement.allocateImmutableStorage (source.internalFormat, size, size, source.layers, levelCount - level);
+    replacement.setParameter (GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    replacement.setParameter (GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    replacement.setParameter (GL_TEXTURE_WRAP_S, GL_REPEAT);
+    replacement.setParameter (GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+    // Only complete levels are kept, a partially uploaded level has to be streamed again.
+    const auto resident = std::max (stream.resident, level);
+
+    for (auto copy = resident; copy < levelCount && stream.array->isInitialised(); ++copy)
+    {
+        const auto copySize = levelDimensions (source, copy);
+        glCopyImageSubData (stream.array->getID(), GL_TEXTURE_2D_ARRAY, copy - stream.allocated, 0, 0, 0,
+            replacement.getID(), GL_TEXTURE_2D_ARRAY, copy - level, 0, 0, 0, copySize, copySize, source.layers);
+    }
+
+    replacement.setParameter (GL_TEXTURE_BASE_LEVEL, std::min (resident, levelCount - 1) - level);
+
+    m_statistics.allocatedBytes -= storageSize (source, stream.allocated);
+    m_statistics.allocatedBytes += storageSize (source, level);
+
+    *stream.array       = std::move (replacement);
+    stream.allocated    = level;
+    stream.resident     = resident;
+    stream.progress     = 0;
+    return true;
+}
+
+
+void TextureStreamer::updateStatistics() noexcept
+{
+    m_statistics.residentBytes  = 0;
+    m_statistics.requestedBytes = 0;
+    m_statistics.pendingLevels  = 0;
+
+    for (const auto& stream : m_streams)
+    {
+        m_statistics.residentBytes  += storageSize (stream.source, stream.resident);
+        m_statistics.requestedBytes += storageSize (stream.source, std::min (stream.desired, stream.resident));
+        m_statistics.pendingLevels  += static_cast<GLuint> (std::max (stream.resident - stream.desired, 0));
+    }
+}
+
+
+TextureStreamer::Usage* TextureStreamer::usage (const size_t partition) noexcept
+{
+    return reinterpret_cast<Usage*> (m_usage.pointer (partition));
+}
+
+
+GLsizei TextureStreamer::levelDimensions (const Source& source, const GLsizei level) noexcept
+{
+    return std::max (source.dimensions >> level, 1);
+}
+
+
+GLsizei TextureStreamer::rowCount (const Source& source, const GLsizei level) noexcept
+{
+    // Compressed levels are stored in rows of 4x4 blocks.
+    const auto size = levelDimensions (source, level);
+    return source.pixelFormat == 0 ? (size + 3) / 4 : size;
+}
+
+
+size_t TextureStreamer::storageSize (const Source& source, const GLsizei level) noexcept
+{
+    auto size = size_t { 0 };
+
+    for (auto i = static_cast<size_t> (std::max (level, 0)); i < source.levels.size(); ++i)
+    {
+        size += source.levels[i].size();
+    }
+
+    return size;
+}
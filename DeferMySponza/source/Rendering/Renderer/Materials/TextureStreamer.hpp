@@ -0,0 +1,202 @@
+#pragma once
+
+#if !defined    _RENDERING_RENDERER_MATERIALS_TEXTURE_STREAMER_
+#define         _RENDERING_RENDERER_MATERIALS_TEXTURE_STREAMER_
+
+// STL headers.
+#include <array>
+#include <cstdint>
+#include <vector>
+
+
+// Personal headers.
+#include <Rendering/Composites/PersistentMappedBuffer.hpp>
+#include <Rendering/Objects/Program.hpp>
+#include <Rendering/Objects/Texture.hpp>
+#include <Rendering/Renderer/Types.hpp>
+
+
+/// <summary>
+/// Streams the mipmap levels of material texture arrays. Only the coarsest levels are uploaded before the first frame,
+/// finer levels are then uploaded a few rows at a time through a persistently mapped pixel unpack buffer with one
+/// partition per buffered frame, the fence of each frame protects its partition from being overwritten whilst the GPU
+/// is still reading it. A compute program samples the gbuffer to find which arrays are visible and how fine a level
+/// they need, the results are read back without stalling in the same way as the complexity histograms. Arrays are
+/// upgraded in order of how many pixels use them whilst keeping the allocated storage under a budget, arrays which are
+/// used less are evicted to make room.
+///
+/// Immutable storage can't shrink and sparse textures aren't available everywhere so each change in resolution
+/// reallocates the array and copies the resident levels on the GPU. Every level is kept in system memory so evicted
+/// levels can be streamed again.
+/// </summary>
+class TextureStreamer final
+{
+    public:
+
+        constexpr static auto arrayCount = size_t { 23 };  //!< Must match TextureUsage.cs and the texture arrays in MaterialFetcher.fs.
+
+        /// <summary> Controls whether textures are streamed and how much memory they may use. </summary>
+        struct Settings final
+        {
+            bool        enabled             { false };                  //!< Whether textures are streamed or every level is uploaded at startup.
+            size_t      budget              { 256 * 1024 * 1024 };      //!< How many bytes of texture storage the streamed arrays may allocate.
+            GLsizeiptr  stagingSize         { 8 * 1024 * 1024 };        //!< How many bytes can be uploaded each frame.
+            size_t      initialDimensions   { 64 };                     //!< The size of the largest level uploaded before the first frame.
+        };
+
+        /// <summary> Describes the memory and upload activity of the streamed arrays. </summary>
+        struct Statistics final
+        {
+            size_t      allocatedBytes  { 0 };  //!< The storage allocated for every streamed array.
+            size_t      residentBytes   { 0 };  //!< The storage of levels which have been completely uploaded.
+            size_t      requestedBytes  { 0 };  //!< The storage needed for every array to reach the level the feedback requested.
+            size_t      uploadedBytes   { 0 };  //!< How many bytes were uploaded in the most recent frame.
+            GLuint      pendingLevels   { 0 };  //!< How many requested levels aren't resident yet.
+            GLuint      upgrades        { 0 };  //!< How many levels have been made resident since initialisation.
+            GLuint      evictions       { 0 };  //!< How many levels have been evicted to stay under the budget.
+        };
+
+        /// <summary> Every level of a texture array stored in system memory. </summary>
+        struct Source final
+        {
+            using Level     = std::vector<std::uint8_t>;
+            using Levels    = std::vector<Level>;
+
+            GLenum  internalFormat  { 0 };  //!< The format of the storage, e.g. GL_RGB8 or GL_COMPRESSED_RGBA_BPTC_UNORM.
+            GLenum  pixelFormat     { 0 };  //!< The format of uncompressed 8-bit texels, e.g. GL_RGB. Zero when compressed.
+            GLsizei dimensions      { 0 };  //!< The width and height of the finest level.
+            GLsizei layers          { 0 };  //!< How many layers the array contains.
+            Levels  levels          { };    //!< Every level of the full mipmap chain, each contains every layer in order.
+        };
+
+        TextureStreamer() noexcept                                  = default;
+        TextureStreamer (TextureStreamer&&) noexcept                = default;
+        TextureStreamer& operator= (TextureStreamer&&) noexcept     = default;
+        ~TextureStreamer()                                          = default;
+
+        TextureStreamer (const TextureStreamer&)                    = delete;
+        TextureStreamer& operator= (const TextureStreamer&)         = delete;
+
+
+        /// <summary> Check if the staging and feedback buffers have been created. </summary>
+        bool isInitialised() const noexcept;
+
+        /// <summary> Gets the settings the streamer was initialised with. </summary>
+        const Settings& getSettings() const noexcept        { return m_settings; }
+
+        /// <summary> Gets the memory and upload activity of the streamed arrays. </summary>
+        const Statistics& getStatistics() const noexcept    { return m_statistics; }
+
+        /// <summary> Gets the staging buffer so the bytes written to it can be recorded. </summary>
+        types::PMB& getStagingBuffer() noexcept             { return m_staging; }
+
+
+        /// <summary>
+        /// Creates the staging and feedback buffers. Successive calls will forget every streamed array. Upon failure
+        /// the object will not be modified.
+        /// </summary>
+        /// <param name="settings"> Controls the budget and how much can be uploaded each frame. </param>
+        /// <returns> Whether the buffers were successfully created. </returns>
+        bool initialise (const Settings& settings) noexcept;
+
+        /// <summary> Deletes the buffers and forgets every streamed array, the arrays themselves are left alone. </summary>
+        void clean() noexcept;
+
+        /// <summary>
+        /// Starts streaming the given array. Storage is allocated for the levels no larger than the initial dimensions
+        /// and they're uploaded immediately. The array must outlive the streamer or be removed by clean().
+        /// </summary>
+        /// <param name="array"> An initialised array without storage, it will be replaced whenever it's resized. </param>
+        /// <param name="index"> The index of the array in the texture samplers of the material shaders. </param>
+        /// <param name="source"> Every level of the array. </param>
+        /// <returns> Whether the array can be streamed. </returns>
+        bool add (Texture2DArray& array, const GLuint index, Source&& source) noexcept;
+
+
+        /// <summary>
+        /// Collects the usage feedback of the frame which last used the given partition, evicts and reallocates
+        /// arrays and then uploads as many rows as the staging partition can hold. This must be called after
+        /// synchronising with the GPU and before the arrays are bound.
+        /// </summary>
+        void beginFrame (const size_t partition) noexcept;
+
+        /// <summary>
+        /// Measures which arrays are sampled by the pixels in the gbuffer. The gbuffer and materials must be bound.
+        /// </summary>
+        /// <param name="usage"> The compute program which samples the gbuffer. </param>
+        /// <param name="width"> The width of the gbuffer. </param>
+        /// <param name="height"> The height of the gbuffer. </param>
+        void gatherUsage (const Program& usage, const GLsizei width, const GLsizei height) noexcept;
+
+    private:
+
+        constexpr static auto workGroupSize = GLsizei { 16 };   //!< Must match the local size of TextureUsage.cs.
+        constexpr static auto sampleSpacing = GLsizei { 4 };    //!< Must match TextureUsage.cs, one pixel in each 4x4 block is sampled.
+
+        /// <summary> The feedback written by TextureUsage.cs. </summary>
+        struct Usage final
+        {
+            std::array<GLuint, arrayCount> footprints;  //!< The smallest UV distance between neighbouring pixels as float bits.
+            std::array<GLuint, arrayCount> pixels;      //!< How many sampled pixels used each array.
+        };
+
+        /// <summary> The residency of a streamed array. </summary>
+        struct Stream final
+        {
+            Texture2DArray* array       { nullptr };    //!< The array which is reallocated as levels are streamed in and out.
+            GLuint          index       { 0 };          //!< The index used by the usage feedback.
+            Source          source      { };            //!< Every level of the array.
+            GLsizei         allocated   { 0 };          //!< The finest level which has storage, storage always continues to the coarsest level.
+            GLsizei         resident    { 0 };          //!< The finest level which has been completely uploaded.
+            GLsizei         progress    { 0 };          //!< How many rows of the level above the resident level have been uploaded.
+            GLsizei         desired     { 0 };          //!< The finest level which the feedback requested.
+            GLsizei         initial     { 0 };          //!< The level uploaded at startup, arrays are never evicted beyond it.
+            GLuint          pixels      { 0 };          //!< How many sampled pixels used the array in the most recent feedback.
+        };
+
+        using Streams   = std::vector<Stream>;
+        using Recorded  = std::array<bool, types::multiBuffering>;
+
+        Settings    m_settings      { };    //!< Controls the budget and how much can be uploaded each frame.
+        Statistics  m_statistics    { };    //!< The memory and upload activity of the streamed arrays.
+        Streams     m_streams       { };    //!< Every streamed array.
+        types::PMB  m_staging       { };    //!< Texels are copied here and then uploaded by the GPU.
+        types::PMB  m_usage         { };    //!< Contains one set of usage feedback per buffered frame.
+        Recorded    m_recorded      { };    //!< Whether each partition contains feedback waiting to be read.
+        size_t      m_partition     { 0 };  //!< The partition which the current frame uses.
+
+    private:
+
+        /// <summary> Reads the feedback of the current partition and calculates which level each array needs. </summary>
+        void collectUsage() noexcept;
+
+        /// <summary> Uploads the rows of the most used arrays until the staging partition is full. </summary>
+        void upload() noexcept;
+
+        /// <summary> Uploads rows of the level above the resident level, making the level resident once complete. </summary>
+        /// <returns> Whether the level was completed, false means the staging partition is full. </returns>
+        bool uploadRows (Stream& stream, GLsizeiptr& staged) noexcept;
+
+        /// <summary> Evicts less used arrays until the given array can allocate the given level. </summary>
+        bool makeRoomFor (Stream& stream, const GLsizei level) noexcept;
+
+        /// <summary> Replaces the storage of an array so the given level is the finest, copying resident levels. </summary>
+        bool reallocate (Stream& stream, const GLsizei level) noexcept;
+
+        /// <summary> Recalculates the memory statistics of every array. </summary>
+        void updateStatistics() noexcept;
+
+        /// <summary> Gets a pointer to the feedback stored in the given partition. </summary>
+        Usage* usage (const size_t partition) noexcept;
+
+        /// <summary> Gets the width and height of a level. </summary>
+        static GLsizei levelDimensions (const Source& source, const GLsizei level) noexcept;
+
+        /// <summary> Gets how many rows of texels or compressed blocks each layer of a level contains. </summary>
+        static GLsizei rowCount (const Source& source, const GLsizei level) noexcept;
+
+        /// <summary> Gets how many bytes the storage of the given level and every coarser level requires. </summary>
+        static size_t storageSize (const Source& source, const GLsizei level) noexcept;
+};
+
+#endif // _RENDERING_RENDERER_MATERIALS_TEXTURE_STREAMER_
@@ -0,0 +1,201 @@
+#include "ComplexityCounter.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+
+// Personal headers.
+#include <Rendering/Binders/ProgramBinder.hpp>
+#include <Rendering/State/StateCache.hpp>
+
+
+bool ComplexityCounter::isInitialised() const noexcept
+{
+    return m_overdraw.isInitialised() && m_lights.isInitialised() && m_buffer.isInitialised();
+}
+
+
+float ComplexityCounter::mean (const Bins& bins) noexcept
+{
+    auto pixels = GLuint64 { 0 };
+    auto total  = GLuint64 { 0 };
+
+    for (size_t i { 0 }; i < binCount; ++i)
+    {
+        pixels  += bins[i];
+        total   += bins[i] * i;
+    }
+
+    return pixels > 0 ? static_cast<float> (total) / pixels : 0.f;
+}
+
+
+GLuint ComplexityCounter::percentile (const Bins& bins, const float proportion) noexcept
+{
+    const auto pixels   = std::accumulate (std::begin (bins), std::end (bins), GLuint64 { 0 });
+    const auto target   = static_cast<GLuint64> (pixels * std::min (std::max (proportion, 0.f), 1.f));
+    auto seen           = GLuint64 { 0 };
+
+    for (size_t i { 0 }; i < binCount; ++i)
+    {
+        seen += bins[i];
+
+        if (seen >= target && seen > 0)
+        {
+            return static_cast<GLuint> (i);
+        }
+    }
+
+    return 0;
+}
+
+
+bool ComplexityCounter::initialise (const GLsizei width, const GLsizei height) noexcept
+{
+    if (width < 1 || height < 1)
+    {
+        return false;
+    }
+
+    // Create temporary objects so we don't modify the object on failure.
+    auto overdraw   = TextureRectangle { };
+    auto lights     = TextureRectangle { };
+    auto buffer     = types::PMB { };
+
+    // Each partition is bound as a shader storage range so it must respect the offset alignment.
+    auto alignment = GLint { 0 };
+    glGetIntegerv (GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    alignment = std::max (alignment, 1);
+
+    const auto partitionSize = static_cast<GLsizeiptr> ((sizeof (Histograms) + alignment - 1) / alignment * alignment);
+
+    if (!(overdraw.initialise (0) && lights.initialise (0) && buffer.initialise (partitionSize, true, true)))
+    {
+        return false;
+    }
+
+    overdraw.allocateImmutableStorage (GL_R32UI, width, height);
+    lights.allocateImmutableStorage (GL_R32UI, width, height);
+
+    m_overdraw  = std::move (overdraw);
+    m_lights    = std::move (lights);
+    m_buffer    = std::move (buffer);
+    m_width     = width;
+    m_height    = height;
+    m_partition = 0;
+    m_recorded.fill (false);
+    reset();
+    return true;
+}
+
+
+void ComplexityCounter::clean() noexcept
+{
+    m_overdraw.clean();
+    m_lights.clean();
+    m_buffer.clean();
+    m_width     = 0;
+    m_height    = 0;
+    m_partition = 0;
+    m_recorded.fill (false);
+    reset();
+}
+
+
+void ComplexityCounter::reset() noexcept
+{
+    m_last      = Histograms { };
+    m_collected = 0;
+}
+
+
+void ComplexityCounter::beginFrame (const size_t partition) noexcept
+{
+    if (!isInitialised())
+    {
+        return;
+    }
+
+    // The fence of the partition has been signalled so the GPU has finished writing the histograms.
+    m_partition = partition % types::multiBuffering;
+    auto data   = histograms (m_partition);
+
+    if (m_recorded[m_partition])
+    {
+        m_last = *data;
+        ++m_collected;
+    }
+
+    // The histograms are accumulated into with atomics so they must start at zero.
+    *data = Histograms { };
+    m_recorded[m_partition] = false;
+}
+
+
+void ComplexityCounter::beginGeometry() const noexcept
+{
+    if (!isInitialised())
+    {
+        return;
+    }
+
+    glClearTexImage (m_overdraw.getID(), 0, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+    glClearTexImage (m_lights.getID(), 0, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+    glBindImageTexture (0, m_overdraw.getID(), 0, GL_FALSE, 0, GL_READ_WRITE, GL_R32UI);
+}
+
+
+void ComplexityCounter::beginLights() const noexcept
+{
+    if (!isInitialised())
+    {
+        return;
+    }
+
+    glMemoryBarrier (GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+    glBindImageTexture (0, m_lights.getID(), 0, GL_FALSE, 0, GL_READ_WRITE, GL_R32UI);
+}
+
+
+void ComplexityCounter::reduce (const Program& histogram, const GLsizei width, const GLsizei height) noexcept
+{
+    if (!isInitialised())
+    {
+        return;
+    }
+
+    // Every counter must be written before the reduction reads them.
+    glMemoryBarrier (GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+    glBindImageTexture (0, m_overdraw.getID(), 0, GL_FALSE, 0, GL_READ_ONLY, GL_R32UI);
+    glBindImageTexture (1, m_lights.getID(), 0, GL_FALSE, 0, GL_READ_ONLY, GL_R32UI);
+
+    const auto buffer   = m_buffer.getID();
+    const auto offset   = m_buffer.partitionOffset (m_partition);
+    const auto size     = static_cast<GLsizeiptr> (sizeof (Histograms));
+    StateCache::bindBuffersRange (GL_SHADER_STORAGE_BUFFER, 0, 1, &buffer, &offset, &size);
+
+    // Pixels outside of the rendered region are never shaded so they'd only inflate the first bin.
+    const auto regionX = std::min (width, m_width);
+    const auto regionY = std::min (height, m_height);
+    glProgramUniform2i (histogram.getID(), 0, regionX, regionY);
+
+    const auto program = ProgramBinder { histogram };
+    const auto groupsX = static_cast<GLuint> ((regionX + workGroupSize - 1) / workGroupSize);
+    const auto groupsY = static_cast<GLuint> ((regionY + workGroupSize - 1) / workGroupSize);
+    glDispatchCompute (groupsX, groupsY, 1);
+
+    // The CPU reads the histograms through a persistent mapping once the frame's fence has been signalled.
+    glMemoryBarrier (GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT);
+    glBindImageTexture (0, 0, 0, GL_FALSE, 0, GL_READ_WRITE, GL_R32UI);
+    glBindImageTexture (1, 0, 0, GL_FALSE, 0, GL_READ_WRITE, GL_R32UI);
+    m_recorded[m_partition] = true;
+}
+
+
+ComplexityCounter::Histograms* ComplexityCounter::histograms (const size_t partition) noexcept
+{
+    return reinterpret_cast<Histograms*> (m_buffer.pointer (partition));
+}
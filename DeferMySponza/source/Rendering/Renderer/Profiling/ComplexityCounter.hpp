@@ -0,0 +1,119 @@
+#pragma once
+
+#if !defined    _RENDERING_RENDERER_COMPLEXITY_COUNTER_
+#define         _RENDERING_RENDERER_COMPLEXITY_COUNTER_
+
+// STL headers.
+#include <array>
+
+
+// Personal headers.
+#include <Rendering/Composites/PersistentMappedBuffer.hpp>
+#include <Rendering/Objects/Program.hpp>
+#include <Rendering/Objects/Texture.hpp>
+#include <Rendering/Renderer/Types.hpp>
+
+
+/// <summary>
+/// Measures overdraw and light complexity. The geometry and light volume passes increment a per-pixel R32UI counter
+/// using image atomics, a compute program then reduces the counters into histograms on the GPU. Histograms are written
+/// into a persistently mapped buffer with one partition per buffered frame so they can be read once the frame's fence
+/// has been signalled, without stalling.
+/// </summary>
+class ComplexityCounter final
+{
+    public:
+
+        constexpr static auto binCount = size_t { 64 }; //!< Must match ComplexityHistogram.cs, the last bin holds every larger count.
+
+        using Bins = std::array<GLuint, binCount>;
+
+        /// <summary> How many pixels were shaded a given number of times, indexed by the count. </summary>
+        struct Histograms final
+        {
+            Bins overdraw   { };    //!< How many times the geometry pass shaded each pixel.
+            Bins lights     { };    //!< How many point and spotlight volumes shaded each pixel.
+        };
+
+        ComplexityCounter() noexcept                                    = default;
+        ComplexityCounter (ComplexityCounter&&) noexcept                = default;
+        ComplexityCounter& operator= (ComplexityCounter&&) noexcept     = default;
+        ~ComplexityCounter()                                            = default;
+
+        ComplexityCounter (const ComplexityCounter&)                    = delete;
+        ComplexityCounter& operator= (const ComplexityCounter&)         = delete;
+
+
+        /// <summary> Check if the counters and histogram buffer have been created. </summary>
+        bool isInitialised() const noexcept;
+
+        /// <summary> Gets the histograms of the most recently collected frame. </summary>
+        const Histograms& getLastHistograms() const noexcept { return m_last; }
+
+        /// <summary> Gets how many frames have had their histograms collected since the last reset. </summary>
+        GLuint getCollectedFrames() const noexcept { return m_collected; }
+
+        /// <summary> Calculates the mean count of the given histogram. </summary>
+        static float mean (const Bins& bins) noexcept;
+
+        /// <summary> Finds the smallest count which the given proportion of pixels are less than or equal to. </summary>
+        static GLuint percentile (const Bins& bins, const float proportion) noexcept;
+
+
+        /// <summary>
+        /// Creates the counters at the given resolution along with the histogram buffer. Successive calls will replace
+        /// the existing objects. Upon failure the object will not be modified.
+        /// </summary>
+        /// <param name="width"> The width of the internal framebuffers. </param>
+        /// <param name="height"> The height of the internal framebuffers. </param>
+        /// <returns> Whether the objects were successfully created. </returns>
+        bool initialise (const GLsizei width, const GLsizei height) noexcept;
+
+        /// <summary> Deletes every object, freeing the memory used by the counters. </summary>
+        void clean() noexcept;
+
+        /// <summary> Discards the collected histograms. </summary>
+        void reset() noexcept;
+
+
+        /// <summary>
+        /// Collects the histograms of the frame which last used the given partition. This must be called after
+        /// synchronising with the GPU.
+        /// </summary>
+        void beginFrame (const size_t partition) noexcept;
+
+        /// <summary> Zeroes the counters and binds the overdraw counter for the geometry pass. </summary>
+        void beginGeometry() const noexcept;
+
+        /// <summary> Binds the light counter for the light volume passes. </summary>
+        void beginLights() const noexcept;
+
+        /// <summary> Reduces the rendered region of the counters into the current partition's histograms. </summary>
+        /// <param name="histogram"> The compute program which performs the reduction. </param>
+        /// <param name="width"> How many pixels wide the rendered region is, it starts at the origin. </param>
+        /// <param name="height"> How many pixels tall the rendered region is. </param>
+        void reduce (const Program& histogram, const GLsizei width, const GLsizei height) noexcept;
+
+    private:
+
+        constexpr static auto workGroupSize = GLsizei { 16 };   //!< Must match the local size of ComplexityHistogram.cs.
+
+        using Recorded = std::array<bool, types::multiBuffering>;
+
+        TextureRectangle    m_overdraw  { };        //!< Counts how many geometry fragments were shaded per pixel.
+        TextureRectangle    m_lights    { };        //!< Counts how many light volume fragments were shaded per pixel.
+        types::PMB          m_buffer    { };        //!< Contains one set of histograms per buffered frame.
+        Histograms          m_last      { };        //!< The histograms of the most recently collected frame.
+        Recorded            m_recorded  { };        //!< Whether each partition contains histograms waiting to be read.
+        size_t              m_partition { 0 };      //!< The partition which the current frame writes to.
+        GLsizei             m_width     { 0 };      //!< The width of the counters.
+        GLsizei             m_height    { 0 };      //!< The height of the counters.
+        GLuint              m_collected { 0 };      //!< How many frames have been collected.
+
+    private:
+
+        /// <summary> Gets a pointer to the histograms stored in the given partition. </summary>
+        Histograms* histograms (const size_t partition) noexcept;
+};
+
+#endif // _RENDERING_RENDERER_COMPLEXITY_COUNTER_
@@ -0,0 +1,146 @@
+#include "FrameRecorder.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <fstream>
+
+
+void FrameRecorder::submit (const size_t partition, const GLuint frame, const float cpuTime,
+    const float syncTime) noexcept
+{
+    // CPU timings are known immediately.
+    m_cpu.record (cpuTime);
+    m_sync.record (syncTime);
+
+    auto& pending       = m_pending[partition % types::multiBuffering];
+    pending.frame       = frame;
+    pending.cpuTime     = cpuTime;
+    pending.syncTime    = syncTime;
+    pending.valid       = true;
+}
+
+
+void FrameRecorder::resolve (const size_t partition, const float gpuTime, const PassTimer::Times& passes) noexcept
+{
+    auto& pending = m_pending[partition % types::multiBuffering];
+    if (!pending.valid)
+    {
+        return;
+    }
+
+    pending.valid = false;
+    m_gpu.record (gpuTime);
+
+    // A frame is over budget if either processor failed to keep up.
+    if (std::max (pending.cpuTime, gpuTime) <= m_budget)
+    {
+        return;
+    }
+
+    ++m_overBudget;
+
+    // Slow frames are expected if the renderer is consistently over budget, a stutter is a spike above the norm.
+    if (m_gpu.getCount() < minimumFrames)
+    {
+        return;
+    }
+
+    const auto cpuSpike = pending.cpuTime > stutterFactor * m_cpu.getPercentile (0.5f);
+    const auto gpuSpike = gpuTime > stutterFactor * m_gpu.getPercentile (0.5f);
+
+    if (cpuSpike || gpuSpike)
+    {
+        if (m_stutters.size() == maxStutters)
+        {
+            m_stutters.pop_front();
+        }
+
+        auto stutter        = Stutter { };
+        stutter.frame       = pending.frame;
+        stutter.cpuTime     = pending.cpuTime;
+        stutter.gpuTime     = gpuTime;
+        stutter.syncTime    = pending.syncTime;
+        stutter.passes      = passes;
+
+        m_stutters.push_back (stutter);
+        ++m_stutterCount;
+    }
+}
+
+
+void FrameRecorder::reset() noexcept
+{
+    m_cpu.reset();
+    m_gpu.reset();
+    m_sync.reset();
+    m_pending.fill (PendingFrame { });
+    m_stutters.clear();
+    m_overBudget    = 0;
+    m_stutterCount  = 0;
+}
+
+
+bool FrameRecorder::writeReport (const std::string& file) const noexcept
+{
+    auto output = std::ofstream { file };
+
+    if (!output.is_open())
+    {
+        return false;
+    }
+
+    const auto writeHistogram = [&] (const char* name, const Histogram& histogram)
+    {
+        output << "  \"" << name << "\": {\n";
+        output << "    \"count\": " << histogram.getCount() << ",\n";
+        output << "    \"min\": " << histogram.getMin() << ",\n";
+        output << "    \"mean\": " << histogram.getMean() << ",\n";
+        output << "    \"max\": " << histogram.getMax() << ",\n";
+        output << "    \"p50\": " << histogram.getPercentile (0.5f) << ",\n";
+        output << "    \"p95\": " << histogram.getPercentile (0.95f) << ",\n";
+        output << "    \"p99\": " << histogram.getPercentile (0.99f) << ",\n";
+        output << "    \"p99.9\": " << histogram.getPercentile (0.999f) << ",\n";
+        output << "    \"buckets\": [";
+
+        auto first = true;
+        histogram.forEachBucket ([&] (const float upperBound, const std::uint32_t count)
+        {
+            output << (first ? "" : ", ") << "[" << upperBound << ", " << count << "]";
+            first = false;
+        });
+
+        output << "]\n";
+        output << "  },\n";
+    };
+
+    output << "{\n";
+    output << "  \"budget\": " << m_budget << ",\n";
+    output << "  \"framesOverBudget\": " << m_overBudget << ",\n";
+    output << "  \"stutterCount\": " << m_stutterCount << ",\n";
+    writeHistogram ("cpu", m_cpu);
+    writeHistogram ("gpu", m_gpu);
+    writeHistogram ("sync", m_sync);
+    output << "  \"stutters\": [\n";
+
+    for (size_t i { 0 }; i < m_stutters.size(); ++i)
+    {
+        const auto& stutter = m_stutters[i];
+
+        output << "    { \"frame\": " << stutter.frame << ", \"cpu\": " << stutter.cpuTime
+            << ", \"gpu\": " << stutter.gpuTime << ", \"sync\": " << stutter.syncTime << ", \"passes\": {";
+
+        for (size_t pass { 0 }; pass < PassTimer::passCount; ++pass)
+        {
+            output << (pass == 0 ? " " : ", ") << "\"" << PassTimer::getName (static_cast<PassTimer::Pass> (pass))
+                << "\": " << stutter.passes[pass];
+        }
+
+        output << " } }" << (i + 1 < m_stutters.size() ? "," : "") << "\n";
+    }
+
+    output << "  ]\n";
+    output << "}\n";
+
+    return output.good();
+}
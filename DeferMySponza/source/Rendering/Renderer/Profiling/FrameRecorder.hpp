@@ -0,0 +1,121 @@
+#pragma once
+
+#if !defined    _RENDERING_RENDERER_FRAME_RECORDER_
+#define         _RENDERING_RENDERER_FRAME_RECORDER_
+
+// STL headers.
+#include <array>
+#include <deque>
+#include <string>
+
+
+// Personal headers.
+#include <Rendering/Renderer/Profiling/Histogram.hpp>
+#include <Rendering/Renderer/Profiling/PassTimer.hpp>
+#include <Rendering/Renderer/Types.hpp>
+
+
+/// <summary>
+/// Records the distribution of CPU frame time, GPU frame time and time spent waiting on the GPU in histograms so that
+/// tail latencies are visible rather than hidden by averages. Frames which exceed the budget are counted, and frames
+/// which also take far longer than the median are logged as stutters along with the GPU time of each pass. GPU
+/// timings arrive a few frames late so the CPU side of each frame is held until its GPU results are resolved.
+/// </summary>
+class FrameRecorder final
+{
+    public:
+
+        /// <summary> A frame which took significantly longer than usual. </summary>
+        struct Stutter final
+        {
+            GLuint              frame       { 0 };      //!< The index of the frame since timings were last reset.
+            float               cpuTime     { 0.f };    //!< How long the CPU spent rendering the frame (ms).
+            float               gpuTime     { 0.f };    //!< How long the GPU spent rendering the frame (ms).
+            float               syncTime    { 0.f };    //!< How long the CPU waited for the GPU (ms).
+            PassTimer::Times    passes      { };        //!< The GPU time of each pass (ms).
+        };
+
+        using Stutters = std::deque<Stutter>;
+
+        constexpr static auto defaultBudget = 1000.f / 60.f;    //!< The default frame budget, 60 FPS (ms).
+        constexpr static auto stutterFactor = 2.f;              //!< How many times the median a frame must take to stutter.
+        constexpr static auto minimumFrames = 30U;              //!< Frames required before the median is trusted.
+        constexpr static auto maxStutters   = size_t { 256 };   //!< How many of the most recent stutters are kept.
+
+        FrameRecorder() noexcept                                = default;
+        FrameRecorder (FrameRecorder&&) noexcept                = default;
+        FrameRecorder (const FrameRecorder&)                    = default;
+        FrameRecorder& operator= (FrameRecorder&&) noexcept     = default;
+        FrameRecorder& operator= (const FrameRecorder&)         = default;
+        ~FrameRecorder()                                        = default;
+
+
+        /// <summary> Gets the distribution of CPU frame times. </summary>
+        const Histogram& getCPUTimes() const noexcept   { return m_cpu; }
+
+        /// <summary> Gets the distribution of GPU frame times. </summary>
+        const Histogram& getGPUTimes() const noexcept   { return m_gpu; }
+
+        /// <summary> Gets the distribution of time spent waiting for the GPU. </summary>
+        const Histogram& getSyncTimes() const noexcept  { return m_sync; }
+
+        /// <summary> Gets the target frame time (ms). </summary>
+        float getBudget() const noexcept                { return m_budget; }
+
+        /// <summary> Sets the target frame time (ms). </summary>
+        void setBudget (const float budget) noexcept    { m_budget = budget; }
+
+        /// <summary> Gets how many frames took longer than the budget on either the CPU or GPU. </summary>
+        GLuint getFramesOverBudget() const noexcept     { return m_overBudget; }
+
+        /// <summary> Gets how many stutters have occurred, including any which are no longer kept. </summary>
+        GLuint getStutterCount() const noexcept         { return m_stutterCount; }
+
+        /// <summary> Gets the most recent stutters, oldest first. </summary>
+        const Stutters& getStutters() const noexcept    { return m_stutters; }
+
+
+        /// <summary> Records the CPU side of a frame, this will be held until its GPU timings are resolved. </summary>
+        /// <param name="partition"> The buffer partition the frame was rendered with. </param>
+        /// <param name="frame"> The index of the frame. </param>
+        /// <param name="cpuTime"> How long the CPU spent rendering the frame (ms). </param>
+        /// <param name="syncTime"> How long the CPU waited for the GPU (ms). </param>
+        void submit (const size_t partition, const GLuint frame, const float cpuTime, const float syncTime) noexcept;
+
+        /// <summary> Completes the frame previously submitted with the given partition. </summary>
+        /// <param name="partition"> The buffer partition the frame was rendered with. </param>
+        /// <param name="gpuTime"> How long the GPU spent rendering the frame (ms). </param>
+        /// <param name="passes"> The GPU time of each pass in the frame (ms). </param>
+        void resolve (const size_t partition, const float gpuTime, const PassTimer::Times& passes) noexcept;
+
+        /// <summary> Discards every recorded frame and stutter, the budget is kept. </summary>
+        void reset() noexcept;
+
+        /// <summary> Writes percentiles, histogram buckets and stutters to the given file as JSON. </summary>
+        /// <returns> Whether the file was written successfully. </returns>
+        bool writeReport (const std::string& file) const noexcept;
+
+    private:
+
+        /// <summary> The CPU side of a frame waiting for its GPU timings. </summary>
+        struct PendingFrame final
+        {
+            GLuint  frame       { 0 };      //!< The index of the frame.
+            float   cpuTime     { 0.f };    //!< How long the CPU spent rendering the frame (ms).
+            float   syncTime    { 0.f };    //!< How long the CPU waited for the GPU (ms).
+            bool    valid       { false };  //!< Whether the frame is waiting to be resolved.
+        };
+
+        using PendingFrames = std::array<PendingFrame, types::multiBuffering>;
+
+        Histogram       m_cpu           { };                //!< The distribution of CPU frame times.
+        Histogram       m_gpu           { };                //!< The distribution of GPU frame times.
+        Histogram       m_sync          { };                //!< The distribution of GPU wait times.
+        PendingFrames   m_pending       { };                //!< Frames waiting on GPU results, one per partition.
+        Stutters        m_stutters      { };                //!< The most recent stutters.
+        float           m_budget        { defaultBudget };  //!< The target frame time (ms).
+        GLuint          m_overBudget    { 0 };              //!< How many frames exceeded the budget.
+        GLuint          m_stutterCount  { 0 };              //!< How many stutters have occurred.
+};
+
+#endif // _RENDERING_RENDERER_FRAME_RECORDER_
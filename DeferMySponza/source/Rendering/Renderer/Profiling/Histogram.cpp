@@ -0,0 +1,98 @@
+#include "Histogram.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <cmath>
+
+
+float Histogram::getPercentile (const float fraction) const noexcept
+{
+    if (m_count == 0)
+    {
+        return 0.f;
+    }
+
+    // Walk the buckets until we've seen enough values.
+    const auto clamped  = std::min (std::max (fraction, 0.f), 1.f);
+    const auto target   = std::max (static_cast<std::uint64_t> (std::ceil (clamped * m_count)), std::uint64_t { 1 });
+    auto seen           = std::uint64_t { 0 };
+
+    for (std::uint32_t i { 0 }; i < bucketCount; ++i)
+    {
+        seen += m_counts[i];
+
+        if (seen >= target)
+        {
+            // The bucket bound may overshoot what was actually recorded.
+            return std::min (bucketUpperBound (i), m_max) / 1000.f;
+        }
+    }
+
+    return getMax();
+}
+
+
+void Histogram::record (const float milliseconds) noexcept
+{
+    const auto microseconds = static_cast<std::uint64_t> (std::max (milliseconds, 0.f) * 1000.f + 0.5f);
+
+    ++m_counts[bucketIndex (microseconds)];
+
+    m_min   = m_count == 0 ? microseconds : std::min (m_min, microseconds);
+    m_max   = std::max (m_max, microseconds);
+    m_total += microseconds;
+    ++m_count;
+}
+
+
+void Histogram::reset() noexcept
+{
+    m_counts.fill (0);
+    m_count = 0;
+    m_total = 0;
+    m_min   = 0;
+    m_max   = 0;
+}
+
+
+std::uint32_t Histogram::bucketIndex (const std::uint64_t microseconds) noexcept
+{
+    // Small values map directly onto the first set of linear sub-buckets.
+    if (microseconds < subBucketCount)
+    {
+        return static_cast<std::uint32_t> (microseconds);
+    }
+
+    // Otherwise shift the value until it occupies the top half of the sub-buckets, the shift is the exponent.
+    auto exponent   = std::uint32_t { 0 };
+    auto shifted    = microseconds;
+
+    while (shifted >= subBucketCount)
+    {
+        shifted >>= 1;
+        ++exponent;
+    }
+
+    if (exponent > exponentCount)
+    {
+        return bucketCount - 1;
+    }
+
+    return subBucketCount + (exponent - 1) * subBucketHalf + static_cast<std::uint32_t> (shifted - subBucketHalf);
+}
+
+
+std::uint64_t Histogram::bucketUpperBound (const std::uint32_t index) noexcept
+{
+    if (index < subBucketCount)
+    {
+        return index;
+    }
+
+    const auto offset       = index - subBucketCount;
+    const auto exponent     = offset / subBucketHalf + 1;
+    const auto subBucket    = std::uint64_t { offset % subBucketHalf + subBucketHalf };
+
+    return ((subBucket + 1) << exponent) - 1;
+}
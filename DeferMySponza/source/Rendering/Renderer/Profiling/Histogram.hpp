@@ -0,0 +1,97 @@
+#pragma once
+
+#if !defined    _RENDERING_RENDERER_HISTOGRAM_
+#define         _RENDERING_RENDERER_HISTOGRAM_
+
+// STL headers.
+#include <array>
+#include <cstdint>
+
+
+/// <summary>
+/// A fixed-size, log-linear histogram of timings in the style of HdrHistogram. Values are stored in microseconds.
+/// Below 128us every microsecond has its own bucket, above that each power of two is split into 64 buckets, so a
+/// reported value is within 1/64 (~1.6%) of the recorded one. Values up to 128 * 2^26us (~2.4 hours) are recorded in
+/// constant time with no allocations, which makes percentiles cheap enough to track every frame.
+/// </summary>
+class Histogram final
+{
+    public:
+
+        constexpr static auto subBucketBits     = std::uint32_t { 7 };                  //!< Linear precision of each power of two.
+        constexpr static auto subBucketCount    = std::uint32_t { 1 } << subBucketBits; //!< How many linear sub-buckets exist per power of two.
+        constexpr static auto subBucketHalf     = subBucketCount / 2;                   //!< Each power of two after the first reuses the top half.
+        constexpr static auto exponentCount     = std::uint32_t { 26 };                 //!< Powers of two beyond the first, covering ~2.4 hours.
+        constexpr static auto bucketCount       = subBucketCount + exponentCount * subBucketHalf;
+
+        Histogram() noexcept                                = default;
+        Histogram (Histogram&&) noexcept                    = default;
+        Histogram (const Histogram&) noexcept               = default;
+        Histogram& operator= (Histogram&&) noexcept         = default;
+        Histogram& operator= (const Histogram&) noexcept    = default;
+        ~Histogram()                                        = default;
+
+
+        /// <summary> Gets how many values have been recorded. </summary>
+        std::uint64_t getCount() const noexcept { return m_count; }
+
+        /// <summary> Gets the smallest recorded value (ms). </summary>
+        float getMin() const noexcept           { return m_count > 0 ? m_min / 1000.f : 0.f; }
+
+        /// <summary> Gets the largest recorded value (ms). </summary>
+        float getMax() const noexcept           { return m_max / 1000.f; }
+
+        /// <summary> Gets the average of every recorded value (ms). </summary>
+        float getMean() const noexcept          { return m_count > 0 ? static_cast<float> (m_total / m_count) / 1000.f : 0.f; }
+
+        /// <summary>
+        /// Gets the value which the given fraction of recorded values are less than or equal to (ms), e.g. 0.99 for
+        /// the 99th percentile. The result is accurate to the precision of the containing sub-bucket.
+        /// </summary>
+        float getPercentile (const float fraction) const noexcept;
+
+
+        /// <summary> Records a single value (ms), values beyond the range of the histogram are clamped. </summary>
+        void record (const float milliseconds) noexcept;
+
+        /// <summary> Discards every recorded value. </summary>
+        void reset() noexcept;
+
+
+        /// <summary> Calls the given function with the upper bound (ms) and count of every non-empty bucket. </summary>
+        template <typename Func>
+        void forEachBucket (const Func& func) const noexcept;
+
+    private:
+
+        using Counts = std::array<std::uint32_t, bucketCount>;
+
+        Counts          m_counts    { };    //!< How many values fall into each bucket.
+        std::uint64_t   m_count     { 0 };  //!< The total number of recorded values.
+        std::uint64_t   m_total     { 0 };  //!< The sum of every recorded value (us).
+        std::uint64_t   m_min       { 0 };  //!< The smallest recorded value (us).
+        std::uint64_t   m_max       { 0 };  //!< The largest recorded value (us).
+
+    private:
+
+        /// <summary> Finds the bucket which the given value (us) belongs to. </summary>
+        static std::uint32_t bucketIndex (const std::uint64_t microseconds) noexcept;
+
+        /// <summary> Gets the largest value (us) which maps to the given bucket. </summary>
+        static std::uint64_t bucketUpperBound (const std::uint32_t index) noexcept;
+};
+
+
+template <typename Func>
+void Histogram::forEachBucket (const Func& func) const noexcept
+{
+    for (std::uint32_t i { 0 }; i < bucketCount; ++i)
+    {
+        if (m_counts[i] > 0)
+        {
+            func (bucketUpperBound (i) / 1000.f, m_counts[i]);
+        }
+    }
+}
+
+#endif // _RENDERING_RENDERER_HISTOGRAM_
@@ -0,0 +1,204 @@
+#include "PassTimer.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+
+bool PassTimer::isInitialised() const noexcept
+{
+    for (const auto& frame : m_frames)
+    {
+        for (size_t i { 0 }; i < passCount; ++i)
+        {
+            if (!frame.starts[i].isInitialised() || !frame.ends[i].isInitialised())
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+const char* PassTimer::getName (const Pass pass) noexcept
+{
+    switch (pass)
+    {
+        case Pass::Frame:           return "Frame";
+        case Pass::ShadowMaps:      return "Shadow Maps";
+        case Pass::Geometry:        return "Geometry";
+        case Pass::GlobalLight:     return "Global Light";
+        case Pass::PointLights:     return "Point Lights";
+        case Pass::Spotlights:      return "Spotlights";
+        case Pass::Forward:         return "Forward";
+        case Pass::Antialiasing:    return "Antialiasing";
+        case Pass::Blit:            return "Blit";
+        default:                    return "Unknown";
+    }
+}
+
+
+PassTimer::Statistics PassTimer::getStatistics (const Pass pass) const noexcept
+{
+    const auto& samples = m_samples[static_cast<size_t> (pass)];
+    auto statistics     = Statistics { };
+
+    if (samples.count == 0)
+    {
+        return statistics;
+    }
+
+    // Percentiles require the samples to be sorted, we don't want to disturb the order of the ring.
+    auto sorted = std::vector<float> (samples.values.cbegin(), samples.values.cbegin() + samples.count);
+    std::sort (sorted.begin(), sorted.end());
+
+    const auto percentile = [&] (const float fraction)
+    {
+        const auto index = static_cast<size_t> (std::ceil (fraction * sorted.size())) - 1;
+        return sorted[std::min (index, sorted.size() - 1)];
+    };
+
+    auto total = 0.f;
+    for (const auto value : sorted)
+    {
+        total += value;
+    }
+
+    statistics.min      = sorted.front();
+    statistics.mean     = total / sorted.size();
+    statistics.max      = sorted.back();
+    statistics.p50      = percentile (0.5f);
+    statistics.p95      = percentile (0.95f);
+    statistics.p99      = percentile (0.99f);
+    statistics.samples  = static_cast<GLuint> (sorted.size());
+
+    return statistics;
+}
+
+
+bool PassTimer::initialise() noexcept
+{
+    // Create the queries in a temporary ring so we don't modify the object on failure.
+    auto frames = Frames { };
+
+    for (auto& frame : frames)
+    {
+        for (size_t i { 0 }; i < passCount; ++i)
+        {
+            if (!frame.starts[i].initialise (GL_TIMESTAMP) || !frame.ends[i].initialise (GL_TIMESTAMP))
+            {
+                return false;
+            }
+        }
+    }
+
+    m_frames    = std::move (frames);
+    m_partition = 0;
+    reset();
+    return true;
+}
+
+
+void PassTimer::clean() noexcept
+{
+    for (auto& frame : m_frames)
+    {
+        for (size_t i { 0 }; i < passCount; ++i)
+        {
+            frame.starts[i].clean();
+            frame.ends[i].clean();
+        }
+
+        frame.recorded.fill (false);
+        frame.pending = false;
+    }
+
+    m_partition = 0;
+    reset();
+}
+
+
+void PassTimer::reset() noexcept
+{
+    m_samples.fill (Samples { });
+    m_lastFrame.fill (0.f);
+    m_dropped = 0;
+}
+
+
+void PassTimer::beginFrame (const size_t partition) noexcept
+{
+    m_partition = partition % types::multiBuffering;
+    auto& frame = m_frames[m_partition];
+
+    if (frame.pending)
+    {
+        // The frame timestamp is always recorded last so once it's available every other pass will be too. If the
+        // GPU still hasn't finished then we discard the frame rather than stall.
+        const auto& lastTimestamp = frame.ends[static_cast<size_t> (Pass::Frame)];
+
+        if (lastTimestamp.isResultAvailable())
+        {
+            collect (frame);
+        }
+
+        else
+        {
+            m_lastFrame.fill (0.f);
+            ++m_dropped;
+        }
+    }
+
+    frame.recorded.fill (false);
+    frame.pending = false;
+}
+
+
+void PassTimer::begin (const Pass pass) noexcept
+{
+    m_frames[m_partition].starts[static_cast<size_t> (pass)].recordTimestamp();
+}
+
+
+void PassTimer::end (const Pass pass) noexcept
+{
+    auto& frame         = m_frames[m_partition];
+    const auto index    = static_cast<size_t> (pass);
+
+    frame.ends[index].recordTimestamp();
+    frame.recorded[index] = true;
+
+    // Results can only be collected when the enclosing frame has been timed.
+    if (pass == Pass::Frame)
+    {
+        frame.pending = true;
+    }
+}
+
+
+void PassTimer::collect (const Frame& frame) noexcept
+{
+    m_lastFrame.fill (0.f);
+
+    for (size_t i { 0 }; i < passCount; ++i)
+    {
+        if (frame.recorded[i])
+        {
+            const auto start    = frame.starts[i].resultAsUInt64 (false);
+            const auto end      = frame.ends[i].resultAsUInt64 (false);
+            const auto time     = end > start ? (end - start) / 1'000'000.f : 0.f;
+
+            auto& samples                   = m_samples[i];
+            samples.values[samples.next]    = time;
+            samples.next                    = (samples.next + 1) % windowSize;
+            samples.count                   = std::min (samples.count + 1, windowSize);
+            samples.last                    = time;
+            m_lastFrame[i]                  = time;
+        }
+    }
+}
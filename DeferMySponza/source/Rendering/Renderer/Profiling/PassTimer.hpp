@@ -0,0 +1,149 @@
+#pragma once
+
+#if !defined    _RENDERING_RENDERER_PASS_TIMER_
+#define         _RENDERING_RENDERER_PASS_TIMER_
+
+// STL headers.
+#include <array>
+
+
+// Personal headers.
+#include <Rendering/Objects/Query.hpp>
+#include <Rendering/Renderer/Types.hpp>
+
+
+/// <summary>
+/// Measures how long the GPU spends executing each rendering pass. GL_TIMESTAMP queries are recorded at the start and
+/// end of every pass and stored in a ring with one set of queries per buffered frame. Results are only read back once
+/// the GPU reports them as available so the CPU never waits. A rolling window of recent samples is kept for each pass
+/// so that minimum, mean, maximum and percentile timings can be reported.
+/// </summary>
+class PassTimer final
+{
+    public:
+
+        /// <summary> Each pass which can be timed. Frame encloses every other pass. </summary>
+        enum class Pass : size_t
+        {
+            Frame           = 0,
+            ShadowMaps      = 1,
+            Geometry        = 2,
+            GlobalLight     = 3,
+            PointLights     = 4,
+            Spotlights      = 5,
+            Forward         = 6,
+            Antialiasing    = 7,
+            Blit            = 8,
+            Count           = 9
+        };
+
+        /// <summary> A summary of the timings in the sample window of a pass (ms). </summary>
+        struct Statistics final
+        {
+            float   min     { 0.f };    //!< The quickest sample.
+            float   mean    { 0.f };    //!< The average sample.
+            float   max     { 0.f };    //!< The slowest sample.
+            float   p50     { 0.f };    //!< The median sample.
+            float   p95     { 0.f };    //!< 95% of samples were this quick or quicker.
+            float   p99     { 0.f };    //!< 99% of samples were this quick or quicker.
+            GLuint  samples { 0 };      //!< How many samples the statistics were calculated from.
+        };
+
+        constexpr static auto passCount     = static_cast<size_t> (Pass::Count);    //!< How many passes can be timed.
+        constexpr static auto windowSize    = size_t { 512 };                       //!< How many samples are kept per pass.
+
+        using Times = std::array<float, passCount>;
+
+        PassTimer() noexcept                                = default;
+        PassTimer (PassTimer&&) noexcept                    = default;
+        PassTimer& operator= (PassTimer&&) noexcept         = default;
+        ~PassTimer()                                        = default;
+
+        PassTimer (const PassTimer&)                        = delete;
+        PassTimer& operator= (const PassTimer&)             = delete;
+
+
+        /// <summary> Check if every query object has been created. </summary>
+        bool isInitialised() const noexcept;
+
+        /// <summary> Gets a human readable name for the given pass. </summary>
+        static const char* getName (const Pass pass) noexcept;
+
+        /// <summary> Gets the most recently retrieved time for the given pass (ms). </summary>
+        float getLastTime (const Pass pass) const noexcept { return m_samples[static_cast<size_t> (pass)].last; }
+
+        /// <summary> 
+        /// Gets the time of every pass in the most recently collected frame (ms). Passes which weren't executed, or
+        /// every pass if the frame was dropped, will be zero.
+        /// </summary>
+        const Times& getLastFrameTimes() const noexcept { return m_lastFrame; }
+
+        /// <summary> Gets how many frames had their timings discarded because they weren't ready in time. </summary>
+        GLuint getDroppedFrames() const noexcept { return m_dropped; }
+
+        /// <summary> Calculates the minimum, mean, maximum and percentile timings of the given pass. </summary>
+        Statistics getStatistics (const Pass pass) const noexcept;
+
+
+        /// <summary>
+        /// Attempts to create every timestamp query. Successive calls will recreate the queries and discard any
+        /// recorded samples. Upon failure the object will be left uninitialised.
+        /// </summary>
+        /// <returns> Whether the queries were successfully created. </returns>
+        bool initialise() noexcept;
+
+        /// <summary> Deletes every query and discards recorded samples. </summary>
+        void clean() noexcept;
+
+        /// <summary> Discards every recorded sample whilst leaving the queries intact. </summary>
+        void reset() noexcept;
+
+
+        /// <summary>
+        /// Collects the results of the frame which last used the given partition if the GPU has made them available,
+        /// then prepares the partition for recording. This should be called after synchronising with the GPU.
+        /// </summary>
+        void beginFrame (const size_t partition) noexcept;
+
+        /// <summary> Records the GPU time at which the given pass starts. </summary>
+        void begin (const Pass pass) noexcept;
+
+        /// <summary> Records the GPU time at which the given pass ends. </summary>
+        void end (const Pass pass) noexcept;
+
+    private:
+
+        /// <summary> The queries used by a single buffered frame. </summary>
+        struct Frame final
+        {
+            std::array<Query, passCount>    starts      { };    //!< Timestamps recorded at the beginning of each pass.
+            std::array<Query, passCount>    ends        { };    //!< Timestamps recorded at the end of each pass.
+            std::array<bool, passCount>     recorded    { };    //!< Which passes were executed during the frame.
+            bool                            pending     { };    //!< Whether the frame has results waiting to be read.
+        };
+
+        /// <summary> A rolling window of samples for a single pass. </summary>
+        struct Samples final
+        {
+            std::array<float, windowSize>   values      { };    //!< The ring of sample values (ms).
+            size_t                          count       { 0 };  //!< How many values in the ring are valid.
+            size_t                          next        { 0 };  //!< Where the next value will be written.
+            float                           last        { 0 };  //!< The most recent value.
+        };
+
+        using Frames        = std::array<Frame, types::multiBuffering>;
+        using PassSamples   = std::array<Samples, passCount>;
+
+        Frames      m_frames    { };    //!< A ring of queries, one entry per buffered frame.
+        PassSamples m_samples   { };    //!< Recent timings of each pass.
+        Times       m_lastFrame { };    //!< The timings of each pass in the most recently collected frame.
+        size_t      m_partition { 0 };  //!< The entry of the ring being recorded into.
+        GLuint      m_dropped   { 0 };  //!< How many frames of results have been discarded.
+
+    private:
+
+        /// <summary> Reads every recorded pass of the given frame into the sample windows. </summary>
+        void collect (const Frame& frame) noexcept;
+};
+
+#endif // _RENDERING_RENDERER_PASS_TIMER_
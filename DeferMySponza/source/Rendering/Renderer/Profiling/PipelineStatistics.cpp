@@ -0,0 +1,200 @@
+#include "PipelineStatistics.hpp"
+
+
+// STL headers.
+#include <utility>
+
+
+bool PipelineStatistics::isInitialised() const noexcept
+{
+    for (const auto& frame : m_frames)
+    {
+        for (const auto& pass : frame.queries)
+        {
+            for (const auto& query : pass)
+            {
+                if (!query.isInitialised())
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+
+const char* PipelineStatistics::getName (const Statistic statistic) noexcept
+{
+    switch (statistic)
+    {
+        case Statistic::VertexShaderInvocations:    return "Vertex Shader Invocations";
+        case Statistic::PrimitivesSubmitted:        return "Primitives Submitted";
+        case Statistic::ClippingInputPrimitives:    return "Clipping Input Primitives";
+        case Statistic::ClippingOutputPrimitives:   return "Clipping Output Primitives";
+        case Statistic::FragmentShaderInvocations:  return "Fragment Shader Invocations";
+        default:                                    return "Unknown";
+    }
+}
+
+
+bool PipelineStatistics::initialise() noexcept
+{
+    // Create the queries in a temporary ring so we don't modify the object on failure. Creation fails with an invalid
+    // enum if the driver doesn't support the extension.
+    auto frames = Frames { };
+
+    for (auto& frame : frames)
+    {
+        for (auto& pass : frame.queries)
+        {
+            for (size_t i { 0 }; i < statisticCount; ++i)
+            {
+                if (!pass[i].initialise (getTarget (static_cast<Statistic> (i))))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    m_frames    = std::move (frames);
+    m_partition = 0;
+    m_recording = false;
+    reset();
+    return true;
+}
+
+
+void PipelineStatistics::clean() noexcept
+{
+    for (auto& frame : m_frames)
+    {
+        for (auto& pass : frame.queries)
+        {
+            for (auto& query : pass)
+            {
+                query.clean();
+            }
+        }
+
+        frame.recorded.fill (false);
+        frame.pending = false;
+    }
+
+    m_partition = 0;
+    m_recording = false;
+    reset();
+}
+
+
+void PipelineStatistics::reset() noexcept
+{
+    m_lastFrame.fill (Counts { });
+    m_dropped = 0;
+}
+
+
+void PipelineStatistics::beginFrame (const size_t partition) noexcept
+{
+    if (!isInitialised())
+    {
+        return;
+    }
+
+    m_partition = partition % types::multiBuffering;
+    auto& frame = m_frames[m_partition];
+
+    if (frame.pending)
+    {
+        // Queries complete in order so once the last query of the last pass is available every other will be too.
+        const auto& lastQuery = frame.queries[frame.last].back();
+
+        if (lastQuery.isResultAvailable())
+        {
+            collect (frame);
+        }
+
+        else
+        {
+            m_lastFrame.fill (Counts { });
+            ++m_dropped;
+        }
+    }
+
+    frame.recorded.fill (false);
+    frame.pending = false;
+}
+
+
+void PipelineStatistics::begin (const PassTimer::Pass pass) noexcept
+{
+    if (pass == PassTimer::Pass::Frame || m_recording || !isInitialised())
+    {
+        return;
+    }
+
+    for (const auto& query : m_frames[m_partition].queries[static_cast<size_t> (pass)])
+    {
+        query.begin();
+    }
+
+    m_recording = true;
+}
+
+
+void PipelineStatistics::end (const PassTimer::Pass pass) noexcept
+{
+    if (pass == PassTimer::Pass::Frame || !m_recording)
+    {
+        return;
+    }
+
+    auto& frame         = m_frames[m_partition];
+    const auto index    = static_cast<size_t> (pass);
+
+    for (const auto& query : frame.queries[index])
+    {
+        query.end();
+    }
+
+    frame.recorded[index]   = true;
+    frame.last              = index;
+    frame.pending           = true;
+    m_recording             = false;
+}
+
+
+GLenum PipelineStatistics::getTarget (const Statistic statistic) noexcept
+{
+    switch (statistic)
+    {
+        case Statistic::VertexShaderInvocations:    return GL_VERTEX_SHADER_INVOCATIONS_ARB;
+        case Statistic::PrimitivesSubmitted:        return GL_PRIMITIVES_SUBMITTED_ARB;
+        case Statistic::ClippingInputPrimitives:    return GL_CLIPPING_INPUT_PRIMITIVES_ARB;
+        case Statistic::ClippingOutputPrimitives:   return GL_CLIPPING_OUTPUT_PRIMITIVES_ARB;
+        case Statistic::FragmentShaderInvocations:  return GL_FRAGMENT_SHADER_INVOCATIONS_ARB;
+        default:                                    return GL_NONE;
+    }
+}
+
+
+void PipelineStatistics::collect (const Frame& frame) noexcept
+{
+    const auto frameIndex = static_cast<size_t> (PassTimer::Pass::Frame);
+    m_lastFrame.fill (Counts { });
+
+    for (size_t i { 0 }; i < PassTimer::passCount; ++i)
+    {
+        if (frame.recorded[i])
+        {
+            for (size_t j { 0 }; j < statisticCount; ++j)
+            {
+                const auto count            = frame.queries[i][j].resultAsUInt64 (false);
+                m_lastFrame[i][j]           = count;
+                m_lastFrame[frameIndex][j]  += count;
+            }
+        }
+    }
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#if !defined    _RENDERING_RENDERER_PIPELINE_STATISTICS_
+#define         _RENDERING_RENDERER_PIPELINE_STATISTICS_
+
+// STL headers.
+#include <array>
+
+
+// Personal headers.
+#include <Rendering/Objects/Query.hpp>
+#include <Rendering/Renderer/Profiling/PassTimer.hpp>
+#include <Rendering/Renderer/Types.hpp>
+
+
+/// <summary>
+/// Counts the work the GPU performs during each rendering pass using GL_ARB_pipeline_statistics_query. Queries use
+/// the same ring as PassTimer, one set per buffered frame, and are only read once the GPU reports them as available.
+/// Only one query of each type can be active at a time so the statistics of the frame are the sum of every pass rather
+/// than a separate query. If the driver doesn't support the extension the object remains uninitialised and inert.
+/// </summary>
+class PipelineStatistics final
+{
+    public:
+
+        /// <summary> Each statistic which is gathered. </summary>
+        enum class Statistic : size_t
+        {
+            VertexShaderInvocations     = 0,
+            PrimitivesSubmitted         = 1,
+            ClippingInputPrimitives     = 2,
+            ClippingOutputPrimitives    = 3,
+            FragmentShaderInvocations   = 4,
+            Count                       = 5
+        };
+
+        constexpr static auto statisticCount = static_cast<size_t> (Statistic::Count);
+
+        using Counts = std::array<GLuint64, statisticCount>;
+
+        PipelineStatistics() noexcept                                   = default;
+        PipelineStatistics (PipelineStatistics&&) noexcept              = default;
+        PipelineStatistics& operator= (PipelineStatistics&&) noexcept   = default;
+        ~PipelineStatistics()                                           = default;
+
+        PipelineStatistics (const PipelineStatistics&)                  = delete;
+        PipelineStatistics& operator= (const PipelineStatistics&)       = delete;
+
+
+        /// <summary> Check if every query object has been created. </summary>
+        bool isInitialised() const noexcept;
+
+        /// <summary> Gets a human readable name for the given statistic. </summary>
+        static const char* getName (const Statistic statistic) noexcept;
+
+        /// <summary>
+        /// Gets the counts of the given pass in the most recently collected frame. Pass::Frame gives the total of every
+        /// pass. Passes which weren't executed will be zero.
+        /// </summary>
+        const Counts& getLastCounts (const PassTimer::Pass pass) const noexcept { return m_lastFrame[static_cast<size_t> (pass)]; }
+
+        /// <summary> Gets how many frames had their statistics discarded because they weren't ready in time. </summary>
+        GLuint getDroppedFrames() const noexcept { return m_dropped; }
+
+
+        /// <summary>
+        /// Attempts to create every pipeline statistics query. Successive calls will recreate the queries. Upon failure,
+        /// including when the extension isn't supported, the object will be left uninitialised.
+        /// </summary>
+        /// <returns> Whether the queries were successfully created. </returns>
+        bool initialise() noexcept;
+
+        /// <summary> Deletes every query and discards collected counts. </summary>
+        void clean() noexcept;
+
+        /// <summary> Discards collected counts whilst leaving the queries intact. </summary>
+        void reset() noexcept;
+
+
+        /// <summary>
+        /// Collects the results of the frame which last used the given partition if the GPU has made them available,
+        /// then prepares the partition for recording. This should be called after synchronising with the GPU.
+        /// </summary>
+        void beginFrame (const size_t partition) noexcept;
+
+        /// <summary> Starts counting for the given pass, Pass::Frame is ignored. </summary>
+        void begin (const PassTimer::Pass pass) noexcept;
+
+        /// <summary> Stops counting for the given pass, Pass::Frame is ignored. </summary>
+        void end (const PassTimer::Pass pass) noexcept;
+
+    private:
+
+        using PassQueries   = std::array<Query, statisticCount>;
+        using PassCounts    = std::array<Counts, PassTimer::passCount>;
+
+        /// <summary> The queries used by a single buffered frame. </summary>
+        struct Frame final
+        {
+            std::array<PassQueries, PassTimer::passCount>   queries     { };    //!< The queries of each pass.
+            std::array<bool, PassTimer::passCount>          recorded    { };    //!< Which passes were executed.
+            size_t                                          last        { 0 };  //!< The pass which ended last.
+            bool                                            pending     { };    //!< Whether results are waiting to be read.
+        };
+
+        using Frames = std::array<Frame, types::multiBuffering>;
+
+        Frames      m_frames    { };        //!< A ring of queries, one entry per buffered frame.
+        PassCounts  m_lastFrame { };        //!< The counts of each pass in the most recently collected frame.
+        size_t      m_partition { 0 };      //!< The entry of the ring being recorded into.
+        GLuint      m_dropped   { 0 };      //!< How many frames of results have been discarded.
+        bool        m_recording { false };  //!< Whether a pass is being counted, queries of a type can't overlap.
+
+    private:
+
+        /// <summary> Gets the query target of the given statistic. </summary>
+        static GLenum getTarget (const Statistic statistic) noexcept;
+
+        /// <summary> Reads every recorded pass of the given frame. </summary>
+        void collect (const Frame& frame) noexcept;
+};
+
+#endif // _RENDERING_RENDERER_PIPELINE_STATISTICS_
@@ -0,0 +1,131 @@
+#include "RenderStatistics.hpp"
+
+
+// STL headers.
+#include <algorithm>
+
+
+const char* RenderStatistics::getName (const Stream stream) noexcept
+{
+    switch (stream)
+    {
+        case Stream::Uniforms:              return "Uniforms";
+        case Stream::ObjectDrawCommands:    return "Object Draw Commands";
+        case Stream::ObjectMaterialIDs:     return "Object Material IDs";
+        case Stream::ObjectTransforms:      return "Object Transforms";
+        case Stream::LightDrawCommands:     return "Light Draw Commands";
+        case Stream::LightTransforms:       return "Light Transforms";
+        case Stream::Textures:              return "Textures";
+        default:                            return "Unknown";
+    }
+}
+
+
+const char* RenderStatistics::getName (const Light light) noexcept
+{
+    switch (light)
+    {
+        case Light::Directional:    return "Directional";
+        case Light::Point:          return "Point";
+        case Light::Spot:           return "Spot";
+        default:                    return "Unknown";
+    }
+}
+
+
+void RenderStatistics::reset() noexcept
+{
+    m_current   = Frame { };
+    m_last      = Frame { };
+    m_totals    = Frame { };
+    m_peaks     = Frame { };
+    m_frames    = 0;
+}
+
+
+void RenderStatistics::beginFrame() noexcept
+{
+    m_current = Frame { };
+}
+
+
+void RenderStatistics::recordDraws (const PassTimer::Pass pass, const Draws& draws, const GLuint64 repeats) noexcept
+{
+    if (pass == PassTimer::Pass::Frame)
+    {
+        return;
+    }
+
+    const auto add = [&] (Draws& target)
+    {
+        target.calls        += draws.calls * repeats;
+        target.commands     += draws.commands * repeats;
+        target.instances    += draws.instances * repeats;
+        target.triangles    += draws.triangles * repeats;
+    };
+
+    add (m_current.passes[static_cast<size_t> (pass)]);
+    add (m_current.passes[static_cast<size_t> (PassTimer::Pass::Frame)]);
+}
+
+
+void RenderStatistics::recordStream (const Stream stream, const GLuint64 bytes, const GLuint64 flushes) noexcept
+{
+    auto& streaming     = m_current.streams[static_cast<size_t> (stream)];
+    streaming.bytes     += bytes;
+    streaming.flushes   += flushes;
+}
+
+
+void RenderStatistics::recordLights (const Light light, const GLuint64 uploaded) noexcept
+{
+    m_current.lights[static_cast<size_t> (light)].uploaded += uploaded;
+}
+
+
+void RenderStatistics::recordSync (const float time) noexcept
+{
+    if (time > 0.f)
+    {
+        ++m_current.syncStalls;
+        m_current.syncTime += time;
+    }
+}
+
+
+void RenderStatistics::endFrame() noexcept
+{
+    m_last = m_current;
+    ++m_frames;
+
+    combine (m_totals, m_current, [] (auto& total, const auto value) { total += value; });
+    combine (m_peaks, m_current, [] (auto& peak, const auto value) { peak = std::max (peak, value); });
+}
+
+
+template <typename Func>
+void RenderStatistics::combine (Frame& target, const Frame& source, const Func& func) noexcept
+{
+    for (size_t i { 0 }; i < PassTimer::passCount; ++i)
+    {
+        func (target.passes[i].calls, source.passes[i].calls);
+        func (target.passes[i].commands, source.passes[i].commands);
+        func (target.passes[i].instances, source.passes[i].instances);
+        func (target.passes[i].triangles, source.passes[i].triangles);
+    }
+
+    for (size_t i { 0 }; i < streamCount; ++i)
+    {
+        func (target.streams[i].bytes, source.streams[i].bytes);
+        func (target.streams[i].flushes, source.streams[i].flushes);
+    }
+
+    for (size_t i { 0 }; i < lightCount; ++i)
+    {
+        func (target.lights[i].uploaded, source.lights[i].uploaded);
+    }
+
+    func (target.shadowLayers, source.shadowLayers);
+    func (target.syncStalls, source.syncStalls);
+    func (target.syncTime, source.syncTime);
+}
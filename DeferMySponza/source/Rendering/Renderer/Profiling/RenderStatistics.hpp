@@ -0,0 +1,151 @@
+#pragma once
+
+#if !defined    _RENDERING_RENDERER_RENDER_STATISTICS_
+#define         _RENDERING_RENDERER_RENDER_STATISTICS_
+
+// STL headers.
+#include <array>
+
+
+// Personal headers.
+#include <Rendering/Renderer/Profiling/PassTimer.hpp>
+
+
+/// <summary>
+/// Counts the work the CPU submits each frame: draw calls, indirect commands, instances and triangles per pass, the
+/// lights uploaded, data streamed into each persistently mapped buffer and how often the CPU stalled on the
+/// GPU. The most recent frame is kept along with totals and peaks of every frame since the last reset, so changes in
+/// content can be correlated with changes in frame cost.
+/// </summary>
+class RenderStatistics final
+{
+    public:
+
+        /// <summary> Each persistently mapped buffer which is written to every frame. </summary>
+        enum class Stream : size_t
+        {
+            Uniforms            = 0,
+            ObjectDrawCommands  = 1,
+            ObjectMaterialIDs   = 2,
+            ObjectTransforms    = 3,
+            LightDrawCommands   = 4,
+            LightTransforms     = 5,
+            Textures            = 6,
+            Count               = 7
+        };
+
+        /// <summary> Each type of light in the scene. </summary>
+        enum class Light : size_t
+        {
+            Directional = 0,
+            Point       = 1,
+            Spot        = 2,
+            Count       = 3
+        };
+
+        constexpr static auto streamCount   = static_cast<size_t> (Stream::Count);
+        constexpr static auto lightCount    = static_cast<size_t> (Light::Count);
+
+        /// <summary> The geometry submitted by a pass. </summary>
+        struct Draws final
+        {
+            GLuint64    calls       { 0 };  //!< How many draw functions were called.
+            GLuint64    commands    { 0 };  //!< How many draw commands were executed, including those in indirect buffers.
+            GLuint64    instances   { 0 };  //!< How many instances were drawn.
+            GLuint64    triangles   { 0 };  //!< How many triangles were submitted.
+        };
+
+        /// <summary> The data written to a persistently mapped buffer. </summary>
+        struct Streaming final
+        {
+            GLuint64    bytes       { 0 };  //!< How many bytes were written.
+            GLuint64    flushes     { 0 };  //!< How many ranges were explicitly flushed.
+        };
+
+        /// <summary> How many lights of a type were given to the GPU, every uploaded light is also drawn. </summary>
+        struct Lights final
+        {
+            GLuint64    uploaded    { 0 };  //!< How many lights were written to the uniform buffer.
+        };
+
+        /// <summary> Every counter of a frame. When aggregated each value is a sum or maximum over many frames. </summary>
+        struct Frame final
+        {
+            std::array<Draws, PassTimer::passCount> passes          { };        //!< The draws of each pass, Pass::Frame is the total.
+            std::array<Streaming, streamCount>      streams         { };        //!< The data written to each buffer.
+            std::array<Lights, lightCount>          lights          { };        //!< The lights of each type.
+            GLuint64                                shadowLayers    { 0 };      //!< How many shadow map layers were rendered.
+            GLuint64                                syncStalls      { 0 };      //!< How many times the CPU waited on the GPU.
+            float                                   syncTime        { 0.f };    //!< How long the CPU waited on the GPU (ms).
+        };
+
+        RenderStatistics() noexcept                                     = default;
+        RenderStatistics (RenderStatistics&&) noexcept                  = default;
+        RenderStatistics (const RenderStatistics&) noexcept             = default;
+        RenderStatistics& operator= (RenderStatistics&&) noexcept       = default;
+        RenderStatistics& operator= (const RenderStatistics&) noexcept  = default;
+        ~RenderStatistics()                                             = default;
+
+
+        /// <summary> Gets a human readable name for the given stream. </summary>
+        static const char* getName (const Stream stream) noexcept;
+
+        /// <summary> Gets a human readable name for the given light type. </summary>
+        static const char* getName (const Light light) noexcept;
+
+        /// <summary> Gets the counters of the most recently completed frame. </summary>
+        const Frame& getLastFrame() const noexcept  { return m_last; }
+
+        /// <summary> Gets the sum of every counter over each frame since the last reset. </summary>
+        const Frame& getTotals() const noexcept     { return m_totals; }
+
+        /// <summary> Gets the largest value of every counter over each frame since the last reset. </summary>
+        const Frame& getPeaks() const noexcept      { return m_peaks; }
+
+        /// <summary> Gets how many frames have been aggregated since the last reset. </summary>
+        GLuint getFrameCount() const noexcept       { return m_frames; }
+
+
+        /// <summary> Discards every aggregated counter. </summary>
+        void reset() noexcept;
+
+        /// <summary> Clears the counters of the current frame ready for recording. </summary>
+        void beginFrame() noexcept;
+
+        /// <summary> Adds the draws to the given pass and the frame total. </summary>
+        /// <param name="pass"> The pass which performed the draws, Pass::Frame is ignored. </param>
+        /// <param name="draws"> The geometry which was submitted. </param>
+        /// <param name="repeats"> How many times the draws were repeated, such as once per shadow map layer. </param>
+        void recordDraws (const PassTimer::Pass pass, const Draws& draws, const GLuint64 repeats = 1) noexcept;
+
+        /// <summary> Records the data written to a buffer. </summary>
+        void recordStream (const Stream stream, const GLuint64 bytes, const GLuint64 flushes) noexcept;
+
+        /// <summary> Records how many lights of a type were uploaded. </summary>
+        void recordLights (const Light light, const GLuint64 uploaded) noexcept;
+
+        /// <summary> Records how many shadow map layers were rendered. </summary>
+        void recordShadowLayers (const GLuint64 layers) noexcept    { m_current.shadowLayers += layers; }
+
+        /// <summary> Records the time spent waiting on the GPU, any non-zero time counts as a stall. </summary>
+        void recordSync (const float time) noexcept;
+
+        /// <summary> Completes the current frame, adding its counters to the totals and peaks. </summary>
+        void endFrame() noexcept;
+
+    private:
+
+        Frame   m_current   { };    //!< The frame being recorded.
+        Frame   m_last      { };    //!< The most recently completed frame.
+        Frame   m_totals    { };    //!< The sum of every completed frame.
+        Frame   m_peaks     { };    //!< The maximum of every completed frame.
+        GLuint  m_frames    { 0 };  //!< How many frames have been completed.
+
+    private:
+
+        /// <summary> Applies the given function to every counter of the target and source frames. </summary>
+        template <typename Func>
+        static void combine (Frame& target, const Frame& source, const Func& func) noexcept;
+};
+
+#endif // _RENDERING_RENDERER_RENDER_STATISTICS_
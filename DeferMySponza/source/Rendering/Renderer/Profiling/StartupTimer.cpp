@@ -0,0 +1,93 @@
+#include "StartupTimer.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <iomanip>
+#include <vector>
+
+
+const char* StartupTimer::getName (const Phase phase) noexcept
+{
+    switch (phase)
+    {
+        case Phase::ShaderSources:          return "Shader Sources";
+        case Phase::MaterialPreparation:    return "Material Preparation";
+        case Phase::GeometryPreparation:    return "Geometry Preparation";
+        case Phase::Programs:               return "Programs";
+        case Phase::Materials:              return "Materials";
+        case Phase::DynamicObjects:         return "Dynamic Objects";
+        case Phase::Lights:                 return "Lights";
+        case Phase::Geometry:               return "Geometry";
+        case Phase::Framebuffers:           return "Framebuffers";
+        case Phase::Uniforms:               return "Uniforms";
+        case Phase::Antialiasing:           return "Antialiasing";
+        default:                            return "Unknown";
+    }
+}
+
+
+void StartupTimer::begin() noexcept
+{
+    m_timings   = Timings { };
+    m_total     = 0.f;
+    m_owner     = std::this_thread::get_id();
+    m_begin     = Clock::now();
+}
+
+
+void StartupTimer::finish() noexcept
+{
+    m_total = sinceBegin (Clock::now());
+}
+
+
+void StartupTimer::record (const Phase phase, const TimePoint start, const TimePoint end) noexcept
+{
+    auto& timing    = m_timings[static_cast<size_t> (phase)];
+    timing.start    = sinceBegin (start);
+    timing.duration = sinceBegin (end) - timing.start;
+    timing.recorded = true;
+    timing.worker   = std::this_thread::get_id() != m_owner;
+}
+
+
+void StartupTimer::report (std::ostream& output) const noexcept
+{
+    // Phases overlap so they're easier to follow in the order they started than in the order they're declared.
+    auto phases = std::vector<Phase> { };
+
+    for (size_t i { 0 }; i < phaseCount; ++i)
+    {
+        if (m_timings[i].recorded)
+        {
+            phases.push_back (static_cast<Phase> (i));
+        }
+    }
+
+    std::stable_sort (std::begin (phases), std::end (phases),
+        [&] (const Phase a, const Phase b) { return getTiming (a).start < getTiming (b).start; });
+
+    const auto flags        = output.flags();
+    const auto precision    = output.precision();
+    output << std::fixed << std::setprecision (2);
+
+    for (const auto phase : phases)
+    {
+        const auto& timing = getTiming (phase);
+        output << std::left << std::setw (24) << getName (phase) << std::right
+            << std::setw (10) << timing.start << "ms +" << std::setw (10) << timing.duration << "ms"
+            << (timing.worker ? " (worker)" : "") << "\n";
+    }
+
+    output << std::left << std::setw (24) << "Total" << std::right << std::setw (10) << m_total << "ms" << std::endl;
+
+    output.flags (flags);
+    output.precision (precision);
+}
+
+
+float StartupTimer::sinceBegin (const TimePoint time) const noexcept
+{
+    return std::chrono::duration<float, std::milli> (time - m_begin).count();
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#if !defined    _RENDERING_RENDERER_STARTUP_TIMER_
+#define         _RENDERING_RENDERER_STARTUP_TIMER_
+
+// STL headers.
+#include <array>
+#include <chrono>
+#include <ostream>
+#include <thread>
+
+
+/// <summary>
+/// Records when each phase of renderer initialisation starts and how long it takes, measured on the CPU from the
+/// moment initialisation begins. Phases which only prepare data run on worker threads alongside the phases which need
+/// OpenGL, so the durations may add up to more than the total. Each phase must only be recorded by one thread and the
+/// timings must only be read once every phase has been joined.
+/// </summary>
+class StartupTimer final
+{
+    public:
+
+        using Clock     = std::chrono::steady_clock;
+        using TimePoint = Clock::time_point;
+
+        /// <summary> Each phase of initialisation, the preparation phases don't touch OpenGL. </summary>
+        enum class Phase : size_t
+        {
+            ShaderSources       = 0,
+            MaterialPreparation = 1,
+            GeometryPreparation = 2,
+            Programs            = 3,
+            Materials           = 4,
+            DynamicObjects      = 5,
+            Lights              = 6,
+            Geometry            = 7,
+            Framebuffers        = 8,
+            Uniforms            = 9,
+            Antialiasing        = 10,
+            Count               = 11
+        };
+
+        /// <summary> When a phase ran relative to the start of initialisation (ms). </summary>
+        struct Timing final
+        {
+            float   start       { 0.f };    //!< How long after initialisation began the phase started.
+            float   duration    { 0.f };    //!< How long the phase took.
+            bool    recorded    { false };  //!< Whether the phase was executed.
+            bool    worker      { false };  //!< Whether the phase ran on a thread other than the one initialising.
+        };
+
+        /// <summary> Records the phase given on construction for as long as the object is alive. </summary>
+        class Scope final
+        {
+            public:
+
+                Scope (StartupTimer& timer, const Phase phase) noexcept
+                    : m_timer (timer), m_phase (phase), m_start (Clock::now()) { }
+
+                ~Scope() { m_timer.record (m_phase, m_start, Clock::now()); }
+
+                Scope (Scope&&)                     = delete;
+                Scope (const Scope&)                = delete;
+                Scope& operator= (Scope&&)          = delete;
+                Scope& operator= (const Scope&)     = delete;
+
+            private:
+
+                StartupTimer&   m_timer;    //!< The timer to record the phase with.
+                Phase           m_phase;    //!< The phase being timed.
+                TimePoint       m_start;    //!< When the scope was entered.
+        };
+
+        constexpr static auto phaseCount = static_cast<size_t> (Phase::Count);  //!< How many phases can be timed.
+
+        StartupTimer() noexcept                             = default;
+        StartupTimer (StartupTimer&&) noexcept              = default;
+        StartupTimer& operator= (StartupTimer&&) noexcept   = default;
+        ~StartupTimer()                                     = default;
+
+        StartupTimer (const StartupTimer&)                  = delete;
+        StartupTimer& operator= (const StartupTimer&)       = delete;
+
+
+        /// <summary> Gets a human readable name for the given phase. </summary>
+        static const char* getName (const Phase phase) noexcept;
+
+        /// <summary> Gets when the given phase ran, phases which weren't executed aren't recorded. </summary>
+        const Timing& getTiming (const Phase phase) const noexcept  { return m_timings[static_cast<size_t> (phase)]; }
+
+        /// <summary> Gets how long initialisation took from beginning to finishing (ms). </summary>
+        float getTotalTime() const noexcept                         { return m_total; }
+
+
+        /// <summary> Discards every recorded timing and starts timing from now on the calling thread. </summary>
+        void begin() noexcept;
+
+        /// <summary> Stops timing initialisation, this must be called on the thread which called begin(). </summary>
+        void finish() noexcept;
+
+        /// <summary> Records a phase which ran between the given times, this may be called from any thread. </summary>
+        void record (const Phase phase, const TimePoint start, const TimePoint end) noexcept;
+
+        /// <summary> Writes a line for every recorded phase in the order they started, followed by the total. </summary>
+        void report (std::ostream& output) const noexcept;
+
+    private:
+
+        using Timings = std::array<Timing, phaseCount>;
+
+        Timings         m_timings   { };        //!< The timing of each phase.
+        TimePoint       m_begin     { };        //!< When initialisation began.
+        std::thread::id m_owner     { };        //!< The thread performing initialisation.
+        float           m_total     { 0.f };    //!< How long initialisation took.
+
+        /// <summary> Converts a time point into milliseconds since initialisation began. </summary>
+        float sinceBegin (const TimePoint time) const noexcept;
+};
+
+#endif // _RENDERING_RENDERER_STARTUP_TIMER_
@@ -5,6 +5,7 @@
 
 // STL headers.
 #include <string>
+#include <vector>
 
 
 // Imports.
@@ -13,6 +14,7 @@ using namespace std::string_literals;
 
 // Definitions.
 const auto pbsDefines       = "content:///Shaders/Defines/PhysicallyBasedShading.glsl"s;
+const auto bindlessDefines  = "content:///Shaders/Defines/BindlessTextures.glsl"s;
 const auto SMAAVSDefines    = "content:///Shaders/Defines/SMAAVertexShader.glsl"s;
 const auto SMAAFSDefines    = "content:///Shaders/Defines/SMAAFragmentShader.glsl"s;
 
@@ -34,12 +36,38 @@ const auto lightingPassFS           = "content:///Shaders/Rendering/LightingPass
 const auto lightsFS                 = "content:///Shaders/Rendering/Lights.fs.glsl"s;
 const auto materialFetcherFS        = "content:///Shaders/Rendering/MaterialFetcher.fs.glsl"s;
 const auto reflectionModelsFS       = "content:///Shaders/Rendering/ReflectionModels.fs.glsl"s;
+const auto countComplexityFS        = "content:///Shaders/Rendering/CountComplexity.fs.glsl"s;
+const auto ignoreComplexityFS       = "content:///Shaders/Rendering/IgnoreComplexity.fs.glsl"s;
 const auto edgeDetectionFS          = "content:///Shaders/SMAA/EdgeDetection.fs.glsl"s;
 const auto blendingWeightFS         = "content:///Shaders/SMAA/BlendingWeightCalculation.fs.glsl"s;
 const auto neighborhoodBlendingFS   = "content:///Shaders/SMAA/NeighborhoodBlending.fs.glsl"s;
 
 
+// Permutations, these name shaders which are compiled from a file above with extra definitions.
+const auto pbsReflectionModelsFS    = reflectionModelsFS + "#PhysicallyBasedShading"s;
+
+
+// Compute shaders.
+const auto complexityHistogramCS    = "content:///Shaders/Rendering/ComplexityHistogram.cs.glsl"s;
+const auto textureUsageCS           = "content:///Shaders/Rendering/TextureUsage.cs.glsl"s;
+const auto warpShadowMomentsCS      = "content:///Shaders/Rendering/WarpShadowMoments.cs.glsl"s;
+const auto blurShadowMomentsCS      = "content:///Shaders/Rendering/BlurShadowMoments.cs.glsl"s;
+
+
 // Others.
 const auto SMAAUberShader = "content:///Shaders/SMAA/SMAA.hlsl"s;
 
+
+// Every file above, these can be read ahead of compilation.
+const auto allShaderSources = std::vector<std::string>
+{
+    pbsDefines, bindlessDefines, SMAAVSDefines, SMAAFSDefines,
+    geometryVS, shadowMapVS, fullScreenTriangleVS, lightVolumeVS, edgeDetectionVS, blendingWeightVS, 
+    neighborhoodBlendingVS,
+    forwardRenderFS, geometryFS, lightingPassFS, lightsFS, materialFetcherFS, reflectionModelsFS, countComplexityFS,
+    ignoreComplexityFS, edgeDetectionFS, blendingWeightFS, neighborhoodBlendingFS,
+    complexityHistogramCS, textureUsageCS, warpShadowMomentsCS, blurShadowMomentsCS,
+    SMAAUberShader
+};
+
 #endif // !defined _RENDERER_HARD_CODED_SHADERS_
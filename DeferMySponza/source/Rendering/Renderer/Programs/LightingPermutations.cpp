@@ -0,0 +1,222 @@
+#include "LightingPermutations.hpp"
+
+
+// Personal headers.
+#include <Rendering/Renderer/Programs/HardCodedShaders.hpp>
+#include <Rendering/Renderer/Programs/Shaders.hpp>
+
+
+/// <summary> Gets the definition which selects the given shadow filter in the light shader, if it isn't PCF. </summary>
+static const char* filterDefinition (const ShadowMaps::Filter filter) noexcept
+{
+    using Filter = ShadowMaps::Filter;
+
+    switch (filter)
+    {
+        case Filter::Gather:    return "SHADOW_FILTER_GATHER";
+        case Filter::EVSM:      return "SHADOW_FILTER_EVSM";
+        default:                return nullptr;
+    }
+}
+
+
+/// <summary> Gets the definition which selects the given pass in the lighting pass shader, if it's used. </summary>
+static const char* passDefinition (const LightingPermutations::Pass pass) noexcept
+{
+    using Pass = LightingPermutations::Pass;
+
+    switch (pass)
+    {
+        case Pass::GlobalLight:         return "GLOBAL_LIGHT_PASS";
+        case Pass::PointLight:          return "POINT_LIGHT_PASS";
+        case Pass::ShadowedSpotlight:   return "SHADOWED_SPOTLIGHT_PASS";
+        case Pass::UnshadowedSpotlight: return "UNSHADOWED_SPOTLIGHT_PASS";
+        default:                        return nullptr;
+    }
+}
+
+
+const char* LightingPermutations::getName (const Pass pass) noexcept
+{
+    switch (pass)
+    {
+        case Pass::GlobalLight:         return "GlobalLightPass";
+        case Pass::PointLight:          return "PointLightPass";
+        case Pass::ShadowedSpotlight:   return "ShadowedSpotlightPass";
+        case Pass::UnshadowedSpotlight: return "UnshadowedSpotlightPass";
+        case Pass::Forward:             return "ForwardRender";
+        default:                        return "Unknown";
+    }
+}
+
+
+const char* LightingPermutations::getName (const ShadowMaps::Filter filter) noexcept
+{
+    using Filter = ShadowMaps::Filter;
+
+    switch (filter)
+    {
+        case Filter::PCF:       return "PCF";
+        case Filter::Gather:    return "Gather";
+        case Filter::EVSM:      return "EVSM";
+        default:                return "Unknown";
+    }
+}
+
+
+LightingPermutations::Key LightingPermutations::keyOf (const size_t index) noexcept
+{
+    const auto slot     = index % programsPerModel;
+    auto key            = Key { };
+    key.physicallyBased = index >= programsPerModel;
+
+    if (slot < firstShadowedPass)
+    {
+        key.pass = static_cast<Pass> (slot);
+    }
+
+    else
+    {
+        const auto filtered = slot - firstShadowedPass;
+        key.pass            = static_cast<Pass> (firstShadowedPass + filtered / ShadowMaps::filterCount);
+        key.filter          = static_cast<ShadowMaps::Filter> (filtered % ShadowMaps::filterCount);
+    }
+
+    return key;
+}
+
+
+bool LightingPermutations::loadShaders (Shaders& shaders, const Configuration& configuration) noexcept
+{
+    // The light shader only depends on the constants and the filter so every pass shares it.
+    auto success = true;
+
+    for (size_t i { 0 }; i < ShadowMaps::filterCount; ++i)
+    {
+        const auto filter = static_cast<ShadowMaps::Filter> (i);
+
+        success = shaders.loadAs (lightsShader (filter), GL_FRAGMENT_SHADER, lightsFS,
+            calculateDefines (configuration, filter, nullptr)) && success;
+    }
+
+    for (size_t i { 0 }; i < passCount; ++i)
+    {
+        const auto pass         = static_cast<Pass> (i);
+        const auto definition   = passDefinition (pass);
+
+        // Forward rendering doesn't need the lighting pass shader.
+        if (definition)
+        {
+            success = shaders.loadAs (lightingPassShader (pass), GL_FRAGMENT_SHADER, lightingPassFS,
+                calculateDefines (configuration, ShadowMaps::Filter::PCF, definition)) && success;
+        }
+    }
+
+    return success;
+}
+
+
+bool LightingPermutations::initialise (const Shaders& shaders, const Configuration& configuration) noexcept
+{
+    // Create temporary objects.
+    auto programs = Permutations { };
+
+    for (auto& program : programs)
+    {
+        if (!program.initialise())
+        {
+            return false;
+        }
+    }
+
+    // Each program only differs from the unspecialised programs by the lighting pass and light shaders.
+    for (size_t i { 0 }; i < permutationCount; ++i)
+    {
+        const auto  key                 = keyOf (i);
+        const auto  pass                = key.pass;
+        const auto& reflectionModels    = key.physicallyBased ? pbsReflectionModelsFS : reflectionModelsFS;
+        auto&       program             = programs[i];
+
+        switch (pass)
+        {
+            case Pass::GlobalLight:
+                program.attachShader (shaders.find (fullScreenTriangleVS));
+                program.attachShader (shaders.find (lightingPassShader (pass)));
+                program.attachShader (shaders.find (ignoreComplexityFS));
+                break;
+
+            case Pass::Forward:
+                program.attachShader (shaders.find (geometryVS));
+                program.attachShader (shaders.find (forwardRenderFS));
+                break;
+
+            default:
+                program.attachShader (shaders.find (lightVolumeVS));
+                program.attachShader (shaders.find (lightingPassShader (pass)));
+                program.attachShader (shaders.find (ignoreComplexityFS));
+                break;
+        }
+
+        program.attachShader (shaders.find (lightsShader (key.filter)));
+        program.attachShader (shaders.find (materialFetcherFS));
+        program.attachShader (shaders.find (reflectionModels));
+    }
+
+    // Success!
+    m_programs      = std::move (programs);
+    m_configuration = configuration;
+
+    return true;
+}
+
+
+void LightingPermutations::clean() noexcept
+{
+    performActionOnPrograms ([] (Program& program) { program.clean(); });
+    m_configuration = Configuration { };
+}
+
+
+std::string LightingPermutations::lightingPassShader (const Pass pass) noexcept
+{
+    return lightingPassFS + "#" + getName (pass);
+}
+
+
+std::string LightingPermutations::lightsShader (const ShadowMaps::Filter filter) noexcept
+{
+    return lightsFS + "#LightingPermutation" + getName (filter);
+}
+
+
+Shader::RawSource LightingPermutations::calculateDefines (const Configuration& configuration, 
+    const ShadowMaps::Filter filter, const char* const definition) noexcept
+{
+    // Light counts are compared with unsigned loop counters.
+    const auto count = [] (const char* name, const GLuint value)
+    {
+        return "#define " + std::string { name } + " " + std::to_string (value) + "u\n";
+    };
+
+    auto defines = "#version 450\n"s;
+    defines += count ("DIRECTIONAL_LIGHT_COUNT", configuration.directionalLights);
+    defines += count ("POINT_LIGHT_COUNT", configuration.pointLights);
+    defines += count ("SPOTLIGHT_COUNT", configuration.spotlights);
+    defines += count ("SHADOWED_SPOTLIGHT_COUNT", configuration.shadowedSpotlights);
+    defines += "#define SHADOW_FILTER_SIZE " + std::to_string (configuration.shadowFilterSize) + "\n";
+
+    const auto filterName = filterDefinition (filter);
+
+    if (filterName)
+    {
+        defines += "#define " + std::string { filterName } + "\n";
+    }
+
+    if (definition)
+    {
+        defines += "#define " + std::string { definition } + "\n";
+    }
+
+    // There's no line break so the version directive of the following file becomes part of the definition.
+    return defines + "#define LIGHTING_PERMUTATION";
+}
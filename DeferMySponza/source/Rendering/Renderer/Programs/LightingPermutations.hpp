@@ -0,0 +1,188 @@
+#pragma once
+
+#if !defined    _RENDERING_LIGHTING_PERMUTATIONS_
+#define         _RENDERING_LIGHTING_PERMUTATIONS_
+
+// STL headers.
+#include <array>
+#include <string>
+
+
+// Personal headers.
+#include <Rendering/Objects/Program.hpp>
+#include <Rendering/Objects/Shader.hpp>
+#include <Rendering/Renderer/Drawing/ShadowMaps.hpp>
+
+
+// Forward declarations.
+class Shaders;
+
+
+/// <summary>
+/// Lighting programs specialised with preprocessor definitions instead of choosing their work at run time. Each pass
+/// has a program of its own rather than a subroutine, and the light counts, which spotlights cast shadows and the size
+/// of the shadow filter are compiled in as constants so drivers can inline every call and unroll every loop. A program
+/// exists for each pass and reflection model, selected with a key, and every program is rebuilt when the constants
+/// change. Passes which sample the shadow maps also have a program for each shadow filter.
+/// </summary>
+class LightingPermutations final
+{
+    public:
+
+        /// <summary> Each pass which has a program of its own. </summary>
+        enum class Pass : size_t
+        {
+            GlobalLight         = 0,    //!< Ambient and directional lighting with an oversized triangle.
+            PointLight          = 1,    //!< Point light volumes.
+            UnshadowedSpotlight = 2,    //!< Spotlight volumes which don't cast shadows.
+            ShadowedSpotlight   = 3,    //!< Spotlight volumes which sample the shadow maps.
+            Forward             = 4,    //!< Forward rendering where every fragment is lit by every light.
+            Count               = 5
+        };
+
+        /// <summary> Identifies a single program, passes which don't sample shadows ignore the filter. </summary>
+        struct Key final
+        {
+            Pass                pass            { Pass::GlobalLight };          //!< The pass the program performs.
+            bool                physicallyBased { true };                       //!< Whether PBS is used.
+            ShadowMaps::Filter  filter          { ShadowMaps::Filter::PCF };    //!< How shadows are filtered.
+        };
+
+        /// <summary>
+        /// The constants compiled into every permutation, these must match the light uniforms. Spotlights which cast
+        /// shadows must be stored before those which don't.
+        /// </summary>
+        struct Configuration final
+        {
+            GLuint  directionalLights   { 0 };  //!< How many directional lights are stored.
+            GLuint  pointLights         { 0 };  //!< How many point lights are stored.
+            GLuint  spotlights          { 0 };  //!< How many spotlights are stored.
+            GLuint  shadowedSpotlights  { 0 };  //!< How many of the spotlights cast shadows.
+            GLuint  shadowFilterSize    { 5 };  //!< How many texels wide each shadow filter is.
+        };
+
+        constexpr static auto passCount         = static_cast<size_t> (Pass::Count);    //!< How many passes exist.
+
+        /// <summary> This pass and every later pass sample shadows, so each has a program per filter. </summary>
+        constexpr static auto firstShadowedPass = static_cast<size_t> (Pass::ShadowedSpotlight);
+
+        /// <summary> How many programs use each reflection model. </summary>
+        constexpr static auto programsPerModel  = firstShadowedPass + 
+            (passCount - firstShadowedPass) * ShadowMaps::filterCount;
+
+        constexpr static auto permutationCount  = programsPerModel * 2; //!< Every program for both reflection models.
+
+        LightingPermutations() noexcept                                   = default;
+        LightingPermutations (LightingPermutations&&) noexcept            = default;
+        LightingPermutations& operator= (LightingPermutations&&) noexcept = default;
+        ~LightingPermutations()                                           = default;
+
+        LightingPermutations (const LightingPermutations&)                = delete;
+        LightingPermutations& operator= (const LightingPermutations&)     = delete;
+
+
+        /// <summary> Gets a human readable name for the given pass. </summary>
+        static const char* getName (const Pass pass) noexcept;
+
+        /// <summary> Gets a human readable name for the given shadow filter. </summary>
+        static const char* getName (const ShadowMaps::Filter filter) noexcept;
+
+        /// <summary> Checks whether the given pass samples shadow maps and so depends on the filter. </summary>
+        static bool samplesShadows (const Pass pass) noexcept
+        {
+            return static_cast<size_t> (pass) >= firstShadowedPass;
+        }
+
+        /// <summary> Gets the key of the program stored at the given index. </summary>
+        static Key keyOf (const size_t index) noexcept;
+
+        /// <summary> Gets the constants every program was compiled with. </summary>
+        const Configuration& getConfiguration() const noexcept  { return m_configuration; }
+
+        /// <summary> Gets the program identified by the given key. </summary>
+        const Program& find (const Key& key) const noexcept     { return m_programs[indexOf (key)]; }
+
+        /// <summary> Gets the program identified by the given key. </summary>
+        Program& find (const Key& key) noexcept                 { return m_programs[indexOf (key)]; }
+
+
+        /// <summary>
+        /// Loads the lighting pass shader for each pass and the light shader, both specialised with the constants.
+        /// They're named after the file they're compiled from with a suffix, so they can share a collection with the
+        /// unspecialised shaders.
+        /// </summary>
+        /// <param name="shaders"> The collection to load the permutations into. </param>
+        /// <param name="configuration"> The constants to compile into every shader. </param>
+        /// <returns> Whether every source file could be read. </returns>
+        static bool loadShaders (Shaders& shaders, const Configuration& configuration) noexcept;
+
+        /// <summary>
+        /// Creates every program and attaches the shaders they need, linking is left to the caller so the permutations
+        /// can be linked alongside other programs.
+        /// </summary>
+        /// <param name="shaders"> Shaders containing both the unspecialised shaders and the permutations. </param>
+        /// <param name="configuration"> The constants the permutations were loaded with. </param>
+        /// <returns> Whether every program could be created. </returns>
+        bool initialise (const Shaders& shaders, const Configuration& configuration) noexcept;
+
+        /// <summary> Deletes each program. </summary>
+        void clean() noexcept;
+
+
+        template <typename Func>
+        void performActionOnPrograms (const Func& func) const noexcept
+        {
+            for (const auto& program : m_programs)
+            {
+                func (program);
+            }
+        }
+
+        template <typename Func>
+        void performActionOnPrograms (const Func& func) noexcept
+        {
+            for (auto& program : m_programs)
+            {
+                func (program);
+            }
+        }
+
+    private:
+
+        using Permutations = std::array<Program, permutationCount>;
+
+        Permutations    m_programs      { };    //!< Every program for Blinn-Phong followed by every program for PBS.
+        Configuration   m_configuration { };    //!< The constants compiled into every program.
+
+        /// <summary> 
+        /// Gets where the program for the given key is stored. Passes which don't sample shadows come first with a
+        /// single program each, followed by a program per filter for each pass which does.
+        /// </summary>
+        static size_t indexOf (const Key& key) noexcept
+        {
+            const auto pass = static_cast<size_t> (key.pass);
+            const auto slot = pass < firstShadowedPass ? pass : 
+                firstShadowedPass + (pass - firstShadowedPass) * ShadowMaps::filterCount + 
+                static_cast<size_t> (key.filter);
+
+            return (key.physicallyBased ? programsPerModel : 0) + slot;
+        }
+
+        /// <summary> Gets the name the lighting pass shader specialised for the given pass is loaded with. </summary>
+        static std::string lightingPassShader (const Pass pass) noexcept;
+
+        /// <summary> Gets the name the light shader for the given filter is loaded with. </summary>
+        static std::string lightsShader (const ShadowMaps::Filter filter) noexcept;
+
+        /// <summary>
+        /// Creates the definitions which precede a specialised shader. The first line is the version directive and the
+        /// last line is left open to consume the version directive of the file which follows.
+        /// </summary>
+        /// <param name="configuration"> The constants to define. </param>
+        /// <param name="filter"> The shadow filter to select. </param>
+        /// <param name="definition"> The definition which selects a pass, if any. </param>
+        static Shader::RawSource calculateDefines (const Configuration& configuration, const ShadowMaps::Filter filter,
+            const char* const definition) noexcept;
+};
+
+#endif // _RENDERING_LIGHTING_PERMUTATIONS_
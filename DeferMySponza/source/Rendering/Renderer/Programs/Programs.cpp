@@ -3,6 +3,7 @@
 
 // STL headers.
 #include <iostream>
+#include <vector>
 
 
 // Personal headers.
@@ -10,14 +11,24 @@
 #include <Rendering/Renderer/Programs/Shaders.hpp>
 
 
-bool Programs::initialise (const Shaders& shaders) noexcept
+bool Programs::initialise (const Shaders& shaders, const LightingPermutations::Configuration& lighting) noexcept
 {
     // Create temporary objects.
-    Program shadow, geo, global, light, forward;
+    Program shadow, geo, geoComplexity, histogram, usage, warp, blur;
+    Shading blinn, pbs;
+    LightingPermutations specialised;
+
+    const auto initialiseShading = [] (Shading& shading)
+    {
+        return shading.globalLightPass.initialise() && shading.lightingPass.initialise() && 
+            shading.forwardRender.initialise() && shading.lightingComplexity.initialise();
+    };
 
     // Initialise each temporary object.
-    if (!(shadow.initialise() && geo.initialise() && global.initialise() && light.initialise() && 
-        forward.initialise()))
+    if (!(shadow.initialise() && geo.initialise() && geoComplexity.initialise() && histogram.initialise() &&
+        usage.initialise() && warp.initialise() && blur.initialise() && initialiseShading (blinn) && 
+        initialiseShading (pbs) && 
+        specialised.initialise (shaders, lighting)))
     {
         return false;
     }
@@ -27,42 +38,90 @@ bool Programs::initialise (const Shaders& shaders) noexcept
 
     geo.attachShader (shaders.find (geometryVS));
     geo.attachShader (shaders.find (geometryFS));
+    geo.attachShader (shaders.find (ignoreComplexityFS));
 
-    global.attachShader (shaders.find (fullScreenTriangleVS));
-    global.attachShader (shaders.find (lightingPassFS));
-    global.attachShader (shaders.find (lightsFS));
-    global.attachShader (shaders.find (materialFetcherFS));
-    global.attachShader (shaders.find (reflectionModelsFS));
+    // The lighting programs are identical for each reflection model except for the reflection model itself.
+    const auto attachShading = [&shaders] (Shading& shading, const std::string& reflectionModels)
+    {
+        shading.globalLightPass.attachShader (shaders.find (fullScreenTriangleVS));
+        shading.globalLightPass.attachShader (shaders.find (lightingPassFS));
+        shading.globalLightPass.attachShader (shaders.find (lightsFS));
+        shading.globalLightPass.attachShader (shaders.find (materialFetcherFS));
+        shading.globalLightPass.attachShader (shaders.find (reflectionModels));
+        shading.globalLightPass.attachShader (shaders.find (ignoreComplexityFS));
     
-    light.attachShader (shaders.find (lightVolumeVS));
-    light.attachShader (shaders.find (lightingPassFS));
-    light.attachShader (shaders.find (lightsFS));
-    light.attachShader (shaders.find (materialFetcherFS));
-    light.attachShader (shaders.find (reflectionModelsFS));
+        shading.lightingPass.attachShader (shaders.find (lightVolumeVS));
+        shading.lightingPass.attachShader (shaders.find (lightingPassFS));
+        shading.lightingPass.attachShader (shaders.find (lightsFS));
+        shading.lightingPass.attachShader (shaders.find (materialFetcherFS));
+        shading.lightingPass.attachShader (shaders.find (reflectionModels));
+        shading.lightingPass.attachShader (shaders.find (ignoreComplexityFS));
     
-    forward.attachShader (shaders.find (geometryVS));
-    forward.attachShader (shaders.find (forwardRenderFS));
-    forward.attachShader (shaders.find (lightsFS));
-    forward.attachShader (shaders.find (materialFetcherFS));
-    forward.attachShader (shaders.find (reflectionModelsFS));
+        shading.forwardRender.attachShader (shaders.find (geometryVS));
+        shading.forwardRender.attachShader (shaders.find (forwardRenderFS));
+        shading.forwardRender.attachShader (shaders.find (lightsFS));
+        shading.forwardRender.attachShader (shaders.find (materialFetcherFS));
+        shading.forwardRender.attachShader (shaders.find (reflectionModels));
+
+        shading.lightingComplexity.attachShader (shaders.find (lightVolumeVS));
+        shading.lightingComplexity.attachShader (shaders.find (lightingPassFS));
+        shading.lightingComplexity.attachShader (shaders.find (lightsFS));
+        shading.lightingComplexity.attachShader (shaders.find (materialFetcherFS));
+        shading.lightingComplexity.attachShader (shaders.find (reflectionModels));
+        shading.lightingComplexity.attachShader (shaders.find (countComplexityFS));
+    };
+
+    attachShading (blinn, reflectionModelsFS);
+    attachShading (pbs, pbsReflectionModelsFS);
 
-    // Track the success of linking each program.
-    auto success = true;
+    // The diagnostic programs are identical except they count each shaded fragment.
+    geoComplexity.attachShader (shaders.find (geometryVS));
+    geoComplexity.attachShader (shaders.find (geometryFS));
+    geoComplexity.attachShader (shaders.find (countComplexityFS));
 
-    const auto linkProgram = [&success] (const Program& program, const std::string& name)
+    histogram.attachShader (shaders.find (complexityHistogramCS));
+    usage.attachShader (shaders.find (textureUsageCS));
+
+    warp.attachShader (shaders.find (warpShadowMomentsCS));
+    blur.attachShader (shaders.find (blurShadowMomentsCS));
+
+    // Every program is linked together, we only find out whether they succeeded once they're all done.
+    auto programs = std::vector<Program*> { };
+
+    const auto linkProgram = [&programs] (Program& program, const std::string& name)
     {
         std::cout << "Linking '" << name << "'..." << std::endl;
-        success = program.link() && success;
+        programs.push_back (&program);
     };
 
     // Check they link properly.
     linkProgram (shadow, "ShadowMapPass");
     linkProgram (geo, "GeometryPass");
-    linkProgram (global, "GlobalLightPass");
-    linkProgram (light, "LightingPass");
-    linkProgram (forward, "ForwardRender");
+    linkProgram (blinn.globalLightPass, "GlobalLightPass (Blinn-Phong)");
+    linkProgram (blinn.lightingPass, "LightingPass (Blinn-Phong)");
+    linkProgram (blinn.forwardRender, "ForwardRender (Blinn-Phong)");
+    linkProgram (blinn.lightingComplexity, "LightingComplexity (Blinn-Phong)");
+    linkProgram (pbs.globalLightPass, "GlobalLightPass (PBS)");
+    linkProgram (pbs.lightingPass, "LightingPass (PBS)");
+    linkProgram (pbs.forwardRender, "ForwardRender (PBS)");
+    linkProgram (pbs.lightingComplexity, "LightingComplexity (PBS)");
+    linkProgram (geoComplexity, "GeometryComplexity");
+    linkProgram (histogram, "ComplexityHistogram");
+    linkProgram (usage, "TextureUsage");
+    linkProgram (warp, "WarpShadowMoments");
+    linkProgram (blur, "BlurShadowMoments");
+
+    for (size_t i { 0 }; i < LightingPermutations::permutationCount; ++i)
+    {
+        const auto key      = LightingPermutations::keyOf (i);
+        const auto model    = key.physicallyBased ? " (PBS, specialised" : " (Blinn-Phong, specialised";
+        const auto filter   = LightingPermutations::samplesShadows (key.pass) ? 
+            ", "s + LightingPermutations::getName (key.filter) : ""s;
+
+        linkProgram (specialised.find (key), LightingPermutations::getName (key.pass) + (model + filter) + ")");
+    }
 
-    if (!success)
+    if (!Program::linkAll (programs))
     {
         return false;
     }
@@ -70,9 +129,15 @@ bool Programs::initialise (const Shaders& shaders) noexcept
     // We've successfully compiled each program.
     shadowMapPass   = std::move (shadow);
     geometryPass    = std::move (geo);
-    globalLightPass = std::move (global);
-    lightingPass    = std::move (light);
-    forwardRender   = std::move (forward);
+    blinnPhong      = std::move (blinn);
+    physicallyBased = std::move (pbs);
+    permutations    = std::move (specialised);
+
+    geometryComplexity  = std::move (geoComplexity);
+    complexityHistogram = std::move (histogram);
+    textureUsage        = std::move (usage);
+    shadowMomentsWarp   = std::move (warp);
+    shadowMomentsBlur   = std::move (blur);
 
     return true;
 }
@@ -5,6 +5,7 @@
 
 // Personal headers.
 #include <Rendering/Objects/Program.hpp>
+#include <Rendering/Renderer/Programs/LightingPermutations.hpp>
 
 
 // Forward declarations.
@@ -20,11 +21,30 @@ struct Programs final
     constexpr static auto pointLightSubroutine  = GLuint { 1 }; //!< The subroutine index for the lighting pass programs to apply point lighting.
     constexpr static auto spotlightSubroutine   = GLuint { 2 }; //!< The subroutine index for the lighting pass programs to apply spotlighting.
 
+    /// <summary> 
+    /// The programs which depend on the reflection model. A set is linked for each model so changing the shading mode
+    /// only changes which set is used.
+    /// </summary>
+    struct Shading final
+    {
+        Program globalLightPass     { };    //!< Provides a global light pass with an oversized triangle.
+        Program lightingPass        { };    //!< Point and spotlight passes based on a subroutine.
+        Program forwardRender       { };    //!< Peforms forward rendering, every fragment will determine the contribution of every light.
+        Program lightingComplexity  { };    //!< The light volume pass which also counts how many lights are shaded per pixel.
+    };
+
     Program shadowMapPass   { };    //!< A depth-pass used for shadow mapping.
     Program geometryPass    { };    //!< Basic shaders which construct the scene with ambient lighting.
-    Program globalLightPass { };    //!< Provides a global light pass with an oversized triangle.
-    Program lightingPass    { };    //!< Point and spotlight passes based on a subroutine.
-    Program forwardRender   { };    //!< Peforms forward rendering, every fragment will determine the contribution of every light.
+    Shading blinnPhong      { };    //!< The lighting programs which use the Blinn-Phong reflection model.
+    Shading physicallyBased { };    //!< The lighting programs which use physically based shading.
+
+    LightingPermutations permutations { };  //!< Lighting programs specialised for each pass without subroutines.
+
+    Program geometryComplexity  { };    //!< The geometry pass which also counts how many fragments are shaded per pixel.
+    Program complexityHistogram { };    //!< A compute program which reduces complexity counters into histograms.
+    Program textureUsage        { };    //!< A compute program which measures which texture arrays the gbuffer samples.
+    Program shadowMomentsWarp   { };    //!< A compute program which warps shadow maps into moments and blurs them horizontally.
+    Program shadowMomentsBlur   { };    //!< A compute program which blurs shadow map moments vertically.
     
 
     Programs() noexcept                         = default;
@@ -39,17 +59,27 @@ struct Programs final
     /// <summary> Checks whether the core programs have been loaded. </summary>
     inline bool isInitialised() const noexcept 
     { 
-        return geometryPass.isInitialised() && globalLightPass.isInitialised() && 
-            lightingPass.isInitialised() && forwardRender.isInitialised();
+        return geometryPass.isInitialised() && 
+            blinnPhong.globalLightPass.isInitialised() && blinnPhong.lightingPass.isInitialised() && 
+            blinnPhong.forwardRender.isInitialised() && physicallyBased.globalLightPass.isInitialised() && 
+            physicallyBased.lightingPass.isInitialised() && physicallyBased.forwardRender.isInitialised();
+    }
+
+    /// <summary> Gets the lighting programs which use the desired reflection model. </summary>
+    inline const Shading& getShading (const bool usePhysicallyBasedShading) const noexcept
+    {
+        return usePhysicallyBasedShading ? physicallyBased : blinnPhong;
     }
 
 
     /// <summary> 
-    /// Initialise the core programs using the shaders provided. This is currently loaded using hard coded value.
+    /// Initialise the core programs using the shaders provided. This is currently loaded using hard coded value. Every
+    /// program is linked at once so drivers supporting GL_KHR_parallel_shader_compile can link them concurrently.
     /// </summary>
-    /// <param name="shaders"> The collection of shaders to attach and link to. </param>
+    /// <param name="shaders"> The shaders to attach and link to, including the lighting permutations. </param>
+    /// <param name="lighting"> The constants the lighting permutations were loaded with. </param>
     /// <returns> Whether the initialisation was successful. </returns>
-    bool initialise (const Shaders& shaders) noexcept;
+    bool initialise (const Shaders& shaders, const LightingPermutations::Configuration& lighting) noexcept;
 
     /// <summary> Detaches all shaders and deletes each program. </summary>
     void clean() noexcept;
@@ -72,9 +102,20 @@ struct Programs final
     {
         func (shadowMapPass);
         func (geometryPass);
-        func (globalLightPass);
-        func (lightingPass);
-        func (forwardRender);
+        func (blinnPhong.globalLightPass);
+        func (blinnPhong.lightingPass);
+        func (blinnPhong.forwardRender);
+        func (blinnPhong.lightingComplexity);
+        func (physicallyBased.globalLightPass);
+        func (physicallyBased.lightingPass);
+        func (physicallyBased.forwardRender);
+        func (physicallyBased.lightingComplexity);
+        func (geometryComplexity);
+        func (complexityHistogram);
+        func (textureUsage);
+        func (shadowMomentsWarp);
+        func (shadowMomentsBlur);
+        permutations.performActionOnPrograms (func);
     }
 
     template <typename Func>
@@ -82,9 +123,20 @@ struct Programs final
     {
         func (shadowMapPass);
         func (geometryPass);
-        func (globalLightPass);
-        func (lightingPass);
-        func (forwardRender);
+        func (blinnPhong.globalLightPass);
+        func (blinnPhong.lightingPass);
+        func (blinnPhong.forwardRender);
+        func (blinnPhong.lightingComplexity);
+        func (physicallyBased.globalLightPass);
+        func (physicallyBased.lightingPass);
+        func (physicallyBased.forwardRender);
+        func (physicallyBased.lightingComplexity);
+        func (geometryComplexity);
+        func (complexityHistogram);
+        func (textureUsage);
+        func (shadowMomentsWarp);
+        func (shadowMomentsBlur);
+        permutations.performActionOnPrograms (func);
     }
 };
 
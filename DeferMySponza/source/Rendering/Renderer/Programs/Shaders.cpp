@@ -13,34 +13,44 @@
 const Shader Shaders::default = Shader { };
 
 
-bool Shaders::initialise (const bool usePhysicallyBasedShaders) noexcept
+bool Shaders::initialise (const bool useBindlessTextures) noexcept
 {
     // TODO: Load shaders from configuration file.
     bool success = true;
-    const auto compileShader = [&] (const auto shaderType, const auto& main, auto&&... strings)
+    const auto loadShader = [&] (const auto shaderType, const auto& main, auto&&... strings)
     {
-        success = compile (shaderType, main, std::forward<decltype (strings)> (strings)...) && success;
+        success = load (shaderType, main, std::forward<decltype (strings)> (strings)...) && success;
     };
     
-    compileShader (GL_VERTEX_SHADER, geometryVS);
-    compileShader (GL_VERTEX_SHADER, shadowMapVS);
-    compileShader (GL_VERTEX_SHADER, fullScreenTriangleVS);
-    compileShader (GL_VERTEX_SHADER, lightVolumeVS);
+    loadShader (GL_VERTEX_SHADER, geometryVS);
+    loadShader (GL_VERTEX_SHADER, shadowMapVS);
+    loadShader (GL_VERTEX_SHADER, fullScreenTriangleVS);
+    loadShader (GL_VERTEX_SHADER, lightVolumeVS);
     
-    compileShader (GL_FRAGMENT_SHADER, forwardRenderFS);
-    compileShader (GL_FRAGMENT_SHADER, geometryFS);
-    compileShader (GL_FRAGMENT_SHADER, lightingPassFS);
-    compileShader (GL_FRAGMENT_SHADER, lightsFS);
-    compileShader (GL_FRAGMENT_SHADER, materialFetcherFS);
+    loadShader (GL_FRAGMENT_SHADER, forwardRenderFS);
+    loadShader (GL_FRAGMENT_SHADER, geometryFS);
+    loadShader (GL_FRAGMENT_SHADER, lightingPassFS);
+    loadShader (GL_FRAGMENT_SHADER, lightsFS);
+    loadShader (GL_FRAGMENT_SHADER, countComplexityFS);
+    loadShader (GL_FRAGMENT_SHADER, ignoreComplexityFS);
+
+    loadShader (GL_COMPUTE_SHADER, complexityHistogramCS);
+    loadShader (GL_COMPUTE_SHADER, textureUsageCS);
+    loadShader (GL_COMPUTE_SHADER, warpShadowMomentsCS);
+    loadShader (GL_COMPUTE_SHADER, blurShadowMomentsCS);
     
-    if (usePhysicallyBasedShaders)
+    // Both reflection models are loaded so the shading mode can be changed without compiling anything.
+    loadShader (GL_FRAGMENT_SHADER, reflectionModelsFS);
+    success = loadAs (pbsReflectionModelsFS, GL_FRAGMENT_SHADER, reflectionModelsFS, pbsDefines) && success;
+
+    if (useBindlessTextures)
     {
-        compileShader (GL_FRAGMENT_SHADER, reflectionModelsFS, pbsDefines);
+        loadShader (GL_FRAGMENT_SHADER, materialFetcherFS, bindlessDefines);
     }
 
     else
     {
-        compileShader (GL_FRAGMENT_SHADER, reflectionModelsFS);
+        loadShader (GL_FRAGMENT_SHADER, materialFetcherFS);
     }
 
     return success;
@@ -49,9 +59,9 @@ bool Shaders::initialise (const bool usePhysicallyBasedShaders) noexcept
 
 const Shader& Shaders::find (const std::string& fileLocation) const noexcept
 {
-    const auto iterator = compiled.find (fileLocation);
+    const auto iterator = loaded.find (fileLocation);
 
-    if (iterator != std::end (compiled))
+    if (iterator != std::end (loaded))
     {
         return iterator->second;
     }
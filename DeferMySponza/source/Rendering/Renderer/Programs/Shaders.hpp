@@ -30,46 +30,60 @@ class Shaders final
         /// <summary> Checks whether the core programs have been loaded. </summary>
         inline bool isInitialised() const noexcept 
         { 
-            return !compiled.empty();
+            return !loaded.empty();
         }
 
-        /// <summary> Checks whether the shader at the given location has been compiled. </summary>
-        inline bool isCompiled (const std::string& fileLocation) const noexcept 
+        /// <summary> Checks whether the shader at the given location has been loaded. </summary>
+        inline bool isLoaded (const std::string& fileLocation) const noexcept 
         { 
-            return compiled.find (fileLocation) != std::end (compiled); 
+            return loaded.find (fileLocation) != std::end (loaded); 
         }
 
 
         /// <summary> 
-        /// Initialise available shaders. This is currently loaded using hard coded filenames.
+        /// Initialise available shaders. This is currently loaded using hard coded filenames. Shaders are compiled
+        /// when a program which uses them is linked, unless the program is loaded from the program cache. The
+        /// reflection models are loaded twice, the physically based permutation is named pbsReflectionModelsFS.
         /// </summary>
-        /// <param name="usePhysicallyBasedShader"> Determines how the reflection model shader is compiled. </param>
+        /// <param name="useBindlessTextures"> Whether materials sample texture arrays through bindless handles. </param>
         /// <returns> Whether the initialisation was successful. </returns>
-        bool initialise (const bool usePhysicallyBasedShaders) noexcept;
+        bool initialise (const bool useBindlessTextures) noexcept;
 
         /// <summary> Discards and marks all shaders for deletion. They won't be deleted until detached from all programs. </summary>
-        inline void clean() noexcept { compiled.clear(); }
+        inline void clean() noexcept { loaded.clear(); }
 
 
-        /// <summary> Attempts to compile a shader from the given file location. Doesn't recompile a shader. </summary>
-        /// <param name="type"> The type of shader being compiled, e.g. GL_VERTEX_SHADER. </param>
+        /// <summary> 
+        /// Attempts to create a shader with the source of the given file location attached, ready to be compiled when
+        /// a program needs it. Doesn't reload a shader.
+        /// </summary>
+        /// <param name="type"> The type of shader being loaded, e.g. GL_VERTEX_SHADER. </param>
         /// <param name="mainSource"> Where to look for the main source file. </param>
         /// <param name="preProcessorSources"> Any extra source files to be used for the preprocessor. </param>
-        /// <returns> Whether the compilation was succesful or not. </returns>
+        /// <returns> Whether every source file could be read. </returns>
         template <typename Source, typename... Args>
-        bool compile (const GLenum type, Source&& mainSource, Args&& ...preProcessorSources) noexcept;
+        bool load (const GLenum type, Source&& mainSource, Args&& ...preProcessorSources) noexcept;
 
-        /// <summary> Attempts to find a compiled shader with at the given file location. </summary>
-        /// <param name="fileLocation"> The file location of the compiled shader. </param>
-        /// <returns> If the shader exists then the compiled shader, otherwise an uninitialised shader. </returns>
+        /// <summary> 
+        /// Loads a shader in the same way as load() but stores it under the given name, allowing a file to be loaded
+        /// multiple times with different preprocessor sources.
+        /// </summary>
+        /// <param name="name"> The name to find the shader with. </param>
+        template <typename Source, typename... Args>
+        bool loadAs (const std::string& name, const GLenum type, Source&& mainSource, 
+            Args&& ...preProcessorSources) noexcept;
+
+        /// <summary> Attempts to find a loaded shader with at the given file location. </summary>
+        /// <param name="fileLocation"> The file location of the loaded shader. </param>
+        /// <returns> If the shader exists then the loaded shader, otherwise an uninitialised shader. </returns>
         const Shader& find (const std::string& fileLocation) const noexcept;
 
     private:
     
-        using CompiledShaders = std::unordered_map<std::string, Shader>;
+        using LoadedShaders = std::unordered_map<std::string, Shader>;
 
         const static Shader default;        //!< A default, uninitialised shader.
-        CompiledShaders     compiled { };   //!< A collection of successfully compiled shaders mapped by their filename.
+        LoadedShaders       loaded  { };    //!< A collection of successfully loaded shaders mapped by their filename.
 
     private:
 
@@ -92,19 +106,23 @@ class Shaders final
 };
 
 
-// STL headers.
-#include <iostream>
+template <typename Source, typename... Args>
+bool Shaders::load (const GLenum type, Source&& mainSource, Args&& ...preProcessorSources) noexcept
+{
+    const auto name = std::string { mainSource };
+    return loadAs (name, type, std::forward<Source> (mainSource), std::forward<Args> (preProcessorSources)...);
+}
 
 
 template <typename Source, typename... Args>
-bool Shaders::compile (const GLenum type, Source&& mainSource, Args&& ...preProcessorSources) noexcept
+bool Shaders::loadAs (const std::string& name, const GLenum type, Source&& mainSource, 
+    Args&& ...preProcessorSources) noexcept
 {
-    // Make sure we haven't already compiled the file.
-    if (isCompiled (mainSource))
+    // Make sure we haven't already loaded the shader.
+    if (isLoaded (name))
     {
         return true;
     }
-    std::cout << "Compiling '" << mainSource << "'..." << std::endl;
 
     // Make sure we can actually create a shader.
     auto shader = Shader {};
@@ -119,14 +137,8 @@ bool Shaders::compile (const GLenum type, Source&& mainSource, Args&& ...preProc
         return false;
     }
 
-    // Finally ensure the shader compiles before adding it.
-    if (!shader.compile())
-    {
-        return false;
-    }
-
-    // Success!
-    compiled.emplace (mainSource, std::move (shader));
+    // Success! Compilation waits until a program needs the shader.
+    loaded.emplace (name, std::move (shader));
     return true;
 }
 
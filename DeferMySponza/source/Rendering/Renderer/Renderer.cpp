@@ -2,15 +2,15 @@
 
 
 // STL headers.
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <future>
+#include <iostream>
+#include <numeric>
 
 
 // Engine headers.
-#ifdef _NVTX
-#include <nvToolsExt.h>
-#endif
 #include <glm/gtc/matrix_transform.hpp>
 #include <scene/scene.hpp>
 
@@ -22,13 +22,17 @@
 #include <Rendering/Binders/TextureBinder.hpp>
 #include <Rendering/Binders/VertexArrayBinder.hpp>
 #include <Rendering/Renderer/Drawing/PassConfigurator.hpp>
+#include <Rendering/Renderer/Programs/HardCodedShaders.hpp>
 #include <Rendering/Renderer/Programs/Shaders.hpp>
 #include <Rendering/Renderer/Uniforms/Blocks/Scene.hpp>
 #include <Rendering/Renderer/Uniforms/Blocks/FullBlock.hpp>
 #include <Rendering/Renderer/Uniforms/Components/DirectionalLight.hpp>
 #include <Rendering/Renderer/Uniforms/Components/PointLight.hpp>
 #include <Rendering/Renderer/Uniforms/Components/Spotlight.hpp>
+#include <Rendering/State/MemoryTracker.hpp>
+#include <Rendering/State/ProgramCache.hpp>
 #include <Utility/Algorithm.hpp>
+#include <Utility/Profiler.hpp>
 #include <Utility/Scene.hpp>
 
 
@@ -73,41 +77,64 @@ struct Renderer::ASyncActions final
 };
 
 
+/// <summary> Presents the spotlights of the scene in the order they're stored in, shadow casters first. </summary>
+struct OrderedSpotlights final
+{
+    const std::vector<scene::SpotLight>&    lights; //!< The spotlights in the order the scene stores them.
+    const std::vector<size_t>&              order;  //!< The scene index of each stored spotlight.
+
+    size_t size() const noexcept                                    { return order.size(); }
+    const scene::SpotLight& operator[] (const size_t i) const noexcept { return lights[order[i]]; }
+};
+
+
 void Renderer::setShadingMode (bool usePhysicallyBasedShading) noexcept
 {
-    // Do nothing if we're already in the correct mode.
-    if (usePhysicallyBasedShading != m_pbs)
-    {
-        // Set the new value of the flag.
-        m_pbs = usePhysicallyBasedShading;
-        
-        // Rebuild the programs and rebind the uniforms.
-        buildPrograms();
-        m_uniforms.bindUniformsToPrograms (m_programs);
-    }
+    // The programs of both reflection models are linked up front so we only need to change which are used.
+    m_pbs = usePhysicallyBasedShading;
 }
 
 
 void Renderer::setAntiAliasingMode (SMAA::Quality quality) noexcept
 {
-    // Only rebuild the AA if necessary.
-    const auto old = m_smaaQuality;
-    m_smaaQuality   = quality;
+    // Every quality preset is linked up front so nothing needs rebuilding.
+    m_smaaQuality = quality;
+}
+
 
-    if (old != quality)
+void Renderer::setComplexityMode (const bool measureComplexity) noexcept
+{
+    if (m_measureComplexity == measureComplexity)
     {
-        buildSMAA();
+        return;
+    }
+
+    // The counters are only allocated whilst measuring as they're as large as the internal resolution.
+    const MemoryTracker::Scope memory { MemoryTracker::Subsystem::Profiling };
+    m_measureComplexity = measureComplexity 
+        && m_complexity.initialise (m_resolution.internalWidth, m_resolution.internalHeight);
+
+    if (!m_measureComplexity)
+    {
+        m_complexity.clean();
     }
 }
 
 
 void Renderer::resetFrameTimings() noexcept
 {
-    m_syncCount = 0;
-    m_frames    = 0;
-    m_totalTime = 0.f;
-    m_minTime   = std::numeric_limits<decltype (m_minTime)>::max();
-    m_maxTime   = std::numeric_limits<decltype (m_maxTime)>::min();
+    m_syncCount         = 0;
+    m_frames            = 0;
+    m_totalTime         = 0.f;
+    m_minTime           = std::numeric_limits<decltype (m_minTime)>::max();
+    m_maxTime           = std::numeric_limits<decltype (m_maxTime)>::min();
+    m_lastTime          = 0.f;
+    m_lastRenderScale   = 1.f;
+    m_passTimer.reset();
+    m_pipelineStatistics.reset();
+    m_frameRecorder.reset();
+    m_renderStatistics.reset();
+    m_complexity.reset();
 }
 
 
@@ -118,11 +145,19 @@ void Renderer::setInternalResolution (const glm::ivec2& resolution) noexcept
     {
         m_resolution.internalWidth  = resolution.x;
         m_resolution.internalHeight = resolution.y;
+        updateRenderResolution();
 
         // We'll need to rebuild the framebuffers due to a resolution changes.
         buildFramebuffers();
         buildUniforms();
         buildSMAA();
+
+        // The complexity counters must match the internal resolution.
+        if (m_measureComplexity)
+        {
+            m_measureComplexity = false;
+            setComplexityMode (true);
+        }
     }
 }
 
@@ -135,68 +170,174 @@ void Renderer::setDisplayResolution (const glm::ivec2& resolution) noexcept
 }
 
 
+void Renderer::setDynamicResolution (const DynamicResolution::Settings& settings) noexcept
+{
+    // The buffers are always allocated at the internal resolution so only the rendered region changes.
+    m_dynamicResolution.setSettings (settings);
+    m_renderScales.fill (1.f);
+    updateRenderResolution();
+}
+
+
 bool Renderer::initialise (scene::Context* scene, const glm::ivec2& internalRes, const glm::ivec2& displayRes) noexcept
 {   
+    // Time to first frame is measured from here, along with how many programs could skip compilation.
+    m_startupTimer.begin();
+    ProgramCache::resetCounters();
+
     // Make sure we keep a reference to the scene.
     m_scene = scene;
 
+    // The context may have been modified behind the back of the state cache before now.
+    StateCache::invalidate();
+
     // Ensure we initialise the query objects!
     std::for_each (m_queries, [] (auto& query) { query.initialise (GL_TIME_ELAPSED); });
+    m_passTimer.initialise();
+
+    // Pipeline statistics are optional, they remain inert if the driver doesn't support them.
+    m_pipelineStatistics.initialise();
 
-    // Programs can be built immediately.
-    if (!buildPrograms())
+    // Bindless handles can't survive the reallocation of streamed arrays so they're only used without streaming.
+    m_bindlessTextures = tglIsAvailable (TGL_EXTENSION_ARB_BINDLESS_TEXTURE) == GL_TRUE && !m_textureStreaming.enabled;
+
+    if (!hasEnoughTextureUnits())
     {
         return false;
     }
 
-    // Same with materials.
-    if (!buildMaterials())
+    // Every program permutation is linked during initialisation so let the driver use as many threads as it likes.
+    if (tglIsAvailable (TGL_EXTENSION_KHR_PARALLEL_SHADER_COMPILE) == GL_TRUE)
+    {
+        glMaxShaderCompilerThreadsKHR (0xFFFFFFFF);
+    }
+
+    // Anything which doesn't need OpenGL is prepared on worker threads whilst this thread creates the GPU objects.
+    // Each task is joined right before the phase which needs it, failing early still waits for them to finish.
+    const auto launch = [] (auto task)
+    {
+        try
+        {
+            return std::async (std::launch::async, task);
+        }
+
+        catch (...)
+        {
+            // Without a thread the task runs when its result is first needed.
+            return std::async (std::launch::deferred, task);
+        }
+    };
+
+    auto shaderSources = launch ([this]
+    {
+        const StartupTimer::Scope timing { m_startupTimer, StartupTimer::Phase::ShaderSources };
+        Shader::cacheSources (allShaderSources);
+    });
+
+    auto materials = launch ([this]
+    {
+        const StartupTimer::Scope timing { m_startupTimer, StartupTimer::Phase::MaterialPreparation };
+        return m_materials.prepare (*m_scene);
+    });
+
+    auto geometry = launch ([this]
+    {
+        const StartupTimer::Scope timing { m_startupTimer, StartupTimer::Phase::GeometryPreparation };
+        return Geometry::prepare (*m_scene);
+    });
+
+    const auto timed = [this] (const StartupTimer::Phase phase, const auto& build)
+    {
+        const StartupTimer::Scope timing { m_startupTimer, phase };
+        return build();
+    };
+
+    // Textures and meshes are prepared on worker threads whilst this thread uploads them through a staging ring.
+    UploadService uploads { };
+
+    if (!uploads.initialise())
     {
         return false;
     }
 
-    // And dynamic object buffers.
-    if (!buildDynamicObjectBuffers())
+    // Dynamic object buffers only need to count instances so they're built whilst the workers read files.
+    if (!timed (StartupTimer::Phase::DynamicObjects, [&] { return buildDynamicObjectBuffers(); }))
     {
         return false;
     }
 
     // Aaaaaand light object buffers.
-    if (!buildLightBuffers())
+    if (!timed (StartupTimer::Phase::Lights, [&] { return buildLightBuffers(); }))
+    {
+        return false;
+    }
+
+    // Programs can be built once their sources have been read.
+    shaderSources.wait();
+
+    if (!timed (StartupTimer::Phase::Programs, [&] { return buildPrograms(); }))
+    {
+        return false;
+    }
+
+    // Same with materials once their textures have been opened.
+    const auto preparedMaterials = materials.get();
+
+    if (!preparedMaterials.first || 
+        !timed (StartupTimer::Phase::Materials, [&] { return buildMaterials (uploads, preparedMaterials.second); }))
     {
         return false;
     }
 
     // With materials and instancing buffers done we can build the geometry.
-    if (!buildGeometry())
+    const auto preparedGeometry = geometry.get();
+
+    if (!timed (StartupTimer::Phase::Geometry, [&] { return buildGeometry (uploads, preparedGeometry); }))
     {
         return false;
     }
 
-    // Set the resolutions.
-    setInternalResolution (internalRes);
+    uploads.clean();
+
+    // Set the resolutions, everything which depends on the internal resolution is built below.
+    m_resolution.internalWidth  = internalRes.x;
+    m_resolution.internalHeight = internalRes.y;
     setDisplayResolution (displayRes);
+    m_dynamicResolution.reset();
+    m_renderScales.fill (1.f);
+    updateRenderResolution();
 
     // We can safely build the framebuffers now.
-    if (!buildFramebuffers())
+    if (!timed (StartupTimer::Phase::Framebuffers, [&] { return buildFramebuffers(); }))
     {
         return false;
     }
 
     // With the framebuffers and materials built we can build the uniforms.
-    if (!buildUniforms())
+    if (!timed (StartupTimer::Phase::Uniforms, [&] { return buildUniforms(); }))
     {
         return false;
     }
 
     // Now that we have our framebuffers we can prepare for antialiasing.
-    if (!buildSMAA())
+    if (!timed (StartupTimer::Phase::Antialiasing, [&] { return buildSMAA(); }))
     {
         return false;
     }
 
+    // The complexity counters must match the internal resolution.
+    if (m_measureComplexity)
+    {
+        m_measureComplexity = false;
+        setComplexityMode (true);
+    }
+
+    // Every shader has been compiled so the sources no longer need to be kept around.
+    Shader::clearSourceCache();
+
     // Finally we've succeeded my lord!
     fillDynamicInstances();
+    m_startupTimer.finish();
     return true;
 }
 
@@ -222,32 +363,85 @@ void Renderer::clean() noexcept
     m_resolution.internalHeight = 0;
     m_resolution.displayWidth   = 0;
     m_resolution.displayHeight  = 0;
+    m_resolution.renderWidth    = 0;
+    m_resolution.renderHeight   = 0;
     m_deferredRender            = true;
+    m_measureComplexity         = false;
     std::for_each (m_syncs, [] (auto& sync) { sync.clean(); });
     std::for_each (m_queries, [] (auto& query) { query.clean(); });
+    m_passTimer.clean();
+    m_pipelineStatistics.clean();
+    m_complexity.clean();
+    Shader::clearSourceCache();
     resetFrameTimings();
 }
 
 
+ShadowMaps::Filter Renderer::activeShadowFilter() const noexcept
+{
+    // The subroutine programs always use percentage-closer filtering, they're used whilst measuring complexity.
+    const auto specialised = m_specialisedLighting && !(m_deferredRender && m_measureComplexity);
+    return specialised ? m_shadowFilter : ShadowMaps::Filter::PCF;
+}
+
+
+void Renderer::updateRenderResolution() noexcept
+{
+    m_resolution.renderWidth    = m_dynamicResolution.scale (m_resolution.internalWidth);
+    m_resolution.renderHeight   = m_dynamicResolution.scale (m_resolution.internalHeight);
+}
+
+
+bool Renderer::hasEnoughTextureUnits() const noexcept
+{
+    // The lighting pass samples three gbuffer textures, the shadow maps and their moments alongside the materials.
+    constexpr auto lightingUnits    = GLint { 5 };
+    constexpr auto materialArrays   = static_cast<GLint> (TextureStreamer::arrayCount);
+    const auto requiredUnits        = lightingUnits + (m_bindlessTextures ? 0 : materialArrays);
+
+    auto availableUnits = GLint { 0 };
+    glGetIntegerv (GL_MAX_TEXTURE_IMAGE_UNITS, &availableUnits);
+
+    if (availableUnits < requiredUnits)
+    {
+        std::cerr << "Renderer: the lighting pass samples " << requiredUnits << " textures but "
+            << "GL_MAX_TEXTURE_IMAGE_UNITS is only " << availableUnits << "." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
 bool Renderer::buildPrograms() noexcept
 {
-    // Firstly we must compile the shaders.
+    // The lighting permutations are specialised for the lights in the scene, in the order they're stored.
+    auto lighting               = LightingPermutations::Configuration { };
+    lighting.directionalLights  = static_cast<GLuint> (m_scene->getAllDirectionalLights().size());
+    lighting.pointLights        = static_cast<GLuint> (m_scene->getAllPointLights().size());
+    lighting.spotlights         = static_cast<GLuint> (m_spotlightOrder.size());
+    lighting.shadowedSpotlights = m_shadowedSpotlights;
+    lighting.shadowFilterSize   = shadowFilterSize;
+
+    // Firstly we must load the shaders, both reflection models are needed.
     auto shaders = Shaders { };
     
-    if (!shaders.initialise (m_pbs))
+    if (!(shaders.initialise (m_bindlessTextures) && LightingPermutations::loadShaders (shaders, lighting)))
     {
         return false;
     }
 
     // Next we can link the shaders together to create programs.
-    return m_programs.initialise (shaders);
+    return m_programs.initialise (shaders, lighting);
 }
 
 
-bool Renderer::buildMaterials() noexcept
+bool Renderer::buildMaterials (UploadService& uploads, const Materials::Preparation& prepared) noexcept
 {
     // As simple as initialising the materials.
-    return m_materials.initialise (*m_scene, materialsStartingTextureUnit);
+    const MemoryTracker::Scope memory { MemoryTracker::Subsystem::Materials };
+    return m_materials.initialise (prepared, materialsStartingTextureUnit, m_textureStreaming, m_bindlessTextures, 
+        uploads);
 }
 
 
@@ -275,6 +469,7 @@ bool Renderer::buildDynamicObjectBuffers() noexcept
     const auto transformSize    = static_cast<GLsizeiptr> (instanceCount * sizeof (ModelTransform));
 
     // Initialise the objects with the correct memory values.
+    const MemoryTracker::Scope memory { MemoryTracker::Subsystem::Objects };
     if (!(m_objectDrawing.buffer.initialise (drawCommandSize, false, false) &&
         m_objectMaterialIDs.initialise (materialIDSize, false, false) && 
         m_objectTransforms.initialise (transformSize, false, false)))
@@ -295,20 +490,41 @@ bool Renderer::buildLightBuffers() noexcept
     const auto& point   = m_scene->getAllPointLights();
     const auto& spot    = m_scene->getAllSpotLights();
     
-    // Finally determine the size of the buffers.
-    constexpr auto lightVolumeCount = size_t { 2 }; 
+    // Finally determine the size of the buffers. Spotlights are drawn together with subroutines but the lighting
+    // permutations draw shadow casters and the remaining spotlights separately.
+    constexpr auto lightVolumeCount = size_t { 4 }; 
     const auto count                = point.size() + spot.size();
     const auto transformSize        = static_cast<GLsizeiptr> (count * sizeof (ModelTransform));
     const auto drawCommandSize      = static_cast<GLsizeiptr> (lightVolumeCount * sizeof (MultiDrawElementsIndirectCommand));
     
-    // Now we can initialise the buffers
-    if (!(m_lightDrawing.buffer.initialise (drawCommandSize, false, false) && 
-        m_lightTransforms.initialise (transformSize, false, false) &&
-        m_shadowMaps.initialise (spot, shadowMapStartingTextureUnit)))
+    // Now we can initialise the buffers.
     {
-        return false;
+        const MemoryTracker::Scope memory { MemoryTracker::Subsystem::Lights };
+        if (!(m_lightDrawing.buffer.initialise (drawCommandSize, false, false) && 
+            m_lightTransforms.initialise (transformSize, false, false)))
+        {
+            return false;
+        }
+    }
+
+    // The shadow maps are accounted for separately as their size depends on the number of spotlights.
+    {
+        const MemoryTracker::Scope memory { MemoryTracker::Subsystem::ShadowMaps };
+        if (!m_shadowMaps.initialise (spot, shadowMapStartingTextureUnit, shadowMomentsTextureUnit))
+        {
+            return false;
+        }
     }
 
+    // Spotlights which cast shadows are stored first so the lighting permutations know which need shadow maps.
+    m_spotlightOrder.resize (spot.size());
+    std::iota (std::begin (m_spotlightOrder), std::end (m_spotlightOrder), size_t { 0 });
+
+    const auto unshadowed = std::stable_partition (std::begin (m_spotlightOrder), std::end (m_spotlightOrder), 
+        [&] (const size_t index) { return spot[index].getCastShadow(); });
+    
+    m_shadowedSpotlights = static_cast<GLuint> (std::distance (std::begin (m_spotlightOrder), unshadowed));
+
     // Finally set up the draw buffer.
     m_lightDrawing.capacity = static_cast<GLsizei> (lightVolumeCount);
     m_lightDrawing.count    = 1;
@@ -316,22 +532,28 @@ bool Renderer::buildLightBuffers() noexcept
 }
 
 
-bool Renderer::buildGeometry() noexcept
+bool Renderer::buildGeometry (UploadService& uploads, const Geometry::Preparation& prepared) noexcept
 {
-    // We need to collate the static instances first.
-    const auto& instances   = m_scene->getAllInstances();
-    auto staticInstances    = std::map<scene::MeshId, std::vector<scene::Instance>> { };
+    // The static instances were collated whilst preparing so we can try to initialise the geometry object.
+    const auto& staticInstances = prepared.staticInstances;
 
-    std::for_each (instances, [&] (const scene::Instance& instance)
+    const MemoryTracker::Scope memory { MemoryTracker::Subsystem::Geometry };
+    if (!m_geometry.initialise (uploads, m_materials, prepared, m_objectMaterialIDs, m_objectTransforms, m_lightTransforms))
     {
-        if (instance.isStatic())
-        {
-            staticInstances[instance.getMeshId()].push_back (instance);
-        }
-    });
+        return false;
+    }
 
-    // Now we can try to initialise the geometry object.
-    return m_geometry.initialise (m_materials, staticInstances, m_objectMaterialIDs, m_objectTransforms, m_lightTransforms);
+    // Static geometry never changes so we only need to count what each draw submits once.
+    m_staticDraws = RenderStatistics::Draws { 1, staticInstances.size(), 0, 0 };
+
+    for (const auto& meshInstancePair : staticInstances)
+    {
+        const auto instances        = static_cast<GLuint64> (meshInstancePair.second.size());
+        m_staticDraws.instances     += instances;
+        m_staticDraws.triangles     += instances * (m_geometry[meshInstancePair.first].elementCount / 3);
+    }
+
+    return true;
 }
 
 
@@ -342,14 +564,23 @@ bool Renderer::buildFramebuffers() noexcept
     const auto height   = m_resolution.internalHeight;
 
     // Now we can initialise the framebuffers.
-    return  m_gbuffer.initialise (width, height, gbufferStartingTextureUnit) &&
-            m_lbuffer.initialise (m_gbuffer.getDepthStencilTexture(), GL_RGBA8, width, height, lbufferStartingTextureUnit);
+    {
+        const MemoryTracker::Scope memory { MemoryTracker::Subsystem::GBuffer };
+        if (!m_gbuffer.initialise (width, height, gbufferStartingTextureUnit))
+        {
+            return false;
+        }
+    }
+
+    const MemoryTracker::Scope memory { MemoryTracker::Subsystem::LBuffer };
+    return m_lbuffer.initialise (m_gbuffer.getDepthStencilTexture(), GL_RGBA8, width, height, lbufferStartingTextureUnit);
 }
 
 
 bool Renderer::buildUniforms() noexcept
 {
     // Make sure the uniforms build correctly.
+    const MemoryTracker::Scope memory { MemoryTracker::Subsystem::Uniforms };
     if (!m_uniforms.initialise (m_gbuffer, m_shadowMaps, m_materials))
     {
         return false;
@@ -363,8 +594,8 @@ bool Renderer::buildUniforms() noexcept
 
 bool Renderer::buildSMAA() noexcept
 {
-    if (!m_smaa.initialise (m_smaaQuality, m_resolution.internalWidth, m_resolution.internalHeight,
-       smaaStartingTextureUnit, false))
+    const MemoryTracker::Scope memory { MemoryTracker::Subsystem::SMAA };
+    if (!m_smaa.initialise (m_resolution.internalWidth, m_resolution.internalHeight, smaaStartingTextureUnit, false))
     {
         return false;
     }
@@ -407,25 +638,48 @@ void Renderer::fillDynamicInstances() noexcept
 
     // Finally remove any excess memory in the dynamic container.
     m_dynamics.shrink_to_fit();
+
+    // Keep track of what drawing dynamic objects will submit.
+    m_dynamicDraws = RenderStatistics::Draws { 1, m_dynamics.size(), 0, 0 };
+
+    for (const auto& meshInstances : m_dynamics)
+    {
+        const auto instances        = static_cast<GLuint64> (meshInstances.instances.size());
+        m_dynamicDraws.instances    += instances;
+        m_dynamicDraws.triangles    += instances * (meshInstances.mesh.elementCount / 3);
+    }
 }
 
 
 void Renderer::render() noexcept
 {
-    #ifdef _NVTX
-        nvtxRangePush (L"Entire Draw");
-        nvtxRangePush (L"Checking Fence Sync");
-    #endif
+    PROFILE_BEGIN ("Entire Draw");
+    PROFILE_BEGIN ("Checking Fence Sync");
+
+    const auto frameStart = std::chrono::high_resolution_clock::now();
+    StateCache::resetCounters();
 
     // We must ensure that we aren't writing to data which the GPU is currently reading from. We must avoid this race
     // condition by checking if the most recent frame that used the current partition has finished accessing the
     // memory.
-    syncWithGPUIfNecessary();
+    const auto syncTime = syncWithGPUIfNecessary();
+    m_renderStatistics.beginFrame();
+    m_renderStatistics.recordSync (syncTime);
+
+    PROFILE_END();
+    PROFILE_BEGIN ("Updating Frame Times");
 
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Updating Frame Times");
-    #endif
+    // Pass timings and statistics of the previous frame to use this partition can be collected now we've synchronised.
+    m_passTimer.beginFrame (m_partition);
+    m_pipelineStatistics.beginFrame (m_partition);
+    m_complexity.beginFrame (m_partition);
+
+    // Streamed textures read their usage feedback now too, arrays may be reallocated so this precedes binding them.
+    if (m_materials.getStreamer().isInitialised())
+    {
+        const MemoryTracker::Scope memory { MemoryTracker::Subsystem::Materials };
+        m_materials.getStreamer().beginFrame (m_partition);
+    }
 
     // Ensure we keep track of how long this frame took.
     auto& query = m_queries[m_partition];
@@ -435,22 +689,29 @@ void Renderer::render() noexcept
         m_minTime           = result < m_minTime != 0.f ? result : m_minTime;
         m_maxTime           = result > m_maxTime ? result : m_maxTime;
         m_totalTime         += result;
+        m_lastTime          = result;
+        m_lastRenderScale   = m_renderScales[m_partition];
+
+        // The scale of the next frame is chosen from the time of the frame which last used this partition.
+        m_dynamicResolution.update (result, m_lastRenderScale);
+        m_frameRecorder.resolve (m_partition, result, m_passTimer.getLastFrameTimes());
     }
 
+    // The rendered region must be known before the scene uniforms calculate the aspect ratio.
+    updateRenderResolution();
+    m_renderScales[m_partition] = m_dynamicResolution.getScale();
+
     query.begin();
+    beginPass (PassTimer::Pass::Frame);
 
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Switching UBO Partition");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Switching UBO Partition");
 
     // Now we can set the correct partition on the uniforms.
     m_uniforms.bindBlocksToPartition (m_partition);
 
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Starting Multi-threading");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Starting Multi-threading");
 
     // We need to retrieve light data before we can render.
     const auto& directional = m_scene->getAllDirectionalLights();
@@ -469,6 +730,7 @@ void Renderer::render() noexcept
     actions.spotLights          = std::async (policy, [&]() { return updateSpotlights (spot, point.size()); });
     actions.shadowUniforms      = std::async (policy, [&]() 
     { 
+        PROFILE_SCOPE ("Streaming Shadow Uniforms");
         auto data = m_uniforms.getWritableLightViewData();
         return m_shadowMaps.setUniforms (m_scene, data.data, data.offset);
     });
@@ -482,19 +744,17 @@ void Renderer::render() noexcept
         });
     }
 
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Binding Textures");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Binding Textures");
 
     // Now perform universal rendering actions. Start by ensuring each material texture unit is bound.
     m_materials.bindTextures();
 
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Shadow Pass");
-        nvtxRangePush (L"Preparing for Static Objects");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Shadow Pass");
+    PROFILE_BEGIN ("Preparing for Static Objects");
+
+    beginPass (PassTimer::Pass::ShadowMaps);
 
     // We need to configure the scene VAO for rendering static objects.
     auto& sceneVAO = m_geometry.getSceneVAO();
@@ -511,26 +771,24 @@ void Renderer::render() noexcept
     const auto& staticObjects = m_geometry.getStaticGeometryCommands();
     BufferBinder<GL_DRAW_INDIRECT_BUFFER>::bind (staticObjects.buffer);
 
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Updating Scene and Shadow UBO Blocks");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Updating Scene and Shadow UBO Blocks");
 
     // Generate shadow maps for static objects.
     m_uniforms.notifyModifiedDataRange (actions.sceneUniforms.get());
     m_uniforms.notifyModifiedDataRange (actions.shadowUniforms.get());
 
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Static Object Shadow Pass");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Static Object Shadow Pass");
 
     m_shadowMaps.generateMaps (true, [&] () { staticObjects.drawWithoutBinding(); });
 
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Preparing for Dynamic Objects");
-    #endif
+    const auto shadowLayers = static_cast<GLuint64> (m_shadowMaps.getMapCount());
+    m_renderStatistics.recordDraws (PassTimer::Pass::ShadowMaps, m_staticDraws, shadowLayers);
+    m_renderStatistics.recordShadowLayers (shadowLayers);
+
+    PROFILE_END();
+    PROFILE_BEGIN ("Preparing for Dynamic Objects");
 
     // We must prepare for drawing dynamic objects.
     sceneVAO.useDynamicBuffers<multiBuffering> (m_partition);
@@ -543,78 +801,98 @@ void Renderer::render() noexcept
     // Generate shadow maps for dynamic objects.
     BufferBinder<GL_DRAW_INDIRECT_BUFFER>::bind (m_objectDrawing.buffer.getID());
 
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Dynamic Object Shadow Pass");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Dynamic Object Shadow Pass");
 
     m_shadowMaps.generateMaps (false, [&] () { m_objectDrawing.drawWithoutBinding(); });
+    m_renderStatistics.recordDraws (PassTimer::Pass::ShadowMaps, m_dynamicDraws, shadowLayers);
 
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePop();
-        nvtxRangePush (L"Binding Shadow Maps");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Filtering Shadow Moments");
+
+    // Exponential variance shadow maps are blurred once here instead of every time a fragment samples them.
+    if (activeShadowFilter() == ShadowMaps::Filter::EVSM)
+    {
+        if (!m_shadowMaps.hasMoments())
+        {
+            const MemoryTracker::Scope memory { MemoryTracker::Subsystem::ShadowMaps };
+            m_shadowMaps.prepareMoments();
+        }
+
+        if (m_shadowMaps.hasMoments())
+        {
+            m_shadowMaps.generateMoments (m_programs.shadowMomentsWarp, m_programs.shadowMomentsBlur, 
+                shadowFilterSize);
+        }
+    }
+
+    endPass (PassTimer::Pass::ShadowMaps);
+
+    PROFILE_END();
+    PROFILE_END();
+    PROFILE_BEGIN ("Binding Shadow Maps");
 
     // Now prepare for rendering the scene again.
     sceneVAO.useStaticBuffers();
 
-    // Ensure we reset the viewport and bind the shadow maps.
-    const auto shadowMaps = TextureBinder { m_shadowMaps.getShadowMaps() };
-    glViewport (0, 0, m_resolution.displayWidth, m_resolution.displayHeight);
+    // Ensure we reset the viewport to the rendered region and bind the shadow maps.
+    const auto shadowMaps       = TextureBinder { m_shadowMaps.getShadowMaps() };
+    const auto shadowMoments    = TextureBinder { m_shadowMaps.getMoments(), m_shadowMaps.getMomentsTextureUnit() };
+    StateCache::viewport (0, 0, m_resolution.renderWidth, m_resolution.renderHeight);
 
     if (m_deferredRender)
     {
-        #ifdef _NVTX
-            nvtxRangePop();
-            nvtxRangePush (L"Deferred Render");
-        #endif
+        PROFILE_END();
+        PROFILE_BEGIN ("Deferred Render");
 
         deferredRender (staticObjects, sceneVAO, actions);
     }
 
     else
     {
-        #ifdef _NVTX
-            nvtxRangePop();
-            nvtxRangePush (L"Forward Render");
-        #endif
+        PROFILE_END();
+        PROFILE_BEGIN ("Forward Render");
 
+        beginPass (PassTimer::Pass::Forward);
         forwardRender (staticObjects, sceneVAO, actions);
+        endPass (PassTimer::Pass::Forward);
     }
 
-    // Render to the screen performing antialiasing if necessary.
+    // Render to the screen performing antialiasing if necessary. Both paths filter beyond the edge of the region.
+    const auto fullScreenDraw = RenderStatistics::Draws { 1, 1, 1, 1 };
+    m_lbuffer.replicateRegionBorder (m_resolution);
+
     if (m_smaaQuality != SMAA::Quality::None)
     {
 
-        #ifdef _NVTX
-            nvtxRangePop();
-            nvtxRangePush (L"SMAA");
-        #endif
+        PROFILE_END();
+        PROFILE_BEGIN ("SMAA");
 
-        m_smaa.run (m_geometry.getTriangleVAO(), m_lbuffer.getColourBuffer(), &m_gbuffer.getDepthStencilTexture());
+        beginPass (PassTimer::Pass::Antialiasing);
+        m_smaa.run (m_smaaQuality, m_geometry.getTriangleVAO(), m_lbuffer.getColourBuffer(), m_resolution,
+            &m_gbuffer.getDepthStencilTexture());
+        m_renderStatistics.recordDraws (PassTimer::Pass::Antialiasing, fullScreenDraw, SMAA::passCount);
+        endPass (PassTimer::Pass::Antialiasing);
     }
 
     else
     {
-        #ifdef _NVTX
-            nvtxRangePop();
-            nvtxRangePush (L"Blitting Screen");
-        #endif
+        PROFILE_END();
+        PROFILE_BEGIN ("Blitting Screen");
 
+        beginPass (PassTimer::Pass::Blit);
         glBlitNamedFramebuffer (m_lbuffer.getFramebuffer().getID(), 0,
-            0, 0, m_resolution.internalWidth, m_resolution.internalHeight,
+            0, 0, m_resolution.renderWidth, m_resolution.renderHeight,
             0, 0, m_resolution.displayWidth, m_resolution.displayHeight, 
             GL_COLOR_BUFFER_BIT, GL_LINEAR);
+        endPass (PassTimer::Pass::Blit);
     }
 
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Cleanup");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Cleanup");
 
-    // Cleanup.
-    m_materials.unbindTextures();
+    // Cleanup. Material textures stay bound so the state cache filters the next frame's binds.
+    endPass (PassTimer::Pass::Frame);
     query.end();
 
     // Prepare for the next frame, the fence sync only allows the given parameters.
@@ -623,16 +901,31 @@ void Renderer::render() noexcept
         assert (false);
     }
 
+    // The GPU time of this frame will be resolved the next time the partition is used.
+    const auto cpuTime = std::chrono::duration<float, std::milli> (std::chrono::high_resolution_clock::now() - frameStart);
+    m_frameRecorder.submit (m_partition, m_frames - 1, cpuTime.count(), syncTime);
+    m_stateCounters = StateCache::getCounters();
+
+    // Lights aren't culled so every uploaded light is drawn, either by a volume or by the forward shader.
+    m_renderStatistics.recordLights (RenderStatistics::Light::Directional, directional.size());
+    m_renderStatistics.recordLights (RenderStatistics::Light::Point, point.size());
+    m_renderStatistics.recordLights (RenderStatistics::Light::Spot, spot.size());
+    recordStreaming();
+    m_renderStatistics.endFrame();
+
+#ifdef TGL_INSTRUMENT
+    // Instrumented builds of tgl count GL calls per frame so they need to know when a frame ends.
+    tglInstrumentEndFrame();
+#endif
+
     ++m_partition %= multiBuffering;
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePop();
-    #endif        
+    PROFILE_END();
+    PROFILE_END();
 }
 
 
-void Renderer::syncWithGPUIfNecessary() noexcept
+float Renderer::syncWithGPUIfNecessary() noexcept
 {
     // Don't attempt to wait if the sync object hasn't been initialised.
     auto& sync = m_syncs[m_partition];
@@ -642,220 +935,318 @@ void Renderer::syncWithGPUIfNecessary() noexcept
         // Don't force a wait if we don't need to.
         if (!sync.checkIfSignalled())
         {
-            #ifdef _NVTX
-                nvtxRangePush (L"Forcing Flush");
-            #endif
+            PROFILE_BEGIN ("Forcing Flush");
 
             // We have to force a wait so we don't cause a data race.
             constexpr auto oneSecond = std::chrono::duration_cast<std::chrono::nanoseconds> (1s).count();
-            const auto result = sync.waitForSignal (true, oneSecond);
+            const auto start    = std::chrono::high_resolution_clock::now();
+            const auto result   = sync.waitForSignal (true, oneSecond);
+            const auto waited   = std::chrono::duration<float, std::milli> (std::chrono::high_resolution_clock::now() - start);
             ++m_syncCount;
             assert (result);
 
-            #ifdef _NVTX
-                nvtxRangePop();
-            #endif
+            PROFILE_END();
+            return waited.count();
         }
     }
+
+    return 0.f;
+}
+
+
+void Renderer::beginPass (const PassTimer::Pass pass) noexcept
+{
+    m_passTimer.begin (pass);
+    m_pipelineStatistics.begin (pass);
+}
+
+
+void Renderer::endPass (const PassTimer::Pass pass) noexcept
+{
+    m_pipelineStatistics.end (pass);
+    m_passTimer.end (pass);
+}
+
+
+void Renderer::recordStreaming() noexcept
+{
+    const auto record = [&] (const RenderStatistics::Stream stream, auto& buffer)
+    {
+        m_renderStatistics.recordStream (stream, buffer.getBytesModified(), buffer.getRangesFlushed());
+        buffer.resetModificationCounters();
+    };
+
+    m_renderStatistics.recordStream (RenderStatistics::Stream::Uniforms, m_uniforms.getBlocks().getBytesModified(), 
+        m_uniforms.getBlocks().getRangesFlushed());
+    m_uniforms.resetModificationCounters();
+
+    record (RenderStatistics::Stream::ObjectDrawCommands, m_objectDrawing.buffer);
+    record (RenderStatistics::Stream::ObjectMaterialIDs, m_objectMaterialIDs);
+    record (RenderStatistics::Stream::ObjectTransforms, m_objectTransforms);
+    record (RenderStatistics::Stream::LightDrawCommands, m_lightDrawing.buffer);
+    record (RenderStatistics::Stream::LightTransforms, m_lightTransforms);
+    record (RenderStatistics::Stream::Textures, m_materials.getStreamer().getStagingBuffer());
+}
+
+
+RenderStatistics::Draws Renderer::lightVolumeDraws (const Mesh& volume, const size_t lights) noexcept
+{
+    const auto instances = static_cast<GLuint64> (lights);
+    return { 1, 1, instances, instances * (volume.elementCount / 3) };
 }
 
 
 void Renderer::deferredRender (const MultiDrawCommands<Buffer>& staticObjects, SceneVAO& sceneVAO, ASyncActions& actions) noexcept
 {
-    #ifdef _NVTX
-        nvtxRangePush (L"Binding Program/Framebuffer/Indirect");
-    #endif
+    PROFILE_BEGIN ("Binding Program/Framebuffer/Indirect");
         
     // We need to perform a geometry pass to collect the position, normal and material data of every object that's 
-    // visible on-screen.
-    const auto activeProgram        = ProgramBinder { m_programs.geometryPass };
+    // visible on-screen. Measuring complexity requires variants of the programs which count shaded fragments.
+    const auto& geometryProgram     = m_measureComplexity ? m_programs.geometryComplexity : m_programs.geometryPass;
+    const auto& shading             = m_programs.getShading (m_pbs);
+    const auto& lightingProgram     = m_measureComplexity ? shading.lightingComplexity : shading.lightingPass;
+    const auto specialised          = m_specialisedLighting && !m_measureComplexity;
+    const auto permutation          = [&] (const LightingPermutations::Pass pass) -> const Program&
+    {
+        return m_programs.permutations.find ({ pass, m_pbs, m_shadowFilter });
+    };
+    const auto activeProgram        = ProgramBinder { geometryProgram };
     const auto activeFramebuffer    = FramebufferBinder<GL_FRAMEBUFFER> { m_gbuffer.getFramebuffer() };
     const auto activeIndirectBuffer = BufferBinder<GL_DRAW_INDIRECT_BUFFER> { staticObjects.buffer.getID() };
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Geometry Pass");
-        nvtxRangePush (L"Preparing for Geometry Pass");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Geometry Pass");
+    PROFILE_BEGIN ("Preparing for Geometry Pass");
 
+    beginPass (PassTimer::Pass::Geometry);
     PassConfigurator::geometryPass();
+
+    if (m_measureComplexity)
+    {
+        m_complexity.beginGeometry();
+    }
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Static Object Geometry");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Static Object Geometry");
 
     // Draw static objects.
     staticObjects.drawWithoutBinding();
+    m_renderStatistics.recordDraws (PassTimer::Pass::Geometry, m_staticDraws);
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Preparing for Dynamic Objects");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Preparing for Dynamic Objects");
 
     sceneVAO.useDynamicBuffers<multiBuffering> (m_partition);
     activeIndirectBuffer.bind (m_objectDrawing.buffer.getID());
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Dynamic Object Geometry");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Dynamic Object Geometry");
 
     m_objectDrawing.drawWithoutBinding();
+    m_renderStatistics.recordDraws (PassTimer::Pass::Geometry, m_dynamicDraws);
+    endPass (PassTimer::Pass::Geometry);
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePop();
-        nvtxRangePush (L"Global Light Pass");
-        nvtxRangePush (L"Preparing for Global Light Pass");
-    #endif
+    PROFILE_END();
+    PROFILE_END();
+    PROFILE_BEGIN ("Global Light Pass");
+    PROFILE_BEGIN ("Preparing for Global Light Pass");
+
+    beginPass (PassTimer::Pass::GlobalLight);
 
     // The geometry pass has completed. We need to prepare for a global lighting pass, this will require using an 
     // oversized triangle to perform a full-screen lighting pass.
-    activeProgram.bind (m_programs.globalLightPass);
+    activeProgram.bind (specialised ? permutation (LightingPermutations::Pass::GlobalLight) : shading.globalLightPass);
     activeFramebuffer.bind (m_lbuffer.getFramebuffer());
     VertexArrayBinder::bind (m_geometry.getTriangleVAO().vao);
 
     // Prepare OpenGL, the light buffer and the program for a global light pass program.
     PassConfigurator::globalLightPass();
-    Programs::setActiveProgramSubroutine (GL_FRAGMENT_SHADER, Programs::globalLightSubroutine);
+
+    if (!specialised)
+    {
+        Programs::setActiveProgramSubroutine (GL_FRAGMENT_SHADER, Programs::globalLightSubroutine);
+    }
 
     // Don't forget to bind the gbuffer textures.
     const auto gbufferPosition  = TextureBinder (m_gbuffer.getPositionTexture());
     const auto gbufferNormals   = TextureBinder (m_gbuffer.getNormalTexture());
     const auto gbufferMaterials = TextureBinder (m_gbuffer.getMaterialTexture());
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Updating Directional Lights");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Updating Directional Lights");
 
     // Now all we need is for the directional light data thread to complete.
     m_uniforms.notifyModifiedDataRange (actions.directionalLights.get());
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Apply Global Lighting");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Apply Global Lighting");
 
     // Finally draw a full-screen triangle and global lighting will be applied.
+    const auto fullScreenDraw = RenderStatistics::Draws { 1, 1, 1, 1 };
     glDrawArrays (GL_TRIANGLES, 0, FullScreenTriangleVAO::vertexCount);
+    m_renderStatistics.recordDraws (PassTimer::Pass::GlobalLight, fullScreenDraw);
+    endPass (PassTimer::Pass::GlobalLight);
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePop();
-        nvtxRangePush (L"Point Light Pass");
-        nvtxRangePush (L"Preparing for Light Volume Pass");
-    #endif
+    PROFILE_END();
+    PROFILE_END();
+    PROFILE_BEGIN ("Point Light Pass");
+    PROFILE_BEGIN ("Preparing for Light Volume Pass");
+
+    beginPass (PassTimer::Pass::PointLights);
 
     // Move on to point llights. This will require binding a different program, VAO and indirect buffer.
-    activeProgram.bind (m_programs.lightingPass);
+    activeProgram.bind (specialised ? permutation (LightingPermutations::Pass::PointLight) : lightingProgram);
     activeIndirectBuffer.bind (m_lightDrawing.buffer.getID());
 
+    if (m_measureComplexity)
+    {
+        m_complexity.beginLights();
+    }
+
     auto& lightingVAO = m_geometry.getLightingVAO();
     VertexArrayBinder::bind (lightingVAO.vao);
     lightingVAO.useTransformPartition (m_partition);
 
     // Configure OpenGL and the new program for usage.
     PassConfigurator::lightVolumePass();
-    Programs::setActiveProgramSubroutine (GL_FRAGMENT_SHADER, Programs::pointLightSubroutine);
+
+    if (!specialised)
+    {
+        Programs::setActiveProgramSubroutine (GL_FRAGMENT_SHADER, Programs::pointLightSubroutine);
+    }
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Updating Light Draw Commands");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Updating Light Draw Commands");
 
     // Update the draw commands, uniforms and transforms.
     m_lightDrawing.buffer.notifyModifiedDataRange (actions.lightDrawCommands.get());
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Updating Point Light Uniforms and Transforms");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Updating Point Light Uniforms and Transforms");
 
     const auto pointLightData = actions.pointLights.get();
     m_uniforms.notifyModifiedDataRange (pointLightData.uniforms);
     m_lightTransforms.notifyModifiedDataRange (pointLightData.transforms);
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Apply Point Lighting");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Apply Point Lighting");
 
     // Now draw the point lights.
     m_lightDrawing.drawWithoutBinding();
+    m_renderStatistics.recordDraws (PassTimer::Pass::PointLights, 
+        lightVolumeDraws (m_geometry.getSphere(), m_scene->getAllPointLights().size()));
+    endPass (PassTimer::Pass::PointLights);
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePop();
-        nvtxRangePush (L"Spotlight Pass");
-        nvtxRangePush (L"Updating Spotlight Uniforms and Transforms");
-    #endif
+    PROFILE_END();
+    PROFILE_END();
+    PROFILE_BEGIN ("Spotlight Pass");
+    PROFILE_BEGIN ("Updating Spotlight Uniforms and Transforms");
 
-    // And finally spotlights.
-    Programs::setActiveProgramSubroutine (GL_FRAGMENT_SHADER, Programs::spotlightSubroutine); 
+    beginPass (PassTimer::Pass::Spotlights);
 
+    // And finally spotlights.
     const auto spotlightData = actions.spotLights.get();
     m_uniforms.notifyModifiedDataRange (spotlightData.uniforms);
     m_lightTransforms.notifyModifiedDataRange (spotlightData.transforms);
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Apply Spotlighting");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Apply Spotlighting");
 
-    // Draw the spotlights.
-    m_lightDrawing.incrementOffset();
-    m_lightDrawing.drawWithoutBinding();
+    // Draw the spotlights, the permutations skip the command covering every spotlight and use the two which follow.
+    const auto& cone    = m_geometry.getCone();
+    const auto shadowed = static_cast<size_t> (m_shadowedSpotlights);
+    const auto spots    = m_spotlightOrder.size();
+
+    if (specialised)
+    {
+        const auto drawSpotlights = [&] (const LightingPermutations::Pass pass, const size_t lights)
+        {
+            m_lightDrawing.incrementOffset();
+
+            if (lights > 0)
+            {
+                activeProgram.bind (permutation (pass));
+                m_lightDrawing.drawWithoutBinding();
+                m_renderStatistics.recordDraws (PassTimer::Pass::Spotlights, lightVolumeDraws (cone, lights));
+            }
+        };
+
+        m_lightDrawing.incrementOffset();
+        drawSpotlights (LightingPermutations::Pass::ShadowedSpotlight, shadowed);
+        drawSpotlights (LightingPermutations::Pass::UnshadowedSpotlight, spots - shadowed);
+    }
+
+    else
+    {
+        Programs::setActiveProgramSubroutine (GL_FRAGMENT_SHADER, Programs::spotlightSubroutine); 
+        m_lightDrawing.incrementOffset();
+        m_lightDrawing.drawWithoutBinding();
+        m_renderStatistics.recordDraws (PassTimer::Pass::Spotlights, lightVolumeDraws (cone, spots));
+    }
+
+    endPass (PassTimer::Pass::Spotlights);
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePop();
-    #endif
+    PROFILE_END();
+    PROFILE_END();
+
+    if (m_measureComplexity)
+    {
+        PROFILE_BEGIN ("Reducing Complexity Histograms");
+
+        m_complexity.reduce (m_programs.complexityHistogram, m_resolution.renderWidth, m_resolution.renderHeight);
+        
+        PROFILE_END();
+    }
+
+    if (m_materials.getStreamer().isInitialised())
+    {
+        PROFILE_BEGIN ("Gathering Texture Usage");
+
+        // The materials and gbuffer are still bound, only depth needs adding so sky pixels can be ignored.
+        const auto gbufferDepth = TextureBinder (m_gbuffer.getDepthStencilTexture());
+        m_materials.getStreamer().gatherUsage (m_programs.textureUsage, 
+            m_resolution.renderWidth, m_resolution.renderHeight);
+
+        PROFILE_END();
+    }
 }
 
 
 void Renderer::forwardRender (const MultiDrawCommands<Buffer>& staticObjects, SceneVAO& sceneVAO, ASyncActions& actions) noexcept
 {
-    #ifdef _NVTX
-        nvtxRangePush (L"Binding Program/Framebuffer/Indirect");
-    #endif
+    PROFILE_BEGIN ("Binding Program/Framebuffer/Indirect");
 
     // We need to use the purpose-made forward render program and write straight into the light buffer.
-    const auto activeProgram        = ProgramBinder { m_programs.forwardRender };
+    const auto& program             = m_specialisedLighting ? 
+        m_programs.permutations.find ({ LightingPermutations::Pass::Forward, m_pbs, m_shadowFilter }) :
+        m_programs.getShading (m_pbs).forwardRender;
+    const auto activeProgram        = ProgramBinder { program };
     const auto activeFramebuffer    = FramebufferBinder<GL_FRAMEBUFFER> { m_lbuffer.getFramebuffer() };
     const auto activeIndirectBuffer = BufferBinder<GL_DRAW_INDIRECT_BUFFER> { staticObjects.buffer };
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Preparing for Forward Render");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Preparing for Forward Render");
 
     // Prepare the fresh frame.
     PassConfigurator::forwardRender();
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Updating Light Uniforms");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Updating Light Uniforms");
 
     // Unfortunately forward rendering doesn't benefit from multi-threading too much so we have to synchronise early.
     m_uniforms.notifyModifiedDataRange (actions.directionalLights.get());
     m_uniforms.notifyModifiedDataRange (actions.pointLights.get().uniforms);
     m_uniforms.notifyModifiedDataRange (actions.spotLights.get().uniforms);
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Drawing Static Objects");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Drawing Static Objects");
     
     // Now we can render static objects.
     staticObjects.drawWithoutBinding();
+    m_renderStatistics.recordDraws (PassTimer::Pass::Forward, m_staticDraws);
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Preparing for Dynamic Objects");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Preparing for Dynamic Objects");
 
     // Prepare for dynamic objects.
     sceneVAO.useDynamicBuffers<multiBuffering> (m_partition);
@@ -863,21 +1254,20 @@ void Renderer::forwardRender (const MultiDrawCommands<Buffer>& staticObjects, Sc
     // Now we can draw!
     activeIndirectBuffer.bind (m_objectDrawing.buffer.getID());
     
-    #ifdef _NVTX
-        nvtxRangePop();
-        nvtxRangePush (L"Drawing Dynamic Objects");
-    #endif
+    PROFILE_END();
+    PROFILE_BEGIN ("Drawing Dynamic Objects");
 
     m_objectDrawing.drawWithoutBinding();
+    m_renderStatistics.recordDraws (PassTimer::Pass::Forward, m_dynamicDraws);
     
-    #ifdef _NVTX
-        nvtxRangePop();
-    #endif
+    PROFILE_END();
 }
 
 
 ModifiedRange Renderer::updateSceneUniforms() noexcept
 {
+    PROFILE_SCOPE ("Streaming Scene Uniforms");
+
     // Retrieve the pointer to the uniforms so we can modify them.
     auto scene = m_uniforms.getWritableSceneData();
 
@@ -886,7 +1276,7 @@ ModifiedRange Renderer::updateSceneUniforms() noexcept
     const auto camPosition  = util::toGLM (camera.getPosition());
     const auto camDirection = util::toGLM (camera.getDirection());
     const auto upDirection  = util::toGLM (m_scene->getUpDirection());
-    const auto aspectRatio  = m_resolution.internalWidth / static_cast<float> (m_resolution.internalHeight);
+    const auto aspectRatio  = m_resolution.renderWidth / static_cast<float> (m_resolution.renderHeight);
 
     // Now we can write the data.
     scene.data->projection = glm::perspective (glm::radians (camera.getVerticalFieldOfViewInDegrees()), aspectRatio, 
@@ -903,6 +1293,8 @@ ModifiedRange Renderer::updateSceneUniforms() noexcept
 
 Renderer::ModifiedDynamicObjectRanges Renderer::updateDynamicObjects() noexcept
 {
+    PROFILE_SCOPE ("Streaming Dynamic Objects");
+
     // Retrieve the necessary pointers. We also need to keep track of how many instances there are.
     auto drawCommandBuffer  = (MultiDrawElementsIndirectCommand*) m_objectDrawing.buffer.pointer (m_partition);
     auto transformBuffer    = (ModelTransform*) m_objectTransforms.pointer (m_partition);
@@ -966,6 +1358,8 @@ Renderer::ModifiedDynamicObjectRanges Renderer::updateDynamicObjects() noexcept
 
 ModifiedRange Renderer::updateLightDrawCommands (const GLuint pointLights, const GLuint spotlights) noexcept
 {
+    PROFILE_SCOPE ("Streaming Light Draw Commands");
+
     // We need the pointer to write to the buffer.
     const auto bufferOffset = m_lightDrawing.buffer.partitionOffset (m_partition);
     auto lightCommands      = (MultiDrawElementsIndirectCommand*) m_lightDrawing.buffer.pointer (m_partition);
@@ -974,12 +1368,16 @@ ModifiedRange Renderer::updateLightDrawCommands (const GLuint pointLights, const
     const auto& sphere  = m_geometry.getSphere();
     const auto& cone    = m_geometry.getCone();
 
-    // Finally add each draw command for the light volumes.
+    // Finally add each draw command for the light volumes. The shadow casting spotlights are stored first.
+    const auto shadowed = m_shadowedSpotlights;
     lightCommands[0] = { sphere.elementCount, pointLights, sphere.elementsIndex, sphere.verticesIndex, 0 };
     lightCommands[1] = { cone.elementCount, spotlights, cone.elementsIndex, cone.verticesIndex, pointLights };
+    lightCommands[2] = { cone.elementCount, shadowed, cone.elementsIndex, cone.verticesIndex, pointLights };
+    lightCommands[3] = { cone.elementCount, spotlights - shadowed, cone.elementsIndex, cone.verticesIndex, 
+        pointLights + shadowed };
 
     // Now return the modified range.
-    const auto modifiedCommands = 2;
+    const auto modifiedCommands = 4;
     m_lightDrawing.start = bufferOffset;
     return { bufferOffset, static_cast<GLsizeiptr> (sizeof (MultiDrawElementsIndirectCommand) * modifiedCommands) };
 }
@@ -987,6 +1385,8 @@ ModifiedRange Renderer::updateLightDrawCommands (const GLuint pointLights, const
 
 ModifiedRange Renderer::updateDirectionalLights (const std::vector<scene::DirectionalLight>& lights) noexcept
 {
+    PROFILE_SCOPE ("Streaming Directional Lights");
+
     auto uniforms = m_uniforms.getWritableDirectionalLightData();
     return processLightUniforms (uniforms, lights, [] (const scene::DirectionalLight& scene, const float intensityScale)
     {
@@ -1001,6 +1401,8 @@ ModifiedRange Renderer::updateDirectionalLights (const std::vector<scene::Direct
 
 Renderer::ModifiedLightVolumeRanges Renderer::updatePointLights (const std::vector<scene::PointLight>& lights) noexcept
 {
+    PROFILE_SCOPE ("Streaming Point Lights");
+
     // We need lambdas for translating scene to uniform information.
     const auto uniforms = [] (const scene::PointLight& scene, const float intensityScale)
     {
@@ -1042,6 +1444,8 @@ Renderer::ModifiedLightVolumeRanges Renderer::updatePointLights (const std::vect
 Renderer::ModifiedLightVolumeRanges Renderer::updateSpotlights (const std::vector<scene::SpotLight>& lights, 
             const size_t transformOffset) noexcept
 {
+    PROFILE_SCOPE ("Streaming Spotlights");
+
     // We need lambdas for translating scene to uniform information.
     const auto uniforms = [&] (const scene::SpotLight& scene, const float intensityScale)
     {
@@ -1075,12 +1479,13 @@ Renderer::ModifiedLightVolumeRanges Renderer::updateSpotlights (const std::vecto
     };
 
     // Only construct transforms if we're going to be using them for deferred rendering.
-    auto block = m_uniforms.getWritableSpotlightData();
+    auto block          = m_uniforms.getWritableSpotlightData();
+    const auto ordered  = OrderedSpotlights { lights, m_spotlightOrder };
 
     if (m_deferredRender)
     {
-        return processLightVolumes (block, lights, transformOffset, uniforms, transforms);
+        return processLightVolumes (block, ordered, transformOffset, uniforms, transforms);
     }
 
-    return { processLightUniforms (block, lights, uniforms), { 0, 0 } };
+    return { processLightUniforms (block, ordered, uniforms), { 0, 0 } };
 }
\ No newline at end of file
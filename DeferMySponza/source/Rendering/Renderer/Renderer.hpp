@@ -5,6 +5,7 @@
 
 // STL headers.
 #include <utility>
+#include <vector>
 
 
 // Engine headers.
@@ -13,9 +14,11 @@
 
 
 // Personal headers.
+#include <Rendering/Composites/UploadService.hpp>
 #include <Rendering/Objects/Buffer.hpp>
 #include <Rendering/Objects/Sync.hpp>
 #include <Rendering/Objects/Query.hpp>
+#include <Rendering/Renderer/Drawing/DynamicResolution.hpp>
 #include <Rendering/Renderer/Drawing/GeometryBuffer.hpp>
 #include <Rendering/Renderer/Drawing/LightBuffer.hpp>
 #include <Rendering/Renderer/Drawing/Resolution.hpp>
@@ -23,8 +26,15 @@
 #include <Rendering/Renderer/Drawing/SMAA.hpp>
 #include <Rendering/Renderer/Geometry/Geometry.hpp>
 #include <Rendering/Renderer/Materials/Materials.hpp>
+#include <Rendering/Renderer/Profiling/ComplexityCounter.hpp>
+#include <Rendering/Renderer/Profiling/FrameRecorder.hpp>
+#include <Rendering/Renderer/Profiling/PassTimer.hpp>
+#include <Rendering/Renderer/Profiling/PipelineStatistics.hpp>
+#include <Rendering/Renderer/Profiling/RenderStatistics.hpp>
+#include <Rendering/Renderer/Profiling/StartupTimer.hpp>
 #include <Rendering/Renderer/Programs/Programs.hpp>
 #include <Rendering/Renderer/Uniforms/Uniforms.hpp>
+#include <Rendering/State/StateCache.hpp>
 
 
 /// <summary>
@@ -58,18 +68,106 @@ class Renderer final
         /// <summary> Get the maximum amount of time taken to render a frame (ms). </summary>
         float getMaxFrameTime() const noexcept                      { return m_maxTime; }
 
+        /// <summary> 
+        /// Gets the most recently retrieved frame time (ms). Results are read without stalling the GPU so this belongs
+        /// to the frame rendered types::multiBuffering frames ago.
+        /// </summary>
+        float getLastFrameTime() const noexcept                     { return m_lastTime; }
+
+        /// <summary> Gets the render scale of the frame timed by getLastFrameTime(). </summary>
+        float getLastRenderScale() const noexcept                   { return m_lastRenderScale; }
+
+        /// <summary> 
+        /// Gets the minimum, mean, maximum and percentile GPU times of a rendering pass over recent frames (ms). 
+        /// </summary>
+        PassTimer::Statistics getPassStatistics (PassTimer::Pass pass) const noexcept   { return m_passTimer.getStatistics (pass); }
+
+        /// <summary> Gets the most recently retrieved GPU time of a rendering pass (ms). </summary>
+        float getLastPassTime (PassTimer::Pass pass) const noexcept                     { return m_passTimer.getLastTime (pass); }
+
+        /// <summary> 
+        /// Gets the vertex, primitive and fragment counts of a rendering pass in the most recently collected frame. 
+        /// These will be zero if the driver doesn't support GL_ARB_pipeline_statistics_query.
+        /// </summary>
+        const PipelineStatistics::Counts& getPipelineStatistics (PassTimer::Pass pass) const noexcept { return m_pipelineStatistics.getLastCounts (pass); }
+
+        /// <summary> Gets the histograms of CPU, GPU and sync times along with any detected stutters. </summary>
+        const FrameRecorder& getFrameRecorder() const noexcept      { return m_frameRecorder; }
+
+        /// <summary> Gets how many state changes the most recent frame sent to the driver and how many were redundant. </summary>
+        StateCache::Counters getStateCounters() const noexcept      { return m_stateCounters; }
+
+        /// <summary> Gets the draws, lights, streamed data and stalls of recent frames along with totals and peaks. </summary>
+        const RenderStatistics& getRenderStatistics() const noexcept { return m_renderStatistics; }
+
+        /// <summary> Gets when each phase of the most recent initialisation ran and how long it took. </summary>
+        const StartupTimer& getStartupTimer() const noexcept        { return m_startupTimer; }
+
+        /// <summary> Gets the overdraw and light complexity histograms, these are only gathered when measuring. </summary>
+        const ComplexityCounter& getComplexity() const noexcept     { return m_complexity; }
+
+        /// <summary> Checks whether overdraw and light complexity are being measured. </summary>
+        bool isMeasuringComplexity() const noexcept                 { return m_measureComplexity; }
+
+        /// <summary> Checks whether lighting uses the lighting permutations rather than subroutines. </summary>
+        bool isUsingSpecialisedLighting() const noexcept            { return m_specialisedLighting; }
+
+        /// <summary> Gets how the edges of spotlight shadows are softened by the lighting permutations. </summary>
+        ShadowMaps::Filter getShadowFilter() const noexcept         { return m_shadowFilter; }
+
+        /// <summary> Gets the memory and upload activity of streamed textures, this is empty unless streaming. </summary>
+        const TextureStreamer::Statistics& getTextureStreaming() const noexcept 
+        { 
+            return m_materials.getStreamer().getStatistics(); 
+        }
+
+        /// <summary> Gets the internal and display resolution currently being rendered at. </summary>
+        const Resolution& getResolution() const noexcept            { return m_resolution; }
+
+        /// <summary> Gets whether the render resolution adapts and the scale it has chosen. </summary>
+        const DynamicResolution& getDynamicResolution() const noexcept { return m_dynamicResolution; }
+
+        /// <summary> Sets the target frame time used to detect slow frames and stutters (ms). </summary>
+        void setFrameBudget (float budget) noexcept                 { m_frameRecorder.setBudget (budget); }
+
         /// <summary> Sets whether the rendering should use multiple threads or not. </summary>
         void setThreadingMode (bool useMultipleThreads) noexcept    { m_multiThreaded = useMultipleThreads; }
 
         /// <summary> Sets whether deferred or forward rendering should be performed.
         void setRenderingMode (bool useDeferredRendering) noexcept  { m_deferredRender = useDeferredRendering; }
 
-        /// <summary> Sets which reflection models should be used. This will cause a recompile of shaders. </summary>
+        /// <summary> Sets which reflection models should be used, the programs for both are always linked. </summary>
         void setShadingMode (bool usePhysicallyBasedShading) noexcept;
 
         /// <summary> Sets the quality setting of the antialiasing to be performed. </summary>
         void setAntiAliasingMode (SMAA::Quality quality) noexcept;
 
+        /// <summary>
+        /// Sets whether lighting uses programs specialised for each pass and the lights in the scene, or programs which
+        /// choose the pass with a subroutine and loop over the light counts stored in uniforms. Both are always linked.
+        /// Measuring complexity always uses subroutines.
+        /// </summary>
+        void setLightingMode (bool useSpecialisedPrograms) noexcept { m_specialisedLighting = useSpecialisedPrograms; }
+
+        /// <summary>
+        /// Sets how the edges of spotlight shadows are softened, every filter covers the same number of texels so they
+        /// give the same softness. Only the lighting permutations use the filter, subroutines always use PCF. The 
+        /// moments needed by EVSM are allocated the first time it's used.
+        /// </summary>
+        void setShadowFilter (ShadowMaps::Filter filter) noexcept   { m_shadowFilter = filter; }
+
+        /// <summary>
+        /// Sets whether the deferred geometry and light volume passes should count how many times each pixel is shaded.
+        /// The counters are reduced into histograms on the GPU. Forward rendering isn't measured.
+        /// </summary>
+        void setComplexityMode (bool measureComplexity) noexcept;
+
+        /// <summary>
+        /// Sets whether material textures should be streamed and how much memory they may use. This only takes effect
+        /// when the renderer is next initialised. Usage is only measured when deferred rendering.
+        /// </summary>
+        void setTextureStreaming (const TextureStreamer::Settings& settings) noexcept { m_textureStreaming = settings; }
+
         /// <summary> Resets calculated frame timings to zero. </summary>
         void resetFrameTimings() noexcept;
 
@@ -81,6 +179,12 @@ class Renderer final
         /// </summary>
         void setDisplayResolution (const glm::ivec2& resolution) noexcept;
 
+        /// <summary>
+        /// Sets whether only a region of the internal resolution is rendered, chosen each frame so the GPU frame time
+        /// meets a target. The region is upscaled to the display by the blit or SMAA so nothing is reallocated.
+        /// </summary>
+        void setDynamicResolution (const DynamicResolution::Settings& settings) noexcept;
+
 
         /// <summary> 
         /// Attempt to initialise the renderer, building all mesh and material data, preparing the renderer for 
@@ -106,8 +210,10 @@ class Renderer final
         constexpr static auto lbufferStartingTextureUnit    = GLuint { 4 };         //!< The starting texture unit for the lbuffer, the lbuffer occupies a single unit.
         constexpr static auto shadowMapStartingTextureUnit  = GLuint { 5 };         //!< The starting texture unit for the shadow map array.
         constexpr static auto smaaStartingTextureUnit       = GLuint { 6 };         //!< The starting texture unit for the antialiasing textures, occupies three units.
-        constexpr static auto materialsStartingTextureUnit  = GLuint { 9 };         //!< The starting texture unit for the material data.
+        constexpr static auto shadowMomentsTextureUnit      = GLuint { 9 };         //!< The texture unit for the filtered moments of the shadow maps.
+        constexpr static auto materialsStartingTextureUnit  = GLuint { 10 };        //!< The starting texture unit for the material data.
         constexpr static auto defaultAA                     = SMAA::Quality::Ultra; //!< The default value for antialiasing.
+        constexpr static auto shadowFilterSize              = GLuint { 5 };         //!< How many texels wide the filter of spotlight shadows is.
 
         struct MeshInstances final
         {
@@ -144,6 +250,7 @@ class Renderer final
         using DrawCommands      = MultiDrawCommands<types::PMB>;
         using SyncObjects       = std::array<Sync, types::multiBuffering>;
         using QueryObjects      = std::array<Query, types::multiBuffering>;
+        using RenderScales      = std::array<GLfloat, types::multiBuffering>;
                 
         scene::Context*     m_scene             { };            //!< Used to render the scene from the correct viewpoint.
         Uniforms            m_uniforms          { };            //!< Uniform data which is accessible to any program that requests it.
@@ -159,6 +266,8 @@ class Renderer final
 
         DrawCommands        m_lightDrawing      { };            //!< Draw commands for light volumes.
         types::PMB          m_lightTransforms   { };            //!< Model transforms for light volumes.
+        std::vector<size_t> m_spotlightOrder    { };            //!< The scene index of each spotlight in the order they're stored, shadow casters first.
+        GLuint              m_shadowedSpotlights { 0 };         //!< How many spotlights cast shadows.
 
         GeometryBuffer      m_gbuffer           { };            //!< The initial framebuffer where geometry is drawn to.
         LightBuffer         m_lbuffer           { };            //!< A colour buffer where lighting is applied using data stored in the gbuffer.
@@ -167,33 +276,63 @@ class Renderer final
         SMAA                m_smaa              { };            //!< Used to perform antialiasing.
 
         Resolution          m_resolution        { };            //!< The internal and display resolution of drawing operations.
+        DynamicResolution   m_dynamicResolution { };            //!< Chooses the render resolution from the GPU frame time.
+        RenderScales        m_renderScales      { };            //!< The scale each partition was last rendered at, read with its frame time.
         
         size_t              m_partition         { 0 };          //!< The buffer partition to use when rendering the current frame.
         SyncObjects         m_syncs             { };            //!< Contains sync objects for each level of buffering, allows us to manually synchronise with the GPU if needed.
         QueryObjects        m_queries           { };            //!< A collection of query objects used to check how long each frame took to complete.
+        PassTimer           m_passTimer         { };            //!< Records how long the GPU spends on each rendering pass.
+        PipelineStatistics  m_pipelineStatistics { };           //!< Counts the vertices, primitives and fragments processed by each pass.
+        FrameRecorder       m_frameRecorder     { };            //!< Tracks the distribution of frame times and detects stutters.
+        StateCache::Counters m_stateCounters    { };            //!< Issued and filtered state changes of the most recent frame.
+        RenderStatistics    m_renderStatistics  { };            //!< Counts the work submitted by the CPU each frame.
+        ComplexityCounter   m_complexity        { };            //!< Measures overdraw and light complexity when enabled.
+        StartupTimer        m_startupTimer      { };            //!< Times each phase of initialisation.
+        RenderStatistics::Draws m_staticDraws   { };            //!< What drawing every static object submits.
+        RenderStatistics::Draws m_dynamicDraws  { };            //!< What drawing every dynamic object submits.
        
         bool                m_deferredRender    { true };       //!< Whether a deferred or forward render should be performed.
         bool                m_multiThreaded     { true };       //!< Whether the renderer should be multi-threaded or not.
         bool                m_pbs               { true };       //!< Whether physically based shaders should be used.
+        bool                m_specialisedLighting { true };     //!< Whether lighting uses the lighting permutations rather than subroutines.
+        ShadowMaps::Filter  m_shadowFilter      { ShadowMaps::Filter::PCF };    //!< How the lighting permutations filter shadows.
         SMAA::Quality       m_smaaQuality       { defaultAA };  //!< The current quality setting for SMAA.
+        bool                m_measureComplexity { false };      //!< Whether overdraw and light complexity should be measured.
+        TextureStreamer::Settings m_textureStreaming { };       //!< Whether material textures are streamed and their budget.
+        bool                m_bindlessTextures  { false };      //!< Whether material textures are sampled through bindless handles.
 
         GLuint              m_syncCount         { 0 };          //!< How many times we've had to manually synchronise the GPU with the CPU.
         GLuint              m_frames            { 0 };          //!< How many frames have been renderered.
         GLfloat             m_totalTime         { 0 };          //!< The total time elapsed for all frames.
         GLfloat             m_minTime           { 0 };          //!< The minimum amount of time for a frame to render.
         GLfloat             m_maxTime           { 0 };          //!< The maximum amount of time for a frame to render.
+        GLfloat             m_lastTime          { 0 };          //!< The most recently retrieved frame time.
+        GLfloat             m_lastRenderScale   { 1 };          //!< The render scale of the most recently retrieved frame time.
 
     private:
 
+        /// <summary> Gets the shadow filter of the lighting programs which will be used this frame. </summary>
+        ShadowMaps::Filter activeShadowFilter() const noexcept;
+
+        /// <summary> Sizes the rendered region of the internal buffers using the dynamic resolution scale. </summary>
+        void updateRenderResolution() noexcept;
+
+        /// <summary>
+        /// Checks that a fragment shader can sample every texture the lighting pass needs. Without bindless handles
+        /// each material array needs a texture unit, which is more than the 16 OpenGL guarantees.
+        /// </summary>
+        bool hasEnoughTextureUnits() const noexcept;
+
         /// <summary>
-        /// Attempts to build the OpenGL programs. 
+        /// Attempts to build the OpenGL programs for both reflection models. 
         /// </summary>
         bool buildPrograms() noexcept;
 
         /// <summary>
         /// Attempts to load the texture and material data of every object in the scene.
         /// </summary>
-        bool buildMaterials() noexcept;
+        bool buildMaterials (UploadService& uploads, const Materials::Preparation& prepared) noexcept;
 
         /// <summary>
         /// Attempts to build the dynamic object command and instancing buffers. This parses the instances container
@@ -204,14 +343,15 @@ class Renderer final
 
         /// <summary>
         /// Attempts to build the light command and transform buffers. This counts the total number of rendering passes
-        /// that will occur and allocates enough memory to perform each pass.
+        /// that will occur and allocates enough memory to perform each pass. It also decides the order spotlights are
+        /// stored in, which the lighting permutations are specialised for.
         /// </summary> 
         bool buildLightBuffers() noexcept;
 
         /// <summary>
         /// Attempts to build the geometry data for every mesh in the scene.
         /// </summary> 
-        bool buildGeometry() noexcept;
+        bool buildGeometry (UploadService& uploads, const Geometry::Preparation& prepared) noexcept;
 
         /// <summary> 
         /// Attempt to build the geometry and light buffers according to the current internal resolution. 
@@ -226,7 +366,7 @@ class Renderer final
         bool buildUniforms() noexcept;
 
         /// <summary> 
-        /// Prepares the SMAA object for performing antialiasing.
+        /// Prepares the SMAA object for performing antialiasing at any quality.
         /// </summary>
         bool buildSMAA() noexcept;
 
@@ -236,7 +376,20 @@ class Renderer final
         void fillDynamicInstances() noexcept;
 
         /// <summary> Checks the sync object of the current partition and waits if it hasn't already fired. </summary>
-        void syncWithGPUIfNecessary() noexcept;
+        /// <returns> How long was spent waiting for the GPU (ms). </returns>
+        float syncWithGPUIfNecessary() noexcept;
+
+        /// <summary> Starts timing and counting the work of the given pass. </summary>
+        void beginPass (const PassTimer::Pass pass) noexcept;
+
+        /// <summary> Stops timing and counting the work of the given pass. </summary>
+        void endPass (const PassTimer::Pass pass) noexcept;
+
+        /// <summary> Records how much data was written to each persistently mapped buffer this frame. </summary>
+        void recordStreaming() noexcept;
+
+        /// <summary> Calculates what drawing the given light volume once per light submits. </summary>
+        static RenderStatistics::Draws lightVolumeDraws (const Mesh& volume, const size_t lights) noexcept;
 
         /// <summary> Performs a forward render of the entire scene. </summary>
         void forwardRender (const MultiDrawCommands<Buffer>& staticObjects, SceneVAO& sceneVAO, ASyncActions& actions) noexcept;
@@ -250,7 +403,10 @@ class Renderer final
         /// <summary> Updates the draw commands, transforms and materail IDs of dynamic objects. </summary>
         ModifiedDynamicObjectRanges updateDynamicObjects() noexcept;
 
-        /// <summary> Adds a draw command for a full-screen quad and every point and spotlight in the scene. </summary>
+        /// <summary> 
+        /// Adds a draw command for every point light, every spotlight, the shadow casting spotlights and the remaining
+        /// spotlights in the scene.
+        /// </summary>
         ModifiedRange updateLightDrawCommands (const GLuint pointLights, const GLuint spotlights) noexcept;
 
         /// <summary> Updates the directional light uniform data with the given light data. </summary>
@@ -259,7 +415,7 @@ class Renderer final
         /// <summary> Updates the transform and uniform data for every given point light. </summary>
         ModifiedLightVolumeRanges updatePointLights (const std::vector<scene::PointLight>& lights) noexcept;
 
-        /// <summary> Updates the transform and uniform data for every given spot light. </summary>
+        /// <summary> Updates the transform and uniform data for every given spot light, shadow casters first. </summary>
         ModifiedLightVolumeRanges updateSpotlights (const std::vector<scene::SpotLight>& lights, 
             const size_t transformOffset) noexcept;
 
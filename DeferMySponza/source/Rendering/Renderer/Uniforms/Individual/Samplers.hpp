@@ -30,9 +30,10 @@ struct Samplers final
     Sampler gbufferPositions    { 0, "gbufferPositions" };  //!< A texture rectangle containing positions of objects.
     Sampler gbufferNormals      { 0, "gbufferNormals" };    //!< A texture rectangle containing world normals of objects.
     Sampler gbufferMaterials    { 0, "gbufferMaterials" };  //!< A texture rectangle containing texture co-ordinates and material IDs of objects.
+    Sampler gbufferDepth        { 0, "gbufferDepth" };      //!< A 2D texture containing the depth of objects.
 
     Sampler shadowMaps          { 0, "shadowMaps" };        //!< A 2D texture array containing shadow maps.
-    Sampler materials           { 0, "materials" };         //!< A texture buffer containing every material in the scene.
+    Sampler shadowMoments       { 0, "shadowMoments" };     //!< A 2D texture array containing filtered shadow map moments.
     Sampler textures            { 0, "textures" };          //!< An array of textures containing texture maps.
     GLsizei textureSamplerCount { 0 };                      //!< The number of texture arrays in the "textures" sampler.
 
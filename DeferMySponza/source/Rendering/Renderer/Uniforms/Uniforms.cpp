@@ -11,6 +11,7 @@
 #include <Rendering/Renderer/Uniforms/Components/DirectionalLight.hpp>
 #include <Rendering/Renderer/Uniforms/Components/PointLight.hpp>
 #include <Rendering/Renderer/Uniforms/Components/Spotlight.hpp>
+#include <Rendering/State/StateCache.hpp>
 
 
 // Initialise the static int.
@@ -90,8 +91,9 @@ void Uniforms::bindUniformsToPrograms (const Programs& programs) const noexcept
         bindSampler (program, m_samplers.gbufferPositions);
         bindSampler (program, m_samplers.gbufferNormals);
         bindSampler (program, m_samplers.gbufferMaterials);
+        bindSampler (program, m_samplers.gbufferDepth);
         bindSampler (program, m_samplers.shadowMaps);
-        bindSampler (program, m_samplers.materials);
+        bindSampler (program, m_samplers.shadowMoments);
 
         // And finally the texture arrays.
         const auto location = glGetUniformLocation (program.getID(), m_samplers.textures.name);
@@ -135,12 +137,13 @@ void Uniforms::retrieveSamplerData (Samplers& samplers, const GeometryBuffer& gb
     samplers.gbufferPositions.unit  = gbuffer.getPositionTexture().getDesiredTextureUnit();
     samplers.gbufferNormals.unit    = gbuffer.getNormalTexture().getDesiredTextureUnit();
     samplers.gbufferMaterials.unit  = gbuffer.getMaterialTexture().getDesiredTextureUnit();
+    samplers.gbufferDepth.unit      = gbuffer.getDepthStencilTexture().getDesiredTextureUnit();
 
     // Retrieve the shadow map data.
     samplers.shadowMaps.unit        = maps.getShadowMapTextureUnit();
+    samplers.shadowMoments.unit     = maps.getMomentsTextureUnit();
 
     // Retrieve the material data.
-    samplers.materials.unit         = materials.getMaterialTextureUnit();
     samplers.textures.unit          = materials.getTextureArrayStartingUnit();
     samplers.textureSamplerCount    = materials.getTextureArrayCount();
 }
@@ -207,5 +210,5 @@ void Uniforms::rebindDynamicBlocks() const noexcept
             sizeof (sizes) / sizeof (GLintptr) == count);
 
     // Bind each block.
-    glBindBuffersRange (GL_UNIFORM_BUFFER, index, count, buffers, offsets, sizes);
+    StateCache::bindBuffersRange (GL_UNIFORM_BUFFER, index, count, buffers, offsets, sizes);
 }
\ No newline at end of file
@@ -79,6 +79,12 @@ class Uniforms final
         /// <summary> Gets a copy of the pointer and partition offset to modifiable spotlight data. </summary>
         LightViews getWritableLightViewData() const noexcept                { return m_lightViews; }
 
+        /// <summary> Gets the multi-buffered uniform buffer which contains every uniform block. </summary>
+        const types::PMB& getBlocks() const noexcept                        { return m_blocks; }
+
+        /// <summary> Resets the modification counters of the uniform buffer. </summary>
+        void resetModificationCounters() noexcept                           { m_blocks.resetModificationCounters(); }
+
 
         /// <summary>
         /// Attempts to initialise the uniform buffer by allocating enough memory for each uniform block. Also fills
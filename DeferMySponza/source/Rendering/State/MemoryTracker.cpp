@@ -0,0 +1,290 @@
+#include "MemoryTracker.hpp"
+
+
+// STL headers.
+#include <algorithm>
+
+
+MemoryTracker::Scope::Scope (const Subsystem subsystem) noexcept
+{
+    m_previous  = current();
+    current()   = subsystem;
+}
+
+
+MemoryTracker::Scope::~Scope()
+{
+    current() = m_previous;
+}
+
+
+MemoryTracker::Usage MemoryTracker::getTotal() noexcept
+{
+    return state().total;
+}
+
+
+MemoryTracker::Usage MemoryTracker::getUsage (const Subsystem subsystem) noexcept
+{
+    const auto index = static_cast<size_t> (subsystem);
+    return index < subsystemCount ? state().subsystems[index] : Usage { };
+}
+
+
+const MemoryTracker::Formats& MemoryTracker::getFormats() noexcept
+{
+    return state().formats;
+}
+
+
+MemoryTracker::Partitions MemoryTracker::getPartitions() noexcept
+{
+    auto partitions = Partitions { };
+
+    for (const auto& pair : state().allocations)
+    {
+        const auto& allocation = pair.second;
+
+        if (allocation.partitions > 1)
+        {
+            partitions.resize (std::max (partitions.size(), static_cast<size_t> (allocation.partitions)), 0);
+
+            for (size_t i { 0 }; i < allocation.partitions; ++i)
+            {
+                partitions[i] += allocation.bytes / allocation.partitions;
+            }
+        }
+    }
+
+    return partitions;
+}
+
+
+void MemoryTracker::resetPeaks() noexcept
+{
+    auto& tracked           = state();
+    tracked.total.peak      = tracked.total.bytes;
+
+    for (auto& usage : tracked.subsystems)
+    {
+        usage.peak = usage.bytes;
+    }
+
+    for (auto& pair : tracked.formats)
+    {
+        pair.second.peak = pair.second.bytes;
+    }
+}
+
+
+const char* MemoryTracker::getName (const Subsystem subsystem) noexcept
+{
+    switch (subsystem)
+    {
+        case Subsystem::Unassigned: return "Unassigned";
+        case Subsystem::Geometry:   return "Geometry";
+        case Subsystem::Materials:  return "Materials";
+        case Subsystem::Objects:    return "Objects";
+        case Subsystem::Lights:     return "Lights";
+        case Subsystem::Uniforms:   return "Uniforms";
+        case Subsystem::GBuffer:    return "GBuffer";
+        case Subsystem::LBuffer:    return "LBuffer";
+        case Subsystem::ShadowMaps: return "Shadow Maps";
+        case Subsystem::SMAA:       return "SMAA";
+        case Subsystem::Profiling:  return "Profiling";
+        default:                    return "Unknown";
+    }
+}
+
+
+const char* MemoryTracker::getFormatName (const GLenum internalFormat) noexcept
+{
+    switch (internalFormat)
+    {
+        case GL_NONE:                       return "Buffer";
+        case GL_R8:                         return "R8";
+        case GL_RG8:                        return "RG8";
+        case GL_RGB8:                       return "RGB8";
+        case GL_RGBA8:                      return "RGBA8";
+        case GL_SRGB8:                      return "SRGB8";
+        case GL_SRGB8_ALPHA8:               return "SRGB8_ALPHA8";
+        case GL_R16F:                       return "R16F";
+        case GL_RG16F:                      return "RG16F";
+        case GL_RGB16F:                     return "RGB16F";
+        case GL_RGBA16F:                    return "RGBA16F";
+        case GL_R32F:                       return "R32F";
+        case GL_RG32F:                      return "RG32F";
+        case GL_RGB32F:                     return "RGB32F";
+        case GL_RGBA32F:                    return "RGBA32F";
+        case GL_R32UI:                      return "R32UI";
+        case GL_R11F_G11F_B10F:             return "R11F_G11F_B10F";
+        case GL_RGB10_A2:                   return "RGB10_A2";
+        case GL_DEPTH_COMPONENT16:          return "DEPTH_COMPONENT16";
+        case GL_DEPTH_COMPONENT24:          return "DEPTH_COMPONENT24";
+        case GL_DEPTH_COMPONENT32:          return "DEPTH_COMPONENT32";
+        case GL_DEPTH_COMPONENT32F:         return "DEPTH_COMPONENT32F";
+        case GL_DEPTH24_STENCIL8:           return "DEPTH24_STENCIL8";
+        case GL_DEPTH32F_STENCIL8:          return "DEPTH32F_STENCIL8";
+        case GL_STENCIL_INDEX8:             return "STENCIL_INDEX8";
+        case GL_COMPRESSED_RGBA_BPTC_UNORM: return "BC7";
+        default:                            return "Unknown";
+    }
+}
+
+
+void MemoryTracker::allocateBuffer (const GLuint buffer, const GLsizeiptr size) noexcept
+{
+    record (Object::Buffer, buffer, GL_NONE, static_cast<GLuint64> (std::max (size, GLsizeiptr { 0 })));
+}
+
+
+void MemoryTracker::partitionBuffer (const GLuint buffer, const GLuint partitions) noexcept
+{
+    const auto allocation = state().allocations.find ({ Object::Buffer, buffer });
+
+    if (allocation != std::end (state().allocations))
+    {
+        allocation->second.partitions = std::max (partitions, 1U);
+    }
+}
+
+
+void MemoryTracker::allocateTexture (const GLuint texture, const GLenum target, const GLenum internalFormat,
+    const GLsizei width, const GLsizei height, const GLsizei depth, const GLsizei levels) noexcept
+{
+    // Only 3D textures shrink in depth with each level, array layers and cube map faces stay constant.
+    const auto faces    = target == GL_TEXTURE_CUBE_MAP ? GLuint64 { 6 } : GLuint64 { 1 };
+    const auto texel    = texelSize (internalFormat);
+    auto texels         = GLuint64 { 0 };
+
+    for (GLsizei level { 0 }; level < std::max (levels, 1); ++level)
+    {
+        const auto levelWidth   = std::max (width >> level, 1);
+        const auto levelHeight  = std::max (height >> level, 1);
+        const auto levelDepth   = target == GL_TEXTURE_3D ? std::max (depth >> level, 1) : std::max (depth, 1);
+
+        texels += static_cast<GLuint64> (levelWidth) * levelHeight * levelDepth;
+    }
+
+    record (Object::Texture, texture, internalFormat, texels * faces * texel);
+}
+
+
+void MemoryTracker::allocateRenderbuffer (const GLuint renderbuffer, const GLenum internalFormat,
+    const GLsizei width, const GLsizei height, const GLsizei samples) noexcept
+{
+    const auto pixels = static_cast<GLuint64> (std::max (width, 0)) * std::max (height, 0) * std::max (samples, 1);
+    record (Object::Renderbuffer, renderbuffer, internalFormat, pixels * texelSize (internalFormat));
+}
+
+
+void MemoryTracker::release (const Object object, const GLuint name) noexcept
+{
+    auto& tracked           = state();
+    const auto allocation   = tracked.allocations.find ({ object, name });
+
+    if (allocation != std::end (tracked.allocations))
+    {
+        const auto& removed = allocation->second;
+        subtract (tracked.total, removed.bytes);
+        subtract (tracked.subsystems[static_cast<size_t> (removed.subsystem)], removed.bytes);
+        subtract (tracked.formats[removed.format], removed.bytes);
+        tracked.allocations.erase (allocation);
+    }
+}
+
+
+MemoryTracker::State& MemoryTracker::state() noexcept
+{
+    static auto current = State { };
+    return current;
+}
+
+
+MemoryTracker::Subsystem& MemoryTracker::current() noexcept
+{
+    static auto subsystem = Subsystem::Unassigned;
+    return subsystem;
+}
+
+
+void MemoryTracker::record (const Object object, const GLuint name, const GLenum format, const GLuint64 bytes) noexcept
+{
+    // Mutable storage can be reallocated so any previous allocation must be removed first.
+    release (object, name);
+
+    auto& tracked       = state();
+    const auto tag      = current();
+    tracked.allocations[{ object, name }] = Allocation { tag, format, bytes, 1 };
+
+    add (tracked.total, bytes);
+    add (tracked.subsystems[static_cast<size_t> (tag)], bytes);
+    add (tracked.formats[format], bytes);
+}
+
+
+GLuint64 MemoryTracker::texelSize (const GLenum internalFormat) noexcept
+{
+    switch (internalFormat)
+    {
+        // BC7 stores 4x4 texels in 16 bytes, levels smaller than a block are slightly undercounted.
+        case GL_R8:
+        case GL_STENCIL_INDEX8:
+        case GL_COMPRESSED_RGBA_BPTC_UNORM:
+            return 1;
+
+        case GL_RG8:
+        case GL_R16F:
+        case GL_DEPTH_COMPONENT16:
+            return 2;
+
+        case GL_RGB8:
+        case GL_SRGB8:
+            return 3;
+
+        case GL_RGBA8:
+        case GL_SRGB8_ALPHA8:
+        case GL_RG16F:
+        case GL_R32F:
+        case GL_R32UI:
+        case GL_R11F_G11F_B10F:
+        case GL_RGB10_A2:
+        case GL_DEPTH_COMPONENT24:
+        case GL_DEPTH_COMPONENT32:
+        case GL_DEPTH_COMPONENT32F:
+        case GL_DEPTH24_STENCIL8:
+            return 4;
+
+        case GL_RGB16F:
+            return 6;
+
+        case GL_RGBA16F:
+        case GL_RG32F:
+        case GL_DEPTH32F_STENCIL8:
+            return 8;
+
+        case GL_RGB32F:
+            return 12;
+
+        case GL_RGBA32F:
+            return 16;
+
+        default:
+            return 0;
+    }
+}
+
+
+void MemoryTracker::add (Usage& usage, const GLuint64 bytes) noexcept
+{
+    usage.bytes += bytes;
+    usage.peak  = std::max (usage.peak, usage.bytes);
+    ++usage.allocations;
+}
+
+
+void MemoryTracker::subtract (Usage& usage, const GLuint64 bytes) noexcept
+{
+    usage.bytes -= std::min (usage.bytes, bytes);
+    usage.allocations -= std::min (usage.allocations, 1U);
+}
\ No newline at end of file
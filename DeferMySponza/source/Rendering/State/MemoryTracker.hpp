@@ -0,0 +1,188 @@
+#pragma once
+
+#if !defined    _RENDERING_STATE_MEMORY_TRACKER_
+#define         _RENDERING_STATE_MEMORY_TRACKER_
+
+// STL headers.
+#include <array>
+#include <map>
+#include <utility>
+#include <vector>
+
+
+// Engine headers.
+#include <tgl/tgl.h>
+
+
+/// <summary>
+/// Keeps a record of every buffer, texture and renderbuffer allocation so the memory used by the renderer can be
+/// queried whilst it runs. Each allocation is tagged with the subsystem of the innermost active Scope, totals are kept
+/// per subsystem and per internal format along with high-water marks. Sizes are calculated from the dimensions and
+/// format of each allocation so they don't include any padding or alignment added by the driver. Like the state
+/// cache, this must only be used from the rendering thread.
+/// </summary>
+class MemoryTracker final
+{
+    public:
+
+        /// <summary> The parts of the renderer which own GPU memory. </summary>
+        enum class Subsystem : size_t
+        {
+            Unassigned  = 0,
+            Geometry    = 1,
+            Materials   = 2,
+            Objects     = 3,
+            Lights      = 4,
+            Uniforms    = 5,
+            GBuffer     = 6,
+            LBuffer     = 7,
+            ShadowMaps  = 8,
+            SMAA        = 9,
+            Profiling   = 10,
+            Count       = 11
+        };
+
+        /// <summary> The kinds of object which can own memory. </summary>
+        enum class Object : size_t
+        {
+            Buffer          = 0,
+            Texture         = 1,
+            Renderbuffer    = 2
+        };
+
+        constexpr static auto subsystemCount = static_cast<size_t> (Subsystem::Count);
+
+        /// <summary> How much memory is currently allocated and the most that has been allocated at once. </summary>
+        struct Usage final
+        {
+            GLuint64    bytes       { 0 };  //!< How many bytes are currently allocated.
+            GLuint64    peak        { 0 };  //!< The high-water mark of bytes since peaks were last reset.
+            GLuint      allocations { 0 };  //!< How many objects currently own memory.
+        };
+
+        using Formats       = std::map<GLenum, Usage>;
+        using Partitions    = std::vector<GLuint64>;
+
+        /// <summary>
+        /// An RAII utility which tags every allocation made during its lifetime with the given subsystem. Scopes can be
+        /// nested, the previous subsystem is restored upon destruction.
+        /// </summary>
+        class Scope final
+        {
+            public:
+
+                Scope (const Subsystem subsystem) noexcept;
+                ~Scope();
+
+                Scope (Scope&&)                 = delete;
+                Scope (const Scope&)            = delete;
+                Scope& operator= (Scope&&)      = delete;
+                Scope& operator= (const Scope&) = delete;
+
+            private:
+
+                Subsystem m_previous { Subsystem::Unassigned }; //!< The subsystem to restore.
+        };
+
+
+        /// <summary> Gets the memory used by every subsystem combined. </summary>
+        static Usage getTotal() noexcept;
+
+        /// <summary> Gets the memory owned by the given subsystem. </summary>
+        static Usage getUsage (const Subsystem subsystem) noexcept;
+
+        /// <summary> Gets the memory used by each internal format, buffers are stored under GL_NONE. </summary>
+        static const Formats& getFormats() noexcept;
+
+        /// <summary>
+        /// Gets how many bytes each partition of the multi-buffered allocations occupies, indexed by partition. These
+        /// are included in the subsystem and format totals.
+        /// </summary>
+        static Partitions getPartitions() noexcept;
+
+        /// <summary> Sets every high-water mark to the amount of memory currently allocated. </summary>
+        static void resetPeaks() noexcept;
+
+        /// <summary> Gets the name of a subsystem as shown in reports. </summary>
+        static const char* getName (const Subsystem subsystem) noexcept;
+
+        /// <summary> Gets the name of an internal format as shown in reports. </summary>
+        static const char* getFormatName (const GLenum internalFormat) noexcept;
+
+
+        /// <summary> Records the storage of a buffer, replacing any previous storage it had. </summary>
+        /// <param name="buffer"> The name of the buffer object. </param>
+        /// <param name="size"> How many bytes were allocated. </param>
+        static void allocateBuffer (const GLuint buffer, const GLsizeiptr size) noexcept;
+
+        /// <summary> Marks the storage of a buffer as being evenly split into multi-buffered partitions. </summary>
+        /// <param name="buffer"> The name of a buffer which has already been allocated. </param>
+        /// <param name="partitions"> How many partitions the buffer is split into. </param>
+        static void partitionBuffer (const GLuint buffer, const GLuint partitions) noexcept;
+
+        /// <summary> Records the storage of a texture, including every mipmap level. </summary>
+        /// <param name="texture"> The name of the texture object. </param>
+        /// <param name="target"> The target of the texture, e.g. GL_TEXTURE_2D_ARRAY. </param>
+        /// <param name="internalFormat"> The format of each texel, e.g. GL_RGB8. </param>
+        /// <param name="width"> How many texels wide the base level is. </param>
+        /// <param name="height"> How many texels tall the base level is. </param>
+        /// <param name="depth"> How many texels deep or how many layers the texture has. </param>
+        /// <param name="levels"> How many mipmap levels were allocated. </param>
+        static void allocateTexture (const GLuint texture, const GLenum target, const GLenum internalFormat,
+            const GLsizei width, const GLsizei height, const GLsizei depth, const GLsizei levels) noexcept;
+
+        /// <summary> Records the storage of a renderbuffer, replacing any previous storage it had. </summary>
+        /// <param name="renderbuffer"> The name of the renderbuffer object. </param>
+        /// <param name="internalFormat"> The format of each pixel. </param>
+        /// <param name="width"> How many pixels wide the renderbuffer is. </param>
+        /// <param name="height"> How many pixels tall the renderbuffer is. </param>
+        /// <param name="samples"> How many samples each pixel has, zero if it isn't multisampled. </param>
+        static void allocateRenderbuffer (const GLuint renderbuffer, const GLenum internalFormat,
+            const GLsizei width, const GLsizei height, const GLsizei samples) noexcept;
+
+        /// <summary> Forgets the storage of an object, this must be called when the object is deleted. </summary>
+        static void release (const Object object, const GLuint name) noexcept;
+
+    private:
+
+        /// <summary> The storage owned by a single object. </summary>
+        struct Allocation final
+        {
+            Subsystem   subsystem   { Subsystem::Unassigned };  //!< The subsystem which was active when allocating.
+            GLenum      format      { GL_NONE };                //!< The internal format, GL_NONE for buffers.
+            GLuint64    bytes       { 0 };                      //!< How many bytes the object owns.
+            GLuint      partitions  { 1 };                      //!< How many partitions the storage is split into.
+        };
+
+        using Key           = std::pair<Object, GLuint>;
+        using Allocations   = std::map<Key, Allocation>;
+        using Subsystems    = std::array<Usage, subsystemCount>;
+
+        /// <summary> Every allocation along with the running totals. </summary>
+        struct State final
+        {
+            Allocations allocations { };    //!< The storage of each live object.
+            Subsystems  subsystems  { };    //!< The usage of each subsystem.
+            Formats     formats     { };    //!< The usage of each internal format.
+            Usage       total       { };    //!< The usage of every allocation.
+        };
+
+    private:
+
+        /// <summary> Gets the recorded allocations. OpenGL is only used from the rendering thread. </summary>
+        static State& state() noexcept;
+
+        /// <summary> Gets the subsystem which new allocations are tagged with. </summary>
+        static Subsystem& current() noexcept;
+
+        /// <summary> Replaces any existing allocation of the given object and updates the totals. </summary>
+        static void record (const Object object, const GLuint name, const GLenum format, const GLuint64 bytes) noexcept;
+
+        /// <summary> Gets how many bytes a single texel of the given format occupies, zero if unknown. </summary>
+        static GLuint64 texelSize (const GLenum internalFormat) noexcept;
+
+        static void add (Usage& usage, const GLuint64 bytes) noexcept;
+        static void subtract (Usage& usage, const GLuint64 bytes) noexcept;
+};
+
+#endif // _RENDERING_STATE_MEMORY_TRACKER_
\ No newline at end of file
@@ -0,0 +1,243 @@
+#include "ProgramCache.hpp"
+
+
+// STL headers.
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+
+// Personal headers.
+#include <Rendering/Objects/Program.hpp>
+#include <Rendering/Objects/Shader.hpp>
+
+
+// Platform headers.
+#if defined _WIN32
+    #if !defined NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <Windows.h>
+#else
+    #include <sys/stat.h>
+#endif
+
+
+/// <summary> The configuration and counters shared by every program. </summary>
+struct CacheState final
+{
+    std::string             directory   { ProgramCache::defaultDirectory }; //!< Where binaries are stored.
+    ProgramCache::Counters  counters    { };                                //!< How programs have been linked.
+};
+
+
+/// <summary> Gets the state shared by every program. </summary>
+static CacheState& cacheState() noexcept
+{
+    static auto state = CacheState { };
+    return state;
+}
+
+
+ProgramCache::Counters ProgramCache::getCounters() noexcept
+{
+    return cacheState().counters;
+}
+
+
+void ProgramCache::resetCounters() noexcept
+{
+    cacheState().counters = Counters { };
+}
+
+
+const std::string& ProgramCache::getDirectory() noexcept
+{
+    return cacheState().directory;
+}
+
+
+void ProgramCache::setDirectory (std::string directory) noexcept
+{
+    cacheState().directory = std::move (directory);
+}
+
+
+ProgramCache::Key ProgramCache::key (const std::vector<const Shader*>& shaders) noexcept
+{
+    // Binaries are only valid for the driver which created them.
+    constexpr GLenum identity[] = { GL_VENDOR, GL_RENDERER, GL_VERSION, GL_SHADING_LANGUAGE_VERSION };
+    auto result                 = offsetBasis;
+
+    for (const auto name : identity)
+    {
+        const auto string = reinterpret_cast<const char*> (glGetString (name));
+
+        if (string != nullptr)
+        {
+            result = hash (string, std::strlen (string) + 1, result);
+        }
+    }
+
+    // The terminating character of each source separates it from the next so moving text between them changes the key.
+    for (const auto shader : shaders)
+    {
+        const auto type = shader->getType();
+        result          = hash (&type, sizeof (type), result);
+
+        for (const auto& source : shader->getSource())
+        {
+            result = hash (source.c_str(), source.size() + 1, result);
+        }
+    }
+
+    return result;
+}
+
+
+bool ProgramCache::load (const Program& program, const Key key) noexcept
+{
+    if (getDirectory().empty())
+    {
+        return false;
+    }
+
+    auto& counters  = cacheState().counters;
+    auto input      = std::ifstream { locationOf (key), std::ios::binary };
+
+    if (!input)
+    {
+        ++counters.misses;
+        return false;
+    }
+
+    // The file must belong to this key and the binary must be intact before the driver sees it.
+    auto header = Header { };
+    input.read (reinterpret_cast<char*> (&header), sizeof (Header));
+
+    if (!input || header.magic != magic || header.version != version || header.key != key || header.size == 0)
+    {
+        ++counters.rejected;
+        return false;
+    }
+
+    auto binary = std::vector<char> (header.size);
+    input.read (binary.data(), static_cast<std::streamsize> (binary.size()));
+
+    if (!input || input.peek() != std::ifstream::traits_type::eof() ||
+        hash (binary.data(), binary.size(), offsetBasis) != header.checksum)
+    {
+        ++counters.rejected;
+        return false;
+    }
+
+    // Drivers refuse binaries from other versions of themselves by failing to link.
+    glProgramBinary (program.getID(), static_cast<GLenum> (header.format), binary.data(),
+        static_cast<GLsizei> (binary.size()));
+
+    auto linkStatus = GLint { 0 };
+    glGetProgramiv (program.getID(), GL_LINK_STATUS, &linkStatus);
+
+    if (linkStatus != GL_TRUE)
+    {
+        ++counters.rejected;
+        return false;
+    }
+
+    ++counters.hits;
+    return true;
+}
+
+
+bool ProgramCache::store (const Program& program, const Key key) noexcept
+{
+    if (getDirectory().empty())
+    {
+        return false;
+    }
+
+    auto length = GLint { 0 };
+    glGetProgramiv (program.getID(), GL_PROGRAM_BINARY_LENGTH, &length);
+
+    if (length <= 0)
+    {
+        return false;
+    }
+
+    auto binary = std::vector<char> (static_cast<size_t> (length));
+    auto format = GLenum { 0 };
+    auto size   = GLsizei { 0 };
+    glGetProgramBinary (program.getID(), length, &size, &format, binary.data());
+
+    if (size <= 0 || !createDirectory())
+    {
+        return false;
+    }
+
+    binary.resize (static_cast<size_t> (size));
+
+    auto header     = Header { };
+    header.format   = static_cast<std::uint32_t> (format);
+    header.size     = static_cast<std::uint32_t> (binary.size());
+    header.key      = key;
+    header.checksum = hash (binary.data(), binary.size(), offsetBasis);
+
+    // A partially written file would fail validation but it's removed anyway to avoid reading it every run.
+    const auto location = locationOf (key);
+    {
+        auto output = std::ofstream { location, std::ios::binary | std::ios::trunc };
+        output.write (reinterpret_cast<const char*> (&header), sizeof (Header));
+        output.write (binary.data(), static_cast<std::streamsize> (binary.size()));
+
+        if (output.good())
+        {
+            ++cacheState().counters.stored;
+            return true;
+        }
+    }
+
+    std::remove (location.c_str());
+    return false;
+}
+
+
+std::string ProgramCache::locationOf (const Key key) noexcept
+{
+    char name[17];
+    std::snprintf (name, sizeof (name), "%016llx", static_cast<unsigned long long> (key));
+    return getDirectory() + "/" + name + extension;
+}
+
+
+std::uint64_t ProgramCache::hash (const void* data, const size_t size, const std::uint64_t seed) noexcept
+{
+    // FNV-1a is plenty to tell sources apart and cheap next to reading the files.
+    constexpr auto prime    = std::uint64_t { 1099511628211ULL };
+    const auto bytes        = static_cast<const unsigned char*> (data);
+    auto result             = seed;
+
+    for (size_t i { 0 }; i < size; ++i)
+    {
+        result = (result ^ bytes[i]) * prime;
+    }
+
+    return result;
+}
+
+
+bool ProgramCache::createDirectory() noexcept
+{
+    const auto& directory = getDirectory();
+
+    #if defined _WIN32
+
+        return CreateDirectoryA (directory.c_str(), nullptr) != 0 || GetLastError() == ERROR_ALREADY_EXISTS;
+
+    #else
+
+        return mkdir (directory.c_str(), 0755) == 0 || errno == EEXIST;
+
+    #endif
+}
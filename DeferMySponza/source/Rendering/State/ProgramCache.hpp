@@ -0,0 +1,98 @@
+#pragma once
+
+#if !defined    _RENDERING_STATE_PROGRAM_CACHE_
+#define         _RENDERING_STATE_PROGRAM_CACHE_
+
+// STL headers.
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+// Engine headers.
+#include <tgl/tgl.h>
+
+
+// Forward declarations.
+class Program;
+class Shader;
+
+
+/// <summary>
+/// Stores linked programs on disk so later runs can skip compiling and linking entirely. Each binary is keyed by a
+/// hash of the driver identity and the source of every attached shader, including any defines, so a change to either
+/// leads to a different file. Files are validated when loaded and the driver may still reject a binary, in which case
+/// the program is compiled and linked as normal and the binary is replaced. The cache is shared by every program and
+/// must only be used on the thread which owns the context.
+/// </summary>
+class ProgramCache final
+{
+    public:
+
+        /// <summary> How programs have been linked since the counters were last reset. </summary>
+        struct Counters final
+        {
+            GLuint  hits        { 0 };  //!< Programs created from a cached binary.
+            GLuint  misses      { 0 };  //!< Programs which had no binary to load.
+            GLuint  rejected    { 0 };  //!< Binaries which were invalid or refused by the driver.
+            GLuint  stored      { 0 };  //!< Binaries written after linking.
+        };
+
+        using Key = std::uint64_t;
+
+        constexpr static auto defaultDirectory  = "ProgramCache";   //!< Where binaries are stored unless told otherwise.
+        constexpr static auto extension         = ".glbin";         //!< Follows the hexadecimal key of each file.
+
+        /// <summary> Gets the counts accumulated since the counters were last reset. </summary>
+        static Counters getCounters() noexcept;
+
+        /// <summary> Zeroes the counters. </summary>
+        static void resetCounters() noexcept;
+
+        /// <summary> Gets the directory binaries are stored in, empty when the cache is disabled. </summary>
+        static const std::string& getDirectory() noexcept;
+
+        /// <summary> Sets the directory binaries are stored in, it's created when the first binary is stored. </summary>
+        /// <param name="directory"> A file system location, empty disables the cache. </param>
+        static void setDirectory (std::string directory) noexcept;
+
+
+        /// <summary> Hashes the driver identity with the type and source of each shader in the order given. </summary>
+        static Key key (const std::vector<const Shader*>& shaders) noexcept;
+
+        /// <summary> Attempts to create the given program from the binary stored with the given key. </summary>
+        /// <returns> Whether the program was loaded and successfully linked. </returns>
+        static bool load (const Program& program, const Key key) noexcept;
+
+        /// <summary> Retrieves the binary of a successfully linked program and writes it with the given key. </summary>
+        /// <returns> Whether the binary was written. </returns>
+        static bool store (const Program& program, const Key key) noexcept;
+
+    private:
+
+        constexpr static auto magic         = std::uint32_t { 0x42504D44 };     //!< "DMPB" when read as bytes.
+        constexpr static auto version       = std::uint32_t { 1 };              //!< Incremented whenever the layout changes.
+        constexpr static auto offsetBasis   = Key { 14695981039346656037ULL };  //!< The initial value of every hash.
+
+        /// <summary> The fixed-size start of every file, the binary follows immediately after. </summary>
+        struct Header final
+        {
+            std::uint32_t   magic       { ProgramCache::magic };    //!< Identifies the file as a program binary.
+            std::uint32_t   version     { ProgramCache::version };  //!< The layout version of the file.
+            std::uint32_t   format      { 0 };                      //!< The driver-specific binary format.
+            std::uint32_t   size        { 0 };                      //!< How many bytes the binary occupies.
+            std::uint64_t   key         { 0 };                      //!< The key the binary was stored with.
+            std::uint64_t   checksum    { 0 };                      //!< A hash of the binary to detect corruption.
+        };
+
+        /// <summary> Gets the location of the file stored with the given key. </summary>
+        static std::string locationOf (const Key key) noexcept;
+
+        /// <summary> Hashes the given bytes, continuing from the given seed. </summary>
+        static std::uint64_t hash (const void* data, const size_t size, const std::uint64_t seed) noexcept;
+
+        /// <summary> Creates the cache directory if it doesn't already exist. </summary>
+        static bool createDirectory() noexcept;
+};
+
+#endif // _RENDERING_STATE_PROGRAM_CACHE_
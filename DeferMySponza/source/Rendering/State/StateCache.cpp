@@ -0,0 +1,391 @@
+#include "StateCache.hpp"
+
+
+StateCache::Counters StateCache::getCounters() noexcept
+{
+    return state().counters;
+}
+
+
+void StateCache::resetCounters() noexcept
+{
+    state().counters = Counters { };
+}
+
+
+void StateCache::invalidate() noexcept
+{
+    // Keep the counters so that a mid-frame invalidation doesn't lose them.
+    auto& current       = state();
+    const auto counters = current.counters;
+
+    current             = State { };
+    current.counters    = counters;
+}
+
+
+void StateCache::setEnabled (const GLenum capability, const bool enabled) noexcept
+{
+    const auto index = toCapability (capability);
+
+    if (index == Capability::Unknown || count (state().enables[static_cast<size_t> (index)].update (enabled)))
+    {
+        if (enabled)
+        {
+            glEnable (capability);
+        }
+
+        else
+        {
+            glDisable (capability);
+        }
+    }
+}
+
+
+void StateCache::depthMask (const GLboolean flag) noexcept
+{
+    if (count (state().depthMask.update (flag)))
+    {
+        glDepthMask (flag);
+    }
+}
+
+
+void StateCache::depthFunc (const GLenum func) noexcept
+{
+    if (count (state().depthFunc.update (func)))
+    {
+        glDepthFunc (func);
+    }
+}
+
+
+void StateCache::stencilFunc (const GLenum func, const GLint ref, const GLuint mask) noexcept
+{
+    if (count (state().stencilFunc.update ({ func, static_cast<GLuint> (ref), mask })))
+    {
+        glStencilFunc (func, ref, mask);
+    }
+}
+
+
+void StateCache::stencilOp (const GLenum sfail, const GLenum dpfail, const GLenum dppass) noexcept
+{
+    if (count (state().stencilOp.update ({ sfail, dpfail, dppass })))
+    {
+        glStencilOp (sfail, dpfail, dppass);
+    }
+}
+
+
+void StateCache::colorMask (const GLboolean red, const GLboolean green, const GLboolean blue, const GLboolean alpha) noexcept
+{
+    if (count (state().colorMask.update ({ red, green, blue, alpha })))
+    {
+        glColorMask (red, green, blue, alpha);
+    }
+}
+
+
+void StateCache::cullFace (const GLenum mode) noexcept
+{
+    if (count (state().cullFace.update (mode)))
+    {
+        glCullFace (mode);
+    }
+}
+
+
+void StateCache::blendFunc (const GLenum sfactor, const GLenum dfactor) noexcept
+{
+    if (count (state().blendFunc.update ({ sfactor, dfactor })))
+    {
+        glBlendFunc (sfactor, dfactor);
+    }
+}
+
+
+void StateCache::blendEquation (const GLenum mode) noexcept
+{
+    if (count (state().blendEquation.update (mode)))
+    {
+        glBlendEquation (mode);
+    }
+}
+
+
+void StateCache::clearColor (const GLfloat red, const GLfloat green, const GLfloat blue, const GLfloat alpha) noexcept
+{
+    if (count (state().clearColor.update ({ red, green, blue, alpha })))
+    {
+        glClearColor (red, green, blue, alpha);
+    }
+}
+
+
+void StateCache::clearDepth (const GLdouble depth) noexcept
+{
+    if (count (state().clearDepth.update (depth)))
+    {
+        glClearDepth (depth);
+    }
+}
+
+
+void StateCache::clearStencil (const GLint stencil) noexcept
+{
+    if (count (state().clearStencil.update (stencil)))
+    {
+        glClearStencil (stencil);
+    }
+}
+
+
+void StateCache::viewport (const GLint x, const GLint y, const GLsizei width, const GLsizei height) noexcept
+{
+    if (count (state().viewport.update ({ x, y, width, height })))
+    {
+        glViewport (x, y, width, height);
+    }
+}
+
+
+void StateCache::useProgram (const GLuint program) noexcept
+{
+    if (count (state().program.update (program)))
+    {
+        glUseProgram (program);
+    }
+}
+
+
+void StateCache::bindVertexArray (const GLuint array) noexcept
+{
+    if (count (state().vertexArray.update (array)))
+    {
+        glBindVertexArray (array);
+    }
+}
+
+
+void StateCache::bindFramebuffer (const GLenum target, const GLuint framebuffer) noexcept
+{
+    auto& current = state();
+
+    // GL_FRAMEBUFFER sets both the draw and read bindings so both must be updated.
+    auto changed = false;
+
+    if (target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER)
+    {
+        changed |= current.drawFramebuffer.update (framebuffer);
+    }
+
+    if (target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER)
+    {
+        changed |= current.readFramebuffer.update (framebuffer);
+    }
+
+    if (count (changed))
+    {
+        glBindFramebuffer (target, framebuffer);
+    }
+}
+
+
+void StateCache::bindRenderbuffer (const GLuint renderbuffer) noexcept
+{
+    if (count (state().renderbuffer.update (renderbuffer)))
+    {
+        glBindRenderbuffer (GL_RENDERBUFFER, renderbuffer);
+    }
+}
+
+
+void StateCache::bindBuffer (const GLenum target, const GLuint buffer) noexcept
+{
+    const auto index = toBufferTarget (target);
+
+    if (index == BufferTarget::Unknown || count (state().buffers[static_cast<size_t> (index)].update (buffer)))
+    {
+        glBindBuffer (target, buffer);
+    }
+}
+
+
+void StateCache::bindBuffersBase (const GLenum target, const GLuint first, const GLsizei bindingCount, 
+    const GLuint* const buffers) noexcept
+{
+    count (true);
+    glBindBuffersBase (target, first, bindingCount, buffers);
+}
+
+
+void StateCache::bindBuffersRange (const GLenum target, const GLuint first, const GLsizei bindingCount, 
+    const GLuint* const buffers, const GLintptr* const offsets, const GLsizeiptr* const sizes) noexcept
+{
+    count (true);
+    glBindBuffersRange (target, first, bindingCount, buffers, offsets, sizes);
+}
+
+
+void StateCache::bindTextureUnit (const GLuint unit, const GLuint texture) noexcept
+{
+    if (unit >= textureUnitCount || count (state().textures[unit].update (texture)))
+    {
+        if (texture != 0)
+        {
+            glBindTextureUnit (unit, texture);
+        }
+
+        else
+        {
+            // Nvidia drivers claim giving the value 0 to glBindTextureUnit is invalid. The OpenGL spec disagrees,
+            // still we must use the old method because the target hardware is an Nvidia card.
+            glBindTextures (unit, 1, nullptr);
+        }
+    }
+}
+
+
+void StateCache::bindTextures (const GLuint first, const GLsizei unitCount, const GLuint* const textures) noexcept
+{
+    // The whole range is issued in a single call if any unit within it changes.
+    auto& current   = state();
+    auto changed    = false;
+
+    for (GLsizei i { 0 }; i < unitCount; ++i)
+    {
+        const auto unit     = first + static_cast<GLuint> (i);
+        const auto texture  = textures ? textures[i] : 0U;
+
+        changed |= unit >= textureUnitCount || current.textures[unit].update (texture);
+    }
+
+    if (count (changed))
+    {
+        glBindTextures (first, unitCount, textures);
+    }
+}
+
+
+void StateCache::forgetProgram (const GLuint program) noexcept
+{
+    forget (state().program, program);
+}
+
+
+void StateCache::forgetVertexArray (const GLuint array) noexcept
+{
+    forget (state().vertexArray, array);
+}
+
+
+void StateCache::forgetFramebuffer (const GLuint framebuffer) noexcept
+{
+    auto& current = state();
+    forget (current.drawFramebuffer, framebuffer);
+    forget (current.readFramebuffer, framebuffer);
+}
+
+
+void StateCache::forgetRenderbuffer (const GLuint renderbuffer) noexcept
+{
+    forget (state().renderbuffer, renderbuffer);
+}
+
+
+void StateCache::forgetBuffer (const GLuint buffer) noexcept
+{
+    for (auto& binding : state().buffers)
+    {
+        forget (binding, buffer);
+    }
+}
+
+
+void StateCache::forgetTexture (const GLuint texture) noexcept
+{
+    for (auto& binding : state().textures)
+    {
+        forget (binding, texture);
+    }
+}
+
+
+StateCache::State& StateCache::state() noexcept
+{
+    static State current;
+    return current;
+}
+
+
+bool StateCache::count (const bool changed) noexcept
+{
+    auto& counters = state().counters;
+
+    if (changed)
+    {
+        ++counters.issued;
+    }
+
+    else
+    {
+        ++counters.filtered;
+    }
+
+    return changed;
+}
+
+
+void StateCache::forget (Cached<GLuint>& cached, const GLuint name) noexcept
+{
+    if (cached.value == name)
+    {
+        cached.known = false;
+    }
+}
+
+
+StateCache::Capability StateCache::toCapability (const GLenum capability) noexcept
+{
+    switch (capability)
+    {
+        case GL_DEPTH_TEST:
+            return Capability::DepthTest;
+        case GL_STENCIL_TEST:
+            return Capability::StencilTest;
+        case GL_BLEND:
+            return Capability::Blend;
+        case GL_CULL_FACE:
+            return Capability::CullFace;
+        default:
+            return Capability::Unknown;
+    }
+}
+
+
+StateCache::BufferTarget StateCache::toBufferTarget (const GLenum target) noexcept
+{
+    switch (target)
+    {
+        case GL_ARRAY_BUFFER:
+            return BufferTarget::Array;
+        case GL_DRAW_INDIRECT_BUFFER:
+            return BufferTarget::DrawIndirect;
+        case GL_UNIFORM_BUFFER:
+            return BufferTarget::Uniform;
+        case GL_SHADER_STORAGE_BUFFER:
+            return BufferTarget::ShaderStorage;
+        case GL_COPY_READ_BUFFER:
+            return BufferTarget::CopyRead;
+        case GL_COPY_WRITE_BUFFER:
+            return BufferTarget::CopyWrite;
+        case GL_PIXEL_PACK_BUFFER:
+            return BufferTarget::PixelPack;
+        case GL_PIXEL_UNPACK_BUFFER:
+            return BufferTarget::PixelUnpack;
+        default:
+            return BufferTarget::Unknown;
+    }
+}
@@ -0,0 +1,207 @@
+#pragma once
+
+#if !defined    _RENDERING_STATE_STATE_CACHE_
+#define         _RENDERING_STATE_STATE_CACHE_
+
+// STL headers.
+#include <array>
+
+
+// Engine headers.
+#include <tgl/tgl.h>
+
+
+/// <summary>
+/// A shadow copy of the OpenGL state which the renderer modifies. Every binder and pass configuration goes through the
+/// cache so that calls which wouldn't change the state of the context are filtered out before reaching the driver.
+/// The cache assumes it is the only thing modifying the context, anything which bypasses it must call invalidate().
+/// Counts of issued and filtered calls are kept so the effectiveness of the cache can be reported each frame.
+/// </summary>
+class StateCache final
+{
+    public:
+
+        /// <summary> How many state changes were sent to the driver and how many were filtered out. </summary>
+        struct Counters final
+        {
+            GLuint  issued      { 0 };  //!< Calls which changed the state of the context.
+            GLuint  filtered    { 0 };  //!< Calls which were dropped because they were redundant.
+        };
+
+        constexpr static auto textureUnitCount = size_t { 96 }; //!< How many texture units are tracked, others are always issued.
+
+        /// <summary> Gets the counts accumulated since the counters were last reset. </summary>
+        static Counters getCounters() noexcept;
+
+        /// <summary> Zeroes the counters, this should be called once per frame. </summary>
+        static void resetCounters() noexcept;
+
+        /// <summary>
+        /// Forgets every cached value so that the next call of each function is always issued. This must be called
+        /// whenever a new context is made current or the state is modified without going through the cache.
+        /// </summary>
+        static void invalidate() noexcept;
+
+
+        /// <summary> Enables or disables the given capability, e.g. GL_DEPTH_TEST. </summary>
+        static void setEnabled (const GLenum capability, const bool enabled) noexcept;
+        static void enable (const GLenum capability) noexcept   { setEnabled (capability, true); }
+        static void disable (const GLenum capability) noexcept  { setEnabled (capability, false); }
+
+        static void depthMask (const GLboolean flag) noexcept;
+        static void depthFunc (const GLenum func) noexcept;
+        static void stencilFunc (const GLenum func, const GLint ref, const GLuint mask) noexcept;
+        static void stencilOp (const GLenum sfail, const GLenum dpfail, const GLenum dppass) noexcept;
+        static void colorMask (const GLboolean red, const GLboolean green, const GLboolean blue, const GLboolean alpha) noexcept;
+        static void cullFace (const GLenum mode) noexcept;
+        static void blendFunc (const GLenum sfactor, const GLenum dfactor) noexcept;
+        static void blendEquation (const GLenum mode) noexcept;
+        static void clearColor (const GLfloat red, const GLfloat green, const GLfloat blue, const GLfloat alpha) noexcept;
+        static void clearDepth (const GLdouble depth) noexcept;
+        static void clearStencil (const GLint stencil) noexcept;
+        static void viewport (const GLint x, const GLint y, const GLsizei width, const GLsizei height) noexcept;
+
+
+        static void useProgram (const GLuint program) noexcept;
+        static void bindVertexArray (const GLuint array) noexcept;
+        static void bindFramebuffer (const GLenum target, const GLuint framebuffer) noexcept;
+        static void bindRenderbuffer (const GLuint renderbuffer) noexcept;
+
+        /// <summary>
+        /// Binds a buffer to the given target. GL_ELEMENT_ARRAY_BUFFER is part of the vertex array state so it is
+        /// always issued.
+        /// </summary>
+        static void bindBuffer (const GLenum target, const GLuint buffer) noexcept;
+
+        /// <summary>
+        /// Binds consecutive indexed binding points of the given target, starting at first. Indexed bindings aren't
+        /// tracked so the call is always issued. Unlike glBindBufferBase() and glBindBufferRange(), the multi-bind
+        /// functions leave the generic binding of the target untouched, so the cached bindBuffer() state stays valid.
+        /// </summary>
+        static void bindBuffersBase (const GLenum target, const GLuint first, const GLsizei bindingCount, 
+            const GLuint* const buffers) noexcept;
+        static void bindBuffersRange (const GLenum target, const GLuint first, const GLsizei bindingCount, 
+            const GLuint* const buffers, const GLintptr* const offsets, const GLsizeiptr* const sizes) noexcept;
+
+        /// <summary> Binds a texture to the given unit, zero will unbind the unit. </summary>
+        static void bindTextureUnit (const GLuint unit, const GLuint texture) noexcept;
+
+        /// <summary> Binds consecutive texture units starting at first, a null array will unbind every unit. </summary>
+        static void bindTextures (const GLuint first, const GLsizei unitCount, const GLuint* const textures) noexcept;
+
+
+        /// <summary>
+        /// Object names are reused by OpenGL once deleted, these functions must be called when an object is deleted so
+        /// that a new object with the same name isn't assumed to be bound.
+        /// </summary>
+        static void forgetProgram (const GLuint program) noexcept;
+        static void forgetVertexArray (const GLuint array) noexcept;
+        static void forgetFramebuffer (const GLuint framebuffer) noexcept;
+        static void forgetRenderbuffer (const GLuint renderbuffer) noexcept;
+        static void forgetBuffer (const GLuint buffer) noexcept;
+        static void forgetTexture (const GLuint texture) noexcept;
+
+    private:
+
+        /// <summary> The capabilities which are tracked, any other capability is always issued. </summary>
+        enum class Capability : size_t
+        {
+            DepthTest   = 0,
+            StencilTest = 1,
+            Blend       = 2,
+            CullFace    = 3,
+            Count       = 4,
+            Unknown     = 5
+        };
+
+        /// <summary> The buffer targets which are tracked, any other target is always issued. </summary>
+        enum class BufferTarget : size_t
+        {
+            Array           = 0,
+            DrawIndirect    = 1,
+            Uniform         = 2,
+            ShaderStorage   = 3,
+            CopyRead        = 4,
+            CopyWrite       = 5,
+            PixelPack       = 6,
+            PixelUnpack     = 7,
+            Count           = 8,
+            Unknown         = 9
+        };
+
+        /// <summary> A cached value which may be unknown, unknown values never match. </summary>
+        template <typename T>
+        struct Cached final
+        {
+            T       value   { };        //!< The last value given to OpenGL.
+            bool    known   { false };  //!< Whether the value reflects the state of the context.
+
+            /// <summary> Stores the given value, returning whether it differed from the cache. </summary>
+            bool update (const T& next) noexcept;
+        };
+
+        using Names     = std::array<Cached<GLuint>, textureUnitCount>;
+        using Buffers   = std::array<Cached<GLuint>, static_cast<size_t> (BufferTarget::Count)>;
+        using Enables   = std::array<Cached<bool>, static_cast<size_t> (Capability::Count)>;
+        using Masks     = std::array<GLboolean, 4>;
+        using Colour    = std::array<GLfloat, 4>;
+        using Rect      = std::array<GLint, 4>;
+        using Stencil   = std::array<GLuint, 3>;
+        using Pair      = std::array<GLenum, 2>;
+
+        /// <summary> Every piece of state which is tracked. </summary>
+        struct State final
+        {
+            Enables             enables         { };    //!< The enabled capabilities.
+            Cached<GLboolean>   depthMask       { };    //!< Whether depth writing is enabled.
+            Cached<GLenum>      depthFunc       { };    //!< The depth comparison function.
+            Cached<Stencil>     stencilFunc     { };    //!< The stencil function, reference value and mask.
+            Cached<Stencil>     stencilOp       { };    //!< The stencil fail, depth fail and pass operations.
+            Cached<Masks>       colorMask       { };    //!< Which colour channels are written.
+            Cached<GLenum>      cullFace        { };    //!< Which faces are culled.
+            Cached<Pair>        blendFunc       { };    //!< The source and destination blend factors.
+            Cached<GLenum>      blendEquation   { };    //!< The blend equation.
+            Cached<Colour>      clearColor      { };    //!< The colour buffers are cleared with.
+            Cached<GLdouble>    clearDepth      { };    //!< The value depth buffers are cleared with.
+            Cached<GLint>       clearStencil    { };    //!< The value stencil buffers are cleared with.
+            Cached<Rect>        viewport        { };    //!< The viewport rectangle.
+            Cached<GLuint>      program         { };    //!< The program in use.
+            Cached<GLuint>      vertexArray     { };    //!< The bound vertex array object.
+            Cached<GLuint>      drawFramebuffer { };    //!< The framebuffer being drawn to.
+            Cached<GLuint>      readFramebuffer { };    //!< The framebuffer being read from.
+            Cached<GLuint>      renderbuffer    { };    //!< The bound renderbuffer.
+            Buffers             buffers         { };    //!< The buffer bound to each tracked target.
+            Names               textures        { };    //!< The texture bound to each tracked unit.
+            Counters            counters        { };    //!< How many calls have been issued and filtered.
+        };
+
+    private:
+
+        /// <summary> Gets the cached state of the context. OpenGL is only used from the rendering thread. </summary>
+        static State& state() noexcept;
+
+        /// <summary> Counts the call as issued if changed is true, otherwise as filtered, and returns changed. </summary>
+        static bool count (const bool changed) noexcept;
+
+        /// <summary> Marks any cached value holding the given name as unknown. </summary>
+        static void forget (Cached<GLuint>& cached, const GLuint name) noexcept;
+
+        static Capability toCapability (const GLenum capability) noexcept;
+        static BufferTarget toBufferTarget (const GLenum target) noexcept;
+};
+
+
+template <typename T>
+bool StateCache::Cached<T>::update (const T& next) noexcept
+{
+    if (known && value == next)
+    {
+        return false;
+    }
+
+    value = next;
+    known = true;
+    return true;
+}
+
+#endif // _RENDERING_STATE_STATE_CACHE_
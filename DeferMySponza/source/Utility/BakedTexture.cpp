@@ -0,0 +1,216 @@
+#include "BakedTexture.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+
+// Engine headers.
+#include <tygra/FileHelper.hpp>
+
+
+GLsizei BakedTexture::getLevelSize (const GLsizei index) const noexcept
+{
+    return static_cast<GLsizei> (level (index).size);
+}
+
+
+const GLvoid* BakedTexture::getLevelData (const GLsizei index) const noexcept
+{
+    const auto entry = level (index);
+    return entry.size > 0 ? m_data.data() + entry.offset : nullptr;
+}
+
+
+std::string BakedTexture::locationOf (const std::string& image) noexcept
+{
+    // Only an extension in the final path segment should be replaced.
+    const auto dot      = image.find_last_of ('.');
+    const auto slash    = image.find_last_of ('/');
+    const auto hasDot   = dot != std::string::npos && (slash == std::string::npos || dot > slash);
+
+    return (hasDot ? image.substr (0, dot) : image) + extension;
+}
+
+
+GLsizei BakedTexture::compressedSize (const GLenum format, const GLsizei width, const GLsizei height) noexcept
+{
+    if (width < 1 || height < 1)
+    {
+        return 0;
+    }
+
+    // Partial blocks at the edges of a level still occupy a whole block.
+    const auto blocks = ((width + 3) / 4) * ((height + 3) / 4);
+
+    switch (format)
+    {
+        case GL_COMPRESSED_RED_RGTC1:
+        case GL_COMPRESSED_SIGNED_RED_RGTC1:
+            return blocks * 8;
+
+        case GL_COMPRESSED_RG_RGTC2:
+        case GL_COMPRESSED_SIGNED_RG_RGTC2:
+        case GL_COMPRESSED_RGBA_BPTC_UNORM:
+        case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+            return blocks * 16;
+
+        default:
+            return 0;
+    }
+}
+
+
+bool BakedTexture::assign (const GLenum format, const GLsizei width, const GLsizei height, const size_t components,
+    const Levels& levels) noexcept
+{
+    if (levels.empty() || levels.size() > maxLevels)
+    {
+        return false;
+    }
+
+    // The level table immediately follows the header and the data follows the table.
+    auto header         = Header { };
+    header.format       = static_cast<std::uint32_t> (format);
+    header.width        = static_cast<std::uint32_t> (std::max (width, 0));
+    header.height       = static_cast<std::uint32_t> (std::max (height, 0));
+    header.levels       = static_cast<std::uint32_t> (levels.size());
+    header.components   = static_cast<std::uint32_t> (components);
+
+    auto table  = std::vector<Level> (levels.size());
+    auto offset = sizeof (Header) + sizeof (Level) * table.size();
+
+    for (size_t i { 0 }; i < levels.size(); ++i)
+    {
+        table[i].offset = static_cast<std::uint32_t> (offset);
+        table[i].size   = static_cast<std::uint32_t> (levels[i].size());
+        offset          += levels[i].size();
+    }
+
+    auto data = Bytes (offset);
+    std::memcpy (data.data(), &header, sizeof (Header));
+    std::memcpy (data.data() + sizeof (Header), table.data(), sizeof (Level) * table.size());
+
+    for (size_t i { 0 }; i < levels.size(); ++i)
+    {
+        std::copy (std::begin (levels[i]), std::end (levels[i]), std::begin (data) + table[i].offset);
+    }
+
+    if (!validate (data))
+    {
+        return false;
+    }
+
+    m_data = std::move (data);
+    return true;
+}
+
+
+bool BakedTexture::load (const std::string& uri) noexcept
+{
+    // Files are read through tygra so the same URIs which locate images can be used, including packed content.
+    auto data = tygra::createBufferFromFile (uri);
+
+    if (!validate (data))
+    {
+        return false;
+    }
+
+    m_data = std::move (data);
+    return true;
+}
+
+
+bool BakedTexture::save (const std::string& file) const noexcept
+{
+    if (!isLoaded())
+    {
+        return false;
+    }
+
+    auto output = std::ofstream { file, std::ios::binary | std::ios::trunc };
+    output.write (reinterpret_cast<const char*> (m_data.data()), static_cast<std::streamsize> (m_data.size()));
+    return output.good();
+}
+
+
+void BakedTexture::clean() noexcept
+{
+    m_data.clear();
+    m_data.shrink_to_fit();
+}
+
+
+BakedTexture::Header BakedTexture::header() const noexcept
+{
+    auto result = Header { };
+    result.magic    = 0;
+    result.version  = 0;
+
+    if (m_data.size() >= sizeof (Header))
+    {
+        std::memcpy (&result, m_data.data(), sizeof (Header));
+    }
+
+    return result;
+}
+
+
+BakedTexture::Level BakedTexture::level (const GLsizei index) const noexcept
+{
+    auto result = Level { };
+
+    if (index >= 0 && index < getLevelCount())
+    {
+        std::memcpy (&result, m_data.data() + sizeof (Header) + sizeof (Level) * index, sizeof (Level));
+    }
+
+    return result;
+}
+
+
+bool BakedTexture::validate (const Bytes& data) noexcept
+{
+    if (data.size() < sizeof (Header))
+    {
+        return false;
+    }
+
+    auto header = Header { };
+    std::memcpy (&header, data.data(), sizeof (Header));
+
+    if (header.magic != magic || header.version != version || header.levels < 1 || header.levels > maxLevels ||
+        header.width < 1 || header.height < 1 || header.components < 1 || header.components > 4)
+    {
+        return false;
+    }
+
+    const auto tableEnd = sizeof (Header) + sizeof (Level) * header.levels;
+
+    if (data.size() < tableEnd)
+    {
+        return false;
+    }
+
+    // Every level must be the exact size expected of its dimensions and lie entirely within the file.
+    for (std::uint32_t i { 0 }; i < header.levels; ++i)
+    {
+        auto entry = Level { };
+        std::memcpy (&entry, data.data() + sizeof (Header) + sizeof (Level) * i, sizeof (Level));
+
+        const auto width    = std::max (static_cast<GLsizei> (header.width >> i), 1);
+        const auto height   = std::max (static_cast<GLsizei> (header.height >> i), 1);
+        const auto expected = compressedSize (static_cast<GLenum> (header.format), width, height);
+
+        if (expected == 0 || entry.size != static_cast<std::uint32_t> (expected) ||
+            entry.offset < tableEnd || entry.offset > data.size() || entry.size > data.size() - entry.offset)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
\ No newline at end of file
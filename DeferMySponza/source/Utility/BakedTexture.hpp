@@ -0,0 +1,138 @@
+#pragma once
+
+#if !defined    _UTIL_BAKED_TEXTURE_
+#define         _UTIL_BAKED_TEXTURE_
+
+// STL headers.
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+// Engine headers.
+#include <tgl/tgl.h>
+
+
+/// <summary>
+/// A block-compressed texture along with every mipmap level, as written by the texture baker. The file starts with a
+/// fixed header followed by a table of levels and then the compressed blocks of each level, largest first. The whole
+/// file is kept in a single contiguous allocation so each level can be handed to OpenGL without any conversion.
+/// </summary>
+class BakedTexture final
+{
+    public:
+
+        constexpr static auto extension = ".btex";                  //!< Replaces the extension of the source image.
+        constexpr static auto maxLevels = std::uint32_t { 16 };     //!< Enough levels for a 32768x32768 texture.
+
+        using Bytes     = std::vector<std::uint8_t>;
+        using Levels    = std::vector<Bytes>;
+
+        BakedTexture() noexcept                             = default;
+        BakedTexture (BakedTexture&&) noexcept              = default;
+        BakedTexture& operator= (BakedTexture&&) noexcept   = default;
+        ~BakedTexture()                                     = default;
+
+        BakedTexture (const BakedTexture&)                  = delete;
+        BakedTexture& operator= (const BakedTexture&)       = delete;
+
+
+        /// <summary> Check if the texture contains valid data. </summary>
+        bool isLoaded() const noexcept                  { return !m_data.empty(); }
+
+        /// <summary> Gets the compressed internal format, e.g. GL_COMPRESSED_RGBA_BPTC_UNORM. </summary>
+        GLenum getFormat() const noexcept               { return static_cast<GLenum> (header().format); }
+
+        /// <summary> Gets how many texels wide the base level is. </summary>
+        GLsizei getWidth() const noexcept               { return static_cast<GLsizei> (header().width); }
+
+        /// <summary> Gets how many texels tall the base level is. </summary>
+        GLsizei getHeight() const noexcept              { return static_cast<GLsizei> (header().height); }
+
+        /// <summary> Gets how many mipmap levels are stored. </summary>
+        GLsizei getLevelCount() const noexcept          { return static_cast<GLsizei> (header().levels); }
+
+        /// <summary> Gets how many components the source image had before compression. </summary>
+        size_t getComponents() const noexcept           { return static_cast<size_t> (header().components); }
+
+        /// <summary> Gets how many bytes of compressed data the given level contains. </summary>
+        GLsizei getLevelSize (const GLsizei level) const noexcept;
+
+        /// <summary> Gets the compressed blocks of the given level. </summary>
+        const GLvoid* getLevelData (const GLsizei level) const noexcept;
+
+
+        /// <summary> Gets the location of the baked counterpart of the given image, e.g. "Bricks.png" becomes "Bricks.btex". </summary>
+        static std::string locationOf (const std::string& image) noexcept;
+
+        /// <summary> Calculates how many bytes a level of the given format and dimensions occupies, zero if unsupported. </summary>
+        static GLsizei compressedSize (const GLenum format, const GLsizei width, const GLsizei height) noexcept;
+
+
+        /// <summary>
+        /// Constructs the texture from a set of compressed levels. Upon failure the object will not be modified.
+        /// </summary>
+        /// <param name="format"> The compressed internal format of every level. </param>
+        /// <param name="width"> How many texels wide the base level is. </param>
+        /// <param name="height"> How many texels tall the base level is. </param>
+        /// <param name="components"> How many components the source image had. </param>
+        /// <param name="levels"> The compressed blocks of each level, starting with the base level. </param>
+        /// <returns> Whether the levels matched the given format and dimensions. </returns>
+        bool assign (const GLenum format, const GLsizei width, const GLsizei height, const size_t components,
+            const Levels& levels) noexcept;
+
+        /// <summary>
+        /// Reads and validates a baked texture through the same URI scheme used for images. Upon failure the object
+        /// will not be modified.
+        /// </summary>
+        /// <param name="uri"> The location of the file, e.g. "content:///Albedos/Bricks.btex". </param>
+        /// <returns> Whether the file exists and contains a valid texture. </returns>
+        bool load (const std::string& uri) noexcept;
+
+        /// <summary> Writes the texture to the given file system location. </summary>
+        /// <returns> Whether the file was written successfully. </returns>
+        bool save (const std::string& file) const noexcept;
+
+        /// <summary> Releases the stored data. </summary>
+        void clean() noexcept;
+
+    private:
+
+        constexpr static auto magic     = std::uint32_t { 0x58544244 }; //!< "DBTX" when read as bytes.
+        constexpr static auto version   = std::uint32_t { 1 };          //!< Incremented whenever the layout changes.
+
+        /// <summary> The fixed-size start of every file. </summary>
+        struct Header final
+        {
+            std::uint32_t   magic       { BakedTexture::magic };    //!< Identifies the file as a baked texture.
+            std::uint32_t   version     { BakedTexture::version };  //!< The layout version of the file.
+            std::uint32_t   format      { 0 };                      //!< The compressed internal format.
+            std::uint32_t   width       { 0 };                      //!< The width of the base level.
+            std::uint32_t   height      { 0 };                      //!< The height of the base level.
+            std::uint32_t   levels      { 0 };                      //!< How many levels follow the header.
+            std::uint32_t   components  { 0 };                      //!< How many components the source image had.
+            std::uint32_t   reserved    { 0 };                      //!< Pads the header to 32 bytes.
+        };
+
+        /// <summary> Locates the data of a level inside the file. </summary>
+        struct Level final
+        {
+            std::uint32_t   offset  { 0 };  //!< How many bytes from the start of the file the level begins.
+            std::uint32_t   size    { 0 };  //!< How many bytes the level occupies.
+        };
+
+        Bytes m_data { };   //!< The entire file, including the header and level table.
+
+    private:
+
+        /// <summary> Gets the header of the stored file, a default header is returned if no data is stored. </summary>
+        Header header() const noexcept;
+
+        /// <summary> Gets the table entry of the given level, an empty level is returned if out of range. </summary>
+        Level level (const GLsizei index) const noexcept;
+
+        /// <summary> Checks the header, level table and level sizes of the given file are consistent. </summary>
+        static bool validate (const Bytes& data) noexcept;
+};
+
+#endif // _UTIL_BAKED_TEXTURE_
\ No newline at end of file
@@ -1,6 +1,12 @@
 #include "Textures.hpp"
 
 
+// STL headers.
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+
 namespace util
 {
     GLenum internalFormat (const size_t components) noexcept
@@ -22,4 +28,110 @@ namespace util
 
         return 0;
     }
+
+
+    std::vector<std::uint8_t> toTexels8 (const void* data, const size_t texelCount, const size_t components, 
+        const size_t bytesPerComponent, const size_t outputComponents) noexcept
+    {
+        const auto source   = static_cast<const std::uint8_t*> (data);
+        auto texels         = std::vector<std::uint8_t> (texelCount * outputComponents, 0);
+
+        for (size_t i { 0 }; i < texelCount; ++i)
+        {
+            auto texel = texels.data() + i * outputComponents;
+
+            if (outputComponents == 4)
+            {
+                texel[3] = 255;
+            }
+
+            for (size_t c { 0 }; c < std::min (components, outputComponents); ++c)
+            {
+                const auto component = source + (i * components + c) * bytesPerComponent;
+
+                // 16-bit components are decoded in native byte order, as GL_UNSIGNED_SHORT uploads expect them.
+                if (bytesPerComponent == 2)
+                {
+                    auto value = std::uint16_t { 0 };
+                    std::memcpy (&value, component, sizeof (value));
+                    texel[c] = static_cast<std::uint8_t> (value >> 8);
+                }
+
+                else
+                {
+                    texel[c] = *component;
+                }
+            }
+        }
+
+        return texels;
+    }
+
+
+    std::vector<std::uint8_t> downsample (const std::vector<std::uint8_t>& texels, const GLsizei width, 
+        const GLsizei height, const size_t components) noexcept
+    {
+        const auto halfWidth    = std::max (width / 2, 1);
+        const auto halfHeight   = std::max (height / 2, 1);
+        auto result             = std::vector<std::uint8_t> (static_cast<size_t> (halfWidth) * halfHeight * components);
+
+        const auto texel = [&] (const GLsizei x, const GLsizei y, const size_t c)
+        {
+            return static_cast<unsigned int> (texels[(static_cast<size_t> (y) * width + x) * components + c]);
+        };
+
+        // Clamping the second sample allows dimensions of one to be halved along the other axis.
+        for (GLsizei y { 0 }; y < halfHeight; ++y)
+        {
+            const auto y0 = y * 2;
+            const auto y1 = std::min (y0 + 1, height - 1);
+
+            for (GLsizei x { 0 }; x < halfWidth; ++x)
+            {
+                const auto x0 = x * 2;
+                const auto x1 = std::min (x0 + 1, width - 1);
+
+                for (size_t c { 0 }; c < components; ++c)
+                {
+                    const auto sum = texel (x0, y0, c) + texel (x1, y0, c) + texel (x0, y1, c) + texel (x1, y1, c);
+                    result[(static_cast<size_t> (y) * halfWidth + x) * components + c] = static_cast<std::uint8_t> ((sum + 2) / 4);
+                }
+            }
+        }
+
+        return result;
+    }
+
+
+    void renormalise (std::vector<std::uint8_t>& texels, const size_t components) noexcept
+    {
+        if (components < 3)
+        {
+            return;
+        }
+
+        for (size_t i { 0 }; i + components <= texels.size(); i += components)
+        {
+            const auto x        = texels[i] / 127.5f - 1.f;
+            const auto y        = texels[i + 1] / 127.5f - 1.f;
+            const auto z        = texels[i + 2] / 127.5f - 1.f;
+            const auto length   = std::sqrt (x * x + y * y + z * z);
+
+            // Opposing normals can cancel out, vectors within a quantisation step of zero have no reliable direction.
+            if (length < 1.f / 127.5f)
+            {
+                continue;
+            }
+
+            const auto encode = [=] (const float value)
+            {
+                const auto scaled = (value / length + 1.f) * 127.5f + 0.5f;
+                return static_cast<std::uint8_t> (std::min (std::max (scaled, 0.f), 255.f));
+            };
+
+            texels[i]       = encode (x);
+            texels[i + 1]   = encode (y);
+            texels[i + 2]   = encode (z);
+        }
+    }
 }
\ No newline at end of file
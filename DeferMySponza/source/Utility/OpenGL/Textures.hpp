@@ -3,6 +3,11 @@
 #if !defined    _UTILITY_OPENGL_TEXTURES_
 #define         _UTILITY_OPENGL_TEXTURES_
 
+// STL headers.
+#include <cstdint>
+#include <vector>
+
+
 // Personal headers.
 #include <tgl/tgl.h>
 
@@ -11,6 +16,32 @@ namespace util
 {
     /// <summary> Gets the internal format for the given number of components. </summary>
     GLenum internalFormat (const size_t components) noexcept;
+
+    /// <summary>
+    /// Converts texels of any component count and depth into tightly packed 8-bit texels with the given component
+    /// count. Missing colour channels are zero and missing alpha is opaque, matching how OpenGL expands R, RG and RGB
+    /// data. Only the most significant byte of 16-bit components, which are in native byte order, is kept.
+    /// </summary>
+    /// <param name="data"> The texels to convert. </param>
+    /// <param name="texelCount"> How many texels are given. </param>
+    /// <param name="components"> How many components each given texel has. </param>
+    /// <param name="bytesPerComponent"> How many bytes each given component uses, either 1 or 2. </param>
+    /// <param name="outputComponents"> How many components each converted texel should have. </param>
+    std::vector<std::uint8_t> toTexels8 (const void* data, const size_t texelCount, const size_t components, 
+        const size_t bytesPerComponent, const size_t outputComponents) noexcept;
+
+    /// <summary>
+    /// Halves both dimensions of the given tightly packed 8-bit level by averaging each 2x2 block of texels. A
+    /// dimension of one is kept as one.
+    /// </summary>
+    std::vector<std::uint8_t> downsample (const std::vector<std::uint8_t>& texels, const GLsizei width, 
+        const GLsizei height, const size_t components) noexcept;
+
+    /// <summary>
+    /// Rescales the XYZ vector of every texel in a normal map back to unit length, components [0, 255] map to [-1, 1].
+    /// Averaging normals shortens them so this should be applied to each downsampled level. Other components are kept.
+    /// </summary>
+    void renormalise (std::vector<std::uint8_t>& texels, const size_t components) noexcept;
 }
 
 #endif // _UTILITY_OPENGL_TEXTURES_
\ No newline at end of file
@@ -0,0 +1,237 @@
+#include "Profiler.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+// Engine headers.
+#ifdef _NVTX
+#include <nvToolsExt.h>
+#endif
+
+
+/// <summary>
+/// The ring of completed zones for a thread. Only the owning thread writes to the ring, the write count is atomic so
+/// the zones can be read back without locking the recording thread. Buffers outlive their threads so short-lived
+/// worker threads can hand them over to the next thread which needs one.
+/// </summary>
+struct Profiler::ThreadBuffer final
+{
+    using Events = std::array<Event, bufferCapacity>;
+
+    Events              events  { };    //!< The most recently completed zones.
+    std::atomic<size_t> written { 0 };  //!< How many zones have ever been written, the ring index is this modulo capacity.
+    std::uint32_t       thread  { 0 };  //!< The row the buffer occupies in the trace.
+    bool                inUse   { };    //!< Whether a live thread currently owns the buffer.
+};
+
+
+/// <summary>
+/// The zone stack of a thread. A buffer is only claimed once the thread records a zone whilst the profiler is enabled
+/// and is returned to the registry when the thread exits.
+/// </summary>
+struct Profiler::ThreadState final
+{
+    std::array<const char*, maxDepth>   names   { };            //!< The names of each open zone.
+    std::array<std::int64_t, maxDepth>  starts  { };            //!< When each open zone started, negative if not recording.
+    size_t                              depth   { 0 };          //!< How many zones are currently open.
+    ThreadBuffer*                       buffer  { nullptr };    //!< Where completed zones are written.
+
+    ~ThreadState();
+};
+
+
+/// <summary>
+/// Owns every thread buffer. The mutex is only taken when a thread claims or returns a buffer and when the recorded
+/// zones are written out or cleared.
+/// </summary>
+struct Profiler::Registry final
+{
+    using Buffers   = std::vector<std::unique_ptr<ThreadBuffer>>;
+    using Clock     = std::chrono::steady_clock;
+
+    std::mutex          mutex   { };                //!< Guards the buffer list.
+    Buffers             buffers { };                //!< Every buffer which has ever been claimed.
+    std::atomic<bool>   enabled { false };          //!< Whether zones are being recorded.
+    Clock::time_point   epoch   { Clock::now() };   //!< The point in time which zone timestamps are relative to.
+};
+
+
+Profiler::ThreadState::~ThreadState()
+{
+    if (buffer)
+    {
+        auto& shared    = registry();
+        const std::lock_guard<std::mutex> lock { shared.mutex };
+        buffer->inUse   = false;
+    }
+}
+
+
+void Profiler::setEnabled (const bool enabled) noexcept
+{
+    registry().enabled.store (enabled, std::memory_order_relaxed);
+}
+
+
+bool Profiler::isEnabled() noexcept
+{
+    return registry().enabled.load (std::memory_order_relaxed);
+}
+
+
+void Profiler::beginZone (const char* name) noexcept
+{
+    #ifdef _NVTX
+        nvtxRangePushA (name);
+    #endif
+
+    auto& state = threadState();
+
+    // Zones nested too deeply are ignored but still counted so they pop correctly.
+    if (state.depth < maxDepth)
+    {
+        state.names[state.depth]    = name;
+        state.starts[state.depth]   = isEnabled() ? now() : -1;
+    }
+
+    ++state.depth;
+}
+
+
+void Profiler::endZone() noexcept
+{
+    #ifdef _NVTX
+        nvtxRangePop();
+    #endif
+
+    auto& state = threadState();
+
+    if (state.depth == 0)
+    {
+        return;
+    }
+
+    const auto depth = --state.depth;
+    if (depth >= maxDepth || state.starts[depth] < 0 || !isEnabled())
+    {
+        return;
+    }
+
+    // Claim a buffer the first time this thread completes a zone. Released buffers are reused so that threads
+    // spawned for each frame don't cause the registry to grow.
+    if (!state.buffer)
+    {
+        auto& shared    = registry();
+        const std::lock_guard<std::mutex> lock { shared.mutex };
+
+        const auto released = std::find_if (shared.buffers.begin(), shared.buffers.end(),
+            [] (const auto& buffer) { return !buffer->inUse; });
+
+        if (released != shared.buffers.end())
+        {
+            state.buffer = released->get();
+        }
+
+        else
+        {
+            shared.buffers.push_back (std::make_unique<ThreadBuffer>());
+            state.buffer            = shared.buffers.back().get();
+            state.buffer->thread    = static_cast<std::uint32_t> (shared.buffers.size() - 1);
+        }
+
+        state.buffer->inUse = true;
+    }
+
+    auto& buffer        = *state.buffer;
+    const auto index    = buffer.written.load (std::memory_order_relaxed);
+    auto& event         = buffer.events[index % bufferCapacity];
+    event.name          = state.names[depth];
+    event.start         = state.starts[depth];
+    event.end           = now();
+    event.depth         = static_cast<std::uint32_t> (depth);
+
+    buffer.written.store (index + 1, std::memory_order_release);
+}
+
+
+void Profiler::clear() noexcept
+{
+    auto& shared    = registry();
+    const std::lock_guard<std::mutex> lock { shared.mutex };
+
+    for (auto& buffer : shared.buffers)
+    {
+        buffer->written.store (0, std::memory_order_release);
+    }
+}
+
+
+bool Profiler::writeChromeTrace (const std::string& file) noexcept
+{
+    auto output = std::ofstream { file };
+
+    if (!output.is_open())
+    {
+        return false;
+    }
+
+    auto& shared    = registry();
+    const std::lock_guard<std::mutex> lock { shared.mutex };
+    auto first      = true;
+
+    // Complete events ("X") carry their own duration, timestamps are in microseconds.
+    output << std::fixed << std::setprecision (3);
+    output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    for (const auto& buffer : shared.buffers)
+    {
+        const auto written  = buffer->written.load (std::memory_order_acquire);
+        const auto count    = std::min (written, bufferCapacity);
+
+        for (auto i = written - count; i < written; ++i)
+        {
+            const auto& event = buffer->events[i % bufferCapacity];
+
+            output << (first ? "" : ",\n")
+                << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->thread
+                << ",\"ts\":" << event.start / 1000.0 << ",\"dur\":" << (event.end - event.start) / 1000.0
+                << ",\"args\":{\"depth\":" << event.depth << "}}";
+
+            first = false;
+        }
+    }
+
+    output << "\n]}\n";
+    return output.good();
+}
+
+
+Profiler::Registry& Profiler::registry() noexcept
+{
+    static Registry shared;
+    return shared;
+}
+
+
+Profiler::ThreadState& Profiler::threadState() noexcept
+{
+    thread_local ThreadState state;
+    return state;
+}
+
+
+std::int64_t Profiler::now() noexcept
+{
+    const auto elapsed = Registry::Clock::now() - registry().epoch;
+    return std::chrono::duration_cast<std::chrono::nanoseconds> (elapsed).count();
+}
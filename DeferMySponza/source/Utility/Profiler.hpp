@@ -0,0 +1,111 @@
+#pragma once
+
+#if !defined    _UTIL_PROFILER_
+#define         _UTIL_PROFILER_
+
+// STL headers.
+#include <cstdint>
+#include <string>
+
+
+/// <summary>
+/// A lightweight CPU profiler which records named zones on any thread. Each thread writes completed zones into its
+/// own fixed-size ring so recording never takes a lock, timestamps come from std::chrono::steady_clock. Recording can
+/// be toggled at runtime and the collected zones can be written out in the Chrome trace event format, viewable in
+/// chrome://tracing or Perfetto. When _NVTX is defined every zone is also forwarded to NVTX as a range.
+/// </summary>
+class Profiler final
+{
+    public:
+
+        constexpr static auto bufferCapacity    = size_t { 1 << 14 };   //!< How many zones each thread can hold before overwriting the oldest.
+        constexpr static auto maxDepth          = size_t { 32 };        //!< How deeply zones can be nested on a single thread.
+
+        /// <summary> Starts or stops the recording of zones. NVTX ranges are emitted regardless. </summary>
+        static void setEnabled (const bool enabled) noexcept;
+
+        /// <summary> Checks whether zones are currently being recorded. </summary>
+        static bool isEnabled() noexcept;
+
+        /// <summary>
+        /// Opens a zone on the calling thread, it will be closed by the next call to endZone() on the same thread.
+        /// </summary>
+        /// <param name="name"> A string literal naming the zone, the pointer must remain valid until written. </param>
+        static void beginZone (const char* name) noexcept;
+
+        /// <summary> Closes the most recently opened zone on the calling thread. </summary>
+        static void endZone() noexcept;
+
+        /// <summary> Discards every recorded zone, this should only be called when no other thread is recording. </summary>
+        static void clear() noexcept;
+
+        /// <summary>
+        /// Writes every recorded zone to the given file as Chrome trace JSON. This should only be called when no other
+        /// thread is recording.
+        /// </summary>
+        /// <param name="file"> The location to write to. </param>
+        /// <returns> Whether the file was written successfully. </returns>
+        static bool writeChromeTrace (const std::string& file) noexcept;
+
+    private:
+
+        /// <summary> A completed zone. </summary>
+        struct Event final
+        {
+            const char*     name    { nullptr };    //!< The name given to the zone.
+            std::int64_t    start   { 0 };          //!< When the zone was opened (ns since the profiler epoch).
+            std::int64_t    end     { 0 };          //!< When the zone was closed (ns since the profiler epoch).
+            std::uint32_t   depth   { 0 };          //!< How many zones enclosed this zone.
+        };
+
+        struct ThreadBuffer;
+        struct ThreadState;
+        struct Registry;
+
+        /// <summary> Gets the shared list of thread buffers. </summary>
+        static Registry& registry() noexcept;
+
+        /// <summary> Gets the zone stack of the calling thread. </summary>
+        static ThreadState& threadState() noexcept;
+
+        /// <summary> Gets the current time in nanoseconds since the profiler epoch. </summary>
+        static std::int64_t now() noexcept;
+};
+
+
+/// <summary>
+/// Opens a profiler zone upon construction and closes it upon destruction.
+/// </summary>
+class ProfileZone final
+{
+    public:
+
+        ProfileZone (const char* name) noexcept     { Profiler::beginZone (name); }
+        ~ProfileZone()                              { Profiler::endZone(); }
+
+        ProfileZone (ProfileZone&&)                 = delete;
+        ProfileZone (const ProfileZone&)            = delete;
+        ProfileZone& operator= (ProfileZone&&)      = delete;
+        ProfileZone& operator= (const ProfileZone&) = delete;
+};
+
+
+// Zones compile away entirely when _NO_PROFILER is defined.
+#if defined _NO_PROFILER
+
+    #define PROFILE_SCOPE(name)
+    #define PROFILE_BEGIN(name)
+    #define PROFILE_END()
+
+#else
+
+    #define PROFILE_CONCATENATE_IMPL(a, b)  a##b
+    #define PROFILE_CONCATENATE(a, b)       PROFILE_CONCATENATE_IMPL (a, b)
+
+    #define PROFILE_SCOPE(name)             const ProfileZone PROFILE_CONCATENATE (profileZone, __LINE__) { name }
+    #define PROFILE_BEGIN(name)             Profiler::beginZone (name)
+    #define PROFILE_END()                   Profiler::endZone()
+
+#endif
+
+#endif // _UTIL_PROFILER_
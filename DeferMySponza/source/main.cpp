@@ -1,14 +1,67 @@
+#include <Baking/ContentPacker.hpp>
+#include <Baking/TextureBaker.hpp>
+#include <Benchmark/Benchmark.hpp>
+#include <Benchmark/DecodeBenchmark.hpp>
 #include <Misc/MyController.hpp>
+#include <tygra/FileHelper.hpp>
 #include <tygra/Window.hpp>
 
+#if defined _MSC_VER
 #include <crtdbg.h>
+#endif
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 
 int main(int argc, char *argv[])
 {
+#if defined _MSC_VER
     // enable debug memory checks
     _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
+
+    // pack the content directory offline, this must happen before a pack is mounted
+    if (argc > 1 && std::strcmp(argv[1], "--pack") == 0) {
+        ContentPacker::Settings settings;
+        ContentPacker packer;
+        const bool success = ContentPacker::parseArguments(argc, argv, settings)
+            && packer.initialise(settings)
+            && packer.run();
+        return success ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // resolve content from a single mapped pack when one has been built, loose files are used otherwise
+    tygra::mountContentPack(ContentPacker::defaultPack);
+
+    // run headless and exit when benchmarking, there's nobody to read the console
+    if (argc > 1 && std::strcmp(argv[1], "--benchmark") == 0) {
+        Benchmark::Settings settings;
+        Benchmark benchmark;
+        const bool success = Benchmark::parseArguments(argc, argv, settings)
+            && benchmark.initialise(settings)
+            && benchmark.run();
+        return success ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // bake compressed textures offline so startup only has to upload them
+    if (argc > 1 && std::strcmp(argv[1], "--bake") == 0) {
+        TextureBaker::Settings settings;
+        TextureBaker baker;
+        const bool success = TextureBaker::parseArguments(argc, argv, settings)
+            && baker.initialise(settings)
+            && baker.run();
+        return success ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // measure how quickly texture maps decode without creating any context
+    if (argc > 1 && std::strcmp(argv[1], "--decode-benchmark") == 0) {
+        DecodeBenchmark::Settings settings;
+        DecodeBenchmark benchmark;
+        const bool success = DecodeBenchmark::parseArguments(argc, argv, settings)
+            && benchmark.initialise(settings)
+            && benchmark.run();
+        return success ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
 
     try {
 
@@ -17,6 +17,8 @@ public:
 
     void update();
 
+    void update(float time_seconds);
+
     bool toggleCameraAnimation();
 
     float getTimeInSeconds() const;
@@ -175,8 +175,13 @@ void Context::update()
     const auto clock_time = std::chrono::system_clock::now() - start_time_;
     const auto clock_millisecs
         = std::chrono::duration_cast<std::chrono::milliseconds>(clock_time);
+    update(0.001f * clock_millisecs.count());
+}
+
+void Context::update(float time_seconds)
+{
     const float prev_time = time_seconds_;
-    time_seconds_ = 0.001f * clock_millisecs.count();
+    time_seconds_ = time_seconds;
     const float dt = time_seconds_ - prev_time;
 
     if (animate_camera_) {
@@ -172,6 +172,8 @@
 #define TGL_PLATFORM_COCOA
 #elif defined(_WIN32)
 #define TGL_PLATFORM_WIN32
+#elif defined(__linux__)
+#define TGL_PLATFORM_EGL
 #else
 #error TGL does not recognise the build platform
 #endif
@@ -180,6 +182,81 @@
 #define TGL_DEBUG
 #endif
 
+/*
+ * Instrumented builds (TGL_INSTRUMENT must be defined for tgl and the
+ * application) wrap every loaded function. Win32 normally links GL 1.0 and 1.1
+ * statically so in instrumented builds they are loaded like any other function
+ * instead, under prefixed names to avoid clashing with opengl32.lib, and gl.h
+ * is blocked so its prototypes can't conflict.
+ */
+#if defined(TGL_INSTRUMENT) && defined(TGL_PLATFORM_WIN32)
+#define TGL_LOAD_LEGACY_GL
+#define __gl_h_
+#define __GL_H__
+#define glCullFace tgl_glCullFace
+#define glFrontFace tgl_glFrontFace
+#define glHint tgl_glHint
+#define glLineWidth tgl_glLineWidth
+#define glPointSize tgl_glPointSize
+#define glPolygonMode tgl_glPolygonMode
+#define glScissor tgl_glScissor
+#define glTexParameterf tgl_glTexParameterf
+#define glTexParameterfv tgl_glTexParameterfv
+#define glTexParameteri tgl_glTexParameteri
+#define glTexParameteriv tgl_glTexParameteriv
+#define glTexImage1D tgl_glTexImage1D
+#define glTexImage2D tgl_glTexImage2D
+#define glDrawBuffer tgl_glDrawBuffer
+#define glClear tgl_glClear
+#define glClearColor tgl_glClearColor
+#define glClearStencil tgl_glClearStencil
+#define glClearDepth tgl_glClearDepth
+#define glStencilMask tgl_glStencilMask
+#define glColorMask tgl_glColorMask
+#define glDepthMask tgl_glDepthMask
+#define glDisable tgl_glDisable
+#define glEnable tgl_glEnable
+#define glFinish tgl_glFinish
+#define glFlush tgl_glFlush
+#define glBlendFunc tgl_glBlendFunc
+#define glLogicOp tgl_glLogicOp
+#define glStencilFunc tgl_glStencilFunc
+#define glStencilOp tgl_glStencilOp
+#define glDepthFunc tgl_glDepthFunc
+#define glPixelStoref tgl_glPixelStoref
+#define glPixelStorei tgl_glPixelStorei
+#define glReadBuffer tgl_glReadBuffer
+#define glReadPixels tgl_glReadPixels
+#define glGetBooleanv tgl_glGetBooleanv
+#define glGetDoublev tgl_glGetDoublev
+#define glGetError tgl_glGetError
+#define glGetFloatv tgl_glGetFloatv
+#define glGetIntegerv tgl_glGetIntegerv
+#define glGetString tgl_glGetString
+#define glGetTexImage tgl_glGetTexImage
+#define glGetTexParameterfv tgl_glGetTexParameterfv
+#define glGetTexParameteriv tgl_glGetTexParameteriv
+#define glGetTexLevelParameterfv tgl_glGetTexLevelParameterfv
+#define glGetTexLevelParameteriv tgl_glGetTexLevelParameteriv
+#define glIsEnabled tgl_glIsEnabled
+#define glDepthRange tgl_glDepthRange
+#define glViewport tgl_glViewport
+#define glDrawArrays tgl_glDrawArrays
+#define glDrawElements tgl_glDrawElements
+#define glGetPointerv tgl_glGetPointerv
+#define glPolygonOffset tgl_glPolygonOffset
+#define glCopyTexImage1D tgl_glCopyTexImage1D
+#define glCopyTexImage2D tgl_glCopyTexImage2D
+#define glCopyTexSubImage1D tgl_glCopyTexSubImage1D
+#define glCopyTexSubImage2D tgl_glCopyTexSubImage2D
+#define glTexSubImage1D tgl_glTexSubImage1D
+#define glTexSubImage2D tgl_glTexSubImage2D
+#define glBindTexture tgl_glBindTexture
+#define glDeleteTextures tgl_glDeleteTextures
+#define glGenTextures tgl_glGenTextures
+#define glIsTexture tgl_glIsTexture
+#endif
+
 
 /*
  * The following section is lifted directly from glfw.h
@@ -425,6 +502,8 @@ typedef enum _TGLEXTENTION {
     TGL_EXTENSION_GL_4_5,
     TGL_EXTENSION_ARB_DEBUG_OUTPUT,
     TGL_EXTENSION_AMD_DEBUG_OUTPUT,
+    TGL_EXTENSION_ARB_BINDLESS_TEXTURE,
+    TGL_EXTENSION_KHR_PARALLEL_SHADER_COMPILE,
     TGL_EXTENSION_MAX
 } TGLEXTENSION;
 
@@ -443,9 +522,35 @@ GLboolean tglIsAvailable(TGLEXTENSION);
 /** Log a debug message */
 void tglDebugMessage(GLenum severity, const char *msg);
 
+#ifdef TGL_INSTRUMENT
+/** Query how many GL functions are instrumented, functions are identified by index. */
+unsigned int tglInstrumentFunctionCount(void);
+
+/** Query the name of an instrumented function. */
+const char* tglInstrumentFunctionName(unsigned int function);
+
+/** Query how many times a function was called during the last completed frame. */
+unsigned int tglInstrumentCallCount(unsigned int function);
+
+/** Query the CPU time spent inside a function during the last completed frame (ms). */
+double tglInstrumentCallTime(unsigned int function);
+
+/** Query how many GL calls were made during the last completed frame. */
+unsigned int tglInstrumentTotalCalls(void);
+
+/** Query the CPU time spent inside GL during the last completed frame (ms). */
+double tglInstrumentTotalTime(void);
+
+/** Mark the end of a frame, returns GL_FALSE if a requested trace couldn't be written. */
+GLboolean tglInstrumentEndFrame(void);
+
+/** Record every GL call made during the next frame to a binary trace file. */
+GLboolean tglInstrumentTraceNextFrame(const char* file);
+#endif
+
 /* GL_version_1_0 */
 #ifdef TGL_DECLARE_CORE_GL_1_0
-#if defined(TGL_PLATFORM_COCOA) || defined(TGL_PLATFORM_WIN32)
+#if defined(TGL_PLATFORM_COCOA) || (defined(TGL_PLATFORM_WIN32) && !defined(TGL_LOAD_LEGACY_GL))
 GLAPI void APIENTRY glCullFace(GLenum mode);
 GLAPI void APIENTRY glFrontFace(GLenum mode);
 GLAPI void APIENTRY glHint(GLenum target, GLenum mode);
@@ -549,7 +654,7 @@ extern PFNGLVIEWPORTPROC glViewport;
 
 /* GL_version_1_1 */
 #ifdef TGL_DECLARE_CORE_GL_1_1
-#if defined(TGL_PLATFORM_WIN32) || defined(TGL_PLATFORM_COCOA)
+#if (defined(TGL_PLATFORM_WIN32) && !defined(TGL_LOAD_LEGACY_GL)) || defined(TGL_PLATFORM_COCOA)
 GLAPI void APIENTRY glDrawArrays(GLenum mode, GLint first, GLsizei count);
 GLAPI void APIENTRY glDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices);
 GLAPI void APIENTRY glGetPointerv(GLenum pname, GLvoid* *params);
@@ -1975,6 +2080,35 @@ extern PFNGLDEBUGMESSAGECALLBACKAMDPROC glDebugMessageCallbackAMD;
 extern PFNGLGETDEBUGMESSAGELOGAMDPROC glGetDebugMessageLogAMD;
 #endif
 
+/* ARB_bindless_texture - copied from glext.h available from opengl.org */
+#ifndef GL_ARB_bindless_texture
+#define GL_ARB_bindless_texture
+#define GL_UNSIGNED_INT64_ARB             0x140F
+typedef GLuint64 (APIENTRYP PFNGLGETTEXTUREHANDLEARBPROC) (GLuint texture);
+typedef void (APIENTRYP PFNGLMAKETEXTUREHANDLERESIDENTARBPROC) (GLuint64 handle);
+typedef void (APIENTRYP PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC) (GLuint64 handle);
+typedef GLboolean (APIENTRYP PFNGLISTEXTUREHANDLERESIDENTARBPROC) (GLuint64 handle);
+#endif /* ARB_bindless_texture */
+#if 1
+#define TGL_DEFINE_ARB_BINDLESS_TEXTURE
+extern PFNGLGETTEXTUREHANDLEARBPROC glGetTextureHandleARB;
+extern PFNGLMAKETEXTUREHANDLERESIDENTARBPROC glMakeTextureHandleResidentARB;
+extern PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC glMakeTextureHandleNonResidentARB;
+extern PFNGLISTEXTUREHANDLERESIDENTARBPROC glIsTextureHandleResidentARB;
+#endif
+
+/* KHR_parallel_shader_compile - copied from glext.h available from opengl.org */
+#ifndef GL_KHR_parallel_shader_compile
+#define GL_KHR_parallel_shader_compile
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR          0x91B1
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC) (GLuint count);
+#endif /* KHR_parallel_shader_compile */
+#if 1
+#define TGL_DEFINE_KHR_PARALLEL_SHADER_COMPILE
+extern PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glMaxShaderCompilerThreadsKHR;
+#endif
+
 
 #ifdef __cplusplus
 }
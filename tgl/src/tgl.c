@@ -41,6 +41,7 @@
 
 #define TGL_TARGET_GL_4_5
 #include <tgl/tgl.h>
+#include <string.h>
 
 #if defined(TGL_PLATFORM_COCOA)
     //#include <Foundation/Foundation.h>
@@ -59,8 +60,26 @@
     #define WIN32_LEAN_AND_MEAN
     #include <Windows.h>
     #define OUTPUTDEBUGSTRING OutputDebugStringA
+    /* GL 1.0 and 1.1 are only exported by opengl32.dll, wglGetProcAddress won't find them */
     #define LOADFUNC( type, name, ret ) \
         name = (type)wglGetProcAddress(#name); \
+        if (name == NULL) {\
+            name = (type)GetProcAddress(GetModuleHandleA("opengl32.dll"), #name);\
+        }\
+        if (name == NULL) {\
+            OUTPUTDEBUGSTRING("TGL ... failed to load procedure ");\
+            OUTPUTDEBUGSTRING(#name);\
+            OUTPUTDEBUGSTRING("\n");\
+            ret = GL_FALSE;\
+        }
+#elif defined(TGL_PLATFORM_EGL)
+    #include <stdio.h>
+    #define EGL_NO_X11
+    #define MESA_EGL_NO_X11_HEADERS
+    #include <EGL/egl.h>
+    #define OUTPUTDEBUGSTRING( str ) fprintf(stderr, "%s", str);
+    #define LOADFUNC( type, name, ret ) \
+        name = (type)eglGetProcAddress(#name); \
         if (name == NULL) {\
             OUTPUTDEBUGSTRING("TGL ... failed to load procedure ");\
             OUTPUTDEBUGSTRING(#name);\
@@ -852,9 +871,27 @@ PFNGLDEBUGMESSAGECALLBACKAMDPROC glDebugMessageCallbackAMD = 0;
 PFNGLGETDEBUGMESSAGELOGAMDPROC glGetDebugMessageLogAMD = 0;
 #endif
 
+/* ARB_bindless_texture */
+#if defined(TGL_DEFINE_ARB_BINDLESS_TEXTURE)
+PFNGLGETTEXTUREHANDLEARBPROC glGetTextureHandleARB = 0;
+PFNGLMAKETEXTUREHANDLERESIDENTARBPROC glMakeTextureHandleResidentARB = 0;
+PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC glMakeTextureHandleNonResidentARB = 0;
+PFNGLISTEXTUREHANDLERESIDENTARBPROC glIsTextureHandleResidentARB = 0;
+#endif
+
+/* KHR_parallel_shader_compile */
+#if defined(TGL_DEFINE_KHR_PARALLEL_SHADER_COMPILE)
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glMaxShaderCompilerThreadsKHR = 0;
+#endif
+
 /* success variables */
 static GLboolean tgl_extensions[TGL_EXTENSION_MAX];
 
+#ifdef TGL_INSTRUMENT
+/* wraps every loaded function, see tgl_instrument.c */
+void _tglInstrumentInit(void);
+#endif
+
 /* callback to display GL debug messages */
 void APIENTRY _tglDebugLog(GLenum source,
                            GLenum type,
@@ -977,6 +1014,22 @@ void APIENTRY _tglDebugLogAMD(GLuint id,
     OUTPUTDEBUGSTRING("\n");
 }
 
+/* checks the extension strings of the current context, glGetStringi must already be loaded */
+static GLboolean _tglIsExtensionSupported(const char* name) {
+    GLint count = 0;
+    GLint i;
+    if (glGetStringi == NULL) {
+        return GL_FALSE;
+    }
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (i=0; i<count; ++i) {
+        if (strcmp((const char*)glGetStringi(GL_EXTENSIONS, (GLuint)i), name) == 0) {
+            return GL_TRUE;
+        }
+    }
+    return GL_FALSE;
+}
+
 void tglInit(void) {
     /* assume all extensions will load successfully */
     int i;
@@ -986,6 +1039,9 @@ void tglInit(void) {
 #ifdef TGL_DEBUG
     /* print driver info */
     /* safe to use glGetString because every platform has the symbol */
+#ifdef TGL_LOAD_LEGACY_GL
+    LOADFUNC(PFNGLGETSTRINGPROC, glGetString, tgl_extensions[TGL_EXTENSION_GL_1_0])
+#endif
     OUTPUTDEBUGSTRING("\nGL vendor: ");
     OUTPUTDEBUGSTRING((const char*)glGetString(GL_VENDOR));
     OUTPUTDEBUGSTRING("\nGL renderer: ");
@@ -1803,6 +1859,30 @@ void tglInit(void) {
         tgl_extensions[TGL_EXTENSION_AMD_DEBUG_OUTPUT] = GL_FALSE;
 #endif
     }
+    /* ARB_bindless_texture */
+    /* procedures may resolve even when the driver lacks the extension so the extension string is checked first */
+#ifdef TGL_DEFINE_ARB_BINDLESS_TEXTURE
+    if (_tglIsExtensionSupported("GL_ARB_bindless_texture")) {
+        LOADFUNC(PFNGLGETTEXTUREHANDLEARBPROC, glGetTextureHandleARB, tgl_extensions[TGL_EXTENSION_ARB_BINDLESS_TEXTURE])
+        LOADFUNC(PFNGLMAKETEXTUREHANDLERESIDENTARBPROC, glMakeTextureHandleResidentARB, tgl_extensions[TGL_EXTENSION_ARB_BINDLESS_TEXTURE])
+        LOADFUNC(PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC, glMakeTextureHandleNonResidentARB, tgl_extensions[TGL_EXTENSION_ARB_BINDLESS_TEXTURE])
+        LOADFUNC(PFNGLISTEXTUREHANDLERESIDENTARBPROC, glIsTextureHandleResidentARB, tgl_extensions[TGL_EXTENSION_ARB_BINDLESS_TEXTURE])
+    } else {
+        tgl_extensions[TGL_EXTENSION_ARB_BINDLESS_TEXTURE] = GL_FALSE;
+    }
+#else
+    tgl_extensions[TGL_EXTENSION_ARB_BINDLESS_TEXTURE] = GL_FALSE;
+#endif
+    /* KHR_parallel_shader_compile */
+#ifdef TGL_DEFINE_KHR_PARALLEL_SHADER_COMPILE
+    if (_tglIsExtensionSupported("GL_KHR_parallel_shader_compile")) {
+        LOADFUNC(PFNGLMAXSHADERCOMPILERTHREADSKHRPROC, glMaxShaderCompilerThreadsKHR, tgl_extensions[TGL_EXTENSION_KHR_PARALLEL_SHADER_COMPILE])
+    } else {
+        tgl_extensions[TGL_EXTENSION_KHR_PARALLEL_SHADER_COMPILE] = GL_FALSE;
+    }
+#else
+    tgl_extensions[TGL_EXTENSION_KHR_PARALLEL_SHADER_COMPILE] = GL_FALSE;
+#endif
 #ifdef TGL_DEBUG
     if (tglIsAvailable(TGL_EXTENSION_ARB_DEBUG_OUTPUT)) {
         glDebugMessageCallbackARB(_tglDebugLog, NULL);
@@ -1831,6 +1911,9 @@ void tglInit(void) {
         OUTPUTDEBUGSTRING("Warning: no GL debug information available from driver\n");
     }
 #endif
+#ifdef TGL_INSTRUMENT
+    _tglInstrumentInit();
+#endif
 }
 
 GLboolean tglIsAvailable(TGLEXTENSION ext) {
@@ -0,0 +1,4436 @@
+/**
+ * @file
+ * @section DESCRIPTION
+ *
+ * TGL instrumentation: an optional layer which is compiled when TGL_INSTRUMENT
+ * is defined. After tglInit has loaded every GL function it replaces each
+ * function pointer with a wrapper which counts calls per entry point, measures
+ * the CPU time spent inside the driver and can record the call stream of a
+ * single frame to a compact binary trace.
+ *
+ * Only the thread which owns the GL context may make GL calls so the counters
+ * are not synchronised.
+ *
+ * The wrappers below are generated from the function tables in tgl.c, any
+ * function added there must also be added here.
+ *
+ * Trace format (native byte order):
+ *   char[4]  "TGLT"
+ *   uint32   version (1)
+ *   uint32   function count
+ *   per function: uint16 name length, name characters (no terminator)
+ *   uint32   record count
+ *   per record: uint16 function, uint32 start (ns from the start of the
+ *               frame), uint32 duration (ns)
+ */
+
+/* clock_gettime is POSIX rather than standard C */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#define TGL_TARGET_GL_4_5
+#include <tgl/tgl.h>
+
+#if defined(TGL_INSTRUMENT)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(TGL_PLATFORM_WIN32)
+    #undef APIENTRY
+    #undef CALLBACK
+    #undef WINGDIAPI
+    #define WIN32_LEAN_AND_MEAN
+    #include <Windows.h>
+#else
+    #include <time.h>
+#endif
+
+/* a single call in the trace */
+typedef struct {
+    unsigned short function;
+    unsigned int start;
+    unsigned int duration;
+} TGLTRACERECORD;
+
+static const char* tgl_function_names[] = {
+    "glCullFace",
+    "glFrontFace",
+    "glHint",
+    "glLineWidth",
+    "glPointSize",
+    "glPolygonMode",
+    "glScissor",
+    "glTexParameterf",
+    "glTexParameterfv",
+    "glTexParameteri",
+    "glTexParameteriv",
+    "glTexImage1D",
+    "glTexImage2D",
+    "glDrawBuffer",
+    "glClear",
+    "glClearColor",
+    "glClearStencil",
+    "glClearDepth",
+    "glStencilMask",
+    "glColorMask",
+    "glDepthMask",
+    "glDisable",
+    "glEnable",
+    "glFinish",
+    "glFlush",
+    "glBlendFunc",
+    "glLogicOp",
+    "glStencilFunc",
+    "glStencilOp",
+    "glDepthFunc",
+    "glPixelStoref",
+    "glPixelStorei",
+    "glReadBuffer",
+    "glReadPixels",
+    "glGetBooleanv",
+    "glGetDoublev",
+    "glGetError",
+    "glGetFloatv",
+    "glGetIntegerv",
+    "glGetString",
+    "glGetTexImage",
+    "glGetTexParameterfv",
+    "glGetTexParameteriv",
+    "glGetTexLevelParameterfv",
+    "glGetTexLevelParameteriv",
+    "glIsEnabled",
+    "glDepthRange",
+    "glViewport",
+    "glDrawArrays",
+    "glDrawElements",
+    "glGetPointerv",
+    "glPolygonOffset",
+    "glCopyTexImage1D",
+    "glCopyTexImage2D",
+    "glCopyTexSubImage1D",
+    "glCopyTexSubImage2D",
+    "glTexSubImage1D",
+    "glTexSubImage2D",
+    "glBindTexture",
+    "glDeleteTextures",
+    "glGenTextures",
+    "glIsTexture",
+    "glBlendColor",
+    "glBlendEquation",
+    "glDrawRangeElements",
+    "glTexImage3D",
+    "glTexSubImage3D",
+    "glCopyTexSubImage3D",
+    "glActiveTexture",
+    "glSampleCoverage",
+    "glCompressedTexImage3D",
+    "glCompressedTexImage2D",
+    "glCompressedTexImage1D",
+    "glCompressedTexSubImage3D",
+    "glCompressedTexSubImage2D",
+    "glCompressedTexSubImage1D",
+    "glGetCompressedTexImage",
+    "glBlendFuncSeparate",
+    "glMultiDrawArrays",
+    "glMultiDrawElements",
+    "glPointParameterf",
+    "glPointParameterfv",
+    "glPointParameteri",
+    "glPointParameteriv",
+    "glGenQueries",
+    "glDeleteQueries",
+    "glIsQuery",
+    "glBeginQuery",
+    "glEndQuery",
+    "glGetQueryiv",
+    "glGetQueryObjectiv",
+    "glGetQueryObjectuiv",
+    "glBindBuffer",
+    "glDeleteBuffers",
+    "glGenBuffers",
+    "glIsBuffer",
+    "glBufferData",
+    "glBufferSubData",
+    "glGetBufferSubData",
+    "glMapBuffer",
+    "glUnmapBuffer",
+    "glGetBufferParameteriv",
+    "glGetBufferPointerv",
+    "glBlendEquationSeparate",
+    "glDrawBuffers",
+    "glStencilOpSeparate",
+    "glStencilFuncSeparate",
+    "glStencilMaskSeparate",
+    "glAttachShader",
+    "glBindAttribLocation",
+    "glCompileShader",
+    "glCreateProgram",
+    "glCreateShader",
+    "glDeleteProgram",
+    "glDeleteShader",
+    "glDetachShader",
+    "glDisableVertexAttribArray",
+    "glEnableVertexAttribArray",
+    "glGetActiveAttrib",
+    "glGetActiveUniform",
+    "glGetAttachedShaders",
+    "glGetAttribLocation",
+    "glGetProgramiv",
+    "glGetProgramInfoLog",
+    "glGetShaderiv",
+    "glGetShaderInfoLog",
+    "glGetShaderSource",
+    "glGetUniformLocation",
+    "glGetUniformfv",
+    "glGetUniformiv",
+    "glGetVertexAttribdv",
+    "glGetVertexAttribfv",
+    "glGetVertexAttribiv",
+    "glGetVertexAttribPointerv",
+    "glIsProgram",
+    "glIsShader",
+    "glLinkProgram",
+    "glShaderSource",
+    "glUseProgram",
+    "glUniform1f",
+    "glUniform2f",
+    "glUniform3f",
+    "glUniform4f",
+    "glUniform1i",
+    "glUniform2i",
+    "glUniform3i",
+    "glUniform4i",
+    "glUniform1fv",
+    "glUniform2fv",
+    "glUniform3fv",
+    "glUniform4fv",
+    "glUniform1iv",
+    "glUniform2iv",
+    "glUniform3iv",
+    "glUniform4iv",
+    "glUniformMatrix2fv",
+    "glUniformMatrix3fv",
+    "glUniformMatrix4fv",
+    "glValidateProgram",
+    "glVertexAttrib1d",
+    "glVertexAttrib1dv",
+    "glVertexAttrib1f",
+    "glVertexAttrib1fv",
+    "glVertexAttrib1s",
+    "glVertexAttrib1sv",
+    "glVertexAttrib2d",
+    "glVertexAttrib2dv",
+    "glVertexAttrib2f",
+    "glVertexAttrib2fv",
+    "glVertexAttrib2s",
+    "glVertexAttrib2sv",
+    "glVertexAttrib3d",
+    "glVertexAttrib3dv",
+    "glVertexAttrib3f",
+    "glVertexAttrib3fv",
+    "glVertexAttrib3s",
+    "glVertexAttrib3sv",
+    "glVertexAttrib4Nbv",
+    "glVertexAttrib4Niv",
+    "glVertexAttrib4Nsv",
+    "glVertexAttrib4Nub",
+    "glVertexAttrib4Nubv",
+    "glVertexAttrib4Nuiv",
+    "glVertexAttrib4Nusv",
+    "glVertexAttrib4bv",
+    "glVertexAttrib4d",
+    "glVertexAttrib4dv",
+    "glVertexAttrib4f",
+    "glVertexAttrib4fv",
+    "glVertexAttrib4iv",
+    "glVertexAttrib4s",
+    "glVertexAttrib4sv",
+    "glVertexAttrib4ubv",
+    "glVertexAttrib4uiv",
+    "glVertexAttrib4usv",
+    "glVertexAttribPointer",
+    "glUniformMatrix2x3fv",
+    "glUniformMatrix3x2fv",
+    "glUniformMatrix2x4fv",
+    "glUniformMatrix4x2fv",
+    "glUniformMatrix3x4fv",
+    "glUniformMatrix4x3fv",
+    "glColorMaski",
+    "glGetBooleani_v",
+    "glGetIntegeri_v",
+    "glEnablei",
+    "glDisablei",
+    "glIsEnabledi",
+    "glBeginTransformFeedback",
+    "glEndTransformFeedback",
+    "glBindBufferRange",
+    "glBindBufferBase",
+    "glTransformFeedbackVaryings",
+    "glGetTransformFeedbackVarying",
+    "glClampColor",
+    "glBeginConditionalRender",
+    "glEndConditionalRender",
+    "glVertexAttribIPointer",
+    "glGetVertexAttribIiv",
+    "glGetVertexAttribIuiv",
+    "glVertexAttribI1i",
+    "glVertexAttribI2i",
+    "glVertexAttribI3i",
+    "glVertexAttribI4i",
+    "glVertexAttribI1ui",
+    "glVertexAttribI2ui",
+    "glVertexAttribI3ui",
+    "glVertexAttribI4ui",
+    "glVertexAttribI1iv",
+    "glVertexAttribI2iv",
+    "glVertexAttribI3iv",
+    "glVertexAttribI4iv",
+    "glVertexAttribI1uiv",
+    "glVertexAttribI2uiv",
+    "glVertexAttribI3uiv",
+    "glVertexAttribI4uiv",
+    "glVertexAttribI4bv",
+    "glVertexAttribI4sv",
+    "glVertexAttribI4ubv",
+    "glVertexAttribI4usv",
+    "glGetUniformuiv",
+    "glBindFragDataLocation",
+    "glGetFragDataLocation",
+    "glUniform1ui",
+    "glUniform2ui",
+    "glUniform3ui",
+    "glUniform4ui",
+    "glUniform1uiv",
+    "glUniform2uiv",
+    "glUniform3uiv",
+    "glUniform4uiv",
+    "glTexParameterIiv",
+    "glTexParameterIuiv",
+    "glGetTexParameterIiv",
+    "glGetTexParameterIuiv",
+    "glClearBufferiv",
+    "glClearBufferuiv",
+    "glClearBufferfv",
+    "glClearBufferfi",
+    "glGetStringi",
+    "glIsRenderbuffer",
+    "glBindRenderbuffer",
+    "glDeleteRenderbuffers",
+    "glGenRenderbuffers",
+    "glRenderbufferStorage",
+    "glGetRenderbufferParameteriv",
+    "glIsFramebuffer",
+    "glBindFramebuffer",
+    "glDeleteFramebuffers",
+    "glGenFramebuffers",
+    "glCheckFramebufferStatus",
+    "glFramebufferTexture1D",
+    "glFramebufferTexture2D",
+    "glFramebufferTexture3D",
+    "glFramebufferRenderbuffer",
+    "glGetFramebufferAttachmentParameteriv",
+    "glGenerateMipmap",
+    "glBlitFramebuffer",
+    "glRenderbufferStorageMultisample",
+    "glFramebufferTextureLayer",
+    "glMapBufferRange",
+    "glFlushMappedBufferRange",
+    "glBindVertexArray",
+    "glDeleteVertexArrays",
+    "glGenVertexArrays",
+    "glIsVertexArray",
+    "glDrawArraysInstanced",
+    "glDrawElementsInstanced",
+    "glTexBuffer",
+    "glPrimitiveRestartIndex",
+    "glCopyBufferSubData",
+    "glGetUniformIndices",
+    "glGetActiveUniformsiv",
+    "glGetActiveUniformName",
+    "glGetUniformBlockIndex",
+    "glGetActiveUniformBlockiv",
+    "glGetActiveUniformBlockName",
+    "glUniformBlockBinding",
+    "glGetInteger64i_v",
+    "glGetBufferParameteri64v",
+    "glFramebufferTexture",
+    "glDrawElementsBaseVertex",
+    "glDrawRangeElementsBaseVertex",
+    "glDrawElementsInstancedBaseVertex",
+    "glMultiDrawElementsBaseVertex",
+    "glProvokingVertex",
+    "glFenceSync",
+    "glIsSync",
+    "glDeleteSync",
+    "glClientWaitSync",
+    "glWaitSync",
+    "glGetInteger64v",
+    "glGetSynciv",
+    "glTexImage2DMultisample",
+    "glTexImage3DMultisample",
+    "glGetMultisamplefv",
+    "glSampleMaski",
+    "glVertexAttribDivisor",
+    "glBindFragDataLocationIndexed",
+    "glGetFragDataIndex",
+    "glGenSamplers",
+    "glDeleteSamplers",
+    "glIsSampler",
+    "glBindSampler",
+    "glSamplerParameteri",
+    "glSamplerParameteriv",
+    "glSamplerParameterf",
+    "glSamplerParameterfv",
+    "glSamplerParameterIiv",
+    "glSamplerParameterIuiv",
+    "glGetSamplerParameteriv",
+    "glGetSamplerParameterIiv",
+    "glGetSamplerParameterfv",
+    "glGetSamplerParameterIuiv",
+    "glQueryCounter",
+    "glGetQueryObjecti64v",
+    "glGetQueryObjectui64v",
+    "glVertexAttribP1ui",
+    "glVertexAttribP1uiv",
+    "glVertexAttribP2ui",
+    "glVertexAttribP2uiv",
+    "glVertexAttribP3ui",
+    "glVertexAttribP3uiv",
+    "glVertexAttribP4ui",
+    "glVertexAttribP4uiv",
+    "glMinSampleShading",
+    "glBlendEquationi",
+    "glBlendEquationSeparatei",
+    "glBlendFunci",
+    "glBlendFuncSeparatei",
+    "glDrawArraysIndirect",
+    "glDrawElementsIndirect",
+    "glUniform1d",
+    "glUniform2d",
+    "glUniform3d",
+    "glUniform4d",
+    "glUniform1dv",
+    "glUniform2dv",
+    "glUniform3dv",
+    "glUniform4dv",
+    "glUniformMatrix2dv",
+    "glUniformMatrix3dv",
+    "glUniformMatrix4dv",
+    "glUniformMatrix2x3dv",
+    "glUniformMatrix2x4dv",
+    "glUniformMatrix3x2dv",
+    "glUniformMatrix3x4dv",
+    "glUniformMatrix4x2dv",
+    "glUniformMatrix4x3dv",
+    "glGetUniformdv",
+    "glGetSubroutineUniformLocation",
+    "glGetSubroutineIndex",
+    "glGetActiveSubroutineUniformiv",
+    "glGetActiveSubroutineUniformName",
+    "glGetActiveSubroutineName",
+    "glUniformSubroutinesuiv",
+    "glGetUniformSubroutineuiv",
+    "glGetProgramStageiv",
+    "glPatchParameteri",
+    "glPatchParameterfv",
+    "glBindTransformFeedback",
+    "glDeleteTransformFeedbacks",
+    "glGenTransformFeedbacks",
+    "glIsTransformFeedback",
+    "glPauseTransformFeedback",
+    "glResumeTransformFeedback",
+    "glDrawTransformFeedback",
+    "glDrawTransformFeedbackStream",
+    "glBeginQueryIndexed",
+    "glEndQueryIndexed",
+    "glGetQueryIndexediv",
+    "glReleaseShaderCompiler",
+    "glShaderBinary",
+    "glGetShaderPrecisionFormat",
+    "glDepthRangef",
+    "glClearDepthf",
+    "glGetProgramBinary",
+    "glProgramBinary",
+    "glProgramParameteri",
+    "glUseProgramStages",
+    "glActiveShaderProgram",
+    "glCreateShaderProgramv",
+    "glBindProgramPipeline",
+    "glDeleteProgramPipelines",
+    "glGenProgramPipelines",
+    "glIsProgramPipeline",
+    "glGetProgramPipelineiv",
+    "glProgramUniform1i",
+    "glProgramUniform1iv",
+    "glProgramUniform1f",
+    "glProgramUniform1fv",
+    "glProgramUniform1d",
+    "glProgramUniform1dv",
+    "glProgramUniform1ui",
+    "glProgramUniform1uiv",
+    "glProgramUniform2i",
+    "glProgramUniform2iv",
+    "glProgramUniform2f",
+    "glProgramUniform2fv",
+    "glProgramUniform2d",
+    "glProgramUniform2dv",
+    "glProgramUniform2ui",
+    "glProgramUniform2uiv",
+    "glProgramUniform3i",
+    "glProgramUniform3iv",
+    "glProgramUniform3f",
+    "glProgramUniform3fv",
+    "glProgramUniform3d",
+    "glProgramUniform3dv",
+    "glProgramUniform3ui",
+    "glProgramUniform3uiv",
+    "glProgramUniform4i",
+    "glProgramUniform4iv",
+    "glProgramUniform4f",
+    "glProgramUniform4fv",
+    "glProgramUniform4d",
+    "glProgramUniform4dv",
+    "glProgramUniform4ui",
+    "glProgramUniform4uiv",
+    "glProgramUniformMatrix2fv",
+    "glProgramUniformMatrix3fv",
+    "glProgramUniformMatrix4fv",
+    "glProgramUniformMatrix2dv",
+    "glProgramUniformMatrix3dv",
+    "glProgramUniformMatrix4dv",
+    "glProgramUniformMatrix2x3fv",
+    "glProgramUniformMatrix3x2fv",
+    "glProgramUniformMatrix2x4fv",
+    "glProgramUniformMatrix4x2fv",
+    "glProgramUniformMatrix3x4fv",
+    "glProgramUniformMatrix4x3fv",
+    "glProgramUniformMatrix2x3dv",
+    "glProgramUniformMatrix3x2dv",
+    "glProgramUniformMatrix2x4dv",
+    "glProgramUniformMatrix4x2dv",
+    "glProgramUniformMatrix3x4dv",
+    "glProgramUniformMatrix4x3dv",
+    "glValidateProgramPipeline",
+    "glGetProgramPipelineInfoLog",
+    "glVertexAttribL1d",
+    "glVertexAttribL2d",
+    "glVertexAttribL3d",
+    "glVertexAttribL4d",
+    "glVertexAttribL1dv",
+    "glVertexAttribL2dv",
+    "glVertexAttribL3dv",
+    "glVertexAttribL4dv",
+    "glVertexAttribLPointer",
+    "glGetVertexAttribLdv",
+    "glViewportArrayv",
+    "glViewportIndexedf",
+    "glViewportIndexedfv",
+    "glScissorArrayv",
+    "glScissorIndexed",
+    "glScissorIndexedv",
+    "glDepthRangeArrayv",
+    "glDepthRangeIndexed",
+    "glGetFloati_v",
+    "glGetDoublei_v",
+    "glDrawArraysInstancedBaseInstance",
+    "glDrawElementsInstancedBaseInstance",
+    "glDrawElementsInstancedBaseVertexBaseInstance",
+    "glGetInternalformativ",
+    "glGetActiveAtomicCounterBufferiv",
+    "glBindImageTexture",
+    "glMemoryBarrier",
+    "glTexStorage1D",
+    "glTexStorage2D",
+    "glTexStorage3D",
+    "glDrawTransformFeedbackInstanced",
+    "glDrawTransformFeedbackStreamInstanced",
+    "glClearBufferData",
+    "glClearBufferSubData",
+    "glDispatchCompute",
+    "glDispatchComputeIndirect",
+    "glCopyImageSubData",
+    "glFramebufferParameteri",
+    "glGetFramebufferParameteriv",
+    "glGetInternalformati64v",
+    "glInvalidateTexSubImage",
+    "glInvalidateTexImage",
+    "glInvalidateBufferSubData",
+    "glInvalidateBufferData",
+    "glInvalidateFramebuffer",
+    "glInvalidateSubFramebuffer",
+    "glMultiDrawArraysIndirect",
+    "glMultiDrawElementsIndirect",
+    "glGetProgramInterfaceiv",
+    "glGetProgramResourceIndex",
+    "glGetProgramResourceName",
+    "glGetProgramResourceiv",
+    "glGetProgramResourceLocation",
+    "glGetProgramResourceLocationIndex",
+    "glShaderStorageBlockBinding",
+    "glTexBufferRange",
+    "glTexStorage2DMultisample",
+    "glTexStorage3DMultisample",
+    "glTextureView",
+    "glBindVertexBuffer",
+    "glVertexAttribFormat",
+    "glVertexAttribIFormat",
+    "glVertexAttribLFormat",
+    "glVertexAttribBinding",
+    "glVertexBindingDivisor",
+    "glDebugMessageControl",
+    "glDebugMessageInsert",
+    "glDebugMessageCallback",
+    "glGetDebugMessageLog",
+    "glPushDebugGroup",
+    "glPopDebugGroup",
+    "glObjectLabel",
+    "glGetObjectLabel",
+    "glObjectPtrLabel",
+    "glGetObjectPtrLabel",
+    "glBufferStorage",
+    "glClearTexImage",
+    "glClearTexSubImage",
+    "glBindBuffersBase",
+    "glBindBuffersRange",
+    "glBindTextures",
+    "glBindSamplers",
+    "glBindImageTextures",
+    "glBindVertexBuffers",
+    "glClipControl",
+    "glCreateTransformFeedbacks",
+    "glTransformFeedbackBufferBase",
+    "glTransformFeedbackBufferRange",
+    "glGetTransformFeedbackiv",
+    "glGetTransformFeedbacki_v",
+    "glGetTransformFeedbacki64_v",
+    "glCreateBuffers",
+    "glNamedBufferStorage",
+    "glNamedBufferData",
+    "glNamedBufferSubData",
+    "glCopyNamedBufferSubData",
+    "glClearNamedBufferData",
+    "glClearNamedBufferSubData",
+    "glMapNamedBuffer",
+    "glMapNamedBufferRange",
+    "glUnmapNamedBuffer",
+    "glFlushMappedNamedBufferRange",
+    "glGetNamedBufferParameteriv",
+    "glGetNamedBufferParameteri64v",
+    "glGetNamedBufferPointerv",
+    "glGetNamedBufferSubData",
+    "glCreateFramebuffers",
+    "glNamedFramebufferRenderbuffer",
+    "glNamedFramebufferParameteri",
+    "glNamedFramebufferTexture",
+    "glNamedFramebufferTextureLayer",
+    "glNamedFramebufferDrawBuffer",
+    "glNamedFramebufferDrawBuffers",
+    "glNamedFramebufferReadBuffer",
+    "glInvalidateNamedFramebufferData",
+    "glInvalidateNamedFramebufferSubData",
+    "glClearNamedFramebufferiv",
+    "glClearNamedFramebufferuiv",
+    "glClearNamedFramebufferfv",
+    "glClearNamedFramebufferfi",
+    "glBlitNamedFramebuffer",
+    "glCheckNamedFramebufferStatus",
+    "glGetNamedFramebufferParameteriv",
+    "glGetNamedFramebufferAttachmentParameteriv",
+    "glCreateRenderbuffers",
+    "glNamedRenderbufferStorage",
+    "glNamedRenderbufferStorageMultisample",
+    "glGetNamedRenderbufferParameteriv",
+    "glCreateTextures",
+    "glTextureBuffer",
+    "glTextureBufferRange",
+    "glTextureStorage1D",
+    "glTextureStorage2D",
+    "glTextureStorage3D",
+    "glTextureStorage2DMultisample",
+    "glTextureStorage3DMultisample",
+    "glTextureSubImage1D",
+    "glTextureSubImage2D",
+    "glTextureSubImage3D",
+    "glCompressedTextureSubImage1D",
+    "glCompressedTextureSubImage2D",
+    "glCompressedTextureSubImage3D",
+    "glCopyTextureSubImage1D",
+    "glCopyTextureSubImage2D",
+    "glTextureParameterf",
+    "glTextureParameterfv",
+    "glTextureParameteri",
+    "glTextureParameterIiv",
+    "glTextureParameterIuiv",
+    "glTextureParameteriv",
+    "glGenerateTextureMipmap",
+    "glBindTextureUnit",
+    "glGetTextureImage",
+    "glGetCompressedTextureImage",
+    "glGetTextureLevelParameterfv",
+    "glGetTextureLevelParameteriv",
+    "glGetTextureParameterfv",
+    "glGetTextureParameterIiv",
+    "glGetTextureParameterIuiv",
+    "glGetTextureParameteriv",
+    "glCreateVertexArrays",
+    "glDisableVertexArrayAttrib",
+    "glEnableVertexArrayAttrib",
+    "glVertexArrayElementBuffer",
+    "glVertexArrayVertexBuffer",
+    "glVertexArrayVertexBuffers",
+    "glVertexArrayAttribBinding",
+    "glVertexArrayAttribFormat",
+    "glVertexArrayAttribIFormat",
+    "glVertexArrayAttribLFormat",
+    "glVertexArrayBindingDivisor",
+    "glGetVertexArrayiv",
+    "glGetVertexArrayIndexediv",
+    "glGetVertexArrayIndexed64iv",
+    "glCreateSamplers",
+    "glCreateProgramPipelines",
+    "glCreateQueries",
+    "glGetQueryBufferObjecti64v",
+    "glGetQueryBufferObjectiv",
+    "glGetQueryBufferObjectui64v",
+    "glGetQueryBufferObjectuiv",
+    "glMemoryBarrierByRegion",
+    "glGetTextureSubImage",
+    "glGetCompressedTextureSubImage",
+    "glGetGraphicsResetStatus",
+    "glGetnCompressedTexImage",
+    "glGetnTexImage",
+    "glGetnUniformdv",
+    "glGetnUniformfv",
+    "glGetnUniformiv",
+    "glGetnUniformuiv",
+    "glReadnPixels",
+    "glTextureBarrier",
+    "glDebugMessageControlARB",
+    "glDebugMessageInsertARB",
+    "glDebugMessageCallbackARB",
+    "glGetDebugMessageLogARB",
+    "glDebugMessageEnableAMD",
+    "glDebugMessageInsertAMD",
+    "glDebugMessageCallbackAMD",
+    "glGetDebugMessageLogAMD",
+    "glGetTextureHandleARB",
+    "glMakeTextureHandleResidentARB",
+    "glMakeTextureHandleNonResidentARB",
+    "glIsTextureHandleResidentARB",
+    "glMaxShaderCompilerThreadsKHR",};
+
+#define TGL_FUNCTION_COUNT (sizeof(tgl_function_names) / sizeof(tgl_function_names[0]))
+
+/* counters for the frame being recorded and the last completed frame */
+static unsigned int tgl_calls[TGL_FUNCTION_COUNT];
+static unsigned long long tgl_time[TGL_FUNCTION_COUNT];
+static unsigned int tgl_last_calls[TGL_FUNCTION_COUNT];
+static unsigned long long tgl_last_time[TGL_FUNCTION_COUNT];
+
+/* trace state, a trace is armed during one frame and recorded during the next */
+static char tgl_trace_file[260];
+static int tgl_trace_armed = 0;
+static int tgl_trace_recording = 0;
+static unsigned long long tgl_trace_start = 0;
+static TGLTRACERECORD* tgl_trace_records = NULL;
+static size_t tgl_trace_count = 0;
+static size_t tgl_trace_capacity = 0;
+
+/* current CPU time in nanoseconds */
+static unsigned long long _tglNow(void) {
+#if defined(TGL_PLATFORM_WIN32)
+    static LARGE_INTEGER frequency = { 0 };
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    return (unsigned long long)(counter.QuadPart / frequency.QuadPart) * 1000000000ULL
+        + (unsigned long long)(counter.QuadPart % frequency.QuadPart) * 1000000000ULL / frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec;
+#endif
+}
+
+/* accumulate a completed call */
+static void _tglRecord(unsigned int function, unsigned long long start, unsigned long long end) {
+    ++tgl_calls[function];
+    tgl_time[function] += end - start;
+    if (tgl_trace_recording) {
+        if (tgl_trace_count == tgl_trace_capacity) {
+            size_t capacity = tgl_trace_capacity ? tgl_trace_capacity * 2 : 4096;
+            TGLTRACERECORD* records = (TGLTRACERECORD*)realloc(tgl_trace_records, capacity * sizeof(TGLTRACERECORD));
+            if (records == NULL) {
+                return;
+            }
+            tgl_trace_records = records;
+            tgl_trace_capacity = capacity;
+        }
+        tgl_trace_records[tgl_trace_count].function = (unsigned short)function;
+        tgl_trace_records[tgl_trace_count].start = (unsigned int)(start - tgl_trace_start);
+        tgl_trace_records[tgl_trace_count].duration = (unsigned int)(end - start);
+        ++tgl_trace_count;
+    }
+}
+
+/* write the recorded call stream to the requested file */
+static GLboolean _tglWriteTrace(void) {
+    const unsigned int version = 1;
+    const unsigned int functions = (unsigned int)TGL_FUNCTION_COUNT;
+    const unsigned int records = (unsigned int)tgl_trace_count;
+    unsigned int i;
+    FILE* file = fopen(tgl_trace_file, "wb");
+    if (file == NULL) {
+        return GL_FALSE;
+    }
+    fwrite("TGLT", 1, 4, file);
+    fwrite(&version, sizeof(version), 1, file);
+    fwrite(&functions, sizeof(functions), 1, file);
+    for (i=0; i<functions; ++i) {
+        const unsigned short length = (unsigned short)strlen(tgl_function_names[i]);
+        fwrite(&length, sizeof(length), 1, file);
+        fwrite(tgl_function_names[i], 1, length, file);
+    }
+    fwrite(&records, sizeof(records), 1, file);
+    for (i=0; i<records; ++i) {
+        fwrite(&tgl_trace_records[i].function, sizeof(unsigned short), 1, file);
+        fwrite(&tgl_trace_records[i].start, sizeof(unsigned int), 1, file);
+        fwrite(&tgl_trace_records[i].duration, sizeof(unsigned int), 1, file);
+    }
+    return fclose(file) == 0 ? GL_TRUE : GL_FALSE;
+}
+
+#define TGL_CALL( function, call ) \
+    const unsigned long long start = _tglNow(); \
+    call; \
+    _tglRecord(function, start, _tglNow());
+
+/* GL_version_1_0 */
+#if defined(TGL_DEFINE_CORE_GL_1_0)
+static PFNGLCULLFACEPROC tgl_real_glCullFace = 0;
+static void APIENTRY tgl_wrap_glCullFace(GLenum p0) {
+    TGL_CALL(0, tgl_real_glCullFace(p0));
+}
+static PFNGLFRONTFACEPROC tgl_real_glFrontFace = 0;
+static void APIENTRY tgl_wrap_glFrontFace(GLenum p0) {
+    TGL_CALL(1, tgl_real_glFrontFace(p0));
+}
+static PFNGLHINTPROC tgl_real_glHint = 0;
+static void APIENTRY tgl_wrap_glHint(GLenum p0, GLenum p1) {
+    TGL_CALL(2, tgl_real_glHint(p0, p1));
+}
+static PFNGLLINEWIDTHPROC tgl_real_glLineWidth = 0;
+static void APIENTRY tgl_wrap_glLineWidth(GLfloat p0) {
+    TGL_CALL(3, tgl_real_glLineWidth(p0));
+}
+static PFNGLPOINTSIZEPROC tgl_real_glPointSize = 0;
+static void APIENTRY tgl_wrap_glPointSize(GLfloat p0) {
+    TGL_CALL(4, tgl_real_glPointSize(p0));
+}
+static PFNGLPOLYGONMODEPROC tgl_real_glPolygonMode = 0;
+static void APIENTRY tgl_wrap_glPolygonMode(GLenum p0, GLenum p1) {
+    TGL_CALL(5, tgl_real_glPolygonMode(p0, p1));
+}
+static PFNGLSCISSORPROC tgl_real_glScissor = 0;
+static void APIENTRY tgl_wrap_glScissor(GLint p0, GLint p1, GLsizei p2, GLsizei p3) {
+    TGL_CALL(6, tgl_real_glScissor(p0, p1, p2, p3));
+}
+static PFNGLTEXPARAMETERFPROC tgl_real_glTexParameterf = 0;
+static void APIENTRY tgl_wrap_glTexParameterf(GLenum p0, GLenum p1, GLfloat p2) {
+    TGL_CALL(7, tgl_real_glTexParameterf(p0, p1, p2));
+}
+static PFNGLTEXPARAMETERFVPROC tgl_real_glTexParameterfv = 0;
+static void APIENTRY tgl_wrap_glTexParameterfv(GLenum p0, GLenum p1, const GLfloat *p2) {
+    TGL_CALL(8, tgl_real_glTexParameterfv(p0, p1, p2));
+}
+static PFNGLTEXPARAMETERIPROC tgl_real_glTexParameteri = 0;
+static void APIENTRY tgl_wrap_glTexParameteri(GLenum p0, GLenum p1, GLint p2) {
+    TGL_CALL(9, tgl_real_glTexParameteri(p0, p1, p2));
+}
+static PFNGLTEXPARAMETERIVPROC tgl_real_glTexParameteriv = 0;
+static void APIENTRY tgl_wrap_glTexParameteriv(GLenum p0, GLenum p1, const GLint *p2) {
+    TGL_CALL(10, tgl_real_glTexParameteriv(p0, p1, p2));
+}
+static PFNGLTEXIMAGE1DPROC tgl_real_glTexImage1D = 0;
+static void APIENTRY tgl_wrap_glTexImage1D(GLenum p0, GLint p1, GLint p2, GLsizei p3, GLint p4, GLenum p5, GLenum p6, const void *p7) {
+    TGL_CALL(11, tgl_real_glTexImage1D(p0, p1, p2, p3, p4, p5, p6, p7));
+}
+static PFNGLTEXIMAGE2DPROC tgl_real_glTexImage2D = 0;
+static void APIENTRY tgl_wrap_glTexImage2D(GLenum p0, GLint p1, GLint p2, GLsizei p3, GLsizei p4, GLint p5, GLenum p6, GLenum p7, const void *p8) {
+    TGL_CALL(12, tgl_real_glTexImage2D(p0, p1, p2, p3, p4, p5, p6, p7, p8));
+}
+static PFNGLDRAWBUFFERPROC tgl_real_glDrawBuffer = 0;
+static void APIENTRY tgl_wrap_glDrawBuffer(GLenum p0) {
+    TGL_CALL(13, tgl_real_glDrawBuffer(p0));
+}
+static PFNGLCLEARPROC tgl_real_glClear = 0;
+static void APIENTRY tgl_wrap_glClear(GLbitfield p0) {
+    TGL_CALL(14, tgl_real_glClear(p0));
+}
+static PFNGLCLEARCOLORPROC tgl_real_glClearColor = 0;
+static void APIENTRY tgl_wrap_glClearColor(GLfloat p0, GLfloat p1, GLfloat p2, GLfloat p3) {
+    TGL_CALL(15, tgl_real_glClearColor(p0, p1, p2, p3));
+}
+static PFNGLCLEARSTENCILPROC tgl_real_glClearStencil = 0;
+static void APIENTRY tgl_wrap_glClearStencil(GLint p0) {
+    TGL_CALL(16, tgl_real_glClearStencil(p0));
+}
+static PFNGLCLEARDEPTHPROC tgl_real_glClearDepth = 0;
+static void APIENTRY tgl_wrap_glClearDepth(GLdouble p0) {
+    TGL_CALL(17, tgl_real_glClearDepth(p0));
+}
+static PFNGLSTENCILMASKPROC tgl_real_glStencilMask = 0;
+static void APIENTRY tgl_wrap_glStencilMask(GLuint p0) {
+    TGL_CALL(18, tgl_real_glStencilMask(p0));
+}
+static PFNGLCOLORMASKPROC tgl_real_glColorMask = 0;
+static void APIENTRY tgl_wrap_glColorMask(GLboolean p0, GLboolean p1, GLboolean p2, GLboolean p3) {
+    TGL_CALL(19, tgl_real_glColorMask(p0, p1, p2, p3));
+}
+static PFNGLDEPTHMASKPROC tgl_real_glDepthMask = 0;
+static void APIENTRY tgl_wrap_glDepthMask(GLboolean p0) {
+    TGL_CALL(20, tgl_real_glDepthMask(p0));
+}
+static PFNGLDISABLEPROC tgl_real_glDisable = 0;
+static void APIENTRY tgl_wrap_glDisable(GLenum p0) {
+    TGL_CALL(21, tgl_real_glDisable(p0));
+}
+static PFNGLENABLEPROC tgl_real_glEnable = 0;
+static void APIENTRY tgl_wrap_glEnable(GLenum p0) {
+    TGL_CALL(22, tgl_real_glEnable(p0));
+}
+static PFNGLFINISHPROC tgl_real_glFinish = 0;
+static void APIENTRY tgl_wrap_glFinish(void) {
+    TGL_CALL(23, tgl_real_glFinish());
+}
+static PFNGLFLUSHPROC tgl_real_glFlush = 0;
+static void APIENTRY tgl_wrap_glFlush(void) {
+    TGL_CALL(24, tgl_real_glFlush());
+}
+static PFNGLBLENDFUNCPROC tgl_real_glBlendFunc = 0;
+static void APIENTRY tgl_wrap_glBlendFunc(GLenum p0, GLenum p1) {
+    TGL_CALL(25, tgl_real_glBlendFunc(p0, p1));
+}
+static PFNGLLOGICOPPROC tgl_real_glLogicOp = 0;
+static void APIENTRY tgl_wrap_glLogicOp(GLenum p0) {
+    TGL_CALL(26, tgl_real_glLogicOp(p0));
+}
+static PFNGLSTENCILFUNCPROC tgl_real_glStencilFunc = 0;
+static void APIENTRY tgl_wrap_glStencilFunc(GLenum p0, GLint p1, GLuint p2) {
+    TGL_CALL(27, tgl_real_glStencilFunc(p0, p1, p2));
+}
+static PFNGLSTENCILOPPROC tgl_real_glStencilOp = 0;
+static void APIENTRY tgl_wrap_glStencilOp(GLenum p0, GLenum p1, GLenum p2) {
+    TGL_CALL(28, tgl_real_glStencilOp(p0, p1, p2));
+}
+static PFNGLDEPTHFUNCPROC tgl_real_glDepthFunc = 0;
+static void APIENTRY tgl_wrap_glDepthFunc(GLenum p0) {
+    TGL_CALL(29, tgl_real_glDepthFunc(p0));
+}
+static PFNGLPIXELSTOREFPROC tgl_real_glPixelStoref = 0;
+static void APIENTRY tgl_wrap_glPixelStoref(GLenum p0, GLfloat p1) {
+    TGL_CALL(30, tgl_real_glPixelStoref(p0, p1));
+}
+static PFNGLPIXELSTOREIPROC tgl_real_glPixelStorei = 0;
+static void APIENTRY tgl_wrap_glPixelStorei(GLenum p0, GLint p1) {
+    TGL_CALL(31, tgl_real_glPixelStorei(p0, p1));
+}
+static PFNGLREADBUFFERPROC tgl_real_glReadBuffer = 0;
+static void APIENTRY tgl_wrap_glReadBuffer(GLenum p0) {
+    TGL_CALL(32, tgl_real_glReadBuffer(p0));
+}
+static PFNGLREADPIXELSPROC tgl_real_glReadPixels = 0;
+static void APIENTRY tgl_wrap_glReadPixels(GLint p0, GLint p1, GLsizei p2, GLsizei p3, GLenum p4, GLenum p5, void *p6) {
+    TGL_CALL(33, tgl_real_glReadPixels(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLGETBOOLEANVPROC tgl_real_glGetBooleanv = 0;
+static void APIENTRY tgl_wrap_glGetBooleanv(GLenum p0, GLboolean *p1) {
+    TGL_CALL(34, tgl_real_glGetBooleanv(p0, p1));
+}
+static PFNGLGETDOUBLEVPROC tgl_real_glGetDoublev = 0;
+static void APIENTRY tgl_wrap_glGetDoublev(GLenum p0, GLdouble *p1) {
+    TGL_CALL(35, tgl_real_glGetDoublev(p0, p1));
+}
+static PFNGLGETERRORPROC tgl_real_glGetError = 0;
+static GLenum APIENTRY tgl_wrap_glGetError(void) {
+    GLenum result;
+    TGL_CALL(36, result = tgl_real_glGetError());
+    return result;
+}
+static PFNGLGETFLOATVPROC tgl_real_glGetFloatv = 0;
+static void APIENTRY tgl_wrap_glGetFloatv(GLenum p0, GLfloat *p1) {
+    TGL_CALL(37, tgl_real_glGetFloatv(p0, p1));
+}
+static PFNGLGETINTEGERVPROC tgl_real_glGetIntegerv = 0;
+static void APIENTRY tgl_wrap_glGetIntegerv(GLenum p0, GLint *p1) {
+    TGL_CALL(38, tgl_real_glGetIntegerv(p0, p1));
+}
+static PFNGLGETSTRINGPROC tgl_real_glGetString = 0;
+static const GLubyte *APIENTRY tgl_wrap_glGetString(GLenum p0) {
+    const GLubyte *result;
+    TGL_CALL(39, result = tgl_real_glGetString(p0));
+    return result;
+}
+static PFNGLGETTEXIMAGEPROC tgl_real_glGetTexImage = 0;
+static void APIENTRY tgl_wrap_glGetTexImage(GLenum p0, GLint p1, GLenum p2, GLenum p3, void *p4) {
+    TGL_CALL(40, tgl_real_glGetTexImage(p0, p1, p2, p3, p4));
+}
+static PFNGLGETTEXPARAMETERFVPROC tgl_real_glGetTexParameterfv = 0;
+static void APIENTRY tgl_wrap_glGetTexParameterfv(GLenum p0, GLenum p1, GLfloat *p2) {
+    TGL_CALL(41, tgl_real_glGetTexParameterfv(p0, p1, p2));
+}
+static PFNGLGETTEXPARAMETERIVPROC tgl_real_glGetTexParameteriv = 0;
+static void APIENTRY tgl_wrap_glGetTexParameteriv(GLenum p0, GLenum p1, GLint *p2) {
+    TGL_CALL(42, tgl_real_glGetTexParameteriv(p0, p1, p2));
+}
+static PFNGLGETTEXLEVELPARAMETERFVPROC tgl_real_glGetTexLevelParameterfv = 0;
+static void APIENTRY tgl_wrap_glGetTexLevelParameterfv(GLenum p0, GLint p1, GLenum p2, GLfloat *p3) {
+    TGL_CALL(43, tgl_real_glGetTexLevelParameterfv(p0, p1, p2, p3));
+}
+static PFNGLGETTEXLEVELPARAMETERIVPROC tgl_real_glGetTexLevelParameteriv = 0;
+static void APIENTRY tgl_wrap_glGetTexLevelParameteriv(GLenum p0, GLint p1, GLenum p2, GLint *p3) {
+    TGL_CALL(44, tgl_real_glGetTexLevelParameteriv(p0, p1, p2, p3));
+}
+static PFNGLISENABLEDPROC tgl_real_glIsEnabled = 0;
+static GLboolean APIENTRY tgl_wrap_glIsEnabled(GLenum p0) {
+    GLboolean result;
+    TGL_CALL(45, result = tgl_real_glIsEnabled(p0));
+    return result;
+}
+static PFNGLDEPTHRANGEPROC tgl_real_glDepthRange = 0;
+static void APIENTRY tgl_wrap_glDepthRange(GLdouble p0, GLdouble p1) {
+    TGL_CALL(46, tgl_real_glDepthRange(p0, p1));
+}
+static PFNGLVIEWPORTPROC tgl_real_glViewport = 0;
+static void APIENTRY tgl_wrap_glViewport(GLint p0, GLint p1, GLsizei p2, GLsizei p3) {
+    TGL_CALL(47, tgl_real_glViewport(p0, p1, p2, p3));
+}
+#endif
+
+/* GL_version_1_1 */
+#if defined(TGL_DEFINE_CORE_GL_1_1)
+static PFNGLDRAWARRAYSPROC tgl_real_glDrawArrays = 0;
+static void APIENTRY tgl_wrap_glDrawArrays(GLenum p0, GLint p1, GLsizei p2) {
+    TGL_CALL(48, tgl_real_glDrawArrays(p0, p1, p2));
+}
+static PFNGLDRAWELEMENTSPROC tgl_real_glDrawElements = 0;
+static void APIENTRY tgl_wrap_glDrawElements(GLenum p0, GLsizei p1, GLenum p2, const void *p3) {
+    TGL_CALL(49, tgl_real_glDrawElements(p0, p1, p2, p3));
+}
+static PFNGLGETPOINTERVPROC tgl_real_glGetPointerv = 0;
+static void APIENTRY tgl_wrap_glGetPointerv(GLenum p0, void **p1) {
+    TGL_CALL(50, tgl_real_glGetPointerv(p0, p1));
+}
+static PFNGLPOLYGONOFFSETPROC tgl_real_glPolygonOffset = 0;
+static void APIENTRY tgl_wrap_glPolygonOffset(GLfloat p0, GLfloat p1) {
+    TGL_CALL(51, tgl_real_glPolygonOffset(p0, p1));
+}
+static PFNGLCOPYTEXIMAGE1DPROC tgl_real_glCopyTexImage1D = 0;
+static void APIENTRY tgl_wrap_glCopyTexImage1D(GLenum p0, GLint p1, GLenum p2, GLint p3, GLint p4, GLsizei p5, GLint p6) {
+    TGL_CALL(52, tgl_real_glCopyTexImage1D(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLCOPYTEXIMAGE2DPROC tgl_real_glCopyTexImage2D = 0;
+static void APIENTRY tgl_wrap_glCopyTexImage2D(GLenum p0, GLint p1, GLenum p2, GLint p3, GLint p4, GLsizei p5, GLsizei p6, GLint p7) {
+    TGL_CALL(53, tgl_real_glCopyTexImage2D(p0, p1, p2, p3, p4, p5, p6, p7));
+}
+static PFNGLCOPYTEXSUBIMAGE1DPROC tgl_real_glCopyTexSubImage1D = 0;
+static void APIENTRY tgl_wrap_glCopyTexSubImage1D(GLenum p0, GLint p1, GLint p2, GLint p3, GLint p4, GLsizei p5) {
+    TGL_CALL(54, tgl_real_glCopyTexSubImage1D(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLCOPYTEXSUBIMAGE2DPROC tgl_real_glCopyTexSubImage2D = 0;
+static void APIENTRY tgl_wrap_glCopyTexSubImage2D(GLenum p0, GLint p1, GLint p2, GLint p3, GLint p4, GLint p5, GLsizei p6, GLsizei p7) {
+    TGL_CALL(55, tgl_real_glCopyTexSubImage2D(p0, p1, p2, p3, p4, p5, p6, p7));
+}
+static PFNGLTEXSUBIMAGE1DPROC tgl_real_glTexSubImage1D = 0;
+static void APIENTRY tgl_wrap_glTexSubImage1D(GLenum p0, GLint p1, GLint p2, GLsizei p3, GLenum p4, GLenum p5, const void *p6) {
+    TGL_CALL(56, tgl_real_glTexSubImage1D(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLTEXSUBIMAGE2DPROC tgl_real_glTexSubImage2D = 0;
+static void APIENTRY tgl_wrap_glTexSubImage2D(GLenum p0, GLint p1, GLint p2, GLint p3, GLsizei p4, GLsizei p5, GLenum p6, GLenum p7, const void *p8) {
+    TGL_CALL(57, tgl_real_glTexSubImage2D(p0, p1, p2, p3, p4, p5, p6, p7, p8));
+}
+static PFNGLBINDTEXTUREPROC tgl_real_glBindTexture = 0;
+static void APIENTRY tgl_wrap_glBindTexture(GLenum p0, GLuint p1) {
+    TGL_CALL(58, tgl_real_glBindTexture(p0, p1));
+}
+static PFNGLDELETETEXTURESPROC tgl_real_glDeleteTextures = 0;
+static void APIENTRY tgl_wrap_glDeleteTextures(GLsizei p0, const GLuint *p1) {
+    TGL_CALL(59, tgl_real_glDeleteTextures(p0, p1));
+}
+static PFNGLGENTEXTURESPROC tgl_real_glGenTextures = 0;
+static void APIENTRY tgl_wrap_glGenTextures(GLsizei p0, GLuint *p1) {
+    TGL_CALL(60, tgl_real_glGenTextures(p0, p1));
+}
+static PFNGLISTEXTUREPROC tgl_real_glIsTexture = 0;
+static GLboolean APIENTRY tgl_wrap_glIsTexture(GLuint p0) {
+    GLboolean result;
+    TGL_CALL(61, result = tgl_real_glIsTexture(p0));
+    return result;
+}
+#endif
+
+/* GL_version_1_2 */
+#if defined(TGL_DEFINE_CORE_GL_1_2)
+static PFNGLBLENDCOLORPROC tgl_real_glBlendColor = 0;
+static void APIENTRY tgl_wrap_glBlendColor(GLfloat p0, GLfloat p1, GLfloat p2, GLfloat p3) {
+    TGL_CALL(62, tgl_real_glBlendColor(p0, p1, p2, p3));
+}
+static PFNGLBLENDEQUATIONPROC tgl_real_glBlendEquation = 0;
+static void APIENTRY tgl_wrap_glBlendEquation(GLenum p0) {
+    TGL_CALL(63, tgl_real_glBlendEquation(p0));
+}
+static PFNGLDRAWRANGEELEMENTSPROC tgl_real_glDrawRangeElements = 0;
+static void APIENTRY tgl_wrap_glDrawRangeElements(GLenum p0, GLuint p1, GLuint p2, GLsizei p3, GLenum p4, const void *p5) {
+    TGL_CALL(64, tgl_real_glDrawRangeElements(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLTEXIMAGE3DPROC tgl_real_glTexImage3D = 0;
+static void APIENTRY tgl_wrap_glTexImage3D(GLenum p0, GLint p1, GLint p2, GLsizei p3, GLsizei p4, GLsizei p5, GLint p6, GLenum p7, GLenum p8, const void *p9) {
+    TGL_CALL(65, tgl_real_glTexImage3D(p0, p1, p2, p3, p4, p5, p6, p7, p8, p9));
+}
+static PFNGLTEXSUBIMAGE3DPROC tgl_real_glTexSubImage3D = 0;
+static void APIENTRY tgl_wrap_glTexSubImage3D(GLenum p0, GLint p1, GLint p2, GLint p3, GLint p4, GLsizei p5, GLsizei p6, GLsizei p7, GLenum p8, GLenum p9, const void *p10) {
+    TGL_CALL(66, tgl_real_glTexSubImage3D(p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10));
+}
+static PFNGLCOPYTEXSUBIMAGE3DPROC tgl_real_glCopyTexSubImage3D = 0;
+static void APIENTRY tgl_wrap_glCopyTexSubImage3D(GLenum p0, GLint p1, GLint p2, GLint p3, GLint p4, GLint p5, GLint p6, GLsizei p7, GLsizei p8) {
+    TGL_CALL(67, tgl_real_glCopyTexSubImage3D(p0, p1, p2, p3, p4, p5, p6, p7, p8));
+}
+#endif
+
+/* GL_version_1_3 */
+#if defined(TGL_DEFINE_CORE_GL_1_3)
+static PFNGLACTIVETEXTUREPROC tgl_real_glActiveTexture = 0;
+static void APIENTRY tgl_wrap_glActiveTexture(GLenum p0) {
+    TGL_CALL(68, tgl_real_glActiveTexture(p0));
+}
+static PFNGLSAMPLECOVERAGEPROC tgl_real_glSampleCoverage = 0;
+static void APIENTRY tgl_wrap_glSampleCoverage(GLfloat p0, GLboolean p1) {
+    TGL_CALL(69, tgl_real_glSampleCoverage(p0, p1));
+}
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC tgl_real_glCompressedTexImage3D = 0;
+static void APIENTRY tgl_wrap_glCompressedTexImage3D(GLenum p0, GLint p1, GLenum p2, GLsizei p3, GLsizei p4, GLsizei p5, GLint p6, GLsizei p7, const void *p8) {
+    TGL_CALL(70, tgl_real_glCompressedTexImage3D(p0, p1, p2, p3, p4, p5, p6, p7, p8));
+}
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC tgl_real_glCompressedTexImage2D = 0;
+static void APIENTRY tgl_wrap_glCompressedTexImage2D(GLenum p0, GLint p1, GLenum p2, GLsizei p3, GLsizei p4, GLint p5, GLsizei p6, const void *p7) {
+    TGL_CALL(71, tgl_real_glCompressedTexImage2D(p0, p1, p2, p3, p4, p5, p6, p7));
+}
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC tgl_real_glCompressedTexImage1D = 0;
+static void APIENTRY tgl_wrap_glCompressedTexImage1D(GLenum p0, GLint p1, GLenum p2, GLsizei p3, GLint p4, GLsizei p5, const void *p6) {
+    TGL_CALL(72, tgl_real_glCompressedTexImage1D(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC tgl_real_glCompressedTexSubImage3D = 0;
+static void APIENTRY tgl_wrap_glCompressedTexSubImage3D(GLenum p0, GLint p1, GLint p2, GLint p3, GLint p4, GLsizei p5, GLsizei p6, GLsizei p7, GLenum p8, GLsizei p9, const void *p10) {
+    TGL_CALL(73, tgl_real_glCompressedTexSubImage3D(p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10));
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC tgl_real_glCompressedTexSubImage2D = 0;
+static void APIENTRY tgl_wrap_glCompressedTexSubImage2D(GLenum p0, GLint p1, GLint p2, GLint p3, GLsizei p4, GLsizei p5, GLenum p6, GLsizei p7, const void *p8) {
+    TGL_CALL(74, tgl_real_glCompressedTexSubImage2D(p0, p1, p2, p3, p4, p5, p6, p7, p8));
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC tgl_real_glCompressedTexSubImage1D = 0;
+static void APIENTRY tgl_wrap_glCompressedTexSubImage1D(GLenum p0, GLint p1, GLint p2, GLsizei p3, GLenum p4, GLsizei p5, const void *p6) {
+    TGL_CALL(75, tgl_real_glCompressedTexSubImage1D(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC tgl_real_glGetCompressedTexImage = 0;
+static void APIENTRY tgl_wrap_glGetCompressedTexImage(GLenum p0, GLint p1, void *p2) {
+    TGL_CALL(76, tgl_real_glGetCompressedTexImage(p0, p1, p2));
+}
+#endif
+
+/* GL_version_1_4 */
+#if defined(TGL_DEFINE_CORE_GL_1_4)
+static PFNGLBLENDFUNCSEPARATEPROC tgl_real_glBlendFuncSeparate = 0;
+static void APIENTRY tgl_wrap_glBlendFuncSeparate(GLenum p0, GLenum p1, GLenum p2, GLenum p3) {
+    TGL_CALL(77, tgl_real_glBlendFuncSeparate(p0, p1, p2, p3));
+}
+static PFNGLMULTIDRAWARRAYSPROC tgl_real_glMultiDrawArrays = 0;
+static void APIENTRY tgl_wrap_glMultiDrawArrays(GLenum p0, const GLint *p1, const GLsizei *p2, GLsizei p3) {
+    TGL_CALL(78, tgl_real_glMultiDrawArrays(p0, p1, p2, p3));
+}
+static PFNGLMULTIDRAWELEMENTSPROC tgl_real_glMultiDrawElements = 0;
+static void APIENTRY tgl_wrap_glMultiDrawElements(GLenum p0, const GLsizei *p1, GLenum p2, const void *const*p3, GLsizei p4) {
+    TGL_CALL(79, tgl_real_glMultiDrawElements(p0, p1, p2, p3, p4));
+}
+static PFNGLPOINTPARAMETERFPROC tgl_real_glPointParameterf = 0;
+static void APIENTRY tgl_wrap_glPointParameterf(GLenum p0, GLfloat p1) {
+    TGL_CALL(80, tgl_real_glPointParameterf(p0, p1));
+}
+static PFNGLPOINTPARAMETERFVPROC tgl_real_glPointParameterfv = 0;
+static void APIENTRY tgl_wrap_glPointParameterfv(GLenum p0, const GLfloat *p1) {
+    TGL_CALL(81, tgl_real_glPointParameterfv(p0, p1));
+}
+static PFNGLPOINTPARAMETERIPROC tgl_real_glPointParameteri = 0;
+static void APIENTRY tgl_wrap_glPointParameteri(GLenum p0, GLint p1) {
+    TGL_CALL(82, tgl_real_glPointParameteri(p0, p1));
+}
+static PFNGLPOINTPARAMETERIVPROC tgl_real_glPointParameteriv = 0;
+static void APIENTRY tgl_wrap_glPointParameteriv(GLenum p0, const GLint *p1) {
+    TGL_CALL(83, tgl_real_glPointParameteriv(p0, p1));
+}
+#endif
+
+/* GL_version_1_5 */
+#if defined(TGL_DEFINE_CORE_GL_1_5)
+static PFNGLGENQUERIESPROC tgl_real_glGenQueries = 0;
+static void APIENTRY tgl_wrap_glGenQueries(GLsizei p0, GLuint *p1) {
+    TGL_CALL(84, tgl_real_glGenQueries(p0, p1));
+}
+static PFNGLDELETEQUERIESPROC tgl_real_glDeleteQueries = 0;
+static void APIENTRY tgl_wrap_glDeleteQueries(GLsizei p0, const GLuint *p1) {
+    TGL_CALL(85, tgl_real_glDeleteQueries(p0, p1));
+}
+static PFNGLISQUERYPROC tgl_real_glIsQuery = 0;
+static GLboolean APIENTRY tgl_wrap_glIsQuery(GLuint p0) {
+    GLboolean result;
+    TGL_CALL(86, result = tgl_real_glIsQuery(p0));
+    return result;
+}
+static PFNGLBEGINQUERYPROC tgl_real_glBeginQuery = 0;
+static void APIENTRY tgl_wrap_glBeginQuery(GLenum p0, GLuint p1) {
+    TGL_CALL(87, tgl_real_glBeginQuery(p0, p1));
+}
+static PFNGLENDQUERYPROC tgl_real_glEndQuery = 0;
+static void APIENTRY tgl_wrap_glEndQuery(GLenum p0) {
+    TGL_CALL(88, tgl_real_glEndQuery(p0));
+}
+static PFNGLGETQUERYIVPROC tgl_real_glGetQueryiv = 0;
+static void APIENTRY tgl_wrap_glGetQueryiv(GLenum p0, GLenum p1, GLint *p2) {
+    TGL_CALL(89, tgl_real_glGetQueryiv(p0, p1, p2));
+}
+static PFNGLGETQUERYOBJECTIVPROC tgl_real_glGetQueryObjectiv = 0;
+static void APIENTRY tgl_wrap_glGetQueryObjectiv(GLuint p0, GLenum p1, GLint *p2) {
+    TGL_CALL(90, tgl_real_glGetQueryObjectiv(p0, p1, p2));
+}
+static PFNGLGETQUERYOBJECTUIVPROC tgl_real_glGetQueryObjectuiv = 0;
+static void APIENTRY tgl_wrap_glGetQueryObjectuiv(GLuint p0, GLenum p1, GLuint *p2) {
+    TGL_CALL(91, tgl_real_glGetQueryObjectuiv(p0, p1, p2));
+}
+static PFNGLBINDBUFFERPROC tgl_real_glBindBuffer = 0;
+static void APIENTRY tgl_wrap_glBindBuffer(GLenum p0, GLuint p1) {
+    TGL_CALL(92, tgl_real_glBindBuffer(p0, p1));
+}
+static PFNGLDELETEBUFFERSPROC tgl_real_glDeleteBuffers = 0;
+static void APIENTRY tgl_wrap_glDeleteBuffers(GLsizei p0, const GLuint *p1) {
+    TGL_CALL(93, tgl_real_glDeleteBuffers(p0, p1));
+}
+static PFNGLGENBUFFERSPROC tgl_real_glGenBuffers = 0;
+static void APIENTRY tgl_wrap_glGenBuffers(GLsizei p0, GLuint *p1) {
+    TGL_CALL(94, tgl_real_glGenBuffers(p0, p1));
+}
+static PFNGLISBUFFERPROC tgl_real_glIsBuffer = 0;
+static GLboolean APIENTRY tgl_wrap_glIsBuffer(GLuint p0) {
+    GLboolean result;
+    TGL_CALL(95, result = tgl_real_glIsBuffer(p0));
+    return result;
+}
+static PFNGLBUFFERDATAPROC tgl_real_glBufferData = 0;
+static void APIENTRY tgl_wrap_glBufferData(GLenum p0, GLsizeiptr p1, const void *p2, GLenum p3) {
+    TGL_CALL(96, tgl_real_glBufferData(p0, p1, p2, p3));
+}
+static PFNGLBUFFERSUBDATAPROC tgl_real_glBufferSubData = 0;
+static void APIENTRY tgl_wrap_glBufferSubData(GLenum p0, GLintptr p1, GLsizeiptr p2, const void *p3) {
+    TGL_CALL(97, tgl_real_glBufferSubData(p0, p1, p2, p3));
+}
+static PFNGLGETBUFFERSUBDATAPROC tgl_real_glGetBufferSubData = 0;
+static void APIENTRY tgl_wrap_glGetBufferSubData(GLenum p0, GLintptr p1, GLsizeiptr p2, void *p3) {
+    TGL_CALL(98, tgl_real_glGetBufferSubData(p0, p1, p2, p3));
+}
+static PFNGLMAPBUFFERPROC tgl_real_glMapBuffer = 0;
+static void *APIENTRY tgl_wrap_glMapBuffer(GLenum p0, GLenum p1) {
+    void *result;
+    TGL_CALL(99, result = tgl_real_glMapBuffer(p0, p1));
+    return result;
+}
+static PFNGLUNMAPBUFFERPROC tgl_real_glUnmapBuffer = 0;
+static GLboolean APIENTRY tgl_wrap_glUnmapBuffer(GLenum p0) {
+    GLboolean result;
+    TGL_CALL(100, result = tgl_real_glUnmapBuffer(p0));
+    return result;
+}
+static PFNGLGETBUFFERPARAMETERIVPROC tgl_real_glGetBufferParameteriv = 0;
+static void APIENTRY tgl_wrap_glGetBufferParameteriv(GLenum p0, GLenum p1, GLint *p2) {
+    TGL_CALL(101, tgl_real_glGetBufferParameteriv(p0, p1, p2));
+}
+static PFNGLGETBUFFERPOINTERVPROC tgl_real_glGetBufferPointerv = 0;
+static void APIENTRY tgl_wrap_glGetBufferPointerv(GLenum p0, GLenum p1, void **p2) {
+    TGL_CALL(102, tgl_real_glGetBufferPointerv(p0, p1, p2));
+}
+#endif
+
+/* GL_version_2_0 */
+#if defined(TGL_DEFINE_CORE_GL_2_0)
+static PFNGLBLENDEQUATIONSEPARATEPROC tgl_real_glBlendEquationSeparate = 0;
+static void APIENTRY tgl_wrap_glBlendEquationSeparate(GLenum p0, GLenum p1) {
+    TGL_CALL(103, tgl_real_glBlendEquationSeparate(p0, p1));
+}
+static PFNGLDRAWBUFFERSPROC tgl_real_glDrawBuffers = 0;
+static void APIENTRY tgl_wrap_glDrawBuffers(GLsizei p0, const GLenum *p1) {
+    TGL_CALL(104, tgl_real_glDrawBuffers(p0, p1));
+}
+static PFNGLSTENCILOPSEPARATEPROC tgl_real_glStencilOpSeparate = 0;
+static void APIENTRY tgl_wrap_glStencilOpSeparate(GLenum p0, GLenum p1, GLenum p2, GLenum p3) {
+    TGL_CALL(105, tgl_real_glStencilOpSeparate(p0, p1, p2, p3));
+}
+static PFNGLSTENCILFUNCSEPARATEPROC tgl_real_glStencilFuncSeparate = 0;
+static void APIENTRY tgl_wrap_glStencilFuncSeparate(GLenum p0, GLenum p1, GLint p2, GLuint p3) {
+    TGL_CALL(106, tgl_real_glStencilFuncSeparate(p0, p1, p2, p3));
+}
+static PFNGLSTENCILMASKSEPARATEPROC tgl_real_glStencilMaskSeparate = 0;
+static void APIENTRY tgl_wrap_glStencilMaskSeparate(GLenum p0, GLuint p1) {
+    TGL_CALL(107, tgl_real_glStencilMaskSeparate(p0, p1));
+}
+static PFNGLATTACHSHADERPROC tgl_real_glAttachShader = 0;
+static void APIENTRY tgl_wrap_glAttachShader(GLuint p0, GLuint p1) {
+    TGL_CALL(108, tgl_real_glAttachShader(p0, p1));
+}
+static PFNGLBINDATTRIBLOCATIONPROC tgl_real_glBindAttribLocation = 0;
+static void APIENTRY tgl_wrap_glBindAttribLocation(GLuint p0, GLuint p1, const GLchar *p2) {
+    TGL_CALL(109, tgl_real_glBindAttribLocation(p0, p1, p2));
+}
+static PFNGLCOMPILESHADERPROC tgl_real_glCompileShader = 0;
+static void APIENTRY tgl_wrap_glCompileShader(GLuint p0) {
+    TGL_CALL(110, tgl_real_glCompileShader(p0));
+}
+static PFNGLCREATEPROGRAMPROC tgl_real_glCreateProgram = 0;
+static GLuint APIENTRY tgl_wrap_glCreateProgram(void) {
+    GLuint result;
+    TGL_CALL(111, result = tgl_real_glCreateProgram());
+    return result;
+}
+static PFNGLCREATESHADERPROC tgl_real_glCreateShader = 0;
+static GLuint APIENTRY tgl_wrap_glCreateShader(GLenum p0) {
+    GLuint result;
+    TGL_CALL(112, result = tgl_real_glCreateShader(p0));
+    return result;
+}
+static PFNGLDELETEPROGRAMPROC tgl_real_glDeleteProgram = 0;
+static void APIENTRY tgl_wrap_glDeleteProgram(GLuint p0) {
+    TGL_CALL(113, tgl_real_glDeleteProgram(p0));
+}
+static PFNGLDELETESHADERPROC tgl_real_glDeleteShader = 0;
+static void APIENTRY tgl_wrap_glDeleteShader(GLuint p0) {
+    TGL_CALL(114, tgl_real_glDeleteShader(p0));
+}
+static PFNGLDETACHSHADERPROC tgl_real_glDetachShader = 0;
+static void APIENTRY tgl_wrap_glDetachShader(GLuint p0, GLuint p1) {
+    TGL_CALL(115, tgl_real_glDetachShader(p0, p1));
+}
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC tgl_real_glDisableVertexAttribArray = 0;
+static void APIENTRY tgl_wrap_glDisableVertexAttribArray(GLuint p0) {
+    TGL_CALL(116, tgl_real_glDisableVertexAttribArray(p0));
+}
+static PFNGLENABLEVERTEXATTRIBARRAYPROC tgl_real_glEnableVertexAttribArray = 0;
+static void APIENTRY tgl_wrap_glEnableVertexAttribArray(GLuint p0) {
+    TGL_CALL(117, tgl_real_glEnableVertexAttribArray(p0));
+}
+static PFNGLGETACTIVEATTRIBPROC tgl_real_glGetActiveAttrib = 0;
+static void APIENTRY tgl_wrap_glGetActiveAttrib(GLuint p0, GLuint p1, GLsizei p2, GLsizei *p3, GLint *p4, GLenum *p5, GLchar *p6) {
+    TGL_CALL(118, tgl_real_glGetActiveAttrib(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLGETACTIVEUNIFORMPROC tgl_real_glGetActiveUniform = 0;
+static void APIENTRY tgl_wrap_glGetActiveUniform(GLuint p0, GLuint p1, GLsizei p2, GLsizei *p3, GLint *p4, GLenum *p5, GLchar *p6) {
+    TGL_CALL(119, tgl_real_glGetActiveUniform(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLGETATTACHEDSHADERSPROC tgl_real_glGetAttachedShaders = 0;
+static void APIENTRY tgl_wrap_glGetAttachedShaders(GLuint p0, GLsizei p1, GLsizei *p2, GLuint *p3) {
+    TGL_CALL(120, tgl_real_glGetAttachedShaders(p0, p1, p2, p3));
+}
+static PFNGLGETATTRIBLOCATIONPROC tgl_real_glGetAttribLocation = 0;
+static GLint APIENTRY tgl_wrap_glGetAttribLocation(GLuint p0, const GLchar *p1) {
+    GLint result;
+    TGL_CALL(121, result = tgl_real_glGetAttribLocation(p0, p1));
+    return result;
+}
+static PFNGLGETPROGRAMIVPROC tgl_real_glGetProgramiv = 0;
+static void APIENTRY tgl_wrap_glGetProgramiv(GLuint p0, GLenum p1, GLint *p2) {
+    TGL_CALL(122, tgl_real_glGetProgramiv(p0, p1, p2));
+}
+static PFNGLGETPROGRAMINFOLOGPROC tgl_real_glGetProgramInfoLog = 0;
+static void APIENTRY tgl_wrap_glGetProgramInfoLog(GLuint p0, GLsizei p1, GLsizei *p2, GLchar *p3) {
+    TGL_CALL(123, tgl_real_glGetProgramInfoLog(p0, p1, p2, p3));
+}
+static PFNGLGETSHADERIVPROC tgl_real_glGetShaderiv = 0;
+static void APIENTRY tgl_wrap_glGetShaderiv(GLuint p0, GLenum p1, GLint *p2) {
+    TGL_CALL(124, tgl_real_glGetShaderiv(p0, p1, p2));
+}
+static PFNGLGETSHADERINFOLOGPROC tgl_real_glGetShaderInfoLog = 0;
+static void APIENTRY tgl_wrap_glGetShaderInfoLog(GLuint p0, GLsizei p1, GLsizei *p2, GLchar *p3) {
+    TGL_CALL(125, tgl_real_glGetShaderInfoLog(p0, p1, p2, p3));
+}
+static PFNGLGETSHADERSOURCEPROC tgl_real_glGetShaderSource = 0;
+static void APIENTRY tgl_wrap_glGetShaderSource(GLuint p0, GLsizei p1, GLsizei *p2, GLchar *p3) {
+    TGL_CALL(126, tgl_real_glGetShaderSource(p0, p1, p2, p3));
+}
+static PFNGLGETUNIFORMLOCATIONPROC tgl_real_glGetUniformLocation = 0;
+static GLint APIENTRY tgl_wrap_glGetUniformLocation(GLuint p0, const GLchar *p1) {
+    GLint result;
+    TGL_CALL(127, result = tgl_real_glGetUniformLocation(p0, p1));
+    return result;
+}
+static PFNGLGETUNIFORMFVPROC tgl_real_glGetUniformfv = 0;
+static void APIENTRY tgl_wrap_glGetUniformfv(GLuint p0, GLint p1, GLfloat *p2) {
+    TGL_CALL(128, tgl_real_glGetUniformfv(p0, p1, p2));
+}
+static PFNGLGETUNIFORMIVPROC tgl_real_glGetUniformiv = 0;
+static void APIENTRY tgl_wrap_glGetUniformiv(GLuint p0, GLint p1, GLint *p2) {
+    TGL_CALL(129, tgl_real_glGetUniformiv(p0, p1, p2));
+}
+static PFNGLGETVERTEXATTRIBDVPROC tgl_real_glGetVertexAttribdv = 0;
+static void APIENTRY tgl_wrap_glGetVertexAttribdv(GLuint p0, GLenum p1, GLdouble *p2) {
+    TGL_CALL(130, tgl_real_glGetVertexAttribdv(p0, p1, p2));
+}
+static PFNGLGETVERTEXATTRIBFVPROC tgl_real_glGetVertexAttribfv = 0;
+static void APIENTRY tgl_wrap_glGetVertexAttribfv(GLuint p0, GLenum p1, GLfloat *p2) {
+    TGL_CALL(131, tgl_real_glGetVertexAttribfv(p0, p1, p2));
+}
+static PFNGLGETVERTEXATTRIBIVPROC tgl_real_glGetVertexAttribiv = 0;
+static void APIENTRY tgl_wrap_glGetVertexAttribiv(GLuint p0, GLenum p1, GLint *p2) {
+    TGL_CALL(132, tgl_real_glGetVertexAttribiv(p0, p1, p2));
+}
+static PFNGLGETVERTEXATTRIBPOINTERVPROC tgl_real_glGetVertexAttribPointerv = 0;
+static void APIENTRY tgl_wrap_glGetVertexAttribPointerv(GLuint p0, GLenum p1, void **p2) {
+    TGL_CALL(133, tgl_real_glGetVertexAttribPointerv(p0, p1, p2));
+}
+static PFNGLISPROGRAMPROC tgl_real_glIsProgram = 0;
+static GLboolean APIENTRY tgl_wrap_glIsProgram(GLuint p0) {
+    GLboolean result;
+    TGL_CALL(134, result = tgl_real_glIsProgram(p0));
+    return result;
+}
+static PFNGLISSHADERPROC tgl_real_glIsShader = 0;
+static GLboolean APIENTRY tgl_wrap_glIsShader(GLuint p0) {
+    GLboolean result;
+    TGL_CALL(135, result = tgl_real_glIsShader(p0));
+    return result;
+}
+static PFNGLLINKPROGRAMPROC tgl_real_glLinkProgram = 0;
+static void APIENTRY tgl_wrap_glLinkProgram(GLuint p0) {
+    TGL_CALL(136, tgl_real_glLinkProgram(p0));
+}
+static PFNGLSHADERSOURCEPROC tgl_real_glShaderSource = 0;
+static void APIENTRY tgl_wrap_glShaderSource(GLuint p0, GLsizei p1, const GLchar *const*p2, const GLint *p3) {
+    TGL_CALL(137, tgl_real_glShaderSource(p0, p1, p2, p3));
+}
+static PFNGLUSEPROGRAMPROC tgl_real_glUseProgram = 0;
+static void APIENTRY tgl_wrap_glUseProgram(GLuint p0) {
+    TGL_CALL(138, tgl_real_glUseProgram(p0));
+}
+static PFNGLUNIFORM1FPROC tgl_real_glUniform1f = 0;
+static void APIENTRY tgl_wrap_glUniform1f(GLint p0, GLfloat p1) {
+    TGL_CALL(139, tgl_real_glUniform1f(p0, p1));
+}
+static PFNGLUNIFORM2FPROC tgl_real_glUniform2f = 0;
+static void APIENTRY tgl_wrap_glUniform2f(GLint p0, GLfloat p1, GLfloat p2) {
+    TGL_CALL(140, tgl_real_glUniform2f(p0, p1, p2));
+}
+static PFNGLUNIFORM3FPROC tgl_real_glUniform3f = 0;
+static void APIENTRY tgl_wrap_glUniform3f(GLint p0, GLfloat p1, GLfloat p2, GLfloat p3) {
+    TGL_CALL(141, tgl_real_glUniform3f(p0, p1, p2, p3));
+}
+static PFNGLUNIFORM4FPROC tgl_real_glUniform4f = 0;
+static void APIENTRY tgl_wrap_glUniform4f(GLint p0, GLfloat p1, GLfloat p2, GLfloat p3, GLfloat p4) {
+    TGL_CALL(142, tgl_real_glUniform4f(p0, p1, p2, p3, p4));
+}
+static PFNGLUNIFORM1IPROC tgl_real_glUniform1i = 0;
+static void APIENTRY tgl_wrap_glUniform1i(GLint p0, GLint p1) {
+    TGL_CALL(143, tgl_real_glUniform1i(p0, p1));
+}
+static PFNGLUNIFORM2IPROC tgl_real_glUniform2i = 0;
+static void APIENTRY tgl_wrap_glUniform2i(GLint p0, GLint p1, GLint p2) {
+    TGL_CALL(144, tgl_real_glUniform2i(p0, p1, p2));
+}
+static PFNGLUNIFORM3IPROC tgl_real_glUniform3i = 0;
+static void APIENTRY tgl_wrap_glUniform3i(GLint p0, GLint p1, GLint p2, GLint p3) {
+    TGL_CALL(145, tgl_real_glUniform3i(p0, p1, p2, p3));
+}
+static PFNGLUNIFORM4IPROC tgl_real_glUniform4i = 0;
+static void APIENTRY tgl_wrap_glUniform4i(GLint p0, GLint p1, GLint p2, GLint p3, GLint p4) {
+    TGL_CALL(146, tgl_real_glUniform4i(p0, p1, p2, p3, p4));
+}
+static PFNGLUNIFORM1FVPROC tgl_real_glUniform1fv = 0;
+static void APIENTRY tgl_wrap_glUniform1fv(GLint p0, GLsizei p1, const GLfloat *p2) {
+    TGL_CALL(147, tgl_real_glUniform1fv(p0, p1, p2));
+}
+static PFNGLUNIFORM2FVPROC tgl_real_glUniform2fv = 0;
+static void APIENTRY tgl_wrap_glUniform2fv(GLint p0, GLsizei p1, const GLfloat *p2) {
+    TGL_CALL(148, tgl_real_glUniform2fv(p0, p1, p2));
+}
+static PFNGLUNIFORM3FVPROC tgl_real_glUniform3fv = 0;
+static void APIENTRY tgl_wrap_glUniform3fv(GLint p0, GLsizei p1, const GLfloat *p2) {
+    TGL_CALL(149, tgl_real_glUniform3fv(p0, p1, p2));
+}
+static PFNGLUNIFORM4FVPROC tgl_real_glUniform4fv = 0;
+static void APIENTRY tgl_wrap_glUniform4fv(GLint p0, GLsizei p1, const GLfloat *p2) {
+    TGL_CALL(150, tgl_real_glUniform4fv(p0, p1, p2));
+}
+static PFNGLUNIFORM1IVPROC tgl_real_glUniform1iv = 0;
+static void APIENTRY tgl_wrap_glUniform1iv(GLint p0, GLsizei p1, const GLint *p2) {
+    TGL_CALL(151, tgl_real_glUniform1iv(p0, p1, p2));
+}
+static PFNGLUNIFORM2IVPROC tgl_real_glUniform2iv = 0;
+static void APIENTRY tgl_wrap_glUniform2iv(GLint p0, GLsizei p1, const GLint *p2) {
+    TGL_CALL(152, tgl_real_glUniform2iv(p0, p1, p2));
+}
+static PFNGLUNIFORM3IVPROC tgl_real_glUniform3iv = 0;
+static void APIENTRY tgl_wrap_glUniform3iv(GLint p0, GLsizei p1, const GLint *p2) {
+    TGL_CALL(153, tgl_real_glUniform3iv(p0, p1, p2));
+}
+static PFNGLUNIFORM4IVPROC tgl_real_glUniform4iv = 0;
+static void APIENTRY tgl_wrap_glUniform4iv(GLint p0, GLsizei p1, const GLint *p2) {
+    TGL_CALL(154, tgl_real_glUniform4iv(p0, p1, p2));
+}
+static PFNGLUNIFORMMATRIX2FVPROC tgl_real_glUniformMatrix2fv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix2fv(GLint p0, GLsizei p1, GLboolean p2, const GLfloat *p3) {
+    TGL_CALL(155, tgl_real_glUniformMatrix2fv(p0, p1, p2, p3));
+}
+static PFNGLUNIFORMMATRIX3FVPROC tgl_real_glUniformMatrix3fv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix3fv(GLint p0, GLsizei p1, GLboolean p2, const GLfloat *p3) {
+    TGL_CALL(156, tgl_real_glUniformMatrix3fv(p0, p1, p2, p3));
+}
+static PFNGLUNIFORMMATRIX4FVPROC tgl_real_glUniformMatrix4fv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix4fv(GLint p0, GLsizei p1, GLboolean p2, const GLfloat *p3) {
+    TGL_CALL(157, tgl_real_glUniformMatrix4fv(p0, p1, p2, p3));
+}
+static PFNGLVALIDATEPROGRAMPROC tgl_real_glValidateProgram = 0;
+static void APIENTRY tgl_wrap_glValidateProgram(GLuint p0) {
+    TGL_CALL(158, tgl_real_glValidateProgram(p0));
+}
+static PFNGLVERTEXATTRIB1DPROC tgl_real_glVertexAttrib1d = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib1d(GLuint p0, GLdouble p1) {
+    TGL_CALL(159, tgl_real_glVertexAttrib1d(p0, p1));
+}
+static PFNGLVERTEXATTRIB1DVPROC tgl_real_glVertexAttrib1dv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib1dv(GLuint p0, const GLdouble *p1) {
+    TGL_CALL(160, tgl_real_glVertexAttrib1dv(p0, p1));
+}
+static PFNGLVERTEXATTRIB1FPROC tgl_real_glVertexAttrib1f = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib1f(GLuint p0, GLfloat p1) {
+    TGL_CALL(161, tgl_real_glVertexAttrib1f(p0, p1));
+}
+static PFNGLVERTEXATTRIB1FVPROC tgl_real_glVertexAttrib1fv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib1fv(GLuint p0, const GLfloat *p1) {
+    TGL_CALL(162, tgl_real_glVertexAttrib1fv(p0, p1));
+}
+static PFNGLVERTEXATTRIB1SPROC tgl_real_glVertexAttrib1s = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib1s(GLuint p0, GLshort p1) {
+    TGL_CALL(163, tgl_real_glVertexAttrib1s(p0, p1));
+}
+static PFNGLVERTEXATTRIB1SVPROC tgl_real_glVertexAttrib1sv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib1sv(GLuint p0, const GLshort *p1) {
+    TGL_CALL(164, tgl_real_glVertexAttrib1sv(p0, p1));
+}
+static PFNGLVERTEXATTRIB2DPROC tgl_real_glVertexAttrib2d = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib2d(GLuint p0, GLdouble p1, GLdouble p2) {
+    TGL_CALL(165, tgl_real_glVertexAttrib2d(p0, p1, p2));
+}
+static PFNGLVERTEXATTRIB2DVPROC tgl_real_glVertexAttrib2dv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib2dv(GLuint p0, const GLdouble *p1) {
+    TGL_CALL(166, tgl_real_glVertexAttrib2dv(p0, p1));
+}
+static PFNGLVERTEXATTRIB2FPROC tgl_real_glVertexAttrib2f = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib2f(GLuint p0, GLfloat p1, GLfloat p2) {
+    TGL_CALL(167, tgl_real_glVertexAttrib2f(p0, p1, p2));
+}
+static PFNGLVERTEXATTRIB2FVPROC tgl_real_glVertexAttrib2fv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib2fv(GLuint p0, const GLfloat *p1) {
+    TGL_CALL(168, tgl_real_glVertexAttrib2fv(p0, p1));
+}
+static PFNGLVERTEXATTRIB2SPROC tgl_real_glVertexAttrib2s = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib2s(GLuint p0, GLshort p1, GLshort p2) {
+    TGL_CALL(169, tgl_real_glVertexAttrib2s(p0, p1, p2));
+}
+static PFNGLVERTEXATTRIB2SVPROC tgl_real_glVertexAttrib2sv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib2sv(GLuint p0, const GLshort *p1) {
+    TGL_CALL(170, tgl_real_glVertexAttrib2sv(p0, p1));
+}
+static PFNGLVERTEXATTRIB3DPROC tgl_real_glVertexAttrib3d = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib3d(GLuint p0, GLdouble p1, GLdouble p2, GLdouble p3) {
+    TGL_CALL(171, tgl_real_glVertexAttrib3d(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIB3DVPROC tgl_real_glVertexAttrib3dv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib3dv(GLuint p0, const GLdouble *p1) {
+    TGL_CALL(172, tgl_real_glVertexAttrib3dv(p0, p1));
+}
+static PFNGLVERTEXATTRIB3FPROC tgl_real_glVertexAttrib3f = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib3f(GLuint p0, GLfloat p1, GLfloat p2, GLfloat p3) {
+    TGL_CALL(173, tgl_real_glVertexAttrib3f(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIB3FVPROC tgl_real_glVertexAttrib3fv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib3fv(GLuint p0, const GLfloat *p1) {
+    TGL_CALL(174, tgl_real_glVertexAttrib3fv(p0, p1));
+}
+static PFNGLVERTEXATTRIB3SPROC tgl_real_glVertexAttrib3s = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib3s(GLuint p0, GLshort p1, GLshort p2, GLshort p3) {
+    TGL_CALL(175, tgl_real_glVertexAttrib3s(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIB3SVPROC tgl_real_glVertexAttrib3sv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib3sv(GLuint p0, const GLshort *p1) {
+    TGL_CALL(176, tgl_real_glVertexAttrib3sv(p0, p1));
+}
+static PFNGLVERTEXATTRIB4NBVPROC tgl_real_glVertexAttrib4Nbv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4Nbv(GLuint p0, const GLbyte *p1) {
+    TGL_CALL(177, tgl_real_glVertexAttrib4Nbv(p0, p1));
+}
+static PFNGLVERTEXATTRIB4NIVPROC tgl_real_glVertexAttrib4Niv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4Niv(GLuint p0, const GLint *p1) {
+    TGL_CALL(178, tgl_real_glVertexAttrib4Niv(p0, p1));
+}
+static PFNGLVERTEXATTRIB4NSVPROC tgl_real_glVertexAttrib4Nsv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4Nsv(GLuint p0, const GLshort *p1) {
+    TGL_CALL(179, tgl_real_glVertexAttrib4Nsv(p0, p1));
+}
+static PFNGLVERTEXATTRIB4NUBPROC tgl_real_glVertexAttrib4Nub = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4Nub(GLuint p0, GLubyte p1, GLubyte p2, GLubyte p3, GLubyte p4) {
+    TGL_CALL(180, tgl_real_glVertexAttrib4Nub(p0, p1, p2, p3, p4));
+}
+static PFNGLVERTEXATTRIB4NUBVPROC tgl_real_glVertexAttrib4Nubv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4Nubv(GLuint p0, const GLubyte *p1) {
+    TGL_CALL(181, tgl_real_glVertexAttrib4Nubv(p0, p1));
+}
+static PFNGLVERTEXATTRIB4NUIVPROC tgl_real_glVertexAttrib4Nuiv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4Nuiv(GLuint p0, const GLuint *p1) {
+    TGL_CALL(182, tgl_real_glVertexAttrib4Nuiv(p0, p1));
+}
+static PFNGLVERTEXATTRIB4NUSVPROC tgl_real_glVertexAttrib4Nusv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4Nusv(GLuint p0, const GLushort *p1) {
+    TGL_CALL(183, tgl_real_glVertexAttrib4Nusv(p0, p1));
+}
+static PFNGLVERTEXATTRIB4BVPROC tgl_real_glVertexAttrib4bv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4bv(GLuint p0, const GLbyte *p1) {
+    TGL_CALL(184, tgl_real_glVertexAttrib4bv(p0, p1));
+}
+static PFNGLVERTEXATTRIB4DPROC tgl_real_glVertexAttrib4d = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4d(GLuint p0, GLdouble p1, GLdouble p2, GLdouble p3, GLdouble p4) {
+    TGL_CALL(185, tgl_real_glVertexAttrib4d(p0, p1, p2, p3, p4));
+}
+static PFNGLVERTEXATTRIB4DVPROC tgl_real_glVertexAttrib4dv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4dv(GLuint p0, const GLdouble *p1) {
+    TGL_CALL(186, tgl_real_glVertexAttrib4dv(p0, p1));
+}
+static PFNGLVERTEXATTRIB4FPROC tgl_real_glVertexAttrib4f = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4f(GLuint p0, GLfloat p1, GLfloat p2, GLfloat p3, GLfloat p4) {
+    TGL_CALL(187, tgl_real_glVertexAttrib4f(p0, p1, p2, p3, p4));
+}
+static PFNGLVERTEXATTRIB4FVPROC tgl_real_glVertexAttrib4fv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4fv(GLuint p0, const GLfloat *p1) {
+    TGL_CALL(188, tgl_real_glVertexAttrib4fv(p0, p1));
+}
+static PFNGLVERTEXATTRIB4IVPROC tgl_real_glVertexAttrib4iv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4iv(GLuint p0, const GLint *p1) {
+    TGL_CALL(189, tgl_real_glVertexAttrib4iv(p0, p1));
+}
+static PFNGLVERTEXATTRIB4SPROC tgl_real_glVertexAttrib4s = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4s(GLuint p0, GLshort p1, GLshort p2, GLshort p3, GLshort p4) {
+    TGL_CALL(190, tgl_real_glVertexAttrib4s(p0, p1, p2, p3, p4));
+}
+static PFNGLVERTEXATTRIB4SVPROC tgl_real_glVertexAttrib4sv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4sv(GLuint p0, const GLshort *p1) {
+    TGL_CALL(191, tgl_real_glVertexAttrib4sv(p0, p1));
+}
+static PFNGLVERTEXATTRIB4UBVPROC tgl_real_glVertexAttrib4ubv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4ubv(GLuint p0, const GLubyte *p1) {
+    TGL_CALL(192, tgl_real_glVertexAttrib4ubv(p0, p1));
+}
+static PFNGLVERTEXATTRIB4UIVPROC tgl_real_glVertexAttrib4uiv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4uiv(GLuint p0, const GLuint *p1) {
+    TGL_CALL(193, tgl_real_glVertexAttrib4uiv(p0, p1));
+}
+static PFNGLVERTEXATTRIB4USVPROC tgl_real_glVertexAttrib4usv = 0;
+static void APIENTRY tgl_wrap_glVertexAttrib4usv(GLuint p0, const GLushort *p1) {
+    TGL_CALL(194, tgl_real_glVertexAttrib4usv(p0, p1));
+}
+static PFNGLVERTEXATTRIBPOINTERPROC tgl_real_glVertexAttribPointer = 0;
+static void APIENTRY tgl_wrap_glVertexAttribPointer(GLuint p0, GLint p1, GLenum p2, GLboolean p3, GLsizei p4, const void *p5) {
+    TGL_CALL(195, tgl_real_glVertexAttribPointer(p0, p1, p2, p3, p4, p5));
+}
+#endif
+
+/* GL_version_2_1 */
+#if defined(TGL_DEFINE_CORE_GL_2_1)
+static PFNGLUNIFORMMATRIX2X3FVPROC tgl_real_glUniformMatrix2x3fv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix2x3fv(GLint p0, GLsizei p1, GLboolean p2, const GLfloat *p3) {
+    TGL_CALL(196, tgl_real_glUniformMatrix2x3fv(p0, p1, p2, p3));
+}
+static PFNGLUNIFORMMATRIX3X2FVPROC tgl_real_glUniformMatrix3x2fv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix3x2fv(GLint p0, GLsizei p1, GLboolean p2, const GLfloat *p3) {
+    TGL_CALL(197, tgl_real_glUniformMatrix3x2fv(p0, p1, p2, p3));
+}
+static PFNGLUNIFORMMATRIX2X4FVPROC tgl_real_glUniformMatrix2x4fv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix2x4fv(GLint p0, GLsizei p1, GLboolean p2, const GLfloat *p3) {
+    TGL_CALL(198, tgl_real_glUniformMatrix2x4fv(p0, p1, p2, p3));
+}
+static PFNGLUNIFORMMATRIX4X2FVPROC tgl_real_glUniformMatrix4x2fv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix4x2fv(GLint p0, GLsizei p1, GLboolean p2, const GLfloat *p3) {
+    TGL_CALL(199, tgl_real_glUniformMatrix4x2fv(p0, p1, p2, p3));
+}
+static PFNGLUNIFORMMATRIX3X4FVPROC tgl_real_glUniformMatrix3x4fv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix3x4fv(GLint p0, GLsizei p1, GLboolean p2, const GLfloat *p3) {
+    TGL_CALL(200, tgl_real_glUniformMatrix3x4fv(p0, p1, p2, p3));
+}
+static PFNGLUNIFORMMATRIX4X3FVPROC tgl_real_glUniformMatrix4x3fv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix4x3fv(GLint p0, GLsizei p1, GLboolean p2, const GLfloat *p3) {
+    TGL_CALL(201, tgl_real_glUniformMatrix4x3fv(p0, p1, p2, p3));
+}
+#endif
+
+/* GL_version_3_0 */
+#if defined(TGL_DEFINE_CORE_GL_3_0)
+static PFNGLCOLORMASKIPROC tgl_real_glColorMaski = 0;
+static void APIENTRY tgl_wrap_glColorMaski(GLuint p0, GLboolean p1, GLboolean p2, GLboolean p3, GLboolean p4) {
+    TGL_CALL(202, tgl_real_glColorMaski(p0, p1, p2, p3, p4));
+}
+static PFNGLGETBOOLEANI_VPROC tgl_real_glGetBooleani_v = 0;
+static void APIENTRY tgl_wrap_glGetBooleani_v(GLenum p0, GLuint p1, GLboolean *p2) {
+    TGL_CALL(203, tgl_real_glGetBooleani_v(p0, p1, p2));
+}
+static PFNGLGETINTEGERI_VPROC tgl_real_glGetIntegeri_v = 0;
+static void APIENTRY tgl_wrap_glGetIntegeri_v(GLenum p0, GLuint p1, GLint *p2) {
+    TGL_CALL(204, tgl_real_glGetIntegeri_v(p0, p1, p2));
+}
+static PFNGLENABLEIPROC tgl_real_glEnablei = 0;
+static void APIENTRY tgl_wrap_glEnablei(GLenum p0, GLuint p1) {
+    TGL_CALL(205, tgl_real_glEnablei(p0, p1));
+}
+static PFNGLDISABLEIPROC tgl_real_glDisablei = 0;
+static void APIENTRY tgl_wrap_glDisablei(GLenum p0, GLuint p1) {
+    TGL_CALL(206, tgl_real_glDisablei(p0, p1));
+}
+static PFNGLISENABLEDIPROC tgl_real_glIsEnabledi = 0;
+static GLboolean APIENTRY tgl_wrap_glIsEnabledi(GLenum p0, GLuint p1) {
+    GLboolean result;
+    TGL_CALL(207, result = tgl_real_glIsEnabledi(p0, p1));
+    return result;
+}
+static PFNGLBEGINTRANSFORMFEEDBACKPROC tgl_real_glBeginTransformFeedback = 0;
+static void APIENTRY tgl_wrap_glBeginTransformFeedback(GLenum p0) {
+    TGL_CALL(208, tgl_real_glBeginTransformFeedback(p0));
+}
+static PFNGLENDTRANSFORMFEEDBACKPROC tgl_real_glEndTransformFeedback = 0;
+static void APIENTRY tgl_wrap_glEndTransformFeedback(void) {
+    TGL_CALL(209, tgl_real_glEndTransformFeedback());
+}
+static PFNGLBINDBUFFERRANGEPROC tgl_real_glBindBufferRange = 0;
+static void APIENTRY tgl_wrap_glBindBufferRange(GLenum p0, GLuint p1, GLuint p2, GLintptr p3, GLsizeiptr p4) {
+    TGL_CALL(210, tgl_real_glBindBufferRange(p0, p1, p2, p3, p4));
+}
+static PFNGLBINDBUFFERBASEPROC tgl_real_glBindBufferBase = 0;
+static void APIENTRY tgl_wrap_glBindBufferBase(GLenum p0, GLuint p1, GLuint p2) {
+    TGL_CALL(211, tgl_real_glBindBufferBase(p0, p1, p2));
+}
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC tgl_real_glTransformFeedbackVaryings = 0;
+static void APIENTRY tgl_wrap_glTransformFeedbackVaryings(GLuint p0, GLsizei p1, const GLchar *const*p2, GLenum p3) {
+    TGL_CALL(212, tgl_real_glTransformFeedbackVaryings(p0, p1, p2, p3));
+}
+static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC tgl_real_glGetTransformFeedbackVarying = 0;
+static void APIENTRY tgl_wrap_glGetTransformFeedbackVarying(GLuint p0, GLuint p1, GLsizei p2, GLsizei *p3, GLsizei *p4, GLenum *p5, GLchar *p6) {
+    TGL_CALL(213, tgl_real_glGetTransformFeedbackVarying(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLCLAMPCOLORPROC tgl_real_glClampColor = 0;
+static void APIENTRY tgl_wrap_glClampColor(GLenum p0, GLenum p1) {
+    TGL_CALL(214, tgl_real_glClampColor(p0, p1));
+}
+static PFNGLBEGINCONDITIONALRENDERPROC tgl_real_glBeginConditionalRender = 0;
+static void APIENTRY tgl_wrap_glBeginConditionalRender(GLuint p0, GLenum p1) {
+    TGL_CALL(215, tgl_real_glBeginConditionalRender(p0, p1));
+}
+static PFNGLENDCONDITIONALRENDERPROC tgl_real_glEndConditionalRender = 0;
+static void APIENTRY tgl_wrap_glEndConditionalRender(void) {
+    TGL_CALL(216, tgl_real_glEndConditionalRender());
+}
+static PFNGLVERTEXATTRIBIPOINTERPROC tgl_real_glVertexAttribIPointer = 0;
+static void APIENTRY tgl_wrap_glVertexAttribIPointer(GLuint p0, GLint p1, GLenum p2, GLsizei p3, const void *p4) {
+    TGL_CALL(217, tgl_real_glVertexAttribIPointer(p0, p1, p2, p3, p4));
+}
+static PFNGLGETVERTEXATTRIBIIVPROC tgl_real_glGetVertexAttribIiv = 0;
+static void APIENTRY tgl_wrap_glGetVertexAttribIiv(GLuint p0, GLenum p1, GLint *p2) {
+    TGL_CALL(218, tgl_real_glGetVertexAttribIiv(p0, p1, p2));
+}
+static PFNGLGETVERTEXATTRIBIUIVPROC tgl_real_glGetVertexAttribIuiv = 0;
+static void APIENTRY tgl_wrap_glGetVertexAttribIuiv(GLuint p0, GLenum p1, GLuint *p2) {
+    TGL_CALL(219, tgl_real_glGetVertexAttribIuiv(p0, p1, p2));
+}
+static PFNGLVERTEXATTRIBI1IPROC tgl_real_glVertexAttribI1i = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI1i(GLuint p0, GLint p1) {
+    TGL_CALL(220, tgl_real_glVertexAttribI1i(p0, p1));
+}
+static PFNGLVERTEXATTRIBI2IPROC tgl_real_glVertexAttribI2i = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI2i(GLuint p0, GLint p1, GLint p2) {
+    TGL_CALL(221, tgl_real_glVertexAttribI2i(p0, p1, p2));
+}
+static PFNGLVERTEXATTRIBI3IPROC tgl_real_glVertexAttribI3i = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI3i(GLuint p0, GLint p1, GLint p2, GLint p3) {
+    TGL_CALL(222, tgl_real_glVertexAttribI3i(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIBI4IPROC tgl_real_glVertexAttribI4i = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI4i(GLuint p0, GLint p1, GLint p2, GLint p3, GLint p4) {
+    TGL_CALL(223, tgl_real_glVertexAttribI4i(p0, p1, p2, p3, p4));
+}
+static PFNGLVERTEXATTRIBI1UIPROC tgl_real_glVertexAttribI1ui = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI1ui(GLuint p0, GLuint p1) {
+    TGL_CALL(224, tgl_real_glVertexAttribI1ui(p0, p1));
+}
+static PFNGLVERTEXATTRIBI2UIPROC tgl_real_glVertexAttribI2ui = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI2ui(GLuint p0, GLuint p1, GLuint p2) {
+    TGL_CALL(225, tgl_real_glVertexAttribI2ui(p0, p1, p2));
+}
+static PFNGLVERTEXATTRIBI3UIPROC tgl_real_glVertexAttribI3ui = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI3ui(GLuint p0, GLuint p1, GLuint p2, GLuint p3) {
+    TGL_CALL(226, tgl_real_glVertexAttribI3ui(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIBI4UIPROC tgl_real_glVertexAttribI4ui = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI4ui(GLuint p0, GLuint p1, GLuint p2, GLuint p3, GLuint p4) {
+    TGL_CALL(227, tgl_real_glVertexAttribI4ui(p0, p1, p2, p3, p4));
+}
+static PFNGLVERTEXATTRIBI1IVPROC tgl_real_glVertexAttribI1iv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI1iv(GLuint p0, const GLint *p1) {
+    TGL_CALL(228, tgl_real_glVertexAttribI1iv(p0, p1));
+}
+static PFNGLVERTEXATTRIBI2IVPROC tgl_real_glVertexAttribI2iv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI2iv(GLuint p0, const GLint *p1) {
+    TGL_CALL(229, tgl_real_glVertexAttribI2iv(p0, p1));
+}
+static PFNGLVERTEXATTRIBI3IVPROC tgl_real_glVertexAttribI3iv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI3iv(GLuint p0, const GLint *p1) {
+    TGL_CALL(230, tgl_real_glVertexAttribI3iv(p0, p1));
+}
+static PFNGLVERTEXATTRIBI4IVPROC tgl_real_glVertexAttribI4iv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI4iv(GLuint p0, const GLint *p1) {
+    TGL_CALL(231, tgl_real_glVertexAttribI4iv(p0, p1));
+}
+static PFNGLVERTEXATTRIBI1UIVPROC tgl_real_glVertexAttribI1uiv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI1uiv(GLuint p0, const GLuint *p1) {
+    TGL_CALL(232, tgl_real_glVertexAttribI1uiv(p0, p1));
+}
+static PFNGLVERTEXATTRIBI2UIVPROC tgl_real_glVertexAttribI2uiv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI2uiv(GLuint p0, const GLuint *p1) {
+    TGL_CALL(233, tgl_real_glVertexAttribI2uiv(p0, p1));
+}
+static PFNGLVERTEXATTRIBI3UIVPROC tgl_real_glVertexAttribI3uiv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI3uiv(GLuint p0, const GLuint *p1) {
+    TGL_CALL(234, tgl_real_glVertexAttribI3uiv(p0, p1));
+}
+static PFNGLVERTEXATTRIBI4UIVPROC tgl_real_glVertexAttribI4uiv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI4uiv(GLuint p0, const GLuint *p1) {
+    TGL_CALL(235, tgl_real_glVertexAttribI4uiv(p0, p1));
+}
+static PFNGLVERTEXATTRIBI4BVPROC tgl_real_glVertexAttribI4bv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI4bv(GLuint p0, const GLbyte *p1) {
+    TGL_CALL(236, tgl_real_glVertexAttribI4bv(p0, p1));
+}
+static PFNGLVERTEXATTRIBI4SVPROC tgl_real_glVertexAttribI4sv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI4sv(GLuint p0, const GLshort *p1) {
+    TGL_CALL(237, tgl_real_glVertexAttribI4sv(p0, p1));
+}
+static PFNGLVERTEXATTRIBI4UBVPROC tgl_real_glVertexAttribI4ubv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI4ubv(GLuint p0, const GLubyte *p1) {
+    TGL_CALL(238, tgl_real_glVertexAttribI4ubv(p0, p1));
+}
+static PFNGLVERTEXATTRIBI4USVPROC tgl_real_glVertexAttribI4usv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribI4usv(GLuint p0, const GLushort *p1) {
+    TGL_CALL(239, tgl_real_glVertexAttribI4usv(p0, p1));
+}
+static PFNGLGETUNIFORMUIVPROC tgl_real_glGetUniformuiv = 0;
+static void APIENTRY tgl_wrap_glGetUniformuiv(GLuint p0, GLint p1, GLuint *p2) {
+    TGL_CALL(240, tgl_real_glGetUniformuiv(p0, p1, p2));
+}
+static PFNGLBINDFRAGDATALOCATIONPROC tgl_real_glBindFragDataLocation = 0;
+static void APIENTRY tgl_wrap_glBindFragDataLocation(GLuint p0, GLuint p1, const GLchar *p2) {
+    TGL_CALL(241, tgl_real_glBindFragDataLocation(p0, p1, p2));
+}
+static PFNGLGETFRAGDATALOCATIONPROC tgl_real_glGetFragDataLocation = 0;
+static GLint APIENTRY tgl_wrap_glGetFragDataLocation(GLuint p0, const GLchar *p1) {
+    GLint result;
+    TGL_CALL(242, result = tgl_real_glGetFragDataLocation(p0, p1));
+    return result;
+}
+static PFNGLUNIFORM1UIPROC tgl_real_glUniform1ui = 0;
+static void APIENTRY tgl_wrap_glUniform1ui(GLint p0, GLuint p1) {
+    TGL_CALL(243, tgl_real_glUniform1ui(p0, p1));
+}
+static PFNGLUNIFORM2UIPROC tgl_real_glUniform2ui = 0;
+static void APIENTRY tgl_wrap_glUniform2ui(GLint p0, GLuint p1, GLuint p2) {
+    TGL_CALL(244, tgl_real_glUniform2ui(p0, p1, p2));
+}
+static PFNGLUNIFORM3UIPROC tgl_real_glUniform3ui = 0;
+static void APIENTRY tgl_wrap_glUniform3ui(GLint p0, GLuint p1, GLuint p2, GLuint p3) {
+    TGL_CALL(245, tgl_real_glUniform3ui(p0, p1, p2, p3));
+}
+static PFNGLUNIFORM4UIPROC tgl_real_glUniform4ui = 0;
+static void APIENTRY tgl_wrap_glUniform4ui(GLint p0, GLuint p1, GLuint p2, GLuint p3, GLuint p4) {
+    TGL_CALL(246, tgl_real_glUniform4ui(p0, p1, p2, p3, p4));
+}
+static PFNGLUNIFORM1UIVPROC tgl_real_glUniform1uiv = 0;
+static void APIENTRY tgl_wrap_glUniform1uiv(GLint p0, GLsizei p1, const GLuint *p2) {
+    TGL_CALL(247, tgl_real_glUniform1uiv(p0, p1, p2));
+}
+static PFNGLUNIFORM2UIVPROC tgl_real_glUniform2uiv = 0;
+static void APIENTRY tgl_wrap_glUniform2uiv(GLint p0, GLsizei p1, const GLuint *p2) {
+    TGL_CALL(248, tgl_real_glUniform2uiv(p0, p1, p2));
+}
+static PFNGLUNIFORM3UIVPROC tgl_real_glUniform3uiv = 0;
+static void APIENTRY tgl_wrap_glUniform3uiv(GLint p0, GLsizei p1, const GLuint *p2) {
+    TGL_CALL(249, tgl_real_glUniform3uiv(p0, p1, p2));
+}
+static PFNGLUNIFORM4UIVPROC tgl_real_glUniform4uiv = 0;
+static void APIENTRY tgl_wrap_glUniform4uiv(GLint p0, GLsizei p1, const GLuint *p2) {
+    TGL_CALL(250, tgl_real_glUniform4uiv(p0, p1, p2));
+}
+static PFNGLTEXPARAMETERIIVPROC tgl_real_glTexParameterIiv = 0;
+static void APIENTRY tgl_wrap_glTexParameterIiv(GLenum p0, GLenum p1, const GLint *p2) {
+    TGL_CALL(251, tgl_real_glTexParameterIiv(p0, p1, p2));
+}
+static PFNGLTEXPARAMETERIUIVPROC tgl_real_glTexParameterIuiv = 0;
+static void APIENTRY tgl_wrap_glTexParameterIuiv(GLenum p0, GLenum p1, const GLuint *p2) {
+    TGL_CALL(252, tgl_real_glTexParameterIuiv(p0, p1, p2));
+}
+static PFNGLGETTEXPARAMETERIIVPROC tgl_real_glGetTexParameterIiv = 0;
+static void APIENTRY tgl_wrap_glGetTexParameterIiv(GLenum p0, GLenum p1, GLint *p2) {
+    TGL_CALL(253, tgl_real_glGetTexParameterIiv(p0, p1, p2));
+}
+static PFNGLGETTEXPARAMETERIUIVPROC tgl_real_glGetTexParameterIuiv = 0;
+static void APIENTRY tgl_wrap_glGetTexParameterIuiv(GLenum p0, GLenum p1, GLuint *p2) {
+    TGL_CALL(254, tgl_real_glGetTexParameterIuiv(p0, p1, p2));
+}
+static PFNGLCLEARBUFFERIVPROC tgl_real_glClearBufferiv = 0;
+static void APIENTRY tgl_wrap_glClearBufferiv(GLenum p0, GLint p1, const GLint *p2) {
+    TGL_CALL(255, tgl_real_glClearBufferiv(p0, p1, p2));
+}
+static PFNGLCLEARBUFFERUIVPROC tgl_real_glClearBufferuiv = 0;
+static void APIENTRY tgl_wrap_glClearBufferuiv(GLenum p0, GLint p1, const GLuint *p2) {
+    TGL_CALL(256, tgl_real_glClearBufferuiv(p0, p1, p2));
+}
+static PFNGLCLEARBUFFERFVPROC tgl_real_glClearBufferfv = 0;
+static void APIENTRY tgl_wrap_glClearBufferfv(GLenum p0, GLint p1, const GLfloat *p2) {
+    TGL_CALL(257, tgl_real_glClearBufferfv(p0, p1, p2));
+}
+static PFNGLCLEARBUFFERFIPROC tgl_real_glClearBufferfi = 0;
+static void APIENTRY tgl_wrap_glClearBufferfi(GLenum p0, GLint p1, GLfloat p2, GLint p3) {
+    TGL_CALL(258, tgl_real_glClearBufferfi(p0, p1, p2, p3));
+}
+static PFNGLGETSTRINGIPROC tgl_real_glGetStringi = 0;
+static const GLubyte *APIENTRY tgl_wrap_glGetStringi(GLenum p0, GLuint p1) {
+    const GLubyte *result;
+    TGL_CALL(259, result = tgl_real_glGetStringi(p0, p1));
+    return result;
+}
+static PFNGLISRENDERBUFFERPROC tgl_real_glIsRenderbuffer = 0;
+static GLboolean APIENTRY tgl_wrap_glIsRenderbuffer(GLuint p0) {
+    GLboolean result;
+    TGL_CALL(260, result = tgl_real_glIsRenderbuffer(p0));
+    return result;
+}
+static PFNGLBINDRENDERBUFFERPROC tgl_real_glBindRenderbuffer = 0;
+static void APIENTRY tgl_wrap_glBindRenderbuffer(GLenum p0, GLuint p1) {
+    TGL_CALL(261, tgl_real_glBindRenderbuffer(p0, p1));
+}
+static PFNGLDELETERENDERBUFFERSPROC tgl_real_glDeleteRenderbuffers = 0;
+static void APIENTRY tgl_wrap_glDeleteRenderbuffers(GLsizei p0, const GLuint *p1) {
+    TGL_CALL(262, tgl_real_glDeleteRenderbuffers(p0, p1));
+}
+static PFNGLGENRENDERBUFFERSPROC tgl_real_glGenRenderbuffers = 0;
+static void APIENTRY tgl_wrap_glGenRenderbuffers(GLsizei p0, GLuint *p1) {
+    TGL_CALL(263, tgl_real_glGenRenderbuffers(p0, p1));
+}
+static PFNGLRENDERBUFFERSTORAGEPROC tgl_real_glRenderbufferStorage = 0;
+static void APIENTRY tgl_wrap_glRenderbufferStorage(GLenum p0, GLenum p1, GLsizei p2, GLsizei p3) {
+    TGL_CALL(264, tgl_real_glRenderbufferStorage(p0, p1, p2, p3));
+}
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC tgl_real_glGetRenderbufferParameteriv = 0;
+static void APIENTRY tgl_wrap_glGetRenderbufferParameteriv(GLenum p0, GLenum p1, GLint *p2) {
+    TGL_CALL(265, tgl_real_glGetRenderbufferParameteriv(p0, p1, p2));
+}
+static PFNGLISFRAMEBUFFERPROC tgl_real_glIsFramebuffer = 0;
+static GLboolean APIENTRY tgl_wrap_glIsFramebuffer(GLuint p0) {
+    GLboolean result;
+    TGL_CALL(266, result = tgl_real_glIsFramebuffer(p0));
+    return result;
+}
+static PFNGLBINDFRAMEBUFFERPROC tgl_real_glBindFramebuffer = 0;
+static void APIENTRY tgl_wrap_glBindFramebuffer(GLenum p0, GLuint p1) {
+    TGL_CALL(267, tgl_real_glBindFramebuffer(p0, p1));
+}
+static PFNGLDELETEFRAMEBUFFERSPROC tgl_real_glDeleteFramebuffers = 0;
+static void APIENTRY tgl_wrap_glDeleteFramebuffers(GLsizei p0, const GLuint *p1) {
+    TGL_CALL(268, tgl_real_glDeleteFramebuffers(p0, p1));
+}
+static PFNGLGENFRAMEBUFFERSPROC tgl_real_glGenFramebuffers = 0;
+static void APIENTRY tgl_wrap_glGenFramebuffers(GLsizei p0, GLuint *p1) {
+    TGL_CALL(269, tgl_real_glGenFramebuffers(p0, p1));
+}
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC tgl_real_glCheckFramebufferStatus = 0;
+static GLenum APIENTRY tgl_wrap_glCheckFramebufferStatus(GLenum p0) {
+    GLenum result;
+    TGL_CALL(270, result = tgl_real_glCheckFramebufferStatus(p0));
+    return result;
+}
+static PFNGLFRAMEBUFFERTEXTURE1DPROC tgl_real_glFramebufferTexture1D = 0;
+static void APIENTRY tgl_wrap_glFramebufferTexture1D(GLenum p0, GLenum p1, GLenum p2, GLuint p3, GLint p4) {
+    TGL_CALL(271, tgl_real_glFramebufferTexture1D(p0, p1, p2, p3, p4));
+}
+static PFNGLFRAMEBUFFERTEXTURE2DPROC tgl_real_glFramebufferTexture2D = 0;
+static void APIENTRY tgl_wrap_glFramebufferTexture2D(GLenum p0, GLenum p1, GLenum p2, GLuint p3, GLint p4) {
+    TGL_CALL(272, tgl_real_glFramebufferTexture2D(p0, p1, p2, p3, p4));
+}
+static PFNGLFRAMEBUFFERTEXTURE3DPROC tgl_real_glFramebufferTexture3D = 0;
+static void APIENTRY tgl_wrap_glFramebufferTexture3D(GLenum p0, GLenum p1, GLenum p2, GLuint p3, GLint p4, GLint p5) {
+    TGL_CALL(273, tgl_real_glFramebufferTexture3D(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC tgl_real_glFramebufferRenderbuffer = 0;
+static void APIENTRY tgl_wrap_glFramebufferRenderbuffer(GLenum p0, GLenum p1, GLenum p2, GLuint p3) {
+    TGL_CALL(274, tgl_real_glFramebufferRenderbuffer(p0, p1, p2, p3));
+}
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC tgl_real_glGetFramebufferAttachmentParameteriv = 0;
+static void APIENTRY tgl_wrap_glGetFramebufferAttachmentParameteriv(GLenum p0, GLenum p1, GLenum p2, GLint *p3) {
+    TGL_CALL(275, tgl_real_glGetFramebufferAttachmentParameteriv(p0, p1, p2, p3));
+}
+static PFNGLGENERATEMIPMAPPROC tgl_real_glGenerateMipmap = 0;
+static void APIENTRY tgl_wrap_glGenerateMipmap(GLenum p0) {
+    TGL_CALL(276, tgl_real_glGenerateMipmap(p0));
+}
+static PFNGLBLITFRAMEBUFFERPROC tgl_real_glBlitFramebuffer = 0;
+static void APIENTRY tgl_wrap_glBlitFramebuffer(GLint p0, GLint p1, GLint p2, GLint p3, GLint p4, GLint p5, GLint p6, GLint p7, GLbitfield p8, GLenum p9) {
+    TGL_CALL(277, tgl_real_glBlitFramebuffer(p0, p1, p2, p3, p4, p5, p6, p7, p8, p9));
+}
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC tgl_real_glRenderbufferStorageMultisample = 0;
+static void APIENTRY tgl_wrap_glRenderbufferStorageMultisample(GLenum p0, GLsizei p1, GLenum p2, GLsizei p3, GLsizei p4) {
+    TGL_CALL(278, tgl_real_glRenderbufferStorageMultisample(p0, p1, p2, p3, p4));
+}
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC tgl_real_glFramebufferTextureLayer = 0;
+static void APIENTRY tgl_wrap_glFramebufferTextureLayer(GLenum p0, GLenum p1, GLuint p2, GLint p3, GLint p4) {
+    TGL_CALL(279, tgl_real_glFramebufferTextureLayer(p0, p1, p2, p3, p4));
+}
+static PFNGLMAPBUFFERRANGEPROC tgl_real_glMapBufferRange = 0;
+static void *APIENTRY tgl_wrap_glMapBufferRange(GLenum p0, GLintptr p1, GLsizeiptr p2, GLbitfield p3) {
+    void *result;
+    TGL_CALL(280, result = tgl_real_glMapBufferRange(p0, p1, p2, p3));
+    return result;
+}
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC tgl_real_glFlushMappedBufferRange = 0;
+static void APIENTRY tgl_wrap_glFlushMappedBufferRange(GLenum p0, GLintptr p1, GLsizeiptr p2) {
+    TGL_CALL(281, tgl_real_glFlushMappedBufferRange(p0, p1, p2));
+}
+static PFNGLBINDVERTEXARRAYPROC tgl_real_glBindVertexArray = 0;
+static void APIENTRY tgl_wrap_glBindVertexArray(GLuint p0) {
+    TGL_CALL(282, tgl_real_glBindVertexArray(p0));
+}
+static PFNGLDELETEVERTEXARRAYSPROC tgl_real_glDeleteVertexArrays = 0;
+static void APIENTRY tgl_wrap_glDeleteVertexArrays(GLsizei p0, const GLuint *p1) {
+    TGL_CALL(283, tgl_real_glDeleteVertexArrays(p0, p1));
+}
+static PFNGLGENVERTEXARRAYSPROC tgl_real_glGenVertexArrays = 0;
+static void APIENTRY tgl_wrap_glGenVertexArrays(GLsizei p0, GLuint *p1) {
+    TGL_CALL(284, tgl_real_glGenVertexArrays(p0, p1));
+}
+static PFNGLISVERTEXARRAYPROC tgl_real_glIsVertexArray = 0;
+static GLboolean APIENTRY tgl_wrap_glIsVertexArray(GLuint p0) {
+    GLboolean result;
+    TGL_CALL(285, result = tgl_real_glIsVertexArray(p0));
+    return result;
+}
+#endif
+
+/* GL_version_3_1 */
+#if defined(TGL_DEFINE_CORE_GL_3_1)
+static PFNGLDRAWARRAYSINSTANCEDPROC tgl_real_glDrawArraysInstanced = 0;
+static void APIENTRY tgl_wrap_glDrawArraysInstanced(GLenum p0, GLint p1, GLsizei p2, GLsizei p3) {
+    TGL_CALL(286, tgl_real_glDrawArraysInstanced(p0, p1, p2, p3));
+}
+static PFNGLDRAWELEMENTSINSTANCEDPROC tgl_real_glDrawElementsInstanced = 0;
+static void APIENTRY tgl_wrap_glDrawElementsInstanced(GLenum p0, GLsizei p1, GLenum p2, const void *p3, GLsizei p4) {
+    TGL_CALL(287, tgl_real_glDrawElementsInstanced(p0, p1, p2, p3, p4));
+}
+static PFNGLTEXBUFFERPROC tgl_real_glTexBuffer = 0;
+static void APIENTRY tgl_wrap_glTexBuffer(GLenum p0, GLenum p1, GLuint p2) {
+    TGL_CALL(288, tgl_real_glTexBuffer(p0, p1, p2));
+}
+static PFNGLPRIMITIVERESTARTINDEXPROC tgl_real_glPrimitiveRestartIndex = 0;
+static void APIENTRY tgl_wrap_glPrimitiveRestartIndex(GLuint p0) {
+    TGL_CALL(289, tgl_real_glPrimitiveRestartIndex(p0));
+}
+static PFNGLCOPYBUFFERSUBDATAPROC tgl_real_glCopyBufferSubData = 0;
+static void APIENTRY tgl_wrap_glCopyBufferSubData(GLenum p0, GLenum p1, GLintptr p2, GLintptr p3, GLsizeiptr p4) {
+    TGL_CALL(290, tgl_real_glCopyBufferSubData(p0, p1, p2, p3, p4));
+}
+static PFNGLGETUNIFORMINDICESPROC tgl_real_glGetUniformIndices = 0;
+static void APIENTRY tgl_wrap_glGetUniformIndices(GLuint p0, GLsizei p1, const GLchar *const*p2, GLuint *p3) {
+    TGL_CALL(291, tgl_real_glGetUniformIndices(p0, p1, p2, p3));
+}
+static PFNGLGETACTIVEUNIFORMSIVPROC tgl_real_glGetActiveUniformsiv = 0;
+static void APIENTRY tgl_wrap_glGetActiveUniformsiv(GLuint p0, GLsizei p1, const GLuint *p2, GLenum p3, GLint *p4) {
+    TGL_CALL(292, tgl_real_glGetActiveUniformsiv(p0, p1, p2, p3, p4));
+}
+static PFNGLGETACTIVEUNIFORMNAMEPROC tgl_real_glGetActiveUniformName = 0;
+static void APIENTRY tgl_wrap_glGetActiveUniformName(GLuint p0, GLuint p1, GLsizei p2, GLsizei *p3, GLchar *p4) {
+    TGL_CALL(293, tgl_real_glGetActiveUniformName(p0, p1, p2, p3, p4));
+}
+static PFNGLGETUNIFORMBLOCKINDEXPROC tgl_real_glGetUniformBlockIndex = 0;
+static GLuint APIENTRY tgl_wrap_glGetUniformBlockIndex(GLuint p0, const GLchar *p1) {
+    GLuint result;
+    TGL_CALL(294, result = tgl_real_glGetUniformBlockIndex(p0, p1));
+    return result;
+}
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC tgl_real_glGetActiveUniformBlockiv = 0;
+static void APIENTRY tgl_wrap_glGetActiveUniformBlockiv(GLuint p0, GLuint p1, GLenum p2, GLint *p3) {
+    TGL_CALL(295, tgl_real_glGetActiveUniformBlockiv(p0, p1, p2, p3));
+}
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC tgl_real_glGetActiveUniformBlockName = 0;
+static void APIENTRY tgl_wrap_glGetActiveUniformBlockName(GLuint p0, GLuint p1, GLsizei p2, GLsizei *p3, GLchar *p4) {
+    TGL_CALL(296, tgl_real_glGetActiveUniformBlockName(p0, p1, p2, p3, p4));
+}
+static PFNGLUNIFORMBLOCKBINDINGPROC tgl_real_glUniformBlockBinding = 0;
+static void APIENTRY tgl_wrap_glUniformBlockBinding(GLuint p0, GLuint p1, GLuint p2) {
+    TGL_CALL(297, tgl_real_glUniformBlockBinding(p0, p1, p2));
+}
+#endif
+
+/* GL_version_3_2 */
+#if defined(TGL_DEFINE_CORE_GL_3_2)
+static PFNGLGETINTEGER64I_VPROC tgl_real_glGetInteger64i_v = 0;
+static void APIENTRY tgl_wrap_glGetInteger64i_v(GLenum p0, GLuint p1, GLint64 *p2) {
+    TGL_CALL(298, tgl_real_glGetInteger64i_v(p0, p1, p2));
+}
+static PFNGLGETBUFFERPARAMETERI64VPROC tgl_real_glGetBufferParameteri64v = 0;
+static void APIENTRY tgl_wrap_glGetBufferParameteri64v(GLenum p0, GLenum p1, GLint64 *p2) {
+    TGL_CALL(299, tgl_real_glGetBufferParameteri64v(p0, p1, p2));
+}
+static PFNGLFRAMEBUFFERTEXTUREPROC tgl_real_glFramebufferTexture = 0;
+static void APIENTRY tgl_wrap_glFramebufferTexture(GLenum p0, GLenum p1, GLuint p2, GLint p3) {
+    TGL_CALL(300, tgl_real_glFramebufferTexture(p0, p1, p2, p3));
+}
+static PFNGLDRAWELEMENTSBASEVERTEXPROC tgl_real_glDrawElementsBaseVertex = 0;
+static void APIENTRY tgl_wrap_glDrawElementsBaseVertex(GLenum p0, GLsizei p1, GLenum p2, const void *p3, GLint p4) {
+    TGL_CALL(301, tgl_real_glDrawElementsBaseVertex(p0, p1, p2, p3, p4));
+}
+static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC tgl_real_glDrawRangeElementsBaseVertex = 0;
+static void APIENTRY tgl_wrap_glDrawRangeElementsBaseVertex(GLenum p0, GLuint p1, GLuint p2, GLsizei p3, GLenum p4, const void *p5, GLint p6) {
+    TGL_CALL(302, tgl_real_glDrawRangeElementsBaseVertex(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC tgl_real_glDrawElementsInstancedBaseVertex = 0;
+static void APIENTRY tgl_wrap_glDrawElementsInstancedBaseVertex(GLenum p0, GLsizei p1, GLenum p2, const void *p3, GLsizei p4, GLint p5) {
+    TGL_CALL(303, tgl_real_glDrawElementsInstancedBaseVertex(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC tgl_real_glMultiDrawElementsBaseVertex = 0;
+static void APIENTRY tgl_wrap_glMultiDrawElementsBaseVertex(GLenum p0, const GLsizei *p1, GLenum p2, const void *const*p3, GLsizei p4, const GLint *p5) {
+    TGL_CALL(304, tgl_real_glMultiDrawElementsBaseVertex(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLPROVOKINGVERTEXPROC tgl_real_glProvokingVertex = 0;
+static void APIENTRY tgl_wrap_glProvokingVertex(GLenum p0) {
+    TGL_CALL(305, tgl_real_glProvokingVertex(p0));
+}
+static PFNGLFENCESYNCPROC tgl_real_glFenceSync = 0;
+static GLsync APIENTRY tgl_wrap_glFenceSync(GLenum p0, GLbitfield p1) {
+    GLsync result;
+    TGL_CALL(306, result = tgl_real_glFenceSync(p0, p1));
+    return result;
+}
+static PFNGLISSYNCPROC tgl_real_glIsSync = 0;
+static GLboolean APIENTRY tgl_wrap_glIsSync(GLsync p0) {
+    GLboolean result;
+    TGL_CALL(307, result = tgl_real_glIsSync(p0));
+    return result;
+}
+static PFNGLDELETESYNCPROC tgl_real_glDeleteSync = 0;
+static void APIENTRY tgl_wrap_glDeleteSync(GLsync p0) {
+    TGL_CALL(308, tgl_real_glDeleteSync(p0));
+}
+static PFNGLCLIENTWAITSYNCPROC tgl_real_glClientWaitSync = 0;
+static GLenum APIENTRY tgl_wrap_glClientWaitSync(GLsync p0, GLbitfield p1, GLuint64 p2) {
+    GLenum result;
+    TGL_CALL(309, result = tgl_real_glClientWaitSync(p0, p1, p2));
+    return result;
+}
+static PFNGLWAITSYNCPROC tgl_real_glWaitSync = 0;
+static void APIENTRY tgl_wrap_glWaitSync(GLsync p0, GLbitfield p1, GLuint64 p2) {
+    TGL_CALL(310, tgl_real_glWaitSync(p0, p1, p2));
+}
+static PFNGLGETINTEGER64VPROC tgl_real_glGetInteger64v = 0;
+static void APIENTRY tgl_wrap_glGetInteger64v(GLenum p0, GLint64 *p1) {
+    TGL_CALL(311, tgl_real_glGetInteger64v(p0, p1));
+}
+static PFNGLGETSYNCIVPROC tgl_real_glGetSynciv = 0;
+static void APIENTRY tgl_wrap_glGetSynciv(GLsync p0, GLenum p1, GLsizei p2, GLsizei *p3, GLint *p4) {
+    TGL_CALL(312, tgl_real_glGetSynciv(p0, p1, p2, p3, p4));
+}
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC tgl_real_glTexImage2DMultisample = 0;
+static void APIENTRY tgl_wrap_glTexImage2DMultisample(GLenum p0, GLsizei p1, GLenum p2, GLsizei p3, GLsizei p4, GLboolean p5) {
+    TGL_CALL(313, tgl_real_glTexImage2DMultisample(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC tgl_real_glTexImage3DMultisample = 0;
+static void APIENTRY tgl_wrap_glTexImage3DMultisample(GLenum p0, GLsizei p1, GLenum p2, GLsizei p3, GLsizei p4, GLsizei p5, GLboolean p6) {
+    TGL_CALL(314, tgl_real_glTexImage3DMultisample(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLGETMULTISAMPLEFVPROC tgl_real_glGetMultisamplefv = 0;
+static void APIENTRY tgl_wrap_glGetMultisamplefv(GLenum p0, GLuint p1, GLfloat *p2) {
+    TGL_CALL(315, tgl_real_glGetMultisamplefv(p0, p1, p2));
+}
+static PFNGLSAMPLEMASKIPROC tgl_real_glSampleMaski = 0;
+static void APIENTRY tgl_wrap_glSampleMaski(GLuint p0, GLbitfield p1) {
+    TGL_CALL(316, tgl_real_glSampleMaski(p0, p1));
+}
+#endif
+
+/* GL_version_3_3 */
+#if defined(TGL_DEFINE_CORE_GL_3_3)
+static PFNGLVERTEXATTRIBDIVISORPROC tgl_real_glVertexAttribDivisor = 0;
+static void APIENTRY tgl_wrap_glVertexAttribDivisor(GLuint p0, GLuint p1) {
+    TGL_CALL(317, tgl_real_glVertexAttribDivisor(p0, p1));
+}
+static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC tgl_real_glBindFragDataLocationIndexed = 0;
+static void APIENTRY tgl_wrap_glBindFragDataLocationIndexed(GLuint p0, GLuint p1, GLuint p2, const GLchar *p3) {
+    TGL_CALL(318, tgl_real_glBindFragDataLocationIndexed(p0, p1, p2, p3));
+}
+static PFNGLGETFRAGDATAINDEXPROC tgl_real_glGetFragDataIndex = 0;
+static GLint APIENTRY tgl_wrap_glGetFragDataIndex(GLuint p0, const GLchar *p1) {
+    GLint result;
+    TGL_CALL(319, result = tgl_real_glGetFragDataIndex(p0, p1));
+    return result;
+}
+static PFNGLGENSAMPLERSPROC tgl_real_glGenSamplers = 0;
+static void APIENTRY tgl_wrap_glGenSamplers(GLsizei p0, GLuint *p1) {
+    TGL_CALL(320, tgl_real_glGenSamplers(p0, p1));
+}
+static PFNGLDELETESAMPLERSPROC tgl_real_glDeleteSamplers = 0;
+static void APIENTRY tgl_wrap_glDeleteSamplers(GLsizei p0, const GLuint *p1) {
+    TGL_CALL(321, tgl_real_glDeleteSamplers(p0, p1));
+}
+static PFNGLISSAMPLERPROC tgl_real_glIsSampler = 0;
+static GLboolean APIENTRY tgl_wrap_glIsSampler(GLuint p0) {
+    GLboolean result;
+    TGL_CALL(322, result = tgl_real_glIsSampler(p0));
+    return result;
+}
+static PFNGLBINDSAMPLERPROC tgl_real_glBindSampler = 0;
+static void APIENTRY tgl_wrap_glBindSampler(GLuint p0, GLuint p1) {
+    TGL_CALL(323, tgl_real_glBindSampler(p0, p1));
+}
+static PFNGLSAMPLERPARAMETERIPROC tgl_real_glSamplerParameteri = 0;
+static void APIENTRY tgl_wrap_glSamplerParameteri(GLuint p0, GLenum p1, GLint p2) {
+    TGL_CALL(324, tgl_real_glSamplerParameteri(p0, p1, p2));
+}
+static PFNGLSAMPLERPARAMETERIVPROC tgl_real_glSamplerParameteriv = 0;
+static void APIENTRY tgl_wrap_glSamplerParameteriv(GLuint p0, GLenum p1, const GLint *p2) {
+    TGL_CALL(325, tgl_real_glSamplerParameteriv(p0, p1, p2));
+}
+static PFNGLSAMPLERPARAMETERFPROC tgl_real_glSamplerParameterf = 0;
+static void APIENTRY tgl_wrap_glSamplerParameterf(GLuint p0, GLenum p1, GLfloat p2) {
+    TGL_CALL(326, tgl_real_glSamplerParameterf(p0, p1, p2));
+}
+static PFNGLSAMPLERPARAMETERFVPROC tgl_real_glSamplerParameterfv = 0;
+static void APIENTRY tgl_wrap_glSamplerParameterfv(GLuint p0, GLenum p1, const GLfloat *p2) {
+    TGL_CALL(327, tgl_real_glSamplerParameterfv(p0, p1, p2));
+}
+static PFNGLSAMPLERPARAMETERIIVPROC tgl_real_glSamplerParameterIiv = 0;
+static void APIENTRY tgl_wrap_glSamplerParameterIiv(GLuint p0, GLenum p1, const GLint *p2) {
+    TGL_CALL(328, tgl_real_glSamplerParameterIiv(p0, p1, p2));
+}
+static PFNGLSAMPLERPARAMETERIUIVPROC tgl_real_glSamplerParameterIuiv = 0;
+static void APIENTRY tgl_wrap_glSamplerParameterIuiv(GLuint p0, GLenum p1, const GLuint *p2) {
+    TGL_CALL(329, tgl_real_glSamplerParameterIuiv(p0, p1, p2));
+}
+static PFNGLGETSAMPLERPARAMETERIVPROC tgl_real_glGetSamplerParameteriv = 0;
+static void APIENTRY tgl_wrap_glGetSamplerParameteriv(GLuint p0, GLenum p1, GLint *p2) {
+    TGL_CALL(330, tgl_real_glGetSamplerParameteriv(p0, p1, p2));
+}
+static PFNGLGETSAMPLERPARAMETERIIVPROC tgl_real_glGetSamplerParameterIiv = 0;
+static void APIENTRY tgl_wrap_glGetSamplerParameterIiv(GLuint p0, GLenum p1, GLint *p2) {
+    TGL_CALL(331, tgl_real_glGetSamplerParameterIiv(p0, p1, p2));
+}
+static PFNGLGETSAMPLERPARAMETERFVPROC tgl_real_glGetSamplerParameterfv = 0;
+static void APIENTRY tgl_wrap_glGetSamplerParameterfv(GLuint p0, GLenum p1, GLfloat *p2) {
+    TGL_CALL(332, tgl_real_glGetSamplerParameterfv(p0, p1, p2));
+}
+static PFNGLGETSAMPLERPARAMETERIUIVPROC tgl_real_glGetSamplerParameterIuiv = 0;
+static void APIENTRY tgl_wrap_glGetSamplerParameterIuiv(GLuint p0, GLenum p1, GLuint *p2) {
+    TGL_CALL(333, tgl_real_glGetSamplerParameterIuiv(p0, p1, p2));
+}
+static PFNGLQUERYCOUNTERPROC tgl_real_glQueryCounter = 0;
+static void APIENTRY tgl_wrap_glQueryCounter(GLuint p0, GLenum p1) {
+    TGL_CALL(334, tgl_real_glQueryCounter(p0, p1));
+}
+static PFNGLGETQUERYOBJECTI64VPROC tgl_real_glGetQueryObjecti64v = 0;
+static void APIENTRY tgl_wrap_glGetQueryObjecti64v(GLuint p0, GLenum p1, GLint64 *p2) {
+    TGL_CALL(335, tgl_real_glGetQueryObjecti64v(p0, p1, p2));
+}
+static PFNGLGETQUERYOBJECTUI64VPROC tgl_real_glGetQueryObjectui64v = 0;
+static void APIENTRY tgl_wrap_glGetQueryObjectui64v(GLuint p0, GLenum p1, GLuint64 *p2) {
+    TGL_CALL(336, tgl_real_glGetQueryObjectui64v(p0, p1, p2));
+}
+static PFNGLVERTEXATTRIBP1UIPROC tgl_real_glVertexAttribP1ui = 0;
+static void APIENTRY tgl_wrap_glVertexAttribP1ui(GLuint p0, GLenum p1, GLboolean p2, GLuint p3) {
+    TGL_CALL(337, tgl_real_glVertexAttribP1ui(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIBP1UIVPROC tgl_real_glVertexAttribP1uiv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribP1uiv(GLuint p0, GLenum p1, GLboolean p2, const GLuint *p3) {
+    TGL_CALL(338, tgl_real_glVertexAttribP1uiv(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIBP2UIPROC tgl_real_glVertexAttribP2ui = 0;
+static void APIENTRY tgl_wrap_glVertexAttribP2ui(GLuint p0, GLenum p1, GLboolean p2, GLuint p3) {
+    TGL_CALL(339, tgl_real_glVertexAttribP2ui(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIBP2UIVPROC tgl_real_glVertexAttribP2uiv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribP2uiv(GLuint p0, GLenum p1, GLboolean p2, const GLuint *p3) {
+    TGL_CALL(340, tgl_real_glVertexAttribP2uiv(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIBP3UIPROC tgl_real_glVertexAttribP3ui = 0;
+static void APIENTRY tgl_wrap_glVertexAttribP3ui(GLuint p0, GLenum p1, GLboolean p2, GLuint p3) {
+    TGL_CALL(341, tgl_real_glVertexAttribP3ui(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIBP3UIVPROC tgl_real_glVertexAttribP3uiv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribP3uiv(GLuint p0, GLenum p1, GLboolean p2, const GLuint *p3) {
+    TGL_CALL(342, tgl_real_glVertexAttribP3uiv(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIBP4UIPROC tgl_real_glVertexAttribP4ui = 0;
+static void APIENTRY tgl_wrap_glVertexAttribP4ui(GLuint p0, GLenum p1, GLboolean p2, GLuint p3) {
+    TGL_CALL(343, tgl_real_glVertexAttribP4ui(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIBP4UIVPROC tgl_real_glVertexAttribP4uiv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribP4uiv(GLuint p0, GLenum p1, GLboolean p2, const GLuint *p3) {
+    TGL_CALL(344, tgl_real_glVertexAttribP4uiv(p0, p1, p2, p3));
+}
+#endif
+
+/* GL_version_4_0 */
+#if defined(TGL_DEFINE_CORE_GL_4_0)
+static PFNGLMINSAMPLESHADINGPROC tgl_real_glMinSampleShading = 0;
+static void APIENTRY tgl_wrap_glMinSampleShading(GLfloat p0) {
+    TGL_CALL(345, tgl_real_glMinSampleShading(p0));
+}
+static PFNGLBLENDEQUATIONIPROC tgl_real_glBlendEquationi = 0;
+static void APIENTRY tgl_wrap_glBlendEquationi(GLuint p0, GLenum p1) {
+    TGL_CALL(346, tgl_real_glBlendEquationi(p0, p1));
+}
+static PFNGLBLENDEQUATIONSEPARATEIPROC tgl_real_glBlendEquationSeparatei = 0;
+static void APIENTRY tgl_wrap_glBlendEquationSeparatei(GLuint p0, GLenum p1, GLenum p2) {
+    TGL_CALL(347, tgl_real_glBlendEquationSeparatei(p0, p1, p2));
+}
+static PFNGLBLENDFUNCIPROC tgl_real_glBlendFunci = 0;
+static void APIENTRY tgl_wrap_glBlendFunci(GLuint p0, GLenum p1, GLenum p2) {
+    TGL_CALL(348, tgl_real_glBlendFunci(p0, p1, p2));
+}
+static PFNGLBLENDFUNCSEPARATEIPROC tgl_real_glBlendFuncSeparatei = 0;
+static void APIENTRY tgl_wrap_glBlendFuncSeparatei(GLuint p0, GLenum p1, GLenum p2, GLenum p3, GLenum p4) {
+    TGL_CALL(349, tgl_real_glBlendFuncSeparatei(p0, p1, p2, p3, p4));
+}
+static PFNGLDRAWARRAYSINDIRECTPROC tgl_real_glDrawArraysIndirect = 0;
+static void APIENTRY tgl_wrap_glDrawArraysIndirect(GLenum p0, const void *p1) {
+    TGL_CALL(350, tgl_real_glDrawArraysIndirect(p0, p1));
+}
+static PFNGLDRAWELEMENTSINDIRECTPROC tgl_real_glDrawElementsIndirect = 0;
+static void APIENTRY tgl_wrap_glDrawElementsIndirect(GLenum p0, GLenum p1, const void *p2) {
+    TGL_CALL(351, tgl_real_glDrawElementsIndirect(p0, p1, p2));
+}
+static PFNGLUNIFORM1DPROC tgl_real_glUniform1d = 0;
+static void APIENTRY tgl_wrap_glUniform1d(GLint p0, GLdouble p1) {
+    TGL_CALL(352, tgl_real_glUniform1d(p0, p1));
+}
+static PFNGLUNIFORM2DPROC tgl_real_glUniform2d = 0;
+static void APIENTRY tgl_wrap_glUniform2d(GLint p0, GLdouble p1, GLdouble p2) {
+    TGL_CALL(353, tgl_real_glUniform2d(p0, p1, p2));
+}
+static PFNGLUNIFORM3DPROC tgl_real_glUniform3d = 0;
+static void APIENTRY tgl_wrap_glUniform3d(GLint p0, GLdouble p1, GLdouble p2, GLdouble p3) {
+    TGL_CALL(354, tgl_real_glUniform3d(p0, p1, p2, p3));
+}
+static PFNGLUNIFORM4DPROC tgl_real_glUniform4d = 0;
+static void APIENTRY tgl_wrap_glUniform4d(GLint p0, GLdouble p1, GLdouble p2, GLdouble p3, GLdouble p4) {
+    TGL_CALL(355, tgl_real_glUniform4d(p0, p1, p2, p3, p4));
+}
+static PFNGLUNIFORM1DVPROC tgl_real_glUniform1dv = 0;
+static void APIENTRY tgl_wrap_glUniform1dv(GLint p0, GLsizei p1, const GLdouble *p2) {
+    TGL_CALL(356, tgl_real_glUniform1dv(p0, p1, p2));
+}
+static PFNGLUNIFORM2DVPROC tgl_real_glUniform2dv = 0;
+static void APIENTRY tgl_wrap_glUniform2dv(GLint p0, GLsizei p1, const GLdouble *p2) {
+    TGL_CALL(357, tgl_real_glUniform2dv(p0, p1, p2));
+}
+static PFNGLUNIFORM3DVPROC tgl_real_glUniform3dv = 0;
+static void APIENTRY tgl_wrap_glUniform3dv(GLint p0, GLsizei p1, const GLdouble *p2) {
+    TGL_CALL(358, tgl_real_glUniform3dv(p0, p1, p2));
+}
+static PFNGLUNIFORM4DVPROC tgl_real_glUniform4dv = 0;
+static void APIENTRY tgl_wrap_glUniform4dv(GLint p0, GLsizei p1, const GLdouble *p2) {
+    TGL_CALL(359, tgl_real_glUniform4dv(p0, p1, p2));
+}
+static PFNGLUNIFORMMATRIX2DVPROC tgl_real_glUniformMatrix2dv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix2dv(GLint p0, GLsizei p1, GLboolean p2, const GLdouble *p3) {
+    TGL_CALL(360, tgl_real_glUniformMatrix2dv(p0, p1, p2, p3));
+}
+static PFNGLUNIFORMMATRIX3DVPROC tgl_real_glUniformMatrix3dv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix3dv(GLint p0, GLsizei p1, GLboolean p2, const GLdouble *p3) {
+    TGL_CALL(361, tgl_real_glUniformMatrix3dv(p0, p1, p2, p3));
+}
+static PFNGLUNIFORMMATRIX4DVPROC tgl_real_glUniformMatrix4dv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix4dv(GLint p0, GLsizei p1, GLboolean p2, const GLdouble *p3) {
+    TGL_CALL(362, tgl_real_glUniformMatrix4dv(p0, p1, p2, p3));
+}
+static PFNGLUNIFORMMATRIX2X3DVPROC tgl_real_glUniformMatrix2x3dv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix2x3dv(GLint p0, GLsizei p1, GLboolean p2, const GLdouble *p3) {
+    TGL_CALL(363, tgl_real_glUniformMatrix2x3dv(p0, p1, p2, p3));
+}
+static PFNGLUNIFORMMATRIX2X4DVPROC tgl_real_glUniformMatrix2x4dv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix2x4dv(GLint p0, GLsizei p1, GLboolean p2, const GLdouble *p3) {
+    TGL_CALL(364, tgl_real_glUniformMatrix2x4dv(p0, p1, p2, p3));
+}
+static PFNGLUNIFORMMATRIX3X2DVPROC tgl_real_glUniformMatrix3x2dv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix3x2dv(GLint p0, GLsizei p1, GLboolean p2, const GLdouble *p3) {
+    TGL_CALL(365, tgl_real_glUniformMatrix3x2dv(p0, p1, p2, p3));
+}
+static PFNGLUNIFORMMATRIX3X4DVPROC tgl_real_glUniformMatrix3x4dv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix3x4dv(GLint p0, GLsizei p1, GLboolean p2, const GLdouble *p3) {
+    TGL_CALL(366, tgl_real_glUniformMatrix3x4dv(p0, p1, p2, p3));
+}
+static PFNGLUNIFORMMATRIX4X2DVPROC tgl_real_glUniformMatrix4x2dv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix4x2dv(GLint p0, GLsizei p1, GLboolean p2, const GLdouble *p3) {
+    TGL_CALL(367, tgl_real_glUniformMatrix4x2dv(p0, p1, p2, p3));
+}
+static PFNGLUNIFORMMATRIX4X3DVPROC tgl_real_glUniformMatrix4x3dv = 0;
+static void APIENTRY tgl_wrap_glUniformMatrix4x3dv(GLint p0, GLsizei p1, GLboolean p2, const GLdouble *p3) {
+    TGL_CALL(368, tgl_real_glUniformMatrix4x3dv(p0, p1, p2, p3));
+}
+static PFNGLGETUNIFORMDVPROC tgl_real_glGetUniformdv = 0;
+static void APIENTRY tgl_wrap_glGetUniformdv(GLuint p0, GLint p1, GLdouble *p2) {
+    TGL_CALL(369, tgl_real_glGetUniformdv(p0, p1, p2));
+}
+static PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC tgl_real_glGetSubroutineUniformLocation = 0;
+static GLint APIENTRY tgl_wrap_glGetSubroutineUniformLocation(GLuint p0, GLenum p1, const GLchar *p2) {
+    GLint result;
+    TGL_CALL(370, result = tgl_real_glGetSubroutineUniformLocation(p0, p1, p2));
+    return result;
+}
+static PFNGLGETSUBROUTINEINDEXPROC tgl_real_glGetSubroutineIndex = 0;
+static GLuint APIENTRY tgl_wrap_glGetSubroutineIndex(GLuint p0, GLenum p1, const GLchar *p2) {
+    GLuint result;
+    TGL_CALL(371, result = tgl_real_glGetSubroutineIndex(p0, p1, p2));
+    return result;
+}
+static PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC tgl_real_glGetActiveSubroutineUniformiv = 0;
+static void APIENTRY tgl_wrap_glGetActiveSubroutineUniformiv(GLuint p0, GLenum p1, GLuint p2, GLenum p3, GLint *p4) {
+    TGL_CALL(372, tgl_real_glGetActiveSubroutineUniformiv(p0, p1, p2, p3, p4));
+}
+static PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC tgl_real_glGetActiveSubroutineUniformName = 0;
+static void APIENTRY tgl_wrap_glGetActiveSubroutineUniformName(GLuint p0, GLenum p1, GLuint p2, GLsizei p3, GLsizei *p4, GLchar *p5) {
+    TGL_CALL(373, tgl_real_glGetActiveSubroutineUniformName(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLGETACTIVESUBROUTINENAMEPROC tgl_real_glGetActiveSubroutineName = 0;
+static void APIENTRY tgl_wrap_glGetActiveSubroutineName(GLuint p0, GLenum p1, GLuint p2, GLsizei p3, GLsizei *p4, GLchar *p5) {
+    TGL_CALL(374, tgl_real_glGetActiveSubroutineName(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLUNIFORMSUBROUTINESUIVPROC tgl_real_glUniformSubroutinesuiv = 0;
+static void APIENTRY tgl_wrap_glUniformSubroutinesuiv(GLenum p0, GLsizei p1, const GLuint *p2) {
+    TGL_CALL(375, tgl_real_glUniformSubroutinesuiv(p0, p1, p2));
+}
+static PFNGLGETUNIFORMSUBROUTINEUIVPROC tgl_real_glGetUniformSubroutineuiv = 0;
+static void APIENTRY tgl_wrap_glGetUniformSubroutineuiv(GLenum p0, GLint p1, GLuint *p2) {
+    TGL_CALL(376, tgl_real_glGetUniformSubroutineuiv(p0, p1, p2));
+}
+static PFNGLGETPROGRAMSTAGEIVPROC tgl_real_glGetProgramStageiv = 0;
+static void APIENTRY tgl_wrap_glGetProgramStageiv(GLuint p0, GLenum p1, GLenum p2, GLint *p3) {
+    TGL_CALL(377, tgl_real_glGetProgramStageiv(p0, p1, p2, p3));
+}
+static PFNGLPATCHPARAMETERIPROC tgl_real_glPatchParameteri = 0;
+static void APIENTRY tgl_wrap_glPatchParameteri(GLenum p0, GLint p1) {
+    TGL_CALL(378, tgl_real_glPatchParameteri(p0, p1));
+}
+static PFNGLPATCHPARAMETERFVPROC tgl_real_glPatchParameterfv = 0;
+static void APIENTRY tgl_wrap_glPatchParameterfv(GLenum p0, const GLfloat *p1) {
+    TGL_CALL(379, tgl_real_glPatchParameterfv(p0, p1));
+}
+static PFNGLBINDTRANSFORMFEEDBACKPROC tgl_real_glBindTransformFeedback = 0;
+static void APIENTRY tgl_wrap_glBindTransformFeedback(GLenum p0, GLuint p1) {
+    TGL_CALL(380, tgl_real_glBindTransformFeedback(p0, p1));
+}
+static PFNGLDELETETRANSFORMFEEDBACKSPROC tgl_real_glDeleteTransformFeedbacks = 0;
+static void APIENTRY tgl_wrap_glDeleteTransformFeedbacks(GLsizei p0, const GLuint *p1) {
+    TGL_CALL(381, tgl_real_glDeleteTransformFeedbacks(p0, p1));
+}
+static PFNGLGENTRANSFORMFEEDBACKSPROC tgl_real_glGenTransformFeedbacks = 0;
+static void APIENTRY tgl_wrap_glGenTransformFeedbacks(GLsizei p0, GLuint *p1) {
+    TGL_CALL(382, tgl_real_glGenTransformFeedbacks(p0, p1));
+}
+static PFNGLISTRANSFORMFEEDBACKPROC tgl_real_glIsTransformFeedback = 0;
+static GLboolean APIENTRY tgl_wrap_glIsTransformFeedback(GLuint p0) {
+    GLboolean result;
+    TGL_CALL(383, result = tgl_real_glIsTransformFeedback(p0));
+    return result;
+}
+static PFNGLPAUSETRANSFORMFEEDBACKPROC tgl_real_glPauseTransformFeedback = 0;
+static void APIENTRY tgl_wrap_glPauseTransformFeedback(void) {
+    TGL_CALL(384, tgl_real_glPauseTransformFeedback());
+}
+static PFNGLRESUMETRANSFORMFEEDBACKPROC tgl_real_glResumeTransformFeedback = 0;
+static void APIENTRY tgl_wrap_glResumeTransformFeedback(void) {
+    TGL_CALL(385, tgl_real_glResumeTransformFeedback());
+}
+static PFNGLDRAWTRANSFORMFEEDBACKPROC tgl_real_glDrawTransformFeedback = 0;
+static void APIENTRY tgl_wrap_glDrawTransformFeedback(GLenum p0, GLuint p1) {
+    TGL_CALL(386, tgl_real_glDrawTransformFeedback(p0, p1));
+}
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC tgl_real_glDrawTransformFeedbackStream = 0;
+static void APIENTRY tgl_wrap_glDrawTransformFeedbackStream(GLenum p0, GLuint p1, GLuint p2) {
+    TGL_CALL(387, tgl_real_glDrawTransformFeedbackStream(p0, p1, p2));
+}
+static PFNGLBEGINQUERYINDEXEDPROC tgl_real_glBeginQueryIndexed = 0;
+static void APIENTRY tgl_wrap_glBeginQueryIndexed(GLenum p0, GLuint p1, GLuint p2) {
+    TGL_CALL(388, tgl_real_glBeginQueryIndexed(p0, p1, p2));
+}
+static PFNGLENDQUERYINDEXEDPROC tgl_real_glEndQueryIndexed = 0;
+static void APIENTRY tgl_wrap_glEndQueryIndexed(GLenum p0, GLuint p1) {
+    TGL_CALL(389, tgl_real_glEndQueryIndexed(p0, p1));
+}
+static PFNGLGETQUERYINDEXEDIVPROC tgl_real_glGetQueryIndexediv = 0;
+static void APIENTRY tgl_wrap_glGetQueryIndexediv(GLenum p0, GLuint p1, GLenum p2, GLint *p3) {
+    TGL_CALL(390, tgl_real_glGetQueryIndexediv(p0, p1, p2, p3));
+}
+#endif
+
+/* GL_version_4_1 */
+#if defined(TGL_DEFINE_CORE_GL_4_1)
+static PFNGLRELEASESHADERCOMPILERPROC tgl_real_glReleaseShaderCompiler = 0;
+static void APIENTRY tgl_wrap_glReleaseShaderCompiler(void) {
+    TGL_CALL(391, tgl_real_glReleaseShaderCompiler());
+}
+static PFNGLSHADERBINARYPROC tgl_real_glShaderBinary = 0;
+static void APIENTRY tgl_wrap_glShaderBinary(GLsizei p0, const GLuint *p1, GLenum p2, const void *p3, GLsizei p4) {
+    TGL_CALL(392, tgl_real_glShaderBinary(p0, p1, p2, p3, p4));
+}
+static PFNGLGETSHADERPRECISIONFORMATPROC tgl_real_glGetShaderPrecisionFormat = 0;
+static void APIENTRY tgl_wrap_glGetShaderPrecisionFormat(GLenum p0, GLenum p1, GLint *p2, GLint *p3) {
+    TGL_CALL(393, tgl_real_glGetShaderPrecisionFormat(p0, p1, p2, p3));
+}
+static PFNGLDEPTHRANGEFPROC tgl_real_glDepthRangef = 0;
+static void APIENTRY tgl_wrap_glDepthRangef(GLfloat p0, GLfloat p1) {
+    TGL_CALL(394, tgl_real_glDepthRangef(p0, p1));
+}
+static PFNGLCLEARDEPTHFPROC tgl_real_glClearDepthf = 0;
+static void APIENTRY tgl_wrap_glClearDepthf(GLfloat p0) {
+    TGL_CALL(395, tgl_real_glClearDepthf(p0));
+}
+static PFNGLGETPROGRAMBINARYPROC tgl_real_glGetProgramBinary = 0;
+static void APIENTRY tgl_wrap_glGetProgramBinary(GLuint p0, GLsizei p1, GLsizei *p2, GLenum *p3, void *p4) {
+    TGL_CALL(396, tgl_real_glGetProgramBinary(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMBINARYPROC tgl_real_glProgramBinary = 0;
+static void APIENTRY tgl_wrap_glProgramBinary(GLuint p0, GLenum p1, const void *p2, GLsizei p3) {
+    TGL_CALL(397, tgl_real_glProgramBinary(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMPARAMETERIPROC tgl_real_glProgramParameteri = 0;
+static void APIENTRY tgl_wrap_glProgramParameteri(GLuint p0, GLenum p1, GLint p2) {
+    TGL_CALL(398, tgl_real_glProgramParameteri(p0, p1, p2));
+}
+static PFNGLUSEPROGRAMSTAGESPROC tgl_real_glUseProgramStages = 0;
+static void APIENTRY tgl_wrap_glUseProgramStages(GLuint p0, GLbitfield p1, GLuint p2) {
+    TGL_CALL(399, tgl_real_glUseProgramStages(p0, p1, p2));
+}
+static PFNGLACTIVESHADERPROGRAMPROC tgl_real_glActiveShaderProgram = 0;
+static void APIENTRY tgl_wrap_glActiveShaderProgram(GLuint p0, GLuint p1) {
+    TGL_CALL(400, tgl_real_glActiveShaderProgram(p0, p1));
+}
+static PFNGLCREATESHADERPROGRAMVPROC tgl_real_glCreateShaderProgramv = 0;
+static GLuint APIENTRY tgl_wrap_glCreateShaderProgramv(GLenum p0, GLsizei p1, const GLchar *const*p2) {
+    GLuint result;
+    TGL_CALL(401, result = tgl_real_glCreateShaderProgramv(p0, p1, p2));
+    return result;
+}
+static PFNGLBINDPROGRAMPIPELINEPROC tgl_real_glBindProgramPipeline = 0;
+static void APIENTRY tgl_wrap_glBindProgramPipeline(GLuint p0) {
+    TGL_CALL(402, tgl_real_glBindProgramPipeline(p0));
+}
+static PFNGLDELETEPROGRAMPIPELINESPROC tgl_real_glDeleteProgramPipelines = 0;
+static void APIENTRY tgl_wrap_glDeleteProgramPipelines(GLsizei p0, const GLuint *p1) {
+    TGL_CALL(403, tgl_real_glDeleteProgramPipelines(p0, p1));
+}
+static PFNGLGENPROGRAMPIPELINESPROC tgl_real_glGenProgramPipelines = 0;
+static void APIENTRY tgl_wrap_glGenProgramPipelines(GLsizei p0, GLuint *p1) {
+    TGL_CALL(404, tgl_real_glGenProgramPipelines(p0, p1));
+}
+static PFNGLISPROGRAMPIPELINEPROC tgl_real_glIsProgramPipeline = 0;
+static GLboolean APIENTRY tgl_wrap_glIsProgramPipeline(GLuint p0) {
+    GLboolean result;
+    TGL_CALL(405, result = tgl_real_glIsProgramPipeline(p0));
+    return result;
+}
+static PFNGLGETPROGRAMPIPELINEIVPROC tgl_real_glGetProgramPipelineiv = 0;
+static void APIENTRY tgl_wrap_glGetProgramPipelineiv(GLuint p0, GLenum p1, GLint *p2) {
+    TGL_CALL(406, tgl_real_glGetProgramPipelineiv(p0, p1, p2));
+}
+static PFNGLPROGRAMUNIFORM1IPROC tgl_real_glProgramUniform1i = 0;
+static void APIENTRY tgl_wrap_glProgramUniform1i(GLuint p0, GLint p1, GLint p2) {
+    TGL_CALL(407, tgl_real_glProgramUniform1i(p0, p1, p2));
+}
+static PFNGLPROGRAMUNIFORM1IVPROC tgl_real_glProgramUniform1iv = 0;
+static void APIENTRY tgl_wrap_glProgramUniform1iv(GLuint p0, GLint p1, GLsizei p2, const GLint *p3) {
+    TGL_CALL(408, tgl_real_glProgramUniform1iv(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM1FPROC tgl_real_glProgramUniform1f = 0;
+static void APIENTRY tgl_wrap_glProgramUniform1f(GLuint p0, GLint p1, GLfloat p2) {
+    TGL_CALL(409, tgl_real_glProgramUniform1f(p0, p1, p2));
+}
+static PFNGLPROGRAMUNIFORM1FVPROC tgl_real_glProgramUniform1fv = 0;
+static void APIENTRY tgl_wrap_glProgramUniform1fv(GLuint p0, GLint p1, GLsizei p2, const GLfloat *p3) {
+    TGL_CALL(410, tgl_real_glProgramUniform1fv(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM1DPROC tgl_real_glProgramUniform1d = 0;
+static void APIENTRY tgl_wrap_glProgramUniform1d(GLuint p0, GLint p1, GLdouble p2) {
+    TGL_CALL(411, tgl_real_glProgramUniform1d(p0, p1, p2));
+}
+static PFNGLPROGRAMUNIFORM1DVPROC tgl_real_glProgramUniform1dv = 0;
+static void APIENTRY tgl_wrap_glProgramUniform1dv(GLuint p0, GLint p1, GLsizei p2, const GLdouble *p3) {
+    TGL_CALL(412, tgl_real_glProgramUniform1dv(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM1UIPROC tgl_real_glProgramUniform1ui = 0;
+static void APIENTRY tgl_wrap_glProgramUniform1ui(GLuint p0, GLint p1, GLuint p2) {
+    TGL_CALL(413, tgl_real_glProgramUniform1ui(p0, p1, p2));
+}
+static PFNGLPROGRAMUNIFORM1UIVPROC tgl_real_glProgramUniform1uiv = 0;
+static void APIENTRY tgl_wrap_glProgramUniform1uiv(GLuint p0, GLint p1, GLsizei p2, const GLuint *p3) {
+    TGL_CALL(414, tgl_real_glProgramUniform1uiv(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM2IPROC tgl_real_glProgramUniform2i = 0;
+static void APIENTRY tgl_wrap_glProgramUniform2i(GLuint p0, GLint p1, GLint p2, GLint p3) {
+    TGL_CALL(415, tgl_real_glProgramUniform2i(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM2IVPROC tgl_real_glProgramUniform2iv = 0;
+static void APIENTRY tgl_wrap_glProgramUniform2iv(GLuint p0, GLint p1, GLsizei p2, const GLint *p3) {
+    TGL_CALL(416, tgl_real_glProgramUniform2iv(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM2FPROC tgl_real_glProgramUniform2f = 0;
+static void APIENTRY tgl_wrap_glProgramUniform2f(GLuint p0, GLint p1, GLfloat p2, GLfloat p3) {
+    TGL_CALL(417, tgl_real_glProgramUniform2f(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM2FVPROC tgl_real_glProgramUniform2fv = 0;
+static void APIENTRY tgl_wrap_glProgramUniform2fv(GLuint p0, GLint p1, GLsizei p2, const GLfloat *p3) {
+    TGL_CALL(418, tgl_real_glProgramUniform2fv(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM2DPROC tgl_real_glProgramUniform2d = 0;
+static void APIENTRY tgl_wrap_glProgramUniform2d(GLuint p0, GLint p1, GLdouble p2, GLdouble p3) {
+    TGL_CALL(419, tgl_real_glProgramUniform2d(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM2DVPROC tgl_real_glProgramUniform2dv = 0;
+static void APIENTRY tgl_wrap_glProgramUniform2dv(GLuint p0, GLint p1, GLsizei p2, const GLdouble *p3) {
+    TGL_CALL(420, tgl_real_glProgramUniform2dv(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM2UIPROC tgl_real_glProgramUniform2ui = 0;
+static void APIENTRY tgl_wrap_glProgramUniform2ui(GLuint p0, GLint p1, GLuint p2, GLuint p3) {
+    TGL_CALL(421, tgl_real_glProgramUniform2ui(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM2UIVPROC tgl_real_glProgramUniform2uiv = 0;
+static void APIENTRY tgl_wrap_glProgramUniform2uiv(GLuint p0, GLint p1, GLsizei p2, const GLuint *p3) {
+    TGL_CALL(422, tgl_real_glProgramUniform2uiv(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM3IPROC tgl_real_glProgramUniform3i = 0;
+static void APIENTRY tgl_wrap_glProgramUniform3i(GLuint p0, GLint p1, GLint p2, GLint p3, GLint p4) {
+    TGL_CALL(423, tgl_real_glProgramUniform3i(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORM3IVPROC tgl_real_glProgramUniform3iv = 0;
+static void APIENTRY tgl_wrap_glProgramUniform3iv(GLuint p0, GLint p1, GLsizei p2, const GLint *p3) {
+    TGL_CALL(424, tgl_real_glProgramUniform3iv(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM3FPROC tgl_real_glProgramUniform3f = 0;
+static void APIENTRY tgl_wrap_glProgramUniform3f(GLuint p0, GLint p1, GLfloat p2, GLfloat p3, GLfloat p4) {
+    TGL_CALL(425, tgl_real_glProgramUniform3f(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORM3FVPROC tgl_real_glProgramUniform3fv = 0;
+static void APIENTRY tgl_wrap_glProgramUniform3fv(GLuint p0, GLint p1, GLsizei p2, const GLfloat *p3) {
+    TGL_CALL(426, tgl_real_glProgramUniform3fv(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM3DPROC tgl_real_glProgramUniform3d = 0;
+static void APIENTRY tgl_wrap_glProgramUniform3d(GLuint p0, GLint p1, GLdouble p2, GLdouble p3, GLdouble p4) {
+    TGL_CALL(427, tgl_real_glProgramUniform3d(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORM3DVPROC tgl_real_glProgramUniform3dv = 0;
+static void APIENTRY tgl_wrap_glProgramUniform3dv(GLuint p0, GLint p1, GLsizei p2, const GLdouble *p3) {
+    TGL_CALL(428, tgl_real_glProgramUniform3dv(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM3UIPROC tgl_real_glProgramUniform3ui = 0;
+static void APIENTRY tgl_wrap_glProgramUniform3ui(GLuint p0, GLint p1, GLuint p2, GLuint p3, GLuint p4) {
+    TGL_CALL(429, tgl_real_glProgramUniform3ui(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORM3UIVPROC tgl_real_glProgramUniform3uiv = 0;
+static void APIENTRY tgl_wrap_glProgramUniform3uiv(GLuint p0, GLint p1, GLsizei p2, const GLuint *p3) {
+    TGL_CALL(430, tgl_real_glProgramUniform3uiv(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM4IPROC tgl_real_glProgramUniform4i = 0;
+static void APIENTRY tgl_wrap_glProgramUniform4i(GLuint p0, GLint p1, GLint p2, GLint p3, GLint p4, GLint p5) {
+    TGL_CALL(431, tgl_real_glProgramUniform4i(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLPROGRAMUNIFORM4IVPROC tgl_real_glProgramUniform4iv = 0;
+static void APIENTRY tgl_wrap_glProgramUniform4iv(GLuint p0, GLint p1, GLsizei p2, const GLint *p3) {
+    TGL_CALL(432, tgl_real_glProgramUniform4iv(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM4FPROC tgl_real_glProgramUniform4f = 0;
+static void APIENTRY tgl_wrap_glProgramUniform4f(GLuint p0, GLint p1, GLfloat p2, GLfloat p3, GLfloat p4, GLfloat p5) {
+    TGL_CALL(433, tgl_real_glProgramUniform4f(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLPROGRAMUNIFORM4FVPROC tgl_real_glProgramUniform4fv = 0;
+static void APIENTRY tgl_wrap_glProgramUniform4fv(GLuint p0, GLint p1, GLsizei p2, const GLfloat *p3) {
+    TGL_CALL(434, tgl_real_glProgramUniform4fv(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM4DPROC tgl_real_glProgramUniform4d = 0;
+static void APIENTRY tgl_wrap_glProgramUniform4d(GLuint p0, GLint p1, GLdouble p2, GLdouble p3, GLdouble p4, GLdouble p5) {
+    TGL_CALL(435, tgl_real_glProgramUniform4d(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLPROGRAMUNIFORM4DVPROC tgl_real_glProgramUniform4dv = 0;
+static void APIENTRY tgl_wrap_glProgramUniform4dv(GLuint p0, GLint p1, GLsizei p2, const GLdouble *p3) {
+    TGL_CALL(436, tgl_real_glProgramUniform4dv(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORM4UIPROC tgl_real_glProgramUniform4ui = 0;
+static void APIENTRY tgl_wrap_glProgramUniform4ui(GLuint p0, GLint p1, GLuint p2, GLuint p3, GLuint p4, GLuint p5) {
+    TGL_CALL(437, tgl_real_glProgramUniform4ui(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLPROGRAMUNIFORM4UIVPROC tgl_real_glProgramUniform4uiv = 0;
+static void APIENTRY tgl_wrap_glProgramUniform4uiv(GLuint p0, GLint p1, GLsizei p2, const GLuint *p3) {
+    TGL_CALL(438, tgl_real_glProgramUniform4uiv(p0, p1, p2, p3));
+}
+static PFNGLPROGRAMUNIFORMMATRIX2FVPROC tgl_real_glProgramUniformMatrix2fv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix2fv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLfloat *p4) {
+    TGL_CALL(439, tgl_real_glProgramUniformMatrix2fv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX3FVPROC tgl_real_glProgramUniformMatrix3fv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix3fv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLfloat *p4) {
+    TGL_CALL(440, tgl_real_glProgramUniformMatrix3fv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX4FVPROC tgl_real_glProgramUniformMatrix4fv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix4fv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLfloat *p4) {
+    TGL_CALL(441, tgl_real_glProgramUniformMatrix4fv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX2DVPROC tgl_real_glProgramUniformMatrix2dv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix2dv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLdouble *p4) {
+    TGL_CALL(442, tgl_real_glProgramUniformMatrix2dv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX3DVPROC tgl_real_glProgramUniformMatrix3dv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix3dv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLdouble *p4) {
+    TGL_CALL(443, tgl_real_glProgramUniformMatrix3dv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX4DVPROC tgl_real_glProgramUniformMatrix4dv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix4dv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLdouble *p4) {
+    TGL_CALL(444, tgl_real_glProgramUniformMatrix4dv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC tgl_real_glProgramUniformMatrix2x3fv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix2x3fv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLfloat *p4) {
+    TGL_CALL(445, tgl_real_glProgramUniformMatrix2x3fv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC tgl_real_glProgramUniformMatrix3x2fv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix3x2fv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLfloat *p4) {
+    TGL_CALL(446, tgl_real_glProgramUniformMatrix3x2fv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC tgl_real_glProgramUniformMatrix2x4fv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix2x4fv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLfloat *p4) {
+    TGL_CALL(447, tgl_real_glProgramUniformMatrix2x4fv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC tgl_real_glProgramUniformMatrix4x2fv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix4x2fv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLfloat *p4) {
+    TGL_CALL(448, tgl_real_glProgramUniformMatrix4x2fv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC tgl_real_glProgramUniformMatrix3x4fv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix3x4fv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLfloat *p4) {
+    TGL_CALL(449, tgl_real_glProgramUniformMatrix3x4fv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC tgl_real_glProgramUniformMatrix4x3fv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix4x3fv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLfloat *p4) {
+    TGL_CALL(450, tgl_real_glProgramUniformMatrix4x3fv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC tgl_real_glProgramUniformMatrix2x3dv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix2x3dv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLdouble *p4) {
+    TGL_CALL(451, tgl_real_glProgramUniformMatrix2x3dv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC tgl_real_glProgramUniformMatrix3x2dv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix3x2dv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLdouble *p4) {
+    TGL_CALL(452, tgl_real_glProgramUniformMatrix3x2dv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC tgl_real_glProgramUniformMatrix2x4dv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix2x4dv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLdouble *p4) {
+    TGL_CALL(453, tgl_real_glProgramUniformMatrix2x4dv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC tgl_real_glProgramUniformMatrix4x2dv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix4x2dv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLdouble *p4) {
+    TGL_CALL(454, tgl_real_glProgramUniformMatrix4x2dv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC tgl_real_glProgramUniformMatrix3x4dv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix3x4dv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLdouble *p4) {
+    TGL_CALL(455, tgl_real_glProgramUniformMatrix3x4dv(p0, p1, p2, p3, p4));
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC tgl_real_glProgramUniformMatrix4x3dv = 0;
+static void APIENTRY tgl_wrap_glProgramUniformMatrix4x3dv(GLuint p0, GLint p1, GLsizei p2, GLboolean p3, const GLdouble *p4) {
+    TGL_CALL(456, tgl_real_glProgramUniformMatrix4x3dv(p0, p1, p2, p3, p4));
+}
+static PFNGLVALIDATEPROGRAMPIPELINEPROC tgl_real_glValidateProgramPipeline = 0;
+static void APIENTRY tgl_wrap_glValidateProgramPipeline(GLuint p0) {
+    TGL_CALL(457, tgl_real_glValidateProgramPipeline(p0));
+}
+static PFNGLGETPROGRAMPIPELINEINFOLOGPROC tgl_real_glGetProgramPipelineInfoLog = 0;
+static void APIENTRY tgl_wrap_glGetProgramPipelineInfoLog(GLuint p0, GLsizei p1, GLsizei *p2, GLchar *p3) {
+    TGL_CALL(458, tgl_real_glGetProgramPipelineInfoLog(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIBL1DPROC tgl_real_glVertexAttribL1d = 0;
+static void APIENTRY tgl_wrap_glVertexAttribL1d(GLuint p0, GLdouble p1) {
+    TGL_CALL(459, tgl_real_glVertexAttribL1d(p0, p1));
+}
+static PFNGLVERTEXATTRIBL2DPROC tgl_real_glVertexAttribL2d = 0;
+static void APIENTRY tgl_wrap_glVertexAttribL2d(GLuint p0, GLdouble p1, GLdouble p2) {
+    TGL_CALL(460, tgl_real_glVertexAttribL2d(p0, p1, p2));
+}
+static PFNGLVERTEXATTRIBL3DPROC tgl_real_glVertexAttribL3d = 0;
+static void APIENTRY tgl_wrap_glVertexAttribL3d(GLuint p0, GLdouble p1, GLdouble p2, GLdouble p3) {
+    TGL_CALL(461, tgl_real_glVertexAttribL3d(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIBL4DPROC tgl_real_glVertexAttribL4d = 0;
+static void APIENTRY tgl_wrap_glVertexAttribL4d(GLuint p0, GLdouble p1, GLdouble p2, GLdouble p3, GLdouble p4) {
+    TGL_CALL(462, tgl_real_glVertexAttribL4d(p0, p1, p2, p3, p4));
+}
+static PFNGLVERTEXATTRIBL1DVPROC tgl_real_glVertexAttribL1dv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribL1dv(GLuint p0, const GLdouble *p1) {
+    TGL_CALL(463, tgl_real_glVertexAttribL1dv(p0, p1));
+}
+static PFNGLVERTEXATTRIBL2DVPROC tgl_real_glVertexAttribL2dv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribL2dv(GLuint p0, const GLdouble *p1) {
+    TGL_CALL(464, tgl_real_glVertexAttribL2dv(p0, p1));
+}
+static PFNGLVERTEXATTRIBL3DVPROC tgl_real_glVertexAttribL3dv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribL3dv(GLuint p0, const GLdouble *p1) {
+    TGL_CALL(465, tgl_real_glVertexAttribL3dv(p0, p1));
+}
+static PFNGLVERTEXATTRIBL4DVPROC tgl_real_glVertexAttribL4dv = 0;
+static void APIENTRY tgl_wrap_glVertexAttribL4dv(GLuint p0, const GLdouble *p1) {
+    TGL_CALL(466, tgl_real_glVertexAttribL4dv(p0, p1));
+}
+static PFNGLVERTEXATTRIBLPOINTERPROC tgl_real_glVertexAttribLPointer = 0;
+static void APIENTRY tgl_wrap_glVertexAttribLPointer(GLuint p0, GLint p1, GLenum p2, GLsizei p3, const void *p4) {
+    TGL_CALL(467, tgl_real_glVertexAttribLPointer(p0, p1, p2, p3, p4));
+}
+static PFNGLGETVERTEXATTRIBLDVPROC tgl_real_glGetVertexAttribLdv = 0;
+static void APIENTRY tgl_wrap_glGetVertexAttribLdv(GLuint p0, GLenum p1, GLdouble *p2) {
+    TGL_CALL(468, tgl_real_glGetVertexAttribLdv(p0, p1, p2));
+}
+static PFNGLVIEWPORTARRAYVPROC tgl_real_glViewportArrayv = 0;
+static void APIENTRY tgl_wrap_glViewportArrayv(GLuint p0, GLsizei p1, const GLfloat *p2) {
+    TGL_CALL(469, tgl_real_glViewportArrayv(p0, p1, p2));
+}
+static PFNGLVIEWPORTINDEXEDFPROC tgl_real_glViewportIndexedf = 0;
+static void APIENTRY tgl_wrap_glViewportIndexedf(GLuint p0, GLfloat p1, GLfloat p2, GLfloat p3, GLfloat p4) {
+    TGL_CALL(470, tgl_real_glViewportIndexedf(p0, p1, p2, p3, p4));
+}
+static PFNGLVIEWPORTINDEXEDFVPROC tgl_real_glViewportIndexedfv = 0;
+static void APIENTRY tgl_wrap_glViewportIndexedfv(GLuint p0, const GLfloat *p1) {
+    TGL_CALL(471, tgl_real_glViewportIndexedfv(p0, p1));
+}
+static PFNGLSCISSORARRAYVPROC tgl_real_glScissorArrayv = 0;
+static void APIENTRY tgl_wrap_glScissorArrayv(GLuint p0, GLsizei p1, const GLint *p2) {
+    TGL_CALL(472, tgl_real_glScissorArrayv(p0, p1, p2));
+}
+static PFNGLSCISSORINDEXEDPROC tgl_real_glScissorIndexed = 0;
+static void APIENTRY tgl_wrap_glScissorIndexed(GLuint p0, GLint p1, GLint p2, GLsizei p3, GLsizei p4) {
+    TGL_CALL(473, tgl_real_glScissorIndexed(p0, p1, p2, p3, p4));
+}
+static PFNGLSCISSORINDEXEDVPROC tgl_real_glScissorIndexedv = 0;
+static void APIENTRY tgl_wrap_glScissorIndexedv(GLuint p0, const GLint *p1) {
+    TGL_CALL(474, tgl_real_glScissorIndexedv(p0, p1));
+}
+static PFNGLDEPTHRANGEARRAYVPROC tgl_real_glDepthRangeArrayv = 0;
+static void APIENTRY tgl_wrap_glDepthRangeArrayv(GLuint p0, GLsizei p1, const GLdouble *p2) {
+    TGL_CALL(475, tgl_real_glDepthRangeArrayv(p0, p1, p2));
+}
+static PFNGLDEPTHRANGEINDEXEDPROC tgl_real_glDepthRangeIndexed = 0;
+static void APIENTRY tgl_wrap_glDepthRangeIndexed(GLuint p0, GLdouble p1, GLdouble p2) {
+    TGL_CALL(476, tgl_real_glDepthRangeIndexed(p0, p1, p2));
+}
+static PFNGLGETFLOATI_VPROC tgl_real_glGetFloati_v = 0;
+static void APIENTRY tgl_wrap_glGetFloati_v(GLenum p0, GLuint p1, GLfloat *p2) {
+    TGL_CALL(477, tgl_real_glGetFloati_v(p0, p1, p2));
+}
+static PFNGLGETDOUBLEI_VPROC tgl_real_glGetDoublei_v = 0;
+static void APIENTRY tgl_wrap_glGetDoublei_v(GLenum p0, GLuint p1, GLdouble *p2) {
+    TGL_CALL(478, tgl_real_glGetDoublei_v(p0, p1, p2));
+}
+#endif
+
+/* GL_version_4_2 */
+#if defined(TGL_DEFINE_CORE_GL_4_2)
+static PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC tgl_real_glDrawArraysInstancedBaseInstance = 0;
+static void APIENTRY tgl_wrap_glDrawArraysInstancedBaseInstance(GLenum p0, GLint p1, GLsizei p2, GLsizei p3, GLuint p4) {
+    TGL_CALL(479, tgl_real_glDrawArraysInstancedBaseInstance(p0, p1, p2, p3, p4));
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC tgl_real_glDrawElementsInstancedBaseInstance = 0;
+static void APIENTRY tgl_wrap_glDrawElementsInstancedBaseInstance(GLenum p0, GLsizei p1, GLenum p2, const void *p3, GLsizei p4, GLuint p5) {
+    TGL_CALL(480, tgl_real_glDrawElementsInstancedBaseInstance(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC tgl_real_glDrawElementsInstancedBaseVertexBaseInstance = 0;
+static void APIENTRY tgl_wrap_glDrawElementsInstancedBaseVertexBaseInstance(GLenum p0, GLsizei p1, GLenum p2, const void *p3, GLsizei p4, GLint p5, GLuint p6) {
+    TGL_CALL(481, tgl_real_glDrawElementsInstancedBaseVertexBaseInstance(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLGETINTERNALFORMATIVPROC tgl_real_glGetInternalformativ = 0;
+static void APIENTRY tgl_wrap_glGetInternalformativ(GLenum p0, GLenum p1, GLenum p2, GLsizei p3, GLint *p4) {
+    TGL_CALL(482, tgl_real_glGetInternalformativ(p0, p1, p2, p3, p4));
+}
+static PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC tgl_real_glGetActiveAtomicCounterBufferiv = 0;
+static void APIENTRY tgl_wrap_glGetActiveAtomicCounterBufferiv(GLuint p0, GLuint p1, GLenum p2, GLint *p3) {
+    TGL_CALL(483, tgl_real_glGetActiveAtomicCounterBufferiv(p0, p1, p2, p3));
+}
+static PFNGLBINDIMAGETEXTUREPROC tgl_real_glBindImageTexture = 0;
+static void APIENTRY tgl_wrap_glBindImageTexture(GLuint p0, GLuint p1, GLint p2, GLboolean p3, GLint p4, GLenum p5, GLenum p6) {
+    TGL_CALL(484, tgl_real_glBindImageTexture(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLMEMORYBARRIERPROC tgl_real_glMemoryBarrier = 0;
+static void APIENTRY tgl_wrap_glMemoryBarrier(GLbitfield p0) {
+    TGL_CALL(485, tgl_real_glMemoryBarrier(p0));
+}
+static PFNGLTEXSTORAGE1DPROC tgl_real_glTexStorage1D = 0;
+static void APIENTRY tgl_wrap_glTexStorage1D(GLenum p0, GLsizei p1, GLenum p2, GLsizei p3) {
+    TGL_CALL(486, tgl_real_glTexStorage1D(p0, p1, p2, p3));
+}
+static PFNGLTEXSTORAGE2DPROC tgl_real_glTexStorage2D = 0;
+static void APIENTRY tgl_wrap_glTexStorage2D(GLenum p0, GLsizei p1, GLenum p2, GLsizei p3, GLsizei p4) {
+    TGL_CALL(487, tgl_real_glTexStorage2D(p0, p1, p2, p3, p4));
+}
+static PFNGLTEXSTORAGE3DPROC tgl_real_glTexStorage3D = 0;
+static void APIENTRY tgl_wrap_glTexStorage3D(GLenum p0, GLsizei p1, GLenum p2, GLsizei p3, GLsizei p4, GLsizei p5) {
+    TGL_CALL(488, tgl_real_glTexStorage3D(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC tgl_real_glDrawTransformFeedbackInstanced = 0;
+static void APIENTRY tgl_wrap_glDrawTransformFeedbackInstanced(GLenum p0, GLuint p1, GLsizei p2) {
+    TGL_CALL(489, tgl_real_glDrawTransformFeedbackInstanced(p0, p1, p2));
+}
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC tgl_real_glDrawTransformFeedbackStreamInstanced = 0;
+static void APIENTRY tgl_wrap_glDrawTransformFeedbackStreamInstanced(GLenum p0, GLuint p1, GLuint p2, GLsizei p3) {
+    TGL_CALL(490, tgl_real_glDrawTransformFeedbackStreamInstanced(p0, p1, p2, p3));
+}
+#endif
+
+/* GL_version_4_3 */
+#if defined(TGL_DEFINE_CORE_GL_4_3)
+static PFNGLCLEARBUFFERDATAPROC tgl_real_glClearBufferData = 0;
+static void APIENTRY tgl_wrap_glClearBufferData(GLenum p0, GLenum p1, GLenum p2, GLenum p3, const void *p4) {
+    TGL_CALL(491, tgl_real_glClearBufferData(p0, p1, p2, p3, p4));
+}
+static PFNGLCLEARBUFFERSUBDATAPROC tgl_real_glClearBufferSubData = 0;
+static void APIENTRY tgl_wrap_glClearBufferSubData(GLenum p0, GLenum p1, GLintptr p2, GLsizeiptr p3, GLenum p4, GLenum p5, const void *p6) {
+    TGL_CALL(492, tgl_real_glClearBufferSubData(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLDISPATCHCOMPUTEPROC tgl_real_glDispatchCompute = 0;
+static void APIENTRY tgl_wrap_glDispatchCompute(GLuint p0, GLuint p1, GLuint p2) {
+    TGL_CALL(493, tgl_real_glDispatchCompute(p0, p1, p2));
+}
+static PFNGLDISPATCHCOMPUTEINDIRECTPROC tgl_real_glDispatchComputeIndirect = 0;
+static void APIENTRY tgl_wrap_glDispatchComputeIndirect(GLintptr p0) {
+    TGL_CALL(494, tgl_real_glDispatchComputeIndirect(p0));
+}
+static PFNGLCOPYIMAGESUBDATAPROC tgl_real_glCopyImageSubData = 0;
+static void APIENTRY tgl_wrap_glCopyImageSubData(GLuint p0, GLenum p1, GLint p2, GLint p3, GLint p4, GLint p5, GLuint p6, GLenum p7, GLint p8, GLint p9, GLint p10, GLint p11, GLsizei p12, GLsizei p13, GLsizei p14) {
+    TGL_CALL(495, tgl_real_glCopyImageSubData(p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14));
+}
+static PFNGLFRAMEBUFFERPARAMETERIPROC tgl_real_glFramebufferParameteri = 0;
+static void APIENTRY tgl_wrap_glFramebufferParameteri(GLenum p0, GLenum p1, GLint p2) {
+    TGL_CALL(496, tgl_real_glFramebufferParameteri(p0, p1, p2));
+}
+static PFNGLGETFRAMEBUFFERPARAMETERIVPROC tgl_real_glGetFramebufferParameteriv = 0;
+static void APIENTRY tgl_wrap_glGetFramebufferParameteriv(GLenum p0, GLenum p1, GLint *p2) {
+    TGL_CALL(497, tgl_real_glGetFramebufferParameteriv(p0, p1, p2));
+}
+static PFNGLGETINTERNALFORMATI64VPROC tgl_real_glGetInternalformati64v = 0;
+static void APIENTRY tgl_wrap_glGetInternalformati64v(GLenum p0, GLenum p1, GLenum p2, GLsizei p3, GLint64 *p4) {
+    TGL_CALL(498, tgl_real_glGetInternalformati64v(p0, p1, p2, p3, p4));
+}
+static PFNGLINVALIDATETEXSUBIMAGEPROC tgl_real_glInvalidateTexSubImage = 0;
+static void APIENTRY tgl_wrap_glInvalidateTexSubImage(GLuint p0, GLint p1, GLint p2, GLint p3, GLint p4, GLsizei p5, GLsizei p6, GLsizei p7) {
+    TGL_CALL(499, tgl_real_glInvalidateTexSubImage(p0, p1, p2, p3, p4, p5, p6, p7));
+}
+static PFNGLINVALIDATETEXIMAGEPROC tgl_real_glInvalidateTexImage = 0;
+static void APIENTRY tgl_wrap_glInvalidateTexImage(GLuint p0, GLint p1) {
+    TGL_CALL(500, tgl_real_glInvalidateTexImage(p0, p1));
+}
+static PFNGLINVALIDATEBUFFERSUBDATAPROC tgl_real_glInvalidateBufferSubData = 0;
+static void APIENTRY tgl_wrap_glInvalidateBufferSubData(GLuint p0, GLintptr p1, GLsizeiptr p2) {
+    TGL_CALL(501, tgl_real_glInvalidateBufferSubData(p0, p1, p2));
+}
+static PFNGLINVALIDATEBUFFERDATAPROC tgl_real_glInvalidateBufferData = 0;
+static void APIENTRY tgl_wrap_glInvalidateBufferData(GLuint p0) {
+    TGL_CALL(502, tgl_real_glInvalidateBufferData(p0));
+}
+static PFNGLINVALIDATEFRAMEBUFFERPROC tgl_real_glInvalidateFramebuffer = 0;
+static void APIENTRY tgl_wrap_glInvalidateFramebuffer(GLenum p0, GLsizei p1, const GLenum *p2) {
+    TGL_CALL(503, tgl_real_glInvalidateFramebuffer(p0, p1, p2));
+}
+static PFNGLINVALIDATESUBFRAMEBUFFERPROC tgl_real_glInvalidateSubFramebuffer = 0;
+static void APIENTRY tgl_wrap_glInvalidateSubFramebuffer(GLenum p0, GLsizei p1, const GLenum *p2, GLint p3, GLint p4, GLsizei p5, GLsizei p6) {
+    TGL_CALL(504, tgl_real_glInvalidateSubFramebuffer(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLMULTIDRAWARRAYSINDIRECTPROC tgl_real_glMultiDrawArraysIndirect = 0;
+static void APIENTRY tgl_wrap_glMultiDrawArraysIndirect(GLenum p0, const void *p1, GLsizei p2, GLsizei p3) {
+    TGL_CALL(505, tgl_real_glMultiDrawArraysIndirect(p0, p1, p2, p3));
+}
+static PFNGLMULTIDRAWELEMENTSINDIRECTPROC tgl_real_glMultiDrawElementsIndirect = 0;
+static void APIENTRY tgl_wrap_glMultiDrawElementsIndirect(GLenum p0, GLenum p1, const void *p2, GLsizei p3, GLsizei p4) {
+    TGL_CALL(506, tgl_real_glMultiDrawElementsIndirect(p0, p1, p2, p3, p4));
+}
+static PFNGLGETPROGRAMINTERFACEIVPROC tgl_real_glGetProgramInterfaceiv = 0;
+static void APIENTRY tgl_wrap_glGetProgramInterfaceiv(GLuint p0, GLenum p1, GLenum p2, GLint *p3) {
+    TGL_CALL(507, tgl_real_glGetProgramInterfaceiv(p0, p1, p2, p3));
+}
+static PFNGLGETPROGRAMRESOURCEINDEXPROC tgl_real_glGetProgramResourceIndex = 0;
+static GLuint APIENTRY tgl_wrap_glGetProgramResourceIndex(GLuint p0, GLenum p1, const GLchar *p2) {
+    GLuint result;
+    TGL_CALL(508, result = tgl_real_glGetProgramResourceIndex(p0, p1, p2));
+    return result;
+}
+static PFNGLGETPROGRAMRESOURCENAMEPROC tgl_real_glGetProgramResourceName = 0;
+static void APIENTRY tgl_wrap_glGetProgramResourceName(GLuint p0, GLenum p1, GLuint p2, GLsizei p3, GLsizei *p4, GLchar *p5) {
+    TGL_CALL(509, tgl_real_glGetProgramResourceName(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLGETPROGRAMRESOURCEIVPROC tgl_real_glGetProgramResourceiv = 0;
+static void APIENTRY tgl_wrap_glGetProgramResourceiv(GLuint p0, GLenum p1, GLuint p2, GLsizei p3, const GLenum *p4, GLsizei p5, GLsizei *p6, GLint *p7) {
+    TGL_CALL(510, tgl_real_glGetProgramResourceiv(p0, p1, p2, p3, p4, p5, p6, p7));
+}
+static PFNGLGETPROGRAMRESOURCELOCATIONPROC tgl_real_glGetProgramResourceLocation = 0;
+static GLint APIENTRY tgl_wrap_glGetProgramResourceLocation(GLuint p0, GLenum p1, const GLchar *p2) {
+    GLint result;
+    TGL_CALL(511, result = tgl_real_glGetProgramResourceLocation(p0, p1, p2));
+    return result;
+}
+static PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC tgl_real_glGetProgramResourceLocationIndex = 0;
+static GLint APIENTRY tgl_wrap_glGetProgramResourceLocationIndex(GLuint p0, GLenum p1, const GLchar *p2) {
+    GLint result;
+    TGL_CALL(512, result = tgl_real_glGetProgramResourceLocationIndex(p0, p1, p2));
+    return result;
+}
+static PFNGLSHADERSTORAGEBLOCKBINDINGPROC tgl_real_glShaderStorageBlockBinding = 0;
+static void APIENTRY tgl_wrap_glShaderStorageBlockBinding(GLuint p0, GLuint p1, GLuint p2) {
+    TGL_CALL(513, tgl_real_glShaderStorageBlockBinding(p0, p1, p2));
+}
+static PFNGLTEXBUFFERRANGEPROC tgl_real_glTexBufferRange = 0;
+static void APIENTRY tgl_wrap_glTexBufferRange(GLenum p0, GLenum p1, GLuint p2, GLintptr p3, GLsizeiptr p4) {
+    TGL_CALL(514, tgl_real_glTexBufferRange(p0, p1, p2, p3, p4));
+}
+static PFNGLTEXSTORAGE2DMULTISAMPLEPROC tgl_real_glTexStorage2DMultisample = 0;
+static void APIENTRY tgl_wrap_glTexStorage2DMultisample(GLenum p0, GLsizei p1, GLenum p2, GLsizei p3, GLsizei p4, GLboolean p5) {
+    TGL_CALL(515, tgl_real_glTexStorage2DMultisample(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLTEXSTORAGE3DMULTISAMPLEPROC tgl_real_glTexStorage3DMultisample = 0;
+static void APIENTRY tgl_wrap_glTexStorage3DMultisample(GLenum p0, GLsizei p1, GLenum p2, GLsizei p3, GLsizei p4, GLsizei p5, GLboolean p6) {
+    TGL_CALL(516, tgl_real_glTexStorage3DMultisample(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLTEXTUREVIEWPROC tgl_real_glTextureView = 0;
+static void APIENTRY tgl_wrap_glTextureView(GLuint p0, GLenum p1, GLuint p2, GLenum p3, GLuint p4, GLuint p5, GLuint p6, GLuint p7) {
+    TGL_CALL(517, tgl_real_glTextureView(p0, p1, p2, p3, p4, p5, p6, p7));
+}
+static PFNGLBINDVERTEXBUFFERPROC tgl_real_glBindVertexBuffer = 0;
+static void APIENTRY tgl_wrap_glBindVertexBuffer(GLuint p0, GLuint p1, GLintptr p2, GLsizei p3) {
+    TGL_CALL(518, tgl_real_glBindVertexBuffer(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIBFORMATPROC tgl_real_glVertexAttribFormat = 0;
+static void APIENTRY tgl_wrap_glVertexAttribFormat(GLuint p0, GLint p1, GLenum p2, GLboolean p3, GLuint p4) {
+    TGL_CALL(519, tgl_real_glVertexAttribFormat(p0, p1, p2, p3, p4));
+}
+static PFNGLVERTEXATTRIBIFORMATPROC tgl_real_glVertexAttribIFormat = 0;
+static void APIENTRY tgl_wrap_glVertexAttribIFormat(GLuint p0, GLint p1, GLenum p2, GLuint p3) {
+    TGL_CALL(520, tgl_real_glVertexAttribIFormat(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIBLFORMATPROC tgl_real_glVertexAttribLFormat = 0;
+static void APIENTRY tgl_wrap_glVertexAttribLFormat(GLuint p0, GLint p1, GLenum p2, GLuint p3) {
+    TGL_CALL(521, tgl_real_glVertexAttribLFormat(p0, p1, p2, p3));
+}
+static PFNGLVERTEXATTRIBBINDINGPROC tgl_real_glVertexAttribBinding = 0;
+static void APIENTRY tgl_wrap_glVertexAttribBinding(GLuint p0, GLuint p1) {
+    TGL_CALL(522, tgl_real_glVertexAttribBinding(p0, p1));
+}
+static PFNGLVERTEXBINDINGDIVISORPROC tgl_real_glVertexBindingDivisor = 0;
+static void APIENTRY tgl_wrap_glVertexBindingDivisor(GLuint p0, GLuint p1) {
+    TGL_CALL(523, tgl_real_glVertexBindingDivisor(p0, p1));
+}
+static PFNGLDEBUGMESSAGECONTROLPROC tgl_real_glDebugMessageControl = 0;
+static void APIENTRY tgl_wrap_glDebugMessageControl(GLenum p0, GLenum p1, GLenum p2, GLsizei p3, const GLuint *p4, GLboolean p5) {
+    TGL_CALL(524, tgl_real_glDebugMessageControl(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLDEBUGMESSAGEINSERTPROC tgl_real_glDebugMessageInsert = 0;
+static void APIENTRY tgl_wrap_glDebugMessageInsert(GLenum p0, GLenum p1, GLuint p2, GLenum p3, GLsizei p4, const GLchar *p5) {
+    TGL_CALL(525, tgl_real_glDebugMessageInsert(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLDEBUGMESSAGECALLBACKPROC tgl_real_glDebugMessageCallback = 0;
+static void APIENTRY tgl_wrap_glDebugMessageCallback(GLDEBUGPROC p0, const void *p1) {
+    TGL_CALL(526, tgl_real_glDebugMessageCallback(p0, p1));
+}
+static PFNGLGETDEBUGMESSAGELOGPROC tgl_real_glGetDebugMessageLog = 0;
+static GLuint APIENTRY tgl_wrap_glGetDebugMessageLog(GLuint p0, GLsizei p1, GLenum *p2, GLenum *p3, GLuint *p4, GLenum *p5, GLsizei *p6, GLchar *p7) {
+    GLuint result;
+    TGL_CALL(527, result = tgl_real_glGetDebugMessageLog(p0, p1, p2, p3, p4, p5, p6, p7));
+    return result;
+}
+static PFNGLPUSHDEBUGGROUPPROC tgl_real_glPushDebugGroup = 0;
+static void APIENTRY tgl_wrap_glPushDebugGroup(GLenum p0, GLuint p1, GLsizei p2, const GLchar *p3) {
+    TGL_CALL(528, tgl_real_glPushDebugGroup(p0, p1, p2, p3));
+}
+static PFNGLPOPDEBUGGROUPPROC tgl_real_glPopDebugGroup = 0;
+static void APIENTRY tgl_wrap_glPopDebugGroup(void) {
+    TGL_CALL(529, tgl_real_glPopDebugGroup());
+}
+static PFNGLOBJECTLABELPROC tgl_real_glObjectLabel = 0;
+static void APIENTRY tgl_wrap_glObjectLabel(GLenum p0, GLuint p1, GLsizei p2, const GLchar *p3) {
+    TGL_CALL(530, tgl_real_glObjectLabel(p0, p1, p2, p3));
+}
+static PFNGLGETOBJECTLABELPROC tgl_real_glGetObjectLabel = 0;
+static void APIENTRY tgl_wrap_glGetObjectLabel(GLenum p0, GLuint p1, GLsizei p2, GLsizei *p3, GLchar *p4) {
+    TGL_CALL(531, tgl_real_glGetObjectLabel(p0, p1, p2, p3, p4));
+}
+static PFNGLOBJECTPTRLABELPROC tgl_real_glObjectPtrLabel = 0;
+static void APIENTRY tgl_wrap_glObjectPtrLabel(const void *p0, GLsizei p1, const GLchar *p2) {
+    TGL_CALL(532, tgl_real_glObjectPtrLabel(p0, p1, p2));
+}
+static PFNGLGETOBJECTPTRLABELPROC tgl_real_glGetObjectPtrLabel = 0;
+static void APIENTRY tgl_wrap_glGetObjectPtrLabel(const void *p0, GLsizei p1, GLsizei *p2, GLchar *p3) {
+    TGL_CALL(533, tgl_real_glGetObjectPtrLabel(p0, p1, p2, p3));
+}
+#endif
+
+/* GL_version_4_4 */
+#if defined(TGL_DEFINE_CORE_GL_4_4)
+static PFNGLBUFFERSTORAGEPROC tgl_real_glBufferStorage = 0;
+static void APIENTRY tgl_wrap_glBufferStorage(GLenum p0, GLsizeiptr p1, const void *p2, GLbitfield p3) {
+    TGL_CALL(534, tgl_real_glBufferStorage(p0, p1, p2, p3));
+}
+static PFNGLCLEARTEXIMAGEPROC tgl_real_glClearTexImage = 0;
+static void APIENTRY tgl_wrap_glClearTexImage(GLuint p0, GLint p1, GLenum p2, GLenum p3, const void *p4) {
+    TGL_CALL(535, tgl_real_glClearTexImage(p0, p1, p2, p3, p4));
+}
+static PFNGLCLEARTEXSUBIMAGEPROC tgl_real_glClearTexSubImage = 0;
+static void APIENTRY tgl_wrap_glClearTexSubImage(GLuint p0, GLint p1, GLint p2, GLint p3, GLint p4, GLsizei p5, GLsizei p6, GLsizei p7, GLenum p8, GLenum p9, const void *p10) {
+    TGL_CALL(536, tgl_real_glClearTexSubImage(p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10));
+}
+static PFNGLBINDBUFFERSBASEPROC tgl_real_glBindBuffersBase = 0;
+static void APIENTRY tgl_wrap_glBindBuffersBase(GLenum p0, GLuint p1, GLsizei p2, const GLuint *p3) {
+    TGL_CALL(537, tgl_real_glBindBuffersBase(p0, p1, p2, p3));
+}
+static PFNGLBINDBUFFERSRANGEPROC tgl_real_glBindBuffersRange = 0;
+static void APIENTRY tgl_wrap_glBindBuffersRange(GLenum p0, GLuint p1, GLsizei p2, const GLuint *p3, const GLintptr *p4, const GLsizeiptr *p5) {
+    TGL_CALL(538, tgl_real_glBindBuffersRange(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLBINDTEXTURESPROC tgl_real_glBindTextures = 0;
+static void APIENTRY tgl_wrap_glBindTextures(GLuint p0, GLsizei p1, const GLuint *p2) {
+    TGL_CALL(539, tgl_real_glBindTextures(p0, p1, p2));
+}
+static PFNGLBINDSAMPLERSPROC tgl_real_glBindSamplers = 0;
+static void APIENTRY tgl_wrap_glBindSamplers(GLuint p0, GLsizei p1, const GLuint *p2) {
+    TGL_CALL(540, tgl_real_glBindSamplers(p0, p1, p2));
+}
+static PFNGLBINDIMAGETEXTURESPROC tgl_real_glBindImageTextures = 0;
+static void APIENTRY tgl_wrap_glBindImageTextures(GLuint p0, GLsizei p1, const GLuint *p2) {
+    TGL_CALL(541, tgl_real_glBindImageTextures(p0, p1, p2));
+}
+static PFNGLBINDVERTEXBUFFERSPROC tgl_real_glBindVertexBuffers = 0;
+static void APIENTRY tgl_wrap_glBindVertexBuffers(GLuint p0, GLsizei p1, const GLuint *p2, const GLintptr *p3, const GLsizei *p4) {
+    TGL_CALL(542, tgl_real_glBindVertexBuffers(p0, p1, p2, p3, p4));
+}
+#endif
+
+/* GL_version_4_5 */
+#if defined(TGL_DEFINE_CORE_GL_4_5)
+static PFNGLCLIPCONTROLPROC tgl_real_glClipControl = 0;
+static void APIENTRY tgl_wrap_glClipControl(GLenum p0, GLenum p1) {
+    TGL_CALL(543, tgl_real_glClipControl(p0, p1));
+}
+static PFNGLCREATETRANSFORMFEEDBACKSPROC tgl_real_glCreateTransformFeedbacks = 0;
+static void APIENTRY tgl_wrap_glCreateTransformFeedbacks(GLsizei p0, GLuint *p1) {
+    TGL_CALL(544, tgl_real_glCreateTransformFeedbacks(p0, p1));
+}
+static PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC tgl_real_glTransformFeedbackBufferBase = 0;
+static void APIENTRY tgl_wrap_glTransformFeedbackBufferBase(GLuint p0, GLuint p1, GLuint p2) {
+    TGL_CALL(545, tgl_real_glTransformFeedbackBufferBase(p0, p1, p2));
+}
+static PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC tgl_real_glTransformFeedbackBufferRange = 0;
+static void APIENTRY tgl_wrap_glTransformFeedbackBufferRange(GLuint p0, GLuint p1, GLuint p2, GLintptr p3, GLsizeiptr p4) {
+    TGL_CALL(546, tgl_real_glTransformFeedbackBufferRange(p0, p1, p2, p3, p4));
+}
+static PFNGLGETTRANSFORMFEEDBACKIVPROC tgl_real_glGetTransformFeedbackiv = 0;
+static void APIENTRY tgl_wrap_glGetTransformFeedbackiv(GLuint p0, GLenum p1, GLint *p2) {
+    TGL_CALL(547, tgl_real_glGetTransformFeedbackiv(p0, p1, p2));
+}
+static PFNGLGETTRANSFORMFEEDBACKI_VPROC tgl_real_glGetTransformFeedbacki_v = 0;
+static void APIENTRY tgl_wrap_glGetTransformFeedbacki_v(GLuint p0, GLenum p1, GLuint p2, GLint *p3) {
+    TGL_CALL(548, tgl_real_glGetTransformFeedbacki_v(p0, p1, p2, p3));
+}
+static PFNGLGETTRANSFORMFEEDBACKI64_VPROC tgl_real_glGetTransformFeedbacki64_v = 0;
+static void APIENTRY tgl_wrap_glGetTransformFeedbacki64_v(GLuint p0, GLenum p1, GLuint p2, GLint64 *p3) {
+    TGL_CALL(549, tgl_real_glGetTransformFeedbacki64_v(p0, p1, p2, p3));
+}
+static PFNGLCREATEBUFFERSPROC tgl_real_glCreateBuffers = 0;
+static void APIENTRY tgl_wrap_glCreateBuffers(GLsizei p0, GLuint *p1) {
+    TGL_CALL(550, tgl_real_glCreateBuffers(p0, p1));
+}
+static PFNGLNAMEDBUFFERSTORAGEPROC tgl_real_glNamedBufferStorage = 0;
+static void APIENTRY tgl_wrap_glNamedBufferStorage(GLuint p0, GLsizeiptr p1, const void *p2, GLbitfield p3) {
+    TGL_CALL(551, tgl_real_glNamedBufferStorage(p0, p1, p2, p3));
+}
+static PFNGLNAMEDBUFFERDATAPROC tgl_real_glNamedBufferData = 0;
+static void APIENTRY tgl_wrap_glNamedBufferData(GLuint p0, GLsizeiptr p1, const void *p2, GLenum p3) {
+    TGL_CALL(552, tgl_real_glNamedBufferData(p0, p1, p2, p3));
+}
+static PFNGLNAMEDBUFFERSUBDATAPROC tgl_real_glNamedBufferSubData = 0;
+static void APIENTRY tgl_wrap_glNamedBufferSubData(GLuint p0, GLintptr p1, GLsizeiptr p2, const void *p3) {
+    TGL_CALL(553, tgl_real_glNamedBufferSubData(p0, p1, p2, p3));
+}
+static PFNGLCOPYNAMEDBUFFERSUBDATAPROC tgl_real_glCopyNamedBufferSubData = 0;
+static void APIENTRY tgl_wrap_glCopyNamedBufferSubData(GLuint p0, GLuint p1, GLintptr p2, GLintptr p3, GLsizeiptr p4) {
+    TGL_CALL(554, tgl_real_glCopyNamedBufferSubData(p0, p1, p2, p3, p4));
+}
+static PFNGLCLEARNAMEDBUFFERDATAPROC tgl_real_glClearNamedBufferData = 0;
+static void APIENTRY tgl_wrap_glClearNamedBufferData(GLuint p0, GLenum p1, GLenum p2, GLenum p3, const void *p4) {
+    TGL_CALL(555, tgl_real_glClearNamedBufferData(p0, p1, p2, p3, p4));
+}
+static PFNGLCLEARNAMEDBUFFERSUBDATAPROC tgl_real_glClearNamedBufferSubData = 0;
+static void APIENTRY tgl_wrap_glClearNamedBufferSubData(GLuint p0, GLenum p1, GLintptr p2, GLsizeiptr p3, GLenum p4, GLenum p5, const void *p6) {
+    TGL_CALL(556, tgl_real_glClearNamedBufferSubData(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLMAPNAMEDBUFFERPROC tgl_real_glMapNamedBuffer = 0;
+static void *APIENTRY tgl_wrap_glMapNamedBuffer(GLuint p0, GLenum p1) {
+    void *result;
+    TGL_CALL(557, result = tgl_real_glMapNamedBuffer(p0, p1));
+    return result;
+}
+static PFNGLMAPNAMEDBUFFERRANGEPROC tgl_real_glMapNamedBufferRange = 0;
+static void *APIENTRY tgl_wrap_glMapNamedBufferRange(GLuint p0, GLintptr p1, GLsizeiptr p2, GLbitfield p3) {
+    void *result;
+    TGL_CALL(558, result = tgl_real_glMapNamedBufferRange(p0, p1, p2, p3));
+    return result;
+}
+static PFNGLUNMAPNAMEDBUFFERPROC tgl_real_glUnmapNamedBuffer = 0;
+static GLboolean APIENTRY tgl_wrap_glUnmapNamedBuffer(GLuint p0) {
+    GLboolean result;
+    TGL_CALL(559, result = tgl_real_glUnmapNamedBuffer(p0));
+    return result;
+}
+static PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC tgl_real_glFlushMappedNamedBufferRange = 0;
+static void APIENTRY tgl_wrap_glFlushMappedNamedBufferRange(GLuint p0, GLintptr p1, GLsizeiptr p2) {
+    TGL_CALL(560, tgl_real_glFlushMappedNamedBufferRange(p0, p1, p2));
+}
+static PFNGLGETNAMEDBUFFERPARAMETERIVPROC tgl_real_glGetNamedBufferParameteriv = 0;
+static void APIENTRY tgl_wrap_glGetNamedBufferParameteriv(GLuint p0, GLenum p1, GLint *p2) {
+    TGL_CALL(561, tgl_real_glGetNamedBufferParameteriv(p0, p1, p2));
+}
+static PFNGLGETNAMEDBUFFERPARAMETERI64VPROC tgl_real_glGetNamedBufferParameteri64v = 0;
+static void APIENTRY tgl_wrap_glGetNamedBufferParameteri64v(GLuint p0, GLenum p1, GLint64 *p2) {
+    TGL_CALL(562, tgl_real_glGetNamedBufferParameteri64v(p0, p1, p2));
+}
+static PFNGLGETNAMEDBUFFERPOINTERVPROC tgl_real_glGetNamedBufferPointerv = 0;
+static void APIENTRY tgl_wrap_glGetNamedBufferPointerv(GLuint p0, GLenum p1, void **p2) {
+    TGL_CALL(563, tgl_real_glGetNamedBufferPointerv(p0, p1, p2));
+}
+static PFNGLGETNAMEDBUFFERSUBDATAPROC tgl_real_glGetNamedBufferSubData = 0;
+static void APIENTRY tgl_wrap_glGetNamedBufferSubData(GLuint p0, GLintptr p1, GLsizeiptr p2, void *p3) {
+    TGL_CALL(564, tgl_real_glGetNamedBufferSubData(p0, p1, p2, p3));
+}
+static PFNGLCREATEFRAMEBUFFERSPROC tgl_real_glCreateFramebuffers = 0;
+static void APIENTRY tgl_wrap_glCreateFramebuffers(GLsizei p0, GLuint *p1) {
+    TGL_CALL(565, tgl_real_glCreateFramebuffers(p0, p1));
+}
+static PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC tgl_real_glNamedFramebufferRenderbuffer = 0;
+static void APIENTRY tgl_wrap_glNamedFramebufferRenderbuffer(GLuint p0, GLenum p1, GLenum p2, GLuint p3) {
+    TGL_CALL(566, tgl_real_glNamedFramebufferRenderbuffer(p0, p1, p2, p3));
+}
+static PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC tgl_real_glNamedFramebufferParameteri = 0;
+static void APIENTRY tgl_wrap_glNamedFramebufferParameteri(GLuint p0, GLenum p1, GLint p2) {
+    TGL_CALL(567, tgl_real_glNamedFramebufferParameteri(p0, p1, p2));
+}
+static PFNGLNAMEDFRAMEBUFFERTEXTUREPROC tgl_real_glNamedFramebufferTexture = 0;
+static void APIENTRY tgl_wrap_glNamedFramebufferTexture(GLuint p0, GLenum p1, GLuint p2, GLint p3) {
+    TGL_CALL(568, tgl_real_glNamedFramebufferTexture(p0, p1, p2, p3));
+}
+static PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC tgl_real_glNamedFramebufferTextureLayer = 0;
+static void APIENTRY tgl_wrap_glNamedFramebufferTextureLayer(GLuint p0, GLenum p1, GLuint p2, GLint p3, GLint p4) {
+    TGL_CALL(569, tgl_real_glNamedFramebufferTextureLayer(p0, p1, p2, p3, p4));
+}
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC tgl_real_glNamedFramebufferDrawBuffer = 0;
+static void APIENTRY tgl_wrap_glNamedFramebufferDrawBuffer(GLuint p0, GLenum p1) {
+    TGL_CALL(570, tgl_real_glNamedFramebufferDrawBuffer(p0, p1));
+}
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC tgl_real_glNamedFramebufferDrawBuffers = 0;
+static void APIENTRY tgl_wrap_glNamedFramebufferDrawBuffers(GLuint p0, GLsizei p1, const GLenum *p2) {
+    TGL_CALL(571, tgl_real_glNamedFramebufferDrawBuffers(p0, p1, p2));
+}
+static PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC tgl_real_glNamedFramebufferReadBuffer = 0;
+static void APIENTRY tgl_wrap_glNamedFramebufferReadBuffer(GLuint p0, GLenum p1) {
+    TGL_CALL(572, tgl_real_glNamedFramebufferReadBuffer(p0, p1));
+}
+static PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC tgl_real_glInvalidateNamedFramebufferData = 0;
+static void APIENTRY tgl_wrap_glInvalidateNamedFramebufferData(GLuint p0, GLsizei p1, const GLenum *p2) {
+    TGL_CALL(573, tgl_real_glInvalidateNamedFramebufferData(p0, p1, p2));
+}
+static PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC tgl_real_glInvalidateNamedFramebufferSubData = 0;
+static void APIENTRY tgl_wrap_glInvalidateNamedFramebufferSubData(GLuint p0, GLsizei p1, const GLenum *p2, GLint p3, GLint p4, GLsizei p5, GLsizei p6) {
+    TGL_CALL(574, tgl_real_glInvalidateNamedFramebufferSubData(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERIVPROC tgl_real_glClearNamedFramebufferiv = 0;
+static void APIENTRY tgl_wrap_glClearNamedFramebufferiv(GLuint p0, GLenum p1, GLint p2, const GLint *p3) {
+    TGL_CALL(575, tgl_real_glClearNamedFramebufferiv(p0, p1, p2, p3));
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC tgl_real_glClearNamedFramebufferuiv = 0;
+static void APIENTRY tgl_wrap_glClearNamedFramebufferuiv(GLuint p0, GLenum p1, GLint p2, const GLuint *p3) {
+    TGL_CALL(576, tgl_real_glClearNamedFramebufferuiv(p0, p1, p2, p3));
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERFVPROC tgl_real_glClearNamedFramebufferfv = 0;
+static void APIENTRY tgl_wrap_glClearNamedFramebufferfv(GLuint p0, GLenum p1, GLint p2, const GLfloat *p3) {
+    TGL_CALL(577, tgl_real_glClearNamedFramebufferfv(p0, p1, p2, p3));
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERFIPROC tgl_real_glClearNamedFramebufferfi = 0;
+static void APIENTRY tgl_wrap_glClearNamedFramebufferfi(GLuint p0, GLenum p1, GLint p2, GLfloat p3, GLint p4) {
+    TGL_CALL(578, tgl_real_glClearNamedFramebufferfi(p0, p1, p2, p3, p4));
+}
+static PFNGLBLITNAMEDFRAMEBUFFERPROC tgl_real_glBlitNamedFramebuffer = 0;
+static void APIENTRY tgl_wrap_glBlitNamedFramebuffer(GLuint p0, GLuint p1, GLint p2, GLint p3, GLint p4, GLint p5, GLint p6, GLint p7, GLint p8, GLint p9, GLbitfield p10, GLenum p11) {
+    TGL_CALL(579, tgl_real_glBlitNamedFramebuffer(p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11));
+}
+static PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC tgl_real_glCheckNamedFramebufferStatus = 0;
+static GLenum APIENTRY tgl_wrap_glCheckNamedFramebufferStatus(GLuint p0, GLenum p1) {
+    GLenum result;
+    TGL_CALL(580, result = tgl_real_glCheckNamedFramebufferStatus(p0, p1));
+    return result;
+}
+static PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC tgl_real_glGetNamedFramebufferParameteriv = 0;
+static void APIENTRY tgl_wrap_glGetNamedFramebufferParameteriv(GLuint p0, GLenum p1, GLint *p2) {
+    TGL_CALL(581, tgl_real_glGetNamedFramebufferParameteriv(p0, p1, p2));
+}
+static PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC tgl_real_glGetNamedFramebufferAttachmentParameteriv = 0;
+static void APIENTRY tgl_wrap_glGetNamedFramebufferAttachmentParameteriv(GLuint p0, GLenum p1, GLenum p2, GLint *p3) {
+    TGL_CALL(582, tgl_real_glGetNamedFramebufferAttachmentParameteriv(p0, p1, p2, p3));
+}
+static PFNGLCREATERENDERBUFFERSPROC tgl_real_glCreateRenderbuffers = 0;
+static void APIENTRY tgl_wrap_glCreateRenderbuffers(GLsizei p0, GLuint *p1) {
+    TGL_CALL(583, tgl_real_glCreateRenderbuffers(p0, p1));
+}
+static PFNGLNAMEDRENDERBUFFERSTORAGEPROC tgl_real_glNamedRenderbufferStorage = 0;
+static void APIENTRY tgl_wrap_glNamedRenderbufferStorage(GLuint p0, GLenum p1, GLsizei p2, GLsizei p3) {
+    TGL_CALL(584, tgl_real_glNamedRenderbufferStorage(p0, p1, p2, p3));
+}
+static PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC tgl_real_glNamedRenderbufferStorageMultisample = 0;
+static void APIENTRY tgl_wrap_glNamedRenderbufferStorageMultisample(GLuint p0, GLsizei p1, GLenum p2, GLsizei p3, GLsizei p4) {
+    TGL_CALL(585, tgl_real_glNamedRenderbufferStorageMultisample(p0, p1, p2, p3, p4));
+}
+static PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC tgl_real_glGetNamedRenderbufferParameteriv = 0;
+static void APIENTRY tgl_wrap_glGetNamedRenderbufferParameteriv(GLuint p0, GLenum p1, GLint *p2) {
+    TGL_CALL(586, tgl_real_glGetNamedRenderbufferParameteriv(p0, p1, p2));
+}
+static PFNGLCREATETEXTURESPROC tgl_real_glCreateTextures = 0;
+static void APIENTRY tgl_wrap_glCreateTextures(GLenum p0, GLsizei p1, GLuint *p2) {
+    TGL_CALL(587, tgl_real_glCreateTextures(p0, p1, p2));
+}
+static PFNGLTEXTUREBUFFERPROC tgl_real_glTextureBuffer = 0;
+static void APIENTRY tgl_wrap_glTextureBuffer(GLuint p0, GLenum p1, GLuint p2) {
+    TGL_CALL(588, tgl_real_glTextureBuffer(p0, p1, p2));
+}
+static PFNGLTEXTUREBUFFERRANGEPROC tgl_real_glTextureBufferRange = 0;
+static void APIENTRY tgl_wrap_glTextureBufferRange(GLuint p0, GLenum p1, GLuint p2, GLintptr p3, GLsizeiptr p4) {
+    TGL_CALL(589, tgl_real_glTextureBufferRange(p0, p1, p2, p3, p4));
+}
+static PFNGLTEXTURESTORAGE1DPROC tgl_real_glTextureStorage1D = 0;
+static void APIENTRY tgl_wrap_glTextureStorage1D(GLuint p0, GLsizei p1, GLenum p2, GLsizei p3) {
+    TGL_CALL(590, tgl_real_glTextureStorage1D(p0, p1, p2, p3));
+}
+static PFNGLTEXTURESTORAGE2DPROC tgl_real_glTextureStorage2D = 0;
+static void APIENTRY tgl_wrap_glTextureStorage2D(GLuint p0, GLsizei p1, GLenum p2, GLsizei p3, GLsizei p4) {
+    TGL_CALL(591, tgl_real_glTextureStorage2D(p0, p1, p2, p3, p4));
+}
+static PFNGLTEXTURESTORAGE3DPROC tgl_real_glTextureStorage3D = 0;
+static void APIENTRY tgl_wrap_glTextureStorage3D(GLuint p0, GLsizei p1, GLenum p2, GLsizei p3, GLsizei p4, GLsizei p5) {
+    TGL_CALL(592, tgl_real_glTextureStorage3D(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC tgl_real_glTextureStorage2DMultisample = 0;
+static void APIENTRY tgl_wrap_glTextureStorage2DMultisample(GLuint p0, GLsizei p1, GLenum p2, GLsizei p3, GLsizei p4, GLboolean p5) {
+    TGL_CALL(593, tgl_real_glTextureStorage2DMultisample(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC tgl_real_glTextureStorage3DMultisample = 0;
+static void APIENTRY tgl_wrap_glTextureStorage3DMultisample(GLuint p0, GLsizei p1, GLenum p2, GLsizei p3, GLsizei p4, GLsizei p5, GLboolean p6) {
+    TGL_CALL(594, tgl_real_glTextureStorage3DMultisample(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLTEXTURESUBIMAGE1DPROC tgl_real_glTextureSubImage1D = 0;
+static void APIENTRY tgl_wrap_glTextureSubImage1D(GLuint p0, GLint p1, GLint p2, GLsizei p3, GLenum p4, GLenum p5, const void *p6) {
+    TGL_CALL(595, tgl_real_glTextureSubImage1D(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLTEXTURESUBIMAGE2DPROC tgl_real_glTextureSubImage2D = 0;
+static void APIENTRY tgl_wrap_glTextureSubImage2D(GLuint p0, GLint p1, GLint p2, GLint p3, GLsizei p4, GLsizei p5, GLenum p6, GLenum p7, const void *p8) {
+    TGL_CALL(596, tgl_real_glTextureSubImage2D(p0, p1, p2, p3, p4, p5, p6, p7, p8));
+}
+static PFNGLTEXTURESUBIMAGE3DPROC tgl_real_glTextureSubImage3D = 0;
+static void APIENTRY tgl_wrap_glTextureSubImage3D(GLuint p0, GLint p1, GLint p2, GLint p3, GLint p4, GLsizei p5, GLsizei p6, GLsizei p7, GLenum p8, GLenum p9, const void *p10) {
+    TGL_CALL(597, tgl_real_glTextureSubImage3D(p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10));
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC tgl_real_glCompressedTextureSubImage1D = 0;
+static void APIENTRY tgl_wrap_glCompressedTextureSubImage1D(GLuint p0, GLint p1, GLint p2, GLsizei p3, GLenum p4, GLsizei p5, const void *p6) {
+    TGL_CALL(598, tgl_real_glCompressedTextureSubImage1D(p0, p1, p2, p3, p4, p5, p6));
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC tgl_real_glCompressedTextureSubImage2D = 0;
+static void APIENTRY tgl_wrap_glCompressedTextureSubImage2D(GLuint p0, GLint p1, GLint p2, GLint p3, GLsizei p4, GLsizei p5, GLenum p6, GLsizei p7, const void *p8) {
+    TGL_CALL(599, tgl_real_glCompressedTextureSubImage2D(p0, p1, p2, p3, p4, p5, p6, p7, p8));
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC tgl_real_glCompressedTextureSubImage3D = 0;
+static void APIENTRY tgl_wrap_glCompressedTextureSubImage3D(GLuint p0, GLint p1, GLint p2, GLint p3, GLint p4, GLsizei p5, GLsizei p6, GLsizei p7, GLenum p8, GLsizei p9, const void *p10) {
+    TGL_CALL(600, tgl_real_glCompressedTextureSubImage3D(p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10));
+}
+static PFNGLCOPYTEXTURESUBIMAGE1DPROC tgl_real_glCopyTextureSubImage1D = 0;
+static void APIENTRY tgl_wrap_glCopyTextureSubImage1D(GLuint p0, GLint p1, GLint p2, GLint p3, GLint p4, GLsizei p5) {
+    TGL_CALL(601, tgl_real_glCopyTextureSubImage1D(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLCOPYTEXTURESUBIMAGE2DPROC tgl_real_glCopyTextureSubImage2D = 0;
+static void APIENTRY tgl_wrap_glCopyTextureSubImage2D(GLuint p0, GLint p1, GLint p2, GLint p3, GLint p4, GLint p5, GLsizei p6, GLsizei p7) {
+    TGL_CALL(602, tgl_real_glCopyTextureSubImage2D(p0, p1, p2, p3, p4, p5, p6, p7));
+}
+static PFNGLTEXTUREPARAMETERFPROC tgl_real_glTextureParameterf = 0;
+static void APIENTRY tgl_wrap_glTextureParameterf(GLuint p0, GLenum p1, GLfloat p2) {
+    TGL_CALL(603, tgl_real_glTextureParameterf(p0, p1, p2));
+}
+static PFNGLTEXTUREPARAMETERFVPROC tgl_real_glTextureParameterfv = 0;
+static void APIENTRY tgl_wrap_glTextureParameterfv(GLuint p0, GLenum p1, const GLfloat *p2) {
+    TGL_CALL(604, tgl_real_glTextureParameterfv(p0, p1, p2));
+}
+static PFNGLTEXTUREPARAMETERIPROC tgl_real_glTextureParameteri = 0;
+static void APIENTRY tgl_wrap_glTextureParameteri(GLuint p0, GLenum p1, GLint p2) {
+    TGL_CALL(605, tgl_real_glTextureParameteri(p0, p1, p2));
+}
+static PFNGLTEXTUREPARAMETERIIVPROC tgl_real_glTextureParameterIiv = 0;
+static void APIENTRY tgl_wrap_glTextureParameterIiv(GLuint p0, GLenum p1, const GLint *p2) {
+    TGL_CALL(606, tgl_real_glTextureParameterIiv(p0, p1, p2));
+}
+static PFNGLTEXTUREPARAMETERIUIVPROC tgl_real_glTextureParameterIuiv = 0;
+static void APIENTRY tgl_wrap_glTextureParameterIuiv(GLuint p0, GLenum p1, const GLuint *p2) {
+    TGL_CALL(607, tgl_real_glTextureParameterIuiv(p0, p1, p2));
+}
+static PFNGLTEXTUREPARAMETERIVPROC tgl_real_glTextureParameteriv = 0;
+static void APIENTRY tgl_wrap_glTextureParameteriv(GLuint p0, GLenum p1, const GLint *p2) {
+    TGL_CALL(608, tgl_real_glTextureParameteriv(p0, p1, p2));
+}
+static PFNGLGENERATETEXTUREMIPMAPPROC tgl_real_glGenerateTextureMipmap = 0;
+static void APIENTRY tgl_wrap_glGenerateTextureMipmap(GLuint p0) {
+    TGL_CALL(609, tgl_real_glGenerateTextureMipmap(p0));
+}
+static PFNGLBINDTEXTUREUNITPROC tgl_real_glBindTextureUnit = 0;
+static void APIENTRY tgl_wrap_glBindTextureUnit(GLuint p0, GLuint p1) {
+    TGL_CALL(610, tgl_real_glBindTextureUnit(p0, p1));
+}
+static PFNGLGETTEXTUREIMAGEPROC tgl_real_glGetTextureImage = 0;
+static void APIENTRY tgl_wrap_glGetTextureImage(GLuint p0, GLint p1, GLenum p2, GLenum p3, GLsizei p4, void *p5) {
+    TGL_CALL(611, tgl_real_glGetTextureImage(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC tgl_real_glGetCompressedTextureImage = 0;
+static void APIENTRY tgl_wrap_glGetCompressedTextureImage(GLuint p0, GLint p1, GLsizei p2, void *p3) {
+    TGL_CALL(612, tgl_real_glGetCompressedTextureImage(p0, p1, p2, p3));
+}
+static PFNGLGETTEXTURELEVELPARAMETERFVPROC tgl_real_glGetTextureLevelParameterfv = 0;
+static void APIENTRY tgl_wrap_glGetTextureLevelParameterfv(GLuint p0, GLint p1, GLenum p2, GLfloat *p3) {
+    TGL_CALL(613, tgl_real_glGetTextureLevelParameterfv(p0, p1, p2, p3));
+}
+static PFNGLGETTEXTURELEVELPARAMETERIVPROC tgl_real_glGetTextureLevelParameteriv = 0;
+static void APIENTRY tgl_wrap_glGetTextureLevelParameteriv(GLuint p0, GLint p1, GLenum p2, GLint *p3) {
+    TGL_CALL(614, tgl_real_glGetTextureLevelParameteriv(p0, p1, p2, p3));
+}
+static PFNGLGETTEXTUREPARAMETERFVPROC tgl_real_glGetTextureParameterfv = 0;
+static void APIENTRY tgl_wrap_glGetTextureParameterfv(GLuint p0, GLenum p1, GLfloat *p2) {
+    TGL_CALL(615, tgl_real_glGetTextureParameterfv(p0, p1, p2));
+}
+static PFNGLGETTEXTUREPARAMETERIIVPROC tgl_real_glGetTextureParameterIiv = 0;
+static void APIENTRY tgl_wrap_glGetTextureParameterIiv(GLuint p0, GLenum p1, GLint *p2) {
+    TGL_CALL(616, tgl_real_glGetTextureParameterIiv(p0, p1, p2));
+}
+static PFNGLGETTEXTUREPARAMETERIUIVPROC tgl_real_glGetTextureParameterIuiv = 0;
+static void APIENTRY tgl_wrap_glGetTextureParameterIuiv(GLuint p0, GLenum p1, GLuint *p2) {
+    TGL_CALL(617, tgl_real_glGetTextureParameterIuiv(p0, p1, p2));
+}
+static PFNGLGETTEXTUREPARAMETERIVPROC tgl_real_glGetTextureParameteriv = 0;
+static void APIENTRY tgl_wrap_glGetTextureParameteriv(GLuint p0, GLenum p1, GLint *p2) {
+    TGL_CALL(618, tgl_real_glGetTextureParameteriv(p0, p1, p2));
+}
+static PFNGLCREATEVERTEXARRAYSPROC tgl_real_glCreateVertexArrays = 0;
+static void APIENTRY tgl_wrap_glCreateVertexArrays(GLsizei p0, GLuint *p1) {
+    TGL_CALL(619, tgl_real_glCreateVertexArrays(p0, p1));
+}
+static PFNGLDISABLEVERTEXARRAYATTRIBPROC tgl_real_glDisableVertexArrayAttrib = 0;
+static void APIENTRY tgl_wrap_glDisableVertexArrayAttrib(GLuint p0, GLuint p1) {
+    TGL_CALL(620, tgl_real_glDisableVertexArrayAttrib(p0, p1));
+}
+static PFNGLENABLEVERTEXARRAYATTRIBPROC tgl_real_glEnableVertexArrayAttrib = 0;
+static void APIENTRY tgl_wrap_glEnableVertexArrayAttrib(GLuint p0, GLuint p1) {
+    TGL_CALL(621, tgl_real_glEnableVertexArrayAttrib(p0, p1));
+}
+static PFNGLVERTEXARRAYELEMENTBUFFERPROC tgl_real_glVertexArrayElementBuffer = 0;
+static void APIENTRY tgl_wrap_glVertexArrayElementBuffer(GLuint p0, GLuint p1) {
+    TGL_CALL(622, tgl_real_glVertexArrayElementBuffer(p0, p1));
+}
+static PFNGLVERTEXARRAYVERTEXBUFFERPROC tgl_real_glVertexArrayVertexBuffer = 0;
+static void APIENTRY tgl_wrap_glVertexArrayVertexBuffer(GLuint p0, GLuint p1, GLuint p2, GLintptr p3, GLsizei p4) {
+    TGL_CALL(623, tgl_real_glVertexArrayVertexBuffer(p0, p1, p2, p3, p4));
+}
+static PFNGLVERTEXARRAYVERTEXBUFFERSPROC tgl_real_glVertexArrayVertexBuffers = 0;
+static void APIENTRY tgl_wrap_glVertexArrayVertexBuffers(GLuint p0, GLuint p1, GLsizei p2, const GLuint *p3, const GLintptr *p4, const GLsizei *p5) {
+    TGL_CALL(624, tgl_real_glVertexArrayVertexBuffers(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLVERTEXARRAYATTRIBBINDINGPROC tgl_real_glVertexArrayAttribBinding = 0;
+static void APIENTRY tgl_wrap_glVertexArrayAttribBinding(GLuint p0, GLuint p1, GLuint p2) {
+    TGL_CALL(625, tgl_real_glVertexArrayAttribBinding(p0, p1, p2));
+}
+static PFNGLVERTEXARRAYATTRIBFORMATPROC tgl_real_glVertexArrayAttribFormat = 0;
+static void APIENTRY tgl_wrap_glVertexArrayAttribFormat(GLuint p0, GLuint p1, GLint p2, GLenum p3, GLboolean p4, GLuint p5) {
+    TGL_CALL(626, tgl_real_glVertexArrayAttribFormat(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLVERTEXARRAYATTRIBIFORMATPROC tgl_real_glVertexArrayAttribIFormat = 0;
+static void APIENTRY tgl_wrap_glVertexArrayAttribIFormat(GLuint p0, GLuint p1, GLint p2, GLenum p3, GLuint p4) {
+    TGL_CALL(627, tgl_real_glVertexArrayAttribIFormat(p0, p1, p2, p3, p4));
+}
+static PFNGLVERTEXARRAYATTRIBLFORMATPROC tgl_real_glVertexArrayAttribLFormat = 0;
+static void APIENTRY tgl_wrap_glVertexArrayAttribLFormat(GLuint p0, GLuint p1, GLint p2, GLenum p3, GLuint p4) {
+    TGL_CALL(628, tgl_real_glVertexArrayAttribLFormat(p0, p1, p2, p3, p4));
+}
+static PFNGLVERTEXARRAYBINDINGDIVISORPROC tgl_real_glVertexArrayBindingDivisor = 0;
+static void APIENTRY tgl_wrap_glVertexArrayBindingDivisor(GLuint p0, GLuint p1, GLuint p2) {
+    TGL_CALL(629, tgl_real_glVertexArrayBindingDivisor(p0, p1, p2));
+}
+static PFNGLGETVERTEXARRAYIVPROC tgl_real_glGetVertexArrayiv = 0;
+static void APIENTRY tgl_wrap_glGetVertexArrayiv(GLuint p0, GLenum p1, GLint *p2) {
+    TGL_CALL(630, tgl_real_glGetVertexArrayiv(p0, p1, p2));
+}
+static PFNGLGETVERTEXARRAYINDEXEDIVPROC tgl_real_glGetVertexArrayIndexediv = 0;
+static void APIENTRY tgl_wrap_glGetVertexArrayIndexediv(GLuint p0, GLuint p1, GLenum p2, GLint *p3) {
+    TGL_CALL(631, tgl_real_glGetVertexArrayIndexediv(p0, p1, p2, p3));
+}
+static PFNGLGETVERTEXARRAYINDEXED64IVPROC tgl_real_glGetVertexArrayIndexed64iv = 0;
+static void APIENTRY tgl_wrap_glGetVertexArrayIndexed64iv(GLuint p0, GLuint p1, GLenum p2, GLint64 *p3) {
+    TGL_CALL(632, tgl_real_glGetVertexArrayIndexed64iv(p0, p1, p2, p3));
+}
+static PFNGLCREATESAMPLERSPROC tgl_real_glCreateSamplers = 0;
+static void APIENTRY tgl_wrap_glCreateSamplers(GLsizei p0, GLuint *p1) {
+    TGL_CALL(633, tgl_real_glCreateSamplers(p0, p1));
+}
+static PFNGLCREATEPROGRAMPIPELINESPROC tgl_real_glCreateProgramPipelines = 0;
+static void APIENTRY tgl_wrap_glCreateProgramPipelines(GLsizei p0, GLuint *p1) {
+    TGL_CALL(634, tgl_real_glCreateProgramPipelines(p0, p1));
+}
+static PFNGLCREATEQUERIESPROC tgl_real_glCreateQueries = 0;
+static void APIENTRY tgl_wrap_glCreateQueries(GLenum p0, GLsizei p1, GLuint *p2) {
+    TGL_CALL(635, tgl_real_glCreateQueries(p0, p1, p2));
+}
+static PFNGLGETQUERYBUFFEROBJECTI64VPROC tgl_real_glGetQueryBufferObjecti64v = 0;
+static void APIENTRY tgl_wrap_glGetQueryBufferObjecti64v(GLuint p0, GLuint p1, GLenum p2, GLintptr p3) {
+    TGL_CALL(636, tgl_real_glGetQueryBufferObjecti64v(p0, p1, p2, p3));
+}
+static PFNGLGETQUERYBUFFEROBJECTIVPROC tgl_real_glGetQueryBufferObjectiv = 0;
+static void APIENTRY tgl_wrap_glGetQueryBufferObjectiv(GLuint p0, GLuint p1, GLenum p2, GLintptr p3) {
+    TGL_CALL(637, tgl_real_glGetQueryBufferObjectiv(p0, p1, p2, p3));
+}
+static PFNGLGETQUERYBUFFEROBJECTUI64VPROC tgl_real_glGetQueryBufferObjectui64v = 0;
+static void APIENTRY tgl_wrap_glGetQueryBufferObjectui64v(GLuint p0, GLuint p1, GLenum p2, GLintptr p3) {
+    TGL_CALL(638, tgl_real_glGetQueryBufferObjectui64v(p0, p1, p2, p3));
+}
+static PFNGLGETQUERYBUFFEROBJECTUIVPROC tgl_real_glGetQueryBufferObjectuiv = 0;
+static void APIENTRY tgl_wrap_glGetQueryBufferObjectuiv(GLuint p0, GLuint p1, GLenum p2, GLintptr p3) {
+    TGL_CALL(639, tgl_real_glGetQueryBufferObjectuiv(p0, p1, p2, p3));
+}
+static PFNGLMEMORYBARRIERBYREGIONPROC tgl_real_glMemoryBarrierByRegion = 0;
+static void APIENTRY tgl_wrap_glMemoryBarrierByRegion(GLbitfield p0) {
+    TGL_CALL(640, tgl_real_glMemoryBarrierByRegion(p0));
+}
+static PFNGLGETTEXTURESUBIMAGEPROC tgl_real_glGetTextureSubImage = 0;
+static void APIENTRY tgl_wrap_glGetTextureSubImage(GLuint p0, GLint p1, GLint p2, GLint p3, GLint p4, GLsizei p5, GLsizei p6, GLsizei p7, GLenum p8, GLenum p9, GLsizei p10, void *p11) {
+    TGL_CALL(641, tgl_real_glGetTextureSubImage(p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11));
+}
+static PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC tgl_real_glGetCompressedTextureSubImage = 0;
+static void APIENTRY tgl_wrap_glGetCompressedTextureSubImage(GLuint p0, GLint p1, GLint p2, GLint p3, GLint p4, GLsizei p5, GLsizei p6, GLsizei p7, GLsizei p8, void *p9) {
+    TGL_CALL(642, tgl_real_glGetCompressedTextureSubImage(p0, p1, p2, p3, p4, p5, p6, p7, p8, p9));
+}
+static PFNGLGETGRAPHICSRESETSTATUSPROC tgl_real_glGetGraphicsResetStatus = 0;
+static GLenum APIENTRY tgl_wrap_glGetGraphicsResetStatus(void) {
+    GLenum result;
+    TGL_CALL(643, result = tgl_real_glGetGraphicsResetStatus());
+    return result;
+}
+static PFNGLGETNCOMPRESSEDTEXIMAGEPROC tgl_real_glGetnCompressedTexImage = 0;
+static void APIENTRY tgl_wrap_glGetnCompressedTexImage(GLenum p0, GLint p1, GLsizei p2, void *p3) {
+    TGL_CALL(644, tgl_real_glGetnCompressedTexImage(p0, p1, p2, p3));
+}
+static PFNGLGETNTEXIMAGEPROC tgl_real_glGetnTexImage = 0;
+static void APIENTRY tgl_wrap_glGetnTexImage(GLenum p0, GLint p1, GLenum p2, GLenum p3, GLsizei p4, void *p5) {
+    TGL_CALL(645, tgl_real_glGetnTexImage(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLGETNUNIFORMDVPROC tgl_real_glGetnUniformdv = 0;
+static void APIENTRY tgl_wrap_glGetnUniformdv(GLuint p0, GLint p1, GLsizei p2, GLdouble *p3) {
+    TGL_CALL(646, tgl_real_glGetnUniformdv(p0, p1, p2, p3));
+}
+static PFNGLGETNUNIFORMFVPROC tgl_real_glGetnUniformfv = 0;
+static void APIENTRY tgl_wrap_glGetnUniformfv(GLuint p0, GLint p1, GLsizei p2, GLfloat *p3) {
+    TGL_CALL(647, tgl_real_glGetnUniformfv(p0, p1, p2, p3));
+}
+static PFNGLGETNUNIFORMIVPROC tgl_real_glGetnUniformiv = 0;
+static void APIENTRY tgl_wrap_glGetnUniformiv(GLuint p0, GLint p1, GLsizei p2, GLint *p3) {
+    TGL_CALL(648, tgl_real_glGetnUniformiv(p0, p1, p2, p3));
+}
+static PFNGLGETNUNIFORMUIVPROC tgl_real_glGetnUniformuiv = 0;
+static void APIENTRY tgl_wrap_glGetnUniformuiv(GLuint p0, GLint p1, GLsizei p2, GLuint *p3) {
+    TGL_CALL(649, tgl_real_glGetnUniformuiv(p0, p1, p2, p3));
+}
+static PFNGLREADNPIXELSPROC tgl_real_glReadnPixels = 0;
+static void APIENTRY tgl_wrap_glReadnPixels(GLint p0, GLint p1, GLsizei p2, GLsizei p3, GLenum p4, GLenum p5, GLsizei p6, void *p7) {
+    TGL_CALL(650, tgl_real_glReadnPixels(p0, p1, p2, p3, p4, p5, p6, p7));
+}
+static PFNGLTEXTUREBARRIERPROC tgl_real_glTextureBarrier = 0;
+static void APIENTRY tgl_wrap_glTextureBarrier(void) {
+    TGL_CALL(651, tgl_real_glTextureBarrier());
+}
+#endif
+
+/* ARB_debug_output */
+#if defined(TGL_DEFINE_ARB_DEBUG_OUTPUT)
+static PFNGLDEBUGMESSAGECONTROLARBPROC tgl_real_glDebugMessageControlARB = 0;
+static void APIENTRY tgl_wrap_glDebugMessageControlARB(GLenum p0, GLenum p1, GLenum p2, GLsizei p3, const GLuint *p4, GLboolean p5) {
+    TGL_CALL(652, tgl_real_glDebugMessageControlARB(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLDEBUGMESSAGEINSERTARBPROC tgl_real_glDebugMessageInsertARB = 0;
+static void APIENTRY tgl_wrap_glDebugMessageInsertARB(GLenum p0, GLenum p1, GLuint p2, GLenum p3, GLsizei p4, const GLchar *p5) {
+    TGL_CALL(653, tgl_real_glDebugMessageInsertARB(p0, p1, p2, p3, p4, p5));
+}
+static PFNGLDEBUGMESSAGECALLBACKARBPROC tgl_real_glDebugMessageCallbackARB = 0;
+static void APIENTRY tgl_wrap_glDebugMessageCallbackARB(GLDEBUGPROCARB p0, const void *p1) {
+    TGL_CALL(654, tgl_real_glDebugMessageCallbackARB(p0, p1));
+}
+static PFNGLGETDEBUGMESSAGELOGARBPROC tgl_real_glGetDebugMessageLogARB = 0;
+static GLuint APIENTRY tgl_wrap_glGetDebugMessageLogARB(GLuint p0, GLsizei p1, GLenum *p2, GLenum *p3, GLuint *p4, GLenum *p5, GLsizei *p6, GLchar *p7) {
+    GLuint result;
+    TGL_CALL(655, result = tgl_real_glGetDebugMessageLogARB(p0, p1, p2, p3, p4, p5, p6, p7));
+    return result;
+}
+#endif
+
+/* AMD_debug_output */
+#if defined(TGL_DEFINE_AMD_DEBUG_OUTPUT)
+static PFNGLDEBUGMESSAGEENABLEAMDPROC tgl_real_glDebugMessageEnableAMD = 0;
+static void APIENTRY tgl_wrap_glDebugMessageEnableAMD(GLenum p0, GLenum p1, GLsizei p2, const GLuint *p3, GLboolean p4) {
+    TGL_CALL(656, tgl_real_glDebugMessageEnableAMD(p0, p1, p2, p3, p4));
+}
+static PFNGLDEBUGMESSAGEINSERTAMDPROC tgl_real_glDebugMessageInsertAMD = 0;
+static void APIENTRY tgl_wrap_glDebugMessageInsertAMD(GLenum p0, GLenum p1, GLuint p2, GLsizei p3, const GLchar *p4) {
+    TGL_CALL(657, tgl_real_glDebugMessageInsertAMD(p0, p1, p2, p3, p4));
+}
+static PFNGLDEBUGMESSAGECALLBACKAMDPROC tgl_real_glDebugMessageCallbackAMD = 0;
+static void APIENTRY tgl_wrap_glDebugMessageCallbackAMD(GLDEBUGPROCAMD p0, GLvoid *p1) {
+    TGL_CALL(658, tgl_real_glDebugMessageCallbackAMD(p0, p1));
+}
+static PFNGLGETDEBUGMESSAGELOGAMDPROC tgl_real_glGetDebugMessageLogAMD = 0;
+static GLuint APIENTRY tgl_wrap_glGetDebugMessageLogAMD(GLuint p0, GLsizei p1, GLenum *p2, GLuint *p3, GLuint *p4, GLsizei *p5, GLchar *p6) {
+    GLuint result;
+    TGL_CALL(659, result = tgl_real_glGetDebugMessageLogAMD(p0, p1, p2, p3, p4, p5, p6));
+    return result;
+}
+#endif
+#if defined(TGL_DEFINE_ARB_BINDLESS_TEXTURE)
+static PFNGLGETTEXTUREHANDLEARBPROC tgl_real_glGetTextureHandleARB = 0;
+static GLuint64 APIENTRY tgl_wrap_glGetTextureHandleARB(GLuint p0) {
+    GLuint64 result;
+    TGL_CALL(660, result = tgl_real_glGetTextureHandleARB(p0));
+    return result;
+}
+static PFNGLMAKETEXTUREHANDLERESIDENTARBPROC tgl_real_glMakeTextureHandleResidentARB = 0;
+static void APIENTRY tgl_wrap_glMakeTextureHandleResidentARB(GLuint64 p0) {
+    TGL_CALL(661, tgl_real_glMakeTextureHandleResidentARB(p0));
+}
+static PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC tgl_real_glMakeTextureHandleNonResidentARB = 0;
+static void APIENTRY tgl_wrap_glMakeTextureHandleNonResidentARB(GLuint64 p0) {
+    TGL_CALL(662, tgl_real_glMakeTextureHandleNonResidentARB(p0));
+}
+static PFNGLISTEXTUREHANDLERESIDENTARBPROC tgl_real_glIsTextureHandleResidentARB = 0;
+static GLboolean APIENTRY tgl_wrap_glIsTextureHandleResidentARB(GLuint64 p0) {
+    GLboolean result;
+    TGL_CALL(663, result = tgl_real_glIsTextureHandleResidentARB(p0));
+    return result;
+}
+#endif
+#if defined(TGL_DEFINE_KHR_PARALLEL_SHADER_COMPILE)
+static PFNGLMAXSHADERCOMPILERTHREADSKHRPROC tgl_real_glMaxShaderCompilerThreadsKHR = 0;
+static void APIENTRY tgl_wrap_glMaxShaderCompilerThreadsKHR(GLuint p0) {
+    TGL_CALL(664, tgl_real_glMaxShaderCompilerThreadsKHR(p0));
+}
+#endif
+
+/* swap a loaded function pointer for its wrapper */
+#define TGL_HOOK( name ) \
+    if (name != NULL) { \
+        tgl_real_##name = name; \
+        name = tgl_wrap_##name; \
+    }
+
+static void _tglInstrumentHook(void) {
+#if defined(TGL_DEFINE_CORE_GL_1_0)
+    TGL_HOOK(glCullFace)
+    TGL_HOOK(glFrontFace)
+    TGL_HOOK(glHint)
+    TGL_HOOK(glLineWidth)
+    TGL_HOOK(glPointSize)
+    TGL_HOOK(glPolygonMode)
+    TGL_HOOK(glScissor)
+    TGL_HOOK(glTexParameterf)
+    TGL_HOOK(glTexParameterfv)
+    TGL_HOOK(glTexParameteri)
+    TGL_HOOK(glTexParameteriv)
+    TGL_HOOK(glTexImage1D)
+    TGL_HOOK(glTexImage2D)
+    TGL_HOOK(glDrawBuffer)
+    TGL_HOOK(glClear)
+    TGL_HOOK(glClearColor)
+    TGL_HOOK(glClearStencil)
+    TGL_HOOK(glClearDepth)
+    TGL_HOOK(glStencilMask)
+    TGL_HOOK(glColorMask)
+    TGL_HOOK(glDepthMask)
+    TGL_HOOK(glDisable)
+    TGL_HOOK(glEnable)
+    TGL_HOOK(glFinish)
+    TGL_HOOK(glFlush)
+    TGL_HOOK(glBlendFunc)
+    TGL_HOOK(glLogicOp)
+    TGL_HOOK(glStencilFunc)
+    TGL_HOOK(glStencilOp)
+    TGL_HOOK(glDepthFunc)
+    TGL_HOOK(glPixelStoref)
+    TGL_HOOK(glPixelStorei)
+    TGL_HOOK(glReadBuffer)
+    TGL_HOOK(glReadPixels)
+    TGL_HOOK(glGetBooleanv)
+    TGL_HOOK(glGetDoublev)
+    TGL_HOOK(glGetError)
+    TGL_HOOK(glGetFloatv)
+    TGL_HOOK(glGetIntegerv)
+    TGL_HOOK(glGetString)
+    TGL_HOOK(glGetTexImage)
+    TGL_HOOK(glGetTexParameterfv)
+    TGL_HOOK(glGetTexParameteriv)
+    TGL_HOOK(glGetTexLevelParameterfv)
+    TGL_HOOK(glGetTexLevelParameteriv)
+    TGL_HOOK(glIsEnabled)
+    TGL_HOOK(glDepthRange)
+    TGL_HOOK(glViewport)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_1_1)
+    TGL_HOOK(glDrawArrays)
+    TGL_HOOK(glDrawElements)
+    TGL_HOOK(glGetPointerv)
+    TGL_HOOK(glPolygonOffset)
+    TGL_HOOK(glCopyTexImage1D)
+    TGL_HOOK(glCopyTexImage2D)
+    TGL_HOOK(glCopyTexSubImage1D)
+    TGL_HOOK(glCopyTexSubImage2D)
+    TGL_HOOK(glTexSubImage1D)
+    TGL_HOOK(glTexSubImage2D)
+    TGL_HOOK(glBindTexture)
+    TGL_HOOK(glDeleteTextures)
+    TGL_HOOK(glGenTextures)
+    TGL_HOOK(glIsTexture)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_1_2)
+    TGL_HOOK(glBlendColor)
+    TGL_HOOK(glBlendEquation)
+    TGL_HOOK(glDrawRangeElements)
+    TGL_HOOK(glTexImage3D)
+    TGL_HOOK(glTexSubImage3D)
+    TGL_HOOK(glCopyTexSubImage3D)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_1_3)
+    TGL_HOOK(glActiveTexture)
+    TGL_HOOK(glSampleCoverage)
+    TGL_HOOK(glCompressedTexImage3D)
+    TGL_HOOK(glCompressedTexImage2D)
+    TGL_HOOK(glCompressedTexImage1D)
+    TGL_HOOK(glCompressedTexSubImage3D)
+    TGL_HOOK(glCompressedTexSubImage2D)
+    TGL_HOOK(glCompressedTexSubImage1D)
+    TGL_HOOK(glGetCompressedTexImage)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_1_4)
+    TGL_HOOK(glBlendFuncSeparate)
+    TGL_HOOK(glMultiDrawArrays)
+    TGL_HOOK(glMultiDrawElements)
+    TGL_HOOK(glPointParameterf)
+    TGL_HOOK(glPointParameterfv)
+    TGL_HOOK(glPointParameteri)
+    TGL_HOOK(glPointParameteriv)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_1_5)
+    TGL_HOOK(glGenQueries)
+    TGL_HOOK(glDeleteQueries)
+    TGL_HOOK(glIsQuery)
+    TGL_HOOK(glBeginQuery)
+    TGL_HOOK(glEndQuery)
+    TGL_HOOK(glGetQueryiv)
+    TGL_HOOK(glGetQueryObjectiv)
+    TGL_HOOK(glGetQueryObjectuiv)
+    TGL_HOOK(glBindBuffer)
+    TGL_HOOK(glDeleteBuffers)
+    TGL_HOOK(glGenBuffers)
+    TGL_HOOK(glIsBuffer)
+    TGL_HOOK(glBufferData)
+    TGL_HOOK(glBufferSubData)
+    TGL_HOOK(glGetBufferSubData)
+    TGL_HOOK(glMapBuffer)
+    TGL_HOOK(glUnmapBuffer)
+    TGL_HOOK(glGetBufferParameteriv)
+    TGL_HOOK(glGetBufferPointerv)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_2_0)
+    TGL_HOOK(glBlendEquationSeparate)
+    TGL_HOOK(glDrawBuffers)
+    TGL_HOOK(glStencilOpSeparate)
+    TGL_HOOK(glStencilFuncSeparate)
+    TGL_HOOK(glStencilMaskSeparate)
+    TGL_HOOK(glAttachShader)
+    TGL_HOOK(glBindAttribLocation)
+    TGL_HOOK(glCompileShader)
+    TGL_HOOK(glCreateProgram)
+    TGL_HOOK(glCreateShader)
+    TGL_HOOK(glDeleteProgram)
+    TGL_HOOK(glDeleteShader)
+    TGL_HOOK(glDetachShader)
+    TGL_HOOK(glDisableVertexAttribArray)
+    TGL_HOOK(glEnableVertexAttribArray)
+    TGL_HOOK(glGetActiveAttrib)
+    TGL_HOOK(glGetActiveUniform)
+    TGL_HOOK(glGetAttachedShaders)
+    TGL_HOOK(glGetAttribLocation)
+    TGL_HOOK(glGetProgramiv)
+    TGL_HOOK(glGetProgramInfoLog)
+    TGL_HOOK(glGetShaderiv)
+    TGL_HOOK(glGetShaderInfoLog)
+    TGL_HOOK(glGetShaderSource)
+    TGL_HOOK(glGetUniformLocation)
+    TGL_HOOK(glGetUniformfv)
+    TGL_HOOK(glGetUniformiv)
+    TGL_HOOK(glGetVertexAttribdv)
+    TGL_HOOK(glGetVertexAttribfv)
+    TGL_HOOK(glGetVertexAttribiv)
+    TGL_HOOK(glGetVertexAttribPointerv)
+    TGL_HOOK(glIsProgram)
+    TGL_HOOK(glIsShader)
+    TGL_HOOK(glLinkProgram)
+    TGL_HOOK(glShaderSource)
+    TGL_HOOK(glUseProgram)
+    TGL_HOOK(glUniform1f)
+    TGL_HOOK(glUniform2f)
+    TGL_HOOK(glUniform3f)
+    TGL_HOOK(glUniform4f)
+    TGL_HOOK(glUniform1i)
+    TGL_HOOK(glUniform2i)
+    TGL_HOOK(glUniform3i)
+    TGL_HOOK(glUniform4i)
+    TGL_HOOK(glUniform1fv)
+    TGL_HOOK(glUniform2fv)
+    TGL_HOOK(glUniform3fv)
+    TGL_HOOK(glUniform4fv)
+    TGL_HOOK(glUniform1iv)
+    TGL_HOOK(glUniform2iv)
+    TGL_HOOK(glUniform3iv)
+    TGL_HOOK(glUniform4iv)
+    TGL_HOOK(glUniformMatrix2fv)
+    TGL_HOOK(glUniformMatrix3fv)
+    TGL_HOOK(glUniformMatrix4fv)
+    TGL_HOOK(glValidateProgram)
+    TGL_HOOK(glVertexAttrib1d)
+    TGL_HOOK(glVertexAttrib1dv)
+    TGL_HOOK(glVertexAttrib1f)
+    TGL_HOOK(glVertexAttrib1fv)
+    TGL_HOOK(glVertexAttrib1s)
+    TGL_HOOK(glVertexAttrib1sv)
+    TGL_HOOK(glVertexAttrib2d)
+    TGL_HOOK(glVertexAttrib2dv)
+    TGL_HOOK(glVertexAttrib2f)
+    TGL_HOOK(glVertexAttrib2fv)
+    TGL_HOOK(glVertexAttrib2s)
+    TGL_HOOK(glVertexAttrib2sv)
+    TGL_HOOK(glVertexAttrib3d)
+    TGL_HOOK(glVertexAttrib3dv)
+    TGL_HOOK(glVertexAttrib3f)
+    TGL_HOOK(glVertexAttrib3fv)
+    TGL_HOOK(glVertexAttrib3s)
+    TGL_HOOK(glVertexAttrib3sv)
+    TGL_HOOK(glVertexAttrib4Nbv)
+    TGL_HOOK(glVertexAttrib4Niv)
+    TGL_HOOK(glVertexAttrib4Nsv)
+    TGL_HOOK(glVertexAttrib4Nub)
+    TGL_HOOK(glVertexAttrib4Nubv)
+    TGL_HOOK(glVertexAttrib4Nuiv)
+    TGL_HOOK(glVertexAttrib4Nusv)
+    TGL_HOOK(glVertexAttrib4bv)
+    TGL_HOOK(glVertexAttrib4d)
+    TGL_HOOK(glVertexAttrib4dv)
+    TGL_HOOK(glVertexAttrib4f)
+    TGL_HOOK(glVertexAttrib4fv)
+    TGL_HOOK(glVertexAttrib4iv)
+    TGL_HOOK(glVertexAttrib4s)
+    TGL_HOOK(glVertexAttrib4sv)
+    TGL_HOOK(glVertexAttrib4ubv)
+    TGL_HOOK(glVertexAttrib4uiv)
+    TGL_HOOK(glVertexAttrib4usv)
+    TGL_HOOK(glVertexAttribPointer)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_2_1)
+    TGL_HOOK(glUniformMatrix2x3fv)
+    TGL_HOOK(glUniformMatrix3x2fv)
+    TGL_HOOK(glUniformMatrix2x4fv)
+    TGL_HOOK(glUniformMatrix4x2fv)
+    TGL_HOOK(glUniformMatrix3x4fv)
+    TGL_HOOK(glUniformMatrix4x3fv)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_3_0)
+    TGL_HOOK(glColorMaski)
+    TGL_HOOK(glGetBooleani_v)
+    TGL_HOOK(glGetIntegeri_v)
+    TGL_HOOK(glEnablei)
+    TGL_HOOK(glDisablei)
+    TGL_HOOK(glIsEnabledi)
+    TGL_HOOK(glBeginTransformFeedback)
+    TGL_HOOK(glEndTransformFeedback)
+    TGL_HOOK(glBindBufferRange)
+    TGL_HOOK(glBindBufferBase)
+    TGL_HOOK(glTransformFeedbackVaryings)
+    TGL_HOOK(glGetTransformFeedbackVarying)
+    TGL_HOOK(glClampColor)
+    TGL_HOOK(glBeginConditionalRender)
+    TGL_HOOK(glEndConditionalRender)
+    TGL_HOOK(glVertexAttribIPointer)
+    TGL_HOOK(glGetVertexAttribIiv)
+    TGL_HOOK(glGetVertexAttribIuiv)
+    TGL_HOOK(glVertexAttribI1i)
+    TGL_HOOK(glVertexAttribI2i)
+    TGL_HOOK(glVertexAttribI3i)
+    TGL_HOOK(glVertexAttribI4i)
+    TGL_HOOK(glVertexAttribI1ui)
+    TGL_HOOK(glVertexAttribI2ui)
+    TGL_HOOK(glVertexAttribI3ui)
+    TGL_HOOK(glVertexAttribI4ui)
+    TGL_HOOK(glVertexAttribI1iv)
+    TGL_HOOK(glVertexAttribI2iv)
+    TGL_HOOK(glVertexAttribI3iv)
+    TGL_HOOK(glVertexAttribI4iv)
+    TGL_HOOK(glVertexAttribI1uiv)
+    TGL_HOOK(glVertexAttribI2uiv)
+    TGL_HOOK(glVertexAttribI3uiv)
+    TGL_HOOK(glVertexAttribI4uiv)
+    TGL_HOOK(glVertexAttribI4bv)
+    TGL_HOOK(glVertexAttribI4sv)
+    TGL_HOOK(glVertexAttribI4ubv)
+    TGL_HOOK(glVertexAttribI4usv)
+    TGL_HOOK(glGetUniformuiv)
+    TGL_HOOK(glBindFragDataLocation)
+    TGL_HOOK(glGetFragDataLocation)
+    TGL_HOOK(glUniform1ui)
+    TGL_HOOK(glUniform2ui)
+    TGL_HOOK(glUniform3ui)
+    TGL_HOOK(glUniform4ui)
+    TGL_HOOK(glUniform1uiv)
+    TGL_HOOK(glUniform2uiv)
+    TGL_HOOK(glUniform3uiv)
+    TGL_HOOK(glUniform4uiv)
+    TGL_HOOK(glTexParameterIiv)
+    TGL_HOOK(glTexParameterIuiv)
+    TGL_HOOK(glGetTexParameterIiv)
+    TGL_HOOK(glGetTexParameterIuiv)
+    TGL_HOOK(glClearBufferiv)
+    TGL_HOOK(glClearBufferuiv)
+    TGL_HOOK(glClearBufferfv)
+    TGL_HOOK(glClearBufferfi)
+    TGL_HOOK(glGetStringi)
+    TGL_HOOK(glIsRenderbuffer)
+    TGL_HOOK(glBindRenderbuffer)
+    TGL_HOOK(glDeleteRenderbuffers)
+    TGL_HOOK(glGenRenderbuffers)
+    TGL_HOOK(glRenderbufferStorage)
+    TGL_HOOK(glGetRenderbufferParameteriv)
+    TGL_HOOK(glIsFramebuffer)
+    TGL_HOOK(glBindFramebuffer)
+    TGL_HOOK(glDeleteFramebuffers)
+    TGL_HOOK(glGenFramebuffers)
+    TGL_HOOK(glCheckFramebufferStatus)
+    TGL_HOOK(glFramebufferTexture1D)
+    TGL_HOOK(glFramebufferTexture2D)
+    TGL_HOOK(glFramebufferTexture3D)
+    TGL_HOOK(glFramebufferRenderbuffer)
+    TGL_HOOK(glGetFramebufferAttachmentParameteriv)
+    TGL_HOOK(glGenerateMipmap)
+    TGL_HOOK(glBlitFramebuffer)
+    TGL_HOOK(glRenderbufferStorageMultisample)
+    TGL_HOOK(glFramebufferTextureLayer)
+    TGL_HOOK(glMapBufferRange)
+    TGL_HOOK(glFlushMappedBufferRange)
+    TGL_HOOK(glBindVertexArray)
+    TGL_HOOK(glDeleteVertexArrays)
+    TGL_HOOK(glGenVertexArrays)
+    TGL_HOOK(glIsVertexArray)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_3_1)
+    TGL_HOOK(glDrawArraysInstanced)
+    TGL_HOOK(glDrawElementsInstanced)
+    TGL_HOOK(glTexBuffer)
+    TGL_HOOK(glPrimitiveRestartIndex)
+    TGL_HOOK(glCopyBufferSubData)
+    TGL_HOOK(glGetUniformIndices)
+    TGL_HOOK(glGetActiveUniformsiv)
+    TGL_HOOK(glGetActiveUniformName)
+    TGL_HOOK(glGetUniformBlockIndex)
+    TGL_HOOK(glGetActiveUniformBlockiv)
+    TGL_HOOK(glGetActiveUniformBlockName)
+    TGL_HOOK(glUniformBlockBinding)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_3_2)
+    TGL_HOOK(glGetInteger64i_v)
+    TGL_HOOK(glGetBufferParameteri64v)
+    TGL_HOOK(glFramebufferTexture)
+    TGL_HOOK(glDrawElementsBaseVertex)
+    TGL_HOOK(glDrawRangeElementsBaseVertex)
+    TGL_HOOK(glDrawElementsInstancedBaseVertex)
+    TGL_HOOK(glMultiDrawElementsBaseVertex)
+    TGL_HOOK(glProvokingVertex)
+    TGL_HOOK(glFenceSync)
+    TGL_HOOK(glIsSync)
+    TGL_HOOK(glDeleteSync)
+    TGL_HOOK(glClientWaitSync)
+    TGL_HOOK(glWaitSync)
+    TGL_HOOK(glGetInteger64v)
+    TGL_HOOK(glGetSynciv)
+    TGL_HOOK(glTexImage2DMultisample)
+    TGL_HOOK(glTexImage3DMultisample)
+    TGL_HOOK(glGetMultisamplefv)
+    TGL_HOOK(glSampleMaski)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_3_3)
+    TGL_HOOK(glVertexAttribDivisor)
+    TGL_HOOK(glBindFragDataLocationIndexed)
+    TGL_HOOK(glGetFragDataIndex)
+    TGL_HOOK(glGenSamplers)
+    TGL_HOOK(glDeleteSamplers)
+    TGL_HOOK(glIsSampler)
+    TGL_HOOK(glBindSampler)
+    TGL_HOOK(glSamplerParameteri)
+    TGL_HOOK(glSamplerParameteriv)
+    TGL_HOOK(glSamplerParameterf)
+    TGL_HOOK(glSamplerParameterfv)
+    TGL_HOOK(glSamplerParameterIiv)
+    TGL_HOOK(glSamplerParameterIuiv)
+    TGL_HOOK(glGetSamplerParameteriv)
+    TGL_HOOK(glGetSamplerParameterIiv)
+    TGL_HOOK(glGetSamplerParameterfv)
+    TGL_HOOK(glGetSamplerParameterIuiv)
+    TGL_HOOK(glQueryCounter)
+    TGL_HOOK(glGetQueryObjecti64v)
+    TGL_HOOK(glGetQueryObjectui64v)
+    TGL_HOOK(glVertexAttribP1ui)
+    TGL_HOOK(glVertexAttribP1uiv)
+    TGL_HOOK(glVertexAttribP2ui)
+    TGL_HOOK(glVertexAttribP2uiv)
+    TGL_HOOK(glVertexAttribP3ui)
+    TGL_HOOK(glVertexAttribP3uiv)
+    TGL_HOOK(glVertexAttribP4ui)
+    TGL_HOOK(glVertexAttribP4uiv)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_4_0)
+    TGL_HOOK(glMinSampleShading)
+    TGL_HOOK(glBlendEquationi)
+    TGL_HOOK(glBlendEquationSeparatei)
+    TGL_HOOK(glBlendFunci)
+    TGL_HOOK(glBlendFuncSeparatei)
+    TGL_HOOK(glDrawArraysIndirect)
+    TGL_HOOK(glDrawElementsIndirect)
+    TGL_HOOK(glUniform1d)
+    TGL_HOOK(glUniform2d)
+    TGL_HOOK(glUniform3d)
+    TGL_HOOK(glUniform4d)
+    TGL_HOOK(glUniform1dv)
+    TGL_HOOK(glUniform2dv)
+    TGL_HOOK(glUniform3dv)
+    TGL_HOOK(glUniform4dv)
+    TGL_HOOK(glUniformMatrix2dv)
+    TGL_HOOK(glUniformMatrix3dv)
+    TGL_HOOK(glUniformMatrix4dv)
+    TGL_HOOK(glUniformMatrix2x3dv)
+    TGL_HOOK(glUniformMatrix2x4dv)
+    TGL_HOOK(glUniformMatrix3x2dv)
+    TGL_HOOK(glUniformMatrix3x4dv)
+    TGL_HOOK(glUniformMatrix4x2dv)
+    TGL_HOOK(glUniformMatrix4x3dv)
+    TGL_HOOK(glGetUniformdv)
+    TGL_HOOK(glGetSubroutineUniformLocation)
+    TGL_HOOK(glGetSubroutineIndex)
+    TGL_HOOK(glGetActiveSubroutineUniformiv)
+    TGL_HOOK(glGetActiveSubroutineUniformName)
+    TGL_HOOK(glGetActiveSubroutineName)
+    TGL_HOOK(glUniformSubroutinesuiv)
+    TGL_HOOK(glGetUniformSubroutineuiv)
+    TGL_HOOK(glGetProgramStageiv)
+    TGL_HOOK(glPatchParameteri)
+    TGL_HOOK(glPatchParameterfv)
+    TGL_HOOK(glBindTransformFeedback)
+    TGL_HOOK(glDeleteTransformFeedbacks)
+    TGL_HOOK(glGenTransformFeedbacks)
+    TGL_HOOK(glIsTransformFeedback)
+    TGL_HOOK(glPauseTransformFeedback)
+    TGL_HOOK(glResumeTransformFeedback)
+    TGL_HOOK(glDrawTransformFeedback)
+    TGL_HOOK(glDrawTransformFeedbackStream)
+    TGL_HOOK(glBeginQueryIndexed)
+    TGL_HOOK(glEndQueryIndexed)
+    TGL_HOOK(glGetQueryIndexediv)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_4_1)
+    TGL_HOOK(glReleaseShaderCompiler)
+    TGL_HOOK(glShaderBinary)
+    TGL_HOOK(glGetShaderPrecisionFormat)
+    TGL_HOOK(glDepthRangef)
+    TGL_HOOK(glClearDepthf)
+    TGL_HOOK(glGetProgramBinary)
+    TGL_HOOK(glProgramBinary)
+    TGL_HOOK(glProgramParameteri)
+    TGL_HOOK(glUseProgramStages)
+    TGL_HOOK(glActiveShaderProgram)
+    TGL_HOOK(glCreateShaderProgramv)
+    TGL_HOOK(glBindProgramPipeline)
+    TGL_HOOK(glDeleteProgramPipelines)
+    TGL_HOOK(glGenProgramPipelines)
+    TGL_HOOK(glIsProgramPipeline)
+    TGL_HOOK(glGetProgramPipelineiv)
+    TGL_HOOK(glProgramUniform1i)
+    TGL_HOOK(glProgramUniform1iv)
+    TGL_HOOK(glProgramUniform1f)
+    TGL_HOOK(glProgramUniform1fv)
+    TGL_HOOK(glProgramUniform1d)
+    TGL_HOOK(glProgramUniform1dv)
+    TGL_HOOK(glProgramUniform1ui)
+    TGL_HOOK(glProgramUniform1uiv)
+    TGL_HOOK(glProgramUniform2i)
+    TGL_HOOK(glProgramUniform2iv)
+    TGL_HOOK(glProgramUniform2f)
+    TGL_HOOK(glProgramUniform2fv)
+    TGL_HOOK(glProgramUniform2d)
+    TGL_HOOK(glProgramUniform2dv)
+    TGL_HOOK(glProgramUniform2ui)
+    TGL_HOOK(glProgramUniform2uiv)
+    TGL_HOOK(glProgramUniform3i)
+    TGL_HOOK(glProgramUniform3iv)
+    TGL_HOOK(glProgramUniform3f)
+    TGL_HOOK(glProgramUniform3fv)
+    TGL_HOOK(glProgramUniform3d)
+    TGL_HOOK(glProgramUniform3dv)
+    TGL_HOOK(glProgramUniform3ui)
+    TGL_HOOK(glProgramUniform3uiv)
+    TGL_HOOK(glProgramUniform4i)
+    TGL_HOOK(glProgramUniform4iv)
+    TGL_HOOK(glProgramUniform4f)
+    TGL_HOOK(glProgramUniform4fv)
+    TGL_HOOK(glProgramUniform4d)
+    TGL_HOOK(glProgramUniform4dv)
+    TGL_HOOK(glProgramUniform4ui)
+    TGL_HOOK(glProgramUniform4uiv)
+    TGL_HOOK(glProgramUniformMatrix2fv)
+    TGL_HOOK(glProgramUniformMatrix3fv)
+    TGL_HOOK(glProgramUniformMatrix4fv)
+    TGL_HOOK(glProgramUniformMatrix2dv)
+    TGL_HOOK(glProgramUniformMatrix3dv)
+    TGL_HOOK(glProgramUniformMatrix4dv)
+    TGL_HOOK(glProgramUniformMatrix2x3fv)
+    TGL_HOOK(glProgramUniformMatrix3x2fv)
+    TGL_HOOK(glProgramUniformMatrix2x4fv)
+    TGL_HOOK(glProgramUniformMatrix4x2fv)
+    TGL_HOOK(glProgramUniformMatrix3x4fv)
+    TGL_HOOK(glProgramUniformMatrix4x3fv)
+    TGL_HOOK(glProgramUniformMatrix2x3dv)
+    TGL_HOOK(glProgramUniformMatrix3x2dv)
+    TGL_HOOK(glProgramUniformMatrix2x4dv)
+    TGL_HOOK(glProgramUniformMatrix4x2dv)
+    TGL_HOOK(glProgramUniformMatrix3x4dv)
+    TGL_HOOK(glProgramUniformMatrix4x3dv)
+    TGL_HOOK(glValidateProgramPipeline)
+    TGL_HOOK(glGetProgramPipelineInfoLog)
+    TGL_HOOK(glVertexAttribL1d)
+    TGL_HOOK(glVertexAttribL2d)
+    TGL_HOOK(glVertexAttribL3d)
+    TGL_HOOK(glVertexAttribL4d)
+    TGL_HOOK(glVertexAttribL1dv)
+    TGL_HOOK(glVertexAttribL2dv)
+    TGL_HOOK(glVertexAttribL3dv)
+    TGL_HOOK(glVertexAttribL4dv)
+    TGL_HOOK(glVertexAttribLPointer)
+    TGL_HOOK(glGetVertexAttribLdv)
+    TGL_HOOK(glViewportArrayv)
+    TGL_HOOK(glViewportIndexedf)
+    TGL_HOOK(glViewportIndexedfv)
+    TGL_HOOK(glScissorArrayv)
+    TGL_HOOK(glScissorIndexed)
+    TGL_HOOK(glScissorIndexedv)
+    TGL_HOOK(glDepthRangeArrayv)
+    TGL_HOOK(glDepthRangeIndexed)
+    TGL_HOOK(glGetFloati_v)
+    TGL_HOOK(glGetDoublei_v)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_4_2)
+    TGL_HOOK(glDrawArraysInstancedBaseInstance)
+    TGL_HOOK(glDrawElementsInstancedBaseInstance)
+    TGL_HOOK(glDrawElementsInstancedBaseVertexBaseInstance)
+    TGL_HOOK(glGetInternalformativ)
+    TGL_HOOK(glGetActiveAtomicCounterBufferiv)
+    TGL_HOOK(glBindImageTexture)
+    TGL_HOOK(glMemoryBarrier)
+    TGL_HOOK(glTexStorage1D)
+    TGL_HOOK(glTexStorage2D)
+    TGL_HOOK(glTexStorage3D)
+    TGL_HOOK(glDrawTransformFeedbackInstanced)
+    TGL_HOOK(glDrawTransformFeedbackStreamInstanced)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_4_3)
+    TGL_HOOK(glClearBufferData)
+    TGL_HOOK(glClearBufferSubData)
+    TGL_HOOK(glDispatchCompute)
+    TGL_HOOK(glDispatchComputeIndirect)
+    TGL_HOOK(glCopyImageSubData)
+    TGL_HOOK(glFramebufferParameteri)
+    TGL_HOOK(glGetFramebufferParameteriv)
+    TGL_HOOK(glGetInternalformati64v)
+    TGL_HOOK(glInvalidateTexSubImage)
+    TGL_HOOK(glInvalidateTexImage)
+    TGL_HOOK(glInvalidateBufferSubData)
+    TGL_HOOK(glInvalidateBufferData)
+    TGL_HOOK(glInvalidateFramebuffer)
+    TGL_HOOK(glInvalidateSubFramebuffer)
+    TGL_HOOK(glMultiDrawArraysIndirect)
+    TGL_HOOK(glMultiDrawElementsIndirect)
+    TGL_HOOK(glGetProgramInterfaceiv)
+    TGL_HOOK(glGetProgramResourceIndex)
+    TGL_HOOK(glGetProgramResourceName)
+    TGL_HOOK(glGetProgramResourceiv)
+    TGL_HOOK(glGetProgramResourceLocation)
+    TGL_HOOK(glGetProgramResourceLocationIndex)
+    TGL_HOOK(glShaderStorageBlockBinding)
+    TGL_HOOK(glTexBufferRange)
+    TGL_HOOK(glTexStorage2DMultisample)
+    TGL_HOOK(glTexStorage3DMultisample)
+    TGL_HOOK(glTextureView)
+    TGL_HOOK(glBindVertexBuffer)
+    TGL_HOOK(glVertexAttribFormat)
+    TGL_HOOK(glVertexAttribIFormat)
+    TGL_HOOK(glVertexAttribLFormat)
+    TGL_HOOK(glVertexAttribBinding)
+    TGL_HOOK(glVertexBindingDivisor)
+    TGL_HOOK(glDebugMessageControl)
+    TGL_HOOK(glDebugMessageInsert)
+    TGL_HOOK(glDebugMessageCallback)
+    TGL_HOOK(glGetDebugMessageLog)
+    TGL_HOOK(glPushDebugGroup)
+    TGL_HOOK(glPopDebugGroup)
+    TGL_HOOK(glObjectLabel)
+    TGL_HOOK(glGetObjectLabel)
+    TGL_HOOK(glObjectPtrLabel)
+    TGL_HOOK(glGetObjectPtrLabel)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_4_4)
+    TGL_HOOK(glBufferStorage)
+    TGL_HOOK(glClearTexImage)
+    TGL_HOOK(glClearTexSubImage)
+    TGL_HOOK(glBindBuffersBase)
+    TGL_HOOK(glBindBuffersRange)
+    TGL_HOOK(glBindTextures)
+    TGL_HOOK(glBindSamplers)
+    TGL_HOOK(glBindImageTextures)
+    TGL_HOOK(glBindVertexBuffers)
+#endif
+#if defined(TGL_DEFINE_CORE_GL_4_5)
+    TGL_HOOK(glClipControl)
+    TGL_HOOK(glCreateTransformFeedbacks)
+    TGL_HOOK(glTransformFeedbackBufferBase)
+    TGL_HOOK(glTransformFeedbackBufferRange)
+    TGL_HOOK(glGetTransformFeedbackiv)
+    TGL_HOOK(glGetTransformFeedbacki_v)
+    TGL_HOOK(glGetTransformFeedbacki64_v)
+    TGL_HOOK(glCreateBuffers)
+    TGL_HOOK(glNamedBufferStorage)
+    TGL_HOOK(glNamedBufferData)
+    TGL_HOOK(glNamedBufferSubData)
+    TGL_HOOK(glCopyNamedBufferSubData)
+    TGL_HOOK(glClearNamedBufferData)
+    TGL_HOOK(glClearNamedBufferSubData)
+    TGL_HOOK(glMapNamedBuffer)
+    TGL_HOOK(glMapNamedBufferRange)
+    TGL_HOOK(glUnmapNamedBuffer)
+    TGL_HOOK(glFlushMappedNamedBufferRange)
+    TGL_HOOK(glGetNamedBufferParameteriv)
+    TGL_HOOK(glGetNamedBufferParameteri64v)
+    TGL_HOOK(glGetNamedBufferPointerv)
+    TGL_HOOK(glGetNamedBufferSubData)
+    TGL_HOOK(glCreateFramebuffers)
+    TGL_HOOK(glNamedFramebufferRenderbuffer)
+    TGL_HOOK(glNamedFramebufferParameteri)
+    TGL_HOOK(glNamedFramebufferTexture)
+    TGL_HOOK(glNamedFramebufferTextureLayer)
+    TGL_HOOK(glNamedFramebufferDrawBuffer)
+    TGL_HOOK(glNamedFramebufferDrawBuffers)
+    TGL_HOOK(glNamedFramebufferReadBuffer)
+    TGL_HOOK(glInvalidateNamedFramebufferData)
+    TGL_HOOK(glInvalidateNamedFramebufferSubData)
+    TGL_HOOK(glClearNamedFramebufferiv)
+    TGL_HOOK(glClearNamedFramebufferuiv)
+    TGL_HOOK(glClearNamedFramebufferfv)
+    TGL_HOOK(glClearNamedFramebufferfi)
+    TGL_HOOK(glBlitNamedFramebuffer)
+    TGL_HOOK(glCheckNamedFramebufferStatus)
+    TGL_HOOK(glGetNamedFramebufferParameteriv)
+    TGL_HOOK(glGetNamedFramebufferAttachmentParameteriv)
+    TGL_HOOK(glCreateRenderbuffers)
+    TGL_HOOK(glNamedRenderbufferStorage)
+    TGL_HOOK(glNamedRenderbufferStorageMultisample)
+    TGL_HOOK(glGetNamedRenderbufferParameteriv)
+    TGL_HOOK(glCreateTextures)
+    TGL_HOOK(glTextureBuffer)
+    TGL_HOOK(glTextureBufferRange)
+    TGL_HOOK(glTextureStorage1D)
+    TGL_HOOK(glTextureStorage2D)
+    TGL_HOOK(glTextureStorage3D)
+    TGL_HOOK(glTextureStorage2DMultisample)
+    TGL_HOOK(glTextureStorage3DMultisample)
+    TGL_HOOK(glTextureSubImage1D)
+    TGL_HOOK(glTextureSubImage2D)
+    TGL_HOOK(glTextureSubImage3D)
+    TGL_HOOK(glCompressedTextureSubImage1D)
+    TGL_HOOK(glCompressedTextureSubImage2D)
+    TGL_HOOK(glCompressedTextureSubImage3D)
+    TGL_HOOK(glCopyTextureSubImage1D)
+    TGL_HOOK(glCopyTextureSubImage2D)
+    TGL_HOOK(glTextureParameterf)
+    TGL_HOOK(glTextureParameterfv)
+    TGL_HOOK(glTextureParameteri)
+    TGL_HOOK(glTextureParameterIiv)
+    TGL_HOOK(glTextureParameterIuiv)
+    TGL_HOOK(glTextureParameteriv)
+    TGL_HOOK(glGenerateTextureMipmap)
+    TGL_HOOK(glBindTextureUnit)
+    TGL_HOOK(glGetTextureImage)
+    TGL_HOOK(glGetCompressedTextureImage)
+    TGL_HOOK(glGetTextureLevelParameterfv)
+    TGL_HOOK(glGetTextureLevelParameteriv)
+    TGL_HOOK(glGetTextureParameterfv)
+    TGL_HOOK(glGetTextureParameterIiv)
+    TGL_HOOK(glGetTextureParameterIuiv)
+    TGL_HOOK(glGetTextureParameteriv)
+    TGL_HOOK(glCreateVertexArrays)
+    TGL_HOOK(glDisableVertexArrayAttrib)
+    TGL_HOOK(glEnableVertexArrayAttrib)
+    TGL_HOOK(glVertexArrayElementBuffer)
+    TGL_HOOK(glVertexArrayVertexBuffer)
+    TGL_HOOK(glVertexArrayVertexBuffers)
+    TGL_HOOK(glVertexArrayAttribBinding)
+    TGL_HOOK(glVertexArrayAttribFormat)
+    TGL_HOOK(glVertexArrayAttribIFormat)
+    TGL_HOOK(glVertexArrayAttribLFormat)
+    TGL_HOOK(glVertexArrayBindingDivisor)
+    TGL_HOOK(glGetVertexArrayiv)
+    TGL_HOOK(glGetVertexArrayIndexediv)
+    TGL_HOOK(glGetVertexArrayIndexed64iv)
+    TGL_HOOK(glCreateSamplers)
+    TGL_HOOK(glCreateProgramPipelines)
+    TGL_HOOK(glCreateQueries)
+    TGL_HOOK(glGetQueryBufferObjecti64v)
+    TGL_HOOK(glGetQueryBufferObjectiv)
+    TGL_HOOK(glGetQueryBufferObjectui64v)
+    TGL_HOOK(glGetQueryBufferObjectuiv)
+    TGL_HOOK(glMemoryBarrierByRegion)
+    TGL_HOOK(glGetTextureSubImage)
+    TGL_HOOK(glGetCompressedTextureSubImage)
+    TGL_HOOK(glGetGraphicsResetStatus)
+    TGL_HOOK(glGetnCompressedTexImage)
+    TGL_HOOK(glGetnTexImage)
+    TGL_HOOK(glGetnUniformdv)
+    TGL_HOOK(glGetnUniformfv)
+    TGL_HOOK(glGetnUniformiv)
+    TGL_HOOK(glGetnUniformuiv)
+    TGL_HOOK(glReadnPixels)
+    TGL_HOOK(glTextureBarrier)
+#endif
+#if defined(TGL_DEFINE_ARB_DEBUG_OUTPUT)
+    TGL_HOOK(glDebugMessageControlARB)
+    TGL_HOOK(glDebugMessageInsertARB)
+    TGL_HOOK(glDebugMessageCallbackARB)
+    TGL_HOOK(glGetDebugMessageLogARB)
+#endif
+#if defined(TGL_DEFINE_AMD_DEBUG_OUTPUT)
+    TGL_HOOK(glDebugMessageEnableAMD)
+    TGL_HOOK(glDebugMessageInsertAMD)
+    TGL_HOOK(glDebugMessageCallbackAMD)
+    TGL_HOOK(glGetDebugMessageLogAMD)
+#endif
+#if defined(TGL_DEFINE_ARB_BINDLESS_TEXTURE)
+    TGL_HOOK(glGetTextureHandleARB)
+    TGL_HOOK(glMakeTextureHandleResidentARB)
+    TGL_HOOK(glMakeTextureHandleNonResidentARB)
+    TGL_HOOK(glIsTextureHandleResidentARB)
+#endif
+#if defined(TGL_DEFINE_KHR_PARALLEL_SHADER_COMPILE)
+    TGL_HOOK(glMaxShaderCompilerThreadsKHR)
+#endif
+}
+void _tglInstrumentInit(void) {
+    memset(tgl_calls, 0, sizeof(tgl_calls));
+    memset(tgl_time, 0, sizeof(tgl_time));
+    memset(tgl_last_calls, 0, sizeof(tgl_last_calls));
+    memset(tgl_last_time, 0, sizeof(tgl_last_time));
+    _tglInstrumentHook();
+}
+
+unsigned int tglInstrumentFunctionCount(void) {
+    return (unsigned int)TGL_FUNCTION_COUNT;
+}
+
+const char* tglInstrumentFunctionName(unsigned int function) {
+    return function < TGL_FUNCTION_COUNT ? tgl_function_names[function] : NULL;
+}
+
+unsigned int tglInstrumentCallCount(unsigned int function) {
+    return function < TGL_FUNCTION_COUNT ? tgl_last_calls[function] : 0;
+}
+
+double tglInstrumentCallTime(unsigned int function) {
+    return function < TGL_FUNCTION_COUNT ? tgl_last_time[function] / 1000000.0 : 0.0;
+}
+
+unsigned int tglInstrumentTotalCalls(void) {
+    unsigned int total = 0, i;
+    for (i=0; i<TGL_FUNCTION_COUNT; ++i) {
+        total += tgl_last_calls[i];
+    }
+    return total;
+}
+
+double tglInstrumentTotalTime(void) {
+    unsigned long long total = 0;
+    unsigned int i;
+    for (i=0; i<TGL_FUNCTION_COUNT; ++i) {
+        total += tgl_last_time[i];
+    }
+    return total / 1000000.0;
+}
+
+GLboolean tglInstrumentEndFrame(void) {
+    GLboolean written = GL_TRUE;
+    memcpy(tgl_last_calls, tgl_calls, sizeof(tgl_calls));
+    memcpy(tgl_last_time, tgl_time, sizeof(tgl_time));
+    memset(tgl_calls, 0, sizeof(tgl_calls));
+    memset(tgl_time, 0, sizeof(tgl_time));
+    if (tgl_trace_recording) {
+        written = _tglWriteTrace();
+        tgl_trace_recording = 0;
+        tgl_trace_count = 0;
+    }
+    if (tgl_trace_armed) {
+        tgl_trace_armed = 0;
+        tgl_trace_recording = 1;
+        tgl_trace_start = _tglNow();
+    }
+    return written;
+}
+
+GLboolean tglInstrumentTraceNextFrame(const char* file) {
+    if (file == NULL || strlen(file) >= sizeof(tgl_trace_file)) {
+        return GL_FALSE;
+    }
+    strcpy(tgl_trace_file, file);
+    tgl_trace_armed = 1;
+    return GL_TRUE;
+}
+
+#endif /* TGL_INSTRUMENT */
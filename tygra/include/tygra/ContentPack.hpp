@@ -0,0 +1,141 @@
+/**
+ * @file
+ * @date      October 2026
+ *
+ *
+ * @section LICENSE
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#pragma once
+#ifndef __TYGRA_CONTENTPACK__
+#define __TYGRA_CONTENTPACK__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace tygra {
+
+/**
+ * A read-only view of bytes owned by something else, such as a mapped pack.
+ * A view without data means the file wasn't found.
+ */
+struct ContentView
+{
+    const unsigned char * data{ nullptr };
+    size_t size{ 0 };
+};
+
+/**
+ * Many content files stored in a single file which is memory-mapped rather
+ * than read, so looking up a file returns a view into the mapping without
+ * copying. Opening every file costs a single open and the operating system
+ * can read the whole pack sequentially when it's prefetched.
+ *
+ * Packs are built offline by build(). All values are little-endian:
+ *   Header  magic "TPAK", version, entry count, slot count, index offset,
+ *           names offset and names size.
+ *   Index   a power of two number of slots, each containing the hash,
+ *           offset and size of a file and the location of its name. Files
+ *           are found by linear probing from their hash, empty slots have
+ *           an empty name.
+ *   Names   the path of every file relative to the content directory, used
+ *           to reject hash collisions.
+ *   Data    the contents of every file, each starting on a page boundary.
+ */
+class ContentPack
+{
+public:
+
+    static const size_t alignment = 4096;
+
+    ContentPack() = default;
+    ContentPack(const ContentPack&) = delete;
+    ContentPack& operator=(const ContentPack&) = delete;
+    ContentPack(ContentPack&& rhs);
+    ContentPack& operator=(ContentPack&& rhs);
+    ~ContentPack();
+
+    bool isOpen() const
+    {
+        return _base != nullptr;
+    }
+
+    /**
+     * Map a pack into memory, closing any pack which is already open.
+     * @return  True if the file is a valid pack.
+     */
+    bool open(const std::string & path);
+
+    void close();
+
+    /**
+     * Find a file in the pack.
+     * @param   path  The location relative to the content directory, using
+     *                forward slashes, e.g. "Shaders/Rendering/Geometry.vs.glsl".
+     * @return  A view of the contents, valid until the pack is closed.
+     */
+    ContentView find(const char * path, size_t length) const;
+
+    /**
+     * Ask the operating system to start reading the given bytes in the
+     * background so later accesses don't fault on a cold cache.
+     */
+    void prefetch(const ContentView & view) const;
+
+    /**
+     * Ask the operating system to start reading the entire pack.
+     */
+    void prefetchAll() const;
+
+    /**
+     * Write a new pack.
+     * @param   output     Where the pack will be written.
+     * @param   directory  The file system location of the content directory.
+     * @param   files      Every file to store, relative to the directory.
+     * @return  True if every file was read and the pack was written.
+     */
+    static bool build(const std::string & output, const std::string & directory,
+                      const std::vector<std::string> & files);
+
+private:
+
+    const unsigned char * _base{ nullptr };
+    size_t _size{ 0 };
+    const unsigned char * _slots{ nullptr };
+    const unsigned char * _names{ nullptr };
+    size_t _namesSize{ 0 };
+    uint32_t _slotCount{ 0 };
+#if defined(_WIN32)
+    void * _file{ nullptr };
+    void * _mapping{ nullptr };
+#endif
+
+    static uint64_t hash(const char * path, size_t length);
+
+};
+
+} // end namespace tygra
+
+#endif // __TYGRA_CONTENTPACK__
@@ -33,14 +33,49 @@
 #ifndef __TYGRA_FILEHELPER__
 #define __TYGRA_FILEHELPER__
 
+#include "ContentPack.hpp"
 #include "Image.hpp"
 
 #include <string>
+#include <vector>
 
 namespace tygra {
 
+/**
+ * Map a content pack so content uris are found in it before the file system.
+ * This must be done before any other threads read files.
+ * @param   The file system location of the pack.
+ * @param   Whether the whole pack should be read in the background.
+ * @return  True if the pack was mounted, files are read individually if not.
+ */
+bool mountContentPack(const std::string & path, bool prefetch = true);
+
+/**
+ * Unmap the mounted content pack, invalidating every view into it.
+ */
+void unmountContentPack();
+
+/**
+ * Find a file in the mounted content pack without copying it.
+ * @param   A local uri to the file, scheme must be content.
+ * @return  A view valid until the pack is unmounted, without data if the
+ *          file isn't in the pack.
+ */
+ContentView createViewFromFile(const std::string & uri);
+
+/**
+ * Read the entire contents of a file into memory.
+ * The mounted content pack is searched first.
+ * @param   A local uri to the file to read.
+ *          Scheme must be content or resource. Without tdl the scheme is
+ *          resolved relative to TYGRA_CONTENT_DIR, or the working directory.
+ * @return  The bytes of the file, empty if an error occurred.
+ */
+std::vector<unsigned char> createBufferFromFile(const std::string & uri);
+
 /**
  * Construct a new string object with the contents of a text file.
+ * The mounted content pack is searched first.
  * @param   A local uri to the text file to read.
  *          Scheme must be content or resource.
  * @return  A new string object, empty if an error occurred.
@@ -48,7 +83,10 @@ namespace tygra {
 std::string createStringFromFile(const std::string & uri);
 
 /**
- * Construct a new image object with the contents of a PNG file.
+ * Construct a new image object with the contents of a PNG file. The file is
+ * decoded by PngDecoder and the bottom row of the image is stored first,
+ * matching the layout tdlCreateImageFromParser() produced.
+ * Files in the mounted content pack are decoded straight from the mapping.
  * @param   A local uri to the PNG file to read.
  *          Scheme must be content or resource.
  * @return  A new image object, may have no contents is an error occurred.
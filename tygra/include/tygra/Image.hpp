@@ -33,85 +33,102 @@
 #ifndef __TYGRA_IMAGE__
 #define __TYGRA_IMAGE__
 
-#include <tdl/tdl.h>
+#include <cstddef>
+#include <memory>
 
 namespace tygra {
 
 /***
- * C++ wrapper class for a tdlImage object.
+ * An image whose pixels are tightly packed, row by row, in memory owned by
+ * the image.
  */
 class Image
 {
 public:
 
-    Image(tdlImage * image) : _image(image)
+    /**
+     * Allocate uninitialised memory for the pixels, nothing is allocated if
+     * any of the parameters are zero.
+     */
+    Image(size_t width, size_t height, size_t componentsPerPixel, size_t bytesPerComponent)
+        : _width(width), _height(height), _componentsPerPixel(componentsPerPixel),
+          _bytesPerComponent(bytesPerComponent)
     {
+        const size_t size = width * height * componentsPerPixel * bytesPerComponent;
+        if (size > 0) {
+            _data.reset(new unsigned char[size]);
+        }
     }
 
     Image() = delete;
     Image(const Image&) = delete;
 
     Image(Image&& rhs)
+        : _data(std::move(rhs._data)), _width(rhs._width), _height(rhs._height),
+          _componentsPerPixel(rhs._componentsPerPixel), _bytesPerComponent(rhs._bytesPerComponent)
     {
-        _image = rhs._image;
-        rhs._image = nullptr;
+        rhs._width = rhs._height = 0;
     }
 
-    ~Image()
-    {
-        if (_image != nullptr) {
-            tdlFreeImage(_image);
-        }
-    }
+    ~Image() = default;
 
     bool doesContainData() const
     {
-        return tdlGetImageData(_image) != nullptr;
+        return _data != nullptr;
     }
 
     size_t width() const
     {
-        return tdlGetImageWidth(_image);
+        return _width;
     }
 
     size_t height() const
     {
-        return tdlGetImageHeight(_image);
+        return _height;
     }
 
     size_t componentsPerPixel() const
     {
-        return tdlGetImageComponentsPerPixel(_image);
+        return _componentsPerPixel;
     }
 
     size_t bytesPerComponent() const
     {
-        return tdlGetImageBytesPerComponent(_image);
+        return _bytesPerComponent;
     }
 
     const void * pixelData() const
     {
-        return tdlGetImageData(_image);
+        return _data.get();
     }
 
     void * pixelData()
     {
-        return tdlGetImageData(_image);
+        return _data.get();
     }
 
     const void * pixel(size_t x, size_t y) const
     {
-        return tdlGetImagePixel(_image, x, y);
+        return _data ? _data.get() + offsetOf(x, y) : nullptr;
     }
 
     void * pixel(size_t x, size_t y)
     {
-        return tdlGetImagePixel(_image, x, y);
+        return _data ? _data.get() + offsetOf(x, y) : nullptr;
     }
 
 private:
 
-    tdlImage * _image{ nullptr };
+    size_t offsetOf(size_t x, size_t y) const
+    {
+        return (y * _width + x) * _componentsPerPixel * _bytesPerComponent;
+    }
+
+    std::unique_ptr<unsigned char[]> _data;
+    size_t _width{ 0 };
+    size_t _height{ 0 };
+    size_t _componentsPerPixel{ 0 };
+    size_t _bytesPerComponent{ 0 };
 
 };
 
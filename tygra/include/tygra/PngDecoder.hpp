@@ -0,0 +1,123 @@
+/**
+ * @file
+ * @date      October 2026
+ *
+ *
+ * @section LICENSE
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#pragma once
+#ifndef __TYGRA_PNGDECODER__
+#define __TYGRA_PNGDECODER__
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace tygra {
+
+/**
+ * Decodes PNG files held in memory without an intermediate image buffer.
+ * The zlib stream is inflated incrementally through a small sliding window
+ * and each scanline is unfiltered into a scratch row as soon as it's
+ * complete, then written to the caller's memory. The destination is never
+ * read, so it may be a write-combined mapped pixel buffer.
+ * Sub, Up, Average and Paeth unfiltering use SSE2 when it's available.
+ *
+ * Greyscale, greyscale with alpha, RGB and RGBA images are supported at 8 or
+ * 16 bits per component, 16 bit components are written in native byte
+ * order. 8 bit palettes are expanded to RGB, or RGBA when the file contains
+ * transparency. Interlaced images and bit depths below 8 aren't supported.
+ */
+class PngDecoder
+{
+public:
+
+    PngDecoder() = default;
+
+    /**
+     * Parse the chunks of a PNG file. The memory is not copied and must
+     * remain valid until decoding has finished.
+     * @param   data  The contents of the file.
+     * @param   size  The number of bytes in the file.
+     * @return  True if the file is a supported PNG.
+     */
+    bool open(const void * data, size_t size);
+
+    size_t width() const
+    {
+        return _width;
+    }
+
+    size_t height() const
+    {
+        return _height;
+    }
+
+    size_t componentsPerPixel() const
+    {
+        return _components;
+    }
+
+    size_t bytesPerComponent() const
+    {
+        return _bitDepth / 8;
+    }
+
+    /**
+     * The number of bytes in a tightly packed row of decoded pixels.
+     */
+    size_t rowSize() const
+    {
+        return _width * _components * bytesPerComponent();
+    }
+
+    /**
+     * Decode every row of the opened file.
+     * @param   destination     Memory for height() rows of decoded pixels.
+     * @param   pitch           The distance in bytes between the start of
+     *                          each row, at least rowSize().
+     * @param   bottomRowFirst  Whether the bottom row of the image is stored
+     *                          first, as OpenGL expects, rather than the top.
+     * @return  True if every row was decoded, the contents of the
+     *          destination are undefined otherwise.
+     */
+    bool decode(void * destination, size_t pitch, bool bottomRowFirst = false) const;
+
+private:
+
+    using Chunk = std::pair<const unsigned char *, size_t>;
+
+    std::vector<Chunk> _chunks;
+    std::array<unsigned char, 256 * 4> _palette{};
+    size_t _width{ 0 };
+    size_t _height{ 0 };
+    size_t _components{ 0 };
+    unsigned int _bitDepth{ 0 };
+    unsigned int _colourType{ 0 };
+
+};
+
+} // end namespace tygra
+
+#endif // __TYGRA_PNGDECODER__
@@ -0,0 +1,355 @@
+/**
+ * @file
+ * @date      October 2026
+ *
+ *
+ * @section LICENSE
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "tygra/ContentPack.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace tygra {
+
+namespace {
+
+const char magic[4] = { 'T', 'P', 'A', 'K' };
+const uint32_t version = 1;
+
+const size_t headerSize = 40;   // magic, version, entry count, slot count, index, names and names size
+const size_t slotSize = 32;     // hash, offset, size, name offset and name length
+
+template <typename T>
+T readValue(const unsigned char * bytes)
+{
+    T value;
+    std::memcpy(&value, bytes, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void writeValue(std::vector<unsigned char> & bytes, size_t offset, T value)
+{
+    std::memcpy(bytes.data() + offset, &value, sizeof(T));
+}
+
+size_t alignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+} // end anonymous namespace
+
+ContentPack::ContentPack(ContentPack&& rhs)
+{
+    *this = std::move(rhs);
+}
+
+ContentPack& ContentPack::operator=(ContentPack&& rhs)
+{
+    if (this != &rhs) {
+        close();
+        _base = rhs._base;
+        _size = rhs._size;
+        _slots = rhs._slots;
+        _names = rhs._names;
+        _namesSize = rhs._namesSize;
+        _slotCount = rhs._slotCount;
+#if defined(_WIN32)
+        _file = rhs._file;
+        _mapping = rhs._mapping;
+        rhs._file = rhs._mapping = nullptr;
+#endif
+        rhs._base = rhs._slots = rhs._names = nullptr;
+        rhs._size = rhs._namesSize = 0;
+        rhs._slotCount = 0;
+    }
+    return *this;
+}
+
+ContentPack::~ContentPack()
+{
+    close();
+}
+
+bool ContentPack::open(const std::string & path)
+{
+    close();
+
+#if defined(_WIN32)
+    _file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                        FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    LARGE_INTEGER size;
+    if (_file == INVALID_HANDLE_VALUE || !GetFileSizeEx(_file, &size) || size.QuadPart == 0) {
+        if (_file == INVALID_HANDLE_VALUE) {
+            _file = nullptr;
+        }
+        close();
+        return false;
+    }
+    _mapping = CreateFileMappingA(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void * base = _mapping ? MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    _size = size_t(size.QuadPart);
+#else
+    const int file = ::open(path.c_str(), O_RDONLY);
+    struct stat status;
+    if (file < 0 || fstat(file, &status) != 0 || status.st_size == 0) {
+        if (file >= 0) {
+            ::close(file);
+        }
+        return false;
+    }
+    // The mapping keeps the file alive so the descriptor isn't needed afterwards.
+    void * base = mmap(nullptr, size_t(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+    ::close(file);
+    if (base == MAP_FAILED) {
+        base = nullptr;
+    }
+    _size = size_t(status.st_size);
+#endif
+
+    _base = static_cast<const unsigned char *>(base);
+    if (_base == nullptr || _size < headerSize || std::memcmp(_base, magic, 4) != 0
+        || readValue<uint32_t>(_base + 4) != version) {
+        close();
+        return false;
+    }
+
+    _slotCount = readValue<uint32_t>(_base + 12);
+    const auto indexOffset = readValue<uint64_t>(_base + 16);
+    const auto namesOffset = readValue<uint64_t>(_base + 24);
+    _namesSize = size_t(readValue<uint64_t>(_base + 32));
+
+    const auto powerOfTwo = _slotCount != 0 && (_slotCount & (_slotCount - 1)) == 0;
+    if (!powerOfTwo || indexOffset > _size || uint64_t(_slotCount) * slotSize > _size - indexOffset
+        || namesOffset > _size || _namesSize > _size - namesOffset) {
+        close();
+        return false;
+    }
+
+    _slots = _base + indexOffset;
+    _names = _base + namesOffset;
+    return true;
+}
+
+void ContentPack::close()
+{
+#if defined(_WIN32)
+    if (_base != nullptr) {
+        UnmapViewOfFile(_base);
+    }
+    if (_mapping != nullptr) {
+        CloseHandle(_mapping);
+    }
+    if (_file != nullptr) {
+        CloseHandle(_file);
+    }
+    _file = _mapping = nullptr;
+#else
+    if (_base != nullptr) {
+        munmap(const_cast<unsigned char *>(_base), _size);
+    }
+#endif
+    _base = _slots = _names = nullptr;
+    _size = _namesSize = 0;
+    _slotCount = 0;
+}
+
+uint64_t ContentPack::hash(const char * path, size_t length)
+{
+    // FNV-1a, paths are short and this is only done once per file.
+    uint64_t value = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; ++i) {
+        value ^= uint64_t(static_cast<unsigned char>(path[i]));
+        value *= 1099511628211ULL;
+    }
+    return value;
+}
+
+ContentView ContentPack::find(const char * path, size_t length) const
+{
+    if (!isOpen() || length == 0) {
+        return ContentView{};
+    }
+
+    const auto value = hash(path, length);
+    const auto mask = _slotCount - 1;
+    for (uint32_t probe = 0; probe < _slotCount; ++probe) {
+        const auto slot = _slots + size_t((value + probe) & mask) * slotSize;
+        const auto nameOffset = readValue<uint32_t>(slot + 24);
+        const auto nameLength = readValue<uint32_t>(slot + 28);
+        if (nameLength == 0) {
+            break;
+        }
+        if (readValue<uint64_t>(slot) != value || nameLength != length
+            || nameOffset > _namesSize || nameLength > _namesSize - nameOffset
+            || std::memcmp(_names + nameOffset, path, length) != 0) {
+            continue;
+        }
+
+        const auto offset = readValue<uint64_t>(slot + 8);
+        const auto size = readValue<uint64_t>(slot + 16);
+        if (offset > _size || size > _size - offset) {
+            break;
+        }
+        return ContentView{ _base + offset, size_t(size) };
+    }
+    return ContentView{};
+}
+
+void ContentPack::prefetch(const ContentView & view) const
+{
+    if (!isOpen() || view.data < _base || view.size == 0) {
+        return;
+    }
+
+#if defined(_WIN32)
+#if _WIN32_WINNT >= 0x0602
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = const_cast<unsigned char *>(view.data);
+    range.NumberOfBytes = view.size;
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#endif
+#else
+    // madvise() requires the address to be aligned to the system page size.
+    const auto page = size_t(sysconf(_SC_PAGESIZE));
+    const auto start = size_t(view.data - _base) / page * page;
+    const auto end = size_t(view.data - _base) + view.size;
+    madvise(const_cast<unsigned char *>(_base + start), end - start, MADV_WILLNEED);
+#endif
+}
+
+void ContentPack::prefetchAll() const
+{
+    prefetch(ContentView{ _base, _size });
+}
+
+bool ContentPack::build(const std::string & output, const std::string & directory,
+                        const std::vector<std::string> & files)
+{
+    // Keep the index at most half full so probes stay short.
+    uint32_t slotCount = 1;
+    while (slotCount < files.size() * 2) {
+        slotCount <<= 1;
+    }
+
+    std::vector<unsigned char> names;
+    for (const auto & file : files) {
+        names.insert(names.end(), file.begin(), file.end());
+    }
+
+    const size_t indexOffset = headerSize;
+    const size_t namesOffset = indexOffset + size_t(slotCount) * slotSize;
+    std::vector<unsigned char> head(alignUp(namesOffset + names.size(), alignment), 0);
+    std::memcpy(head.data(), magic, 4);
+    writeValue<uint32_t>(head, 4, version);
+    writeValue<uint32_t>(head, 8, uint32_t(files.size()));
+    writeValue<uint32_t>(head, 12, slotCount);
+    writeValue<uint64_t>(head, 16, indexOffset);
+    writeValue<uint64_t>(head, 24, namesOffset);
+    writeValue<uint64_t>(head, 32, names.size());
+    std::memcpy(head.data() + namesOffset, names.data(), names.size());
+
+    std::FILE * pack = std::fopen(output.c_str(), "wb");
+    if (pack == nullptr) {
+        return false;
+    }
+
+    // The index is written last as the size of each file isn't known until it's read.
+    bool success = std::fwrite(head.data(), 1, head.size(), pack) == head.size();
+    size_t offset = head.size();
+    size_t nameOffset = 0;
+    std::vector<unsigned char> contents;
+
+    for (const auto & file : files) {
+        std::FILE * input = success ? std::fopen((directory + "/" + file).c_str(), "rb") : nullptr;
+        if (input == nullptr || file.empty()) {
+            success = false;
+            break;
+        }
+
+        contents.clear();
+        unsigned char chunk[65536];
+        size_t count = 0;
+        while ((count = std::fread(chunk, 1, sizeof(chunk), input)) > 0) {
+            contents.insert(contents.end(), chunk, chunk + count);
+        }
+        std::fclose(input);
+
+        // Duplicates would never be found so they're treated as an error.
+        const auto value = hash(file.c_str(), file.size());
+        auto slot = size_t(value & (slotCount - 1));
+        while (readValue<uint32_t>(head.data() + indexOffset + slot * slotSize + 28) != 0) {
+            const auto existing = head.data() + indexOffset + slot * slotSize;
+            const auto existingName = head.data() + namesOffset + readValue<uint32_t>(existing + 24);
+            if (readValue<uint32_t>(existing + 28) == file.size()
+                && std::memcmp(existingName, file.data(), file.size()) == 0) {
+                success = false;
+            }
+            slot = (slot + 1) & (slotCount - 1);
+        }
+
+        const size_t slotOffset = indexOffset + slot * slotSize;
+        writeValue<uint64_t>(head, slotOffset, value);
+        writeValue<uint64_t>(head, slotOffset + 8, offset);
+        writeValue<uint64_t>(head, slotOffset + 16, contents.size());
+        writeValue<uint32_t>(head, slotOffset + 24, uint32_t(nameOffset));
+        writeValue<uint32_t>(head, slotOffset + 28, uint32_t(file.size()));
+        nameOffset += file.size();
+
+        // Entries start on a page so each can be mapped and prefetched independently.
+        contents.resize(alignUp(contents.size(), alignment), 0);
+        success = success && std::fwrite(contents.data(), 1, contents.size(), pack) == contents.size();
+        offset += contents.size();
+    }
+
+    if (success) {
+        success = std::fseek(pack, 0, SEEK_SET) == 0
+               && std::fwrite(head.data(), 1, namesOffset, pack) == namesOffset;
+    }
+    success = std::fclose(pack) == 0 && success;
+    if (!success) {
+        std::remove(output.c_str());
+    }
+    return success;
+}
+
+} // end namespace tygra
@@ -30,11 +30,64 @@
  */
 
 #include "tygra/FileHelper.hpp"
+#include "tygra/PngDecoder.hpp"
+
+#if defined(_WIN32)
+#include <tdl/tdl.h>
+#else
+#include <cstdio>
+#include <cstdlib>
+#endif
 
 namespace tygra {
 
+namespace {
+
+ContentPack & mountedPack()
+{
+    static ContentPack pack;
+    return pack;
+}
+
+} // end anonymous namespace
+
+bool mountContentPack(const std::string & path, bool prefetch)
+{
+    ContentPack pack;
+    if (!pack.open(path)) {
+        return false;
+    }
+    if (prefetch) {
+        pack.prefetchAll();
+    }
+    mountedPack() = std::move(pack);
+    return true;
+}
+
+void unmountContentPack()
+{
+    mountedPack().close();
+}
+
+ContentView createViewFromFile(const std::string & uri)
+{
+    static const char scheme[] = "content:///";
+    const size_t schemeLength = sizeof(scheme) - 1;
+    if (uri.compare(0, schemeLength, scheme) != 0) {
+        return ContentView{};
+    }
+    return mountedPack().find(uri.c_str() + schemeLength, uri.size() - schemeLength);
+}
+
+#if defined(_WIN32)
+
 std::string createStringFromFile(const std::string & uri)
 {
+    const ContentView view = createViewFromFile(uri);
+    if (view.data != nullptr) {
+        return std::string(reinterpret_cast<const char *>(view.data), view.size);
+    }
+
     tdlStream * stream = tdlCreateStreamFromUri(uri.c_str(), nullptr);
     tdlStringParser * parser = tdlCreateAsciiParser(stream, nullptr);
     tdlString * string = tdlCreateStringFromParser(parser, nullptr);
@@ -44,13 +97,89 @@ std::string createStringFromFile(const std::string & uri)
     return std::move(result);
 }
 
-Image createImageFromPngFile(const std::string & uri)
+std::vector<unsigned char> createBufferFromFile(const std::string & uri)
 {
+    const ContentView view = createViewFromFile(uri);
+    if (view.data != nullptr) {
+        return std::vector<unsigned char>(view.data, view.data + view.size);
+    }
+
+    std::vector<unsigned char> buffer;
     tdlStream * stream = tdlCreateStreamFromUri(uri.c_str(), nullptr);
-    tdlImageParser * parser = tdlCreatePngParser(stream, nullptr);
-    tdlImage * image = tdlCreateImageFromParser(parser, nullptr);
-    tdlFreeImageParser(parser);
-    return Image(image);
+    if (tdlIsStreamOpen(stream)) {
+        const int knownSize = tdlGetStreamKnownSize(stream);
+        const size_t chunkSize = knownSize > 0 ? size_t(knownSize) : 65536;
+        size_t count = 0;
+        do {
+            const size_t offset = buffer.size();
+            buffer.resize(offset + chunkSize);
+            count = chunkSize;
+            tdlReadStream(stream, nullptr, &count, reinterpret_cast<char *>(buffer.data() + offset));
+            buffer.resize(offset + count);
+        } while (count == chunkSize);
+    }
+    tdlFreeStream(stream);
+    return buffer;
+}
+
+#else
+
+std::vector<unsigned char> createBufferFromFile(const std::string & uri)
+{
+    const ContentView view = createViewFromFile(uri);
+    if (view.data != nullptr) {
+        return std::vector<unsigned char>(view.data, view.data + view.size);
+    }
+
+    // Local uris look like "content:///Albedos/Bricks.png".
+    const size_t scheme = uri.find(":///");
+    const char * root = std::getenv("TYGRA_CONTENT_DIR");
+    const std::string path = scheme == std::string::npos
+                           ? uri
+                           : std::string(root ? root : ".") + "/" + uri.substr(scheme + 4);
+
+    std::vector<unsigned char> buffer;
+    std::FILE * file = std::fopen(path.c_str(), "rb");
+    if (file != nullptr) {
+        unsigned char chunk[65536];
+        size_t count = 0;
+        while ((count = std::fread(chunk, 1, sizeof(chunk), file)) > 0) {
+            buffer.insert(buffer.end(), chunk, chunk + count);
+        }
+        std::fclose(file);
+    }
+    return buffer;
+}
+
+std::string createStringFromFile(const std::string & uri)
+{
+    const std::vector<unsigned char> buffer = createBufferFromFile(uri);
+    return std::string(buffer.begin(), buffer.end());
+}
+
+#endif
+
+Image createImageFromPngFile(const std::string & uri)
+{
+    // Packed files are decoded from the mapping, only loose files are copied into memory.
+    const ContentView view = createViewFromFile(uri);
+    const std::vector<unsigned char> file = view.data ? std::vector<unsigned char>() : createBufferFromFile(uri);
+    const unsigned char * data = view.data ? view.data : file.data();
+    const size_t size = view.data ? view.size : file.size();
+
+    // Pixels are decoded straight into the image. The bottom row is stored
+    // first, as OpenGL expects and exactly as tdlCreateImageFromParser() did,
+    // so textures and baked .btex files keep their orientation.
+    PngDecoder decoder;
+    if (!decoder.open(data, size)) {
+        return Image(0, 0, 0, 0);
+    }
+
+    Image image(decoder.width(), decoder.height(), decoder.componentsPerPixel(), decoder.bytesPerComponent());
+    if (!decoder.decode(image.pixelData(), decoder.rowSize(), true)) {
+        return Image(0, 0, 0, 0);
+    }
+    return image;
 }
 
 } // end namespace tyga
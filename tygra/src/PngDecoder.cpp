@@ -0,0 +1,892 @@
+/**
+ * @file
+ * @date      October 2026
+ *
+ *
+ * @section LICENSE
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "tygra/PngDecoder.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TYGRA_PNG_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace tygra {
+
+namespace {
+
+uint32_t readBigEndian(const unsigned char * bytes)
+{
+    return (uint32_t(bytes[0]) << 24) | (uint32_t(bytes[1]) << 16)
+         | (uint32_t(bytes[2]) << 8) | uint32_t(bytes[3]);
+}
+
+/**
+ * Canonical Huffman decoding table. Codes up to fastBits long are resolved
+ * with a single lookup, longer codes search the per-length code ranges.
+ */
+struct Huffman
+{
+    static const int fastBits = 10;
+    static const int maxSymbols = 288;
+
+    uint16_t fast[1 << fastBits];   // (length << 9) | symbol, zero when the code is longer
+    uint16_t firstCode[16];
+    uint16_t firstSymbol[16];
+    uint32_t maxCode[17];           // one past the last code of each length, left aligned to 16 bits
+    uint8_t lengths[maxSymbols];
+    uint16_t symbols[maxSymbols];
+
+    bool build(const uint8_t * codeLengths, int count);
+};
+
+int reverseBits(int bits, int count)
+{
+    auto reversed = 0;
+    for (int i = 0; i < count; ++i) {
+        reversed = (reversed << 1) | (bits & 1);
+        bits >>= 1;
+    }
+    return reversed;
+}
+
+bool Huffman::build(const uint8_t * codeLengths, int count)
+{
+    int sizes[17] = {};
+    int nextCode[16] = {};
+
+    std::memset(fast, 0, sizeof(fast));
+    for (int i = 0; i < count; ++i) {
+        ++sizes[codeLengths[i]];
+    }
+    sizes[0] = 0;
+
+    for (int i = 1; i < 16; ++i) {
+        if (sizes[i] > (1 << i)) {
+            return false;
+        }
+    }
+
+    auto code = 0;
+    auto symbol = 0;
+    for (int i = 1; i < 16; ++i) {
+        nextCode[i] = code;
+        firstCode[i] = uint16_t(code);
+        firstSymbol[i] = uint16_t(symbol);
+        code += sizes[i];
+        if (sizes[i] != 0 && code - 1 >= (1 << i)) {
+            return false;
+        }
+        maxCode[i] = uint32_t(code) << (16 - i);
+        code <<= 1;
+        symbol += sizes[i];
+    }
+    maxCode[16] = 0x10000;
+
+    for (int i = 0; i < count; ++i) {
+        const int length = codeLengths[i];
+        if (length == 0) {
+            continue;
+        }
+
+        const auto index = nextCode[length] - firstCode[length] + firstSymbol[length];
+        lengths[index] = uint8_t(length);
+        symbols[index] = uint16_t(i);
+
+        if (length <= fastBits) {
+            const auto entry = uint16_t((length << 9) | i);
+            for (int j = reverseBits(nextCode[length], length); j < (1 << fastBits); j += 1 << length) {
+                fast[j] = entry;
+            }
+        }
+        ++nextCode[length];
+    }
+    return true;
+}
+
+/**
+ * Inflates a zlib stream split across IDAT chunks. Output is produced on
+ * demand into a sliding window which only needs to hold the 32KB of history
+ * deflate can refer to, so the whole image is never decompressed at once.
+ */
+class Inflater
+{
+public:
+
+    using Chunk = std::pair<const unsigned char *, size_t>;
+
+    explicit Inflater(const std::vector<Chunk> & chunks) : _chunks(chunks)
+    {
+    }
+
+    bool begin();
+
+    /**
+     * Copy the next count bytes of decompressed data into the destination.
+     */
+    bool read(unsigned char * destination, size_t count);
+
+private:
+
+    static const size_t historySize = 32768;
+    static const size_t maxMatch = 258;
+    static const size_t windowSize = historySize * 3;
+
+    enum class State { Header, Stored, Compressed, Finished };
+
+    const std::vector<Chunk> & _chunks;
+    size_t _chunk{ 0 };
+    const unsigned char * _next{ nullptr };
+    const unsigned char * _end{ nullptr };
+    uint64_t _bits{ 0 };
+    unsigned int _bitCount{ 0 };
+    unsigned int _padding{ 0 };
+
+    State _state{ State::Header };
+    bool _finalBlock{ false };
+    size_t _storedRemaining{ 0 };
+    Huffman _lengths;
+    Huffman _distances;
+
+    std::vector<unsigned char> _window;
+    size_t _read{ 0 };
+    size_t _write{ 0 };
+
+    bool nextByte(unsigned char & byte);
+    void refill();
+    uint32_t takeBits(unsigned int count);
+    int decodeSymbol(const Huffman & table);
+    bool overran() const { return _bitCount < _padding * 8; }
+
+    bool fill();
+    bool readBlockHeader();
+    bool readDynamicTables();
+    void useFixedTables();
+    bool inflateStored();
+    bool inflateCompressed();
+};
+
+bool Inflater::nextByte(unsigned char & byte)
+{
+    while (_next == _end) {
+        if (_chunk == _chunks.size()) {
+            return false;
+        }
+        _next = _chunks[_chunk].first;
+        _end = _next + _chunks[_chunk].second;
+        ++_chunk;
+    }
+    byte = *_next++;
+    return true;
+}
+
+void Inflater::refill()
+{
+    while (_bitCount <= 56) {
+        // Reading past the end pads with zeros, overran() reports whether they were used.
+        unsigned char byte = 0;
+        if (!nextByte(byte)) {
+            ++_padding;
+        }
+        _bits |= uint64_t(byte) << _bitCount;
+        _bitCount += 8;
+    }
+}
+
+uint32_t Inflater::takeBits(unsigned int count)
+{
+    if (_bitCount < count) {
+        refill();
+    }
+    const auto value = uint32_t(_bits & ((uint64_t(1) << count) - 1));
+    _bits >>= count;
+    _bitCount -= count;
+    return value;
+}
+
+int Inflater::decodeSymbol(const Huffman & table)
+{
+    if (_bitCount < 16) {
+        refill();
+    }
+
+    const auto entry = table.fast[_bits & ((1 << Huffman::fastBits) - 1)];
+    if (entry != 0) {
+        const auto length = entry >> 9;
+        _bits >>= length;
+        _bitCount -= length;
+        return entry & 511;
+    }
+
+    // Codes are stored most significant bit first, the table ranges expect that order.
+    const auto code = uint32_t(reverseBits(int(_bits & 0xFFFF), 16));
+    int length = Huffman::fastBits + 1;
+    while (length < 16 && code >= table.maxCode[length]) {
+        ++length;
+    }
+    if (length >= 16) {
+        return -1;
+    }
+
+    const auto index = int(code >> (16 - length)) - table.firstCode[length] + table.firstSymbol[length];
+    if (index < 0 || index >= Huffman::maxSymbols || table.lengths[index] != length) {
+        return -1;
+    }
+
+    _bits >>= length;
+    _bitCount -= length;
+    return table.symbols[index];
+}
+
+bool Inflater::begin()
+{
+    _window.resize(windowSize);
+
+    const auto method = takeBits(8);
+    const auto flags = takeBits(8);
+    const auto valid = (method * 256 + flags) % 31 == 0
+                    && (method & 15) == 8
+                    && (flags & 32) == 0;
+    return valid && !overran();
+}
+
+bool Inflater::read(unsigned char * destination, size_t count)
+{
+    while (count > 0) {
+        if (_read == _write && !fill()) {
+            return false;
+        }
+
+        const auto available = _write - _read;
+        const auto size = available < count ? available : count;
+        std::memcpy(destination, _window.data() + _read, size);
+        destination += size;
+        count -= size;
+        _read += size;
+    }
+    return true;
+}
+
+bool Inflater::fill()
+{
+    // Only the history deflate can refer to, plus anything unread, has to be kept.
+    if (_write > historySize && _write + maxMatch > windowSize) {
+        const auto keepFrom = _read < _write - historySize ? _read : _write - historySize;
+        std::memmove(_window.data(), _window.data() + keepFrom, _write - keepFrom);
+        _read -= keepFrom;
+        _write -= keepFrom;
+    }
+
+    const auto start = _write;
+    while (_write + maxMatch <= windowSize && _state != State::Finished) {
+        auto success = true;
+        switch (_state) {
+        case State::Header:
+            success = readBlockHeader();
+            break;
+        case State::Stored:
+            success = inflateStored();
+            break;
+        case State::Compressed:
+            success = inflateCompressed();
+            break;
+        case State::Finished:
+            break;
+        }
+        if (!success || overran()) {
+            return false;
+        }
+    }
+    return _write > start;
+}
+
+bool Inflater::readBlockHeader()
+{
+    if (_finalBlock) {
+        _state = State::Finished;
+        return true;
+    }
+
+    _finalBlock = takeBits(1) == 1;
+    switch (takeBits(2)) {
+    case 0:
+    {
+        // Stored blocks begin on a byte boundary, whole bytes remain in the bit buffer.
+        takeBits(_bitCount & 7);
+        const auto length = takeBits(16);
+        const auto complement = takeBits(16);
+        if ((length ^ 0xFFFF) != complement) {
+            return false;
+        }
+        _storedRemaining = length;
+        _state = State::Stored;
+        return true;
+    }
+    case 1:
+        useFixedTables();
+        _state = State::Compressed;
+        return true;
+    case 2:
+        _state = State::Compressed;
+        return readDynamicTables();
+    default:
+        return false;
+    }
+}
+
+void Inflater::useFixedTables()
+{
+    uint8_t lengths[Huffman::maxSymbols];
+    std::memset(lengths, 8, 144);
+    std::memset(lengths + 144, 9, 256 - 144);
+    std::memset(lengths + 256, 7, 280 - 256);
+    std::memset(lengths + 280, 8, Huffman::maxSymbols - 280);
+    _lengths.build(lengths, Huffman::maxSymbols);
+
+    uint8_t distances[32];
+    std::memset(distances, 5, sizeof(distances));
+    _distances.build(distances, 32);
+}
+
+bool Inflater::readDynamicTables()
+{
+    static const uint8_t order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+    const auto lengthCount = int(takeBits(5)) + 257;
+    const auto distanceCount = int(takeBits(5)) + 1;
+    const auto codeLengthCount = int(takeBits(4)) + 4;
+
+    uint8_t codeLengthSizes[19] = {};
+    for (int i = 0; i < codeLengthCount; ++i) {
+        codeLengthSizes[order[i]] = uint8_t(takeBits(3));
+    }
+
+    auto codeLengths = Huffman{};
+    if (!codeLengths.build(codeLengthSizes, 19)) {
+        return false;
+    }
+
+    uint8_t sizes[286 + 32 + 138];
+    const auto total = lengthCount + distanceCount;
+    auto count = 0;
+    while (count < total) {
+        const auto symbol = decodeSymbol(codeLengths);
+        if (symbol < 0 || symbol >= 19) {
+            return false;
+        }
+        if (symbol < 16) {
+            sizes[count++] = uint8_t(symbol);
+            continue;
+        }
+
+        auto repeat = 0;
+        auto value = uint8_t(0);
+        if (symbol == 16) {
+            if (count == 0) {
+                return false;
+            }
+            repeat = int(takeBits(2)) + 3;
+            value = sizes[count - 1];
+        }
+        else if (symbol == 17) {
+            repeat = int(takeBits(3)) + 3;
+        }
+        else {
+            repeat = int(takeBits(7)) + 11;
+        }
+        if (total - count < repeat) {
+            return false;
+        }
+        std::memset(sizes + count, value, repeat);
+        count += repeat;
+    }
+
+    // Every block has to be able to end.
+    return sizes[256] != 0
+        && _lengths.build(sizes, lengthCount)
+        && _distances.build(sizes + lengthCount, distanceCount);
+}
+
+bool Inflater::inflateStored()
+{
+    auto output = _window.data();
+    while (_storedRemaining > 0 && _write < windowSize) {
+        if (_bitCount >= 8) {
+            output[_write++] = uint8_t(takeBits(8));
+            --_storedRemaining;
+            continue;
+        }
+
+        if (_next == _end) {
+            unsigned char byte = 0;
+            if (!nextByte(byte)) {
+                return false;
+            }
+            output[_write++] = byte;
+            --_storedRemaining;
+            continue;
+        }
+
+        auto size = size_t(_end - _next);
+        size = size < _storedRemaining ? size : _storedRemaining;
+        size = size < windowSize - _write ? size : windowSize - _write;
+        std::memcpy(output + _write, _next, size);
+        _next += size;
+        _write += size;
+        _storedRemaining -= size;
+    }
+
+    if (_storedRemaining == 0) {
+        _state = State::Header;
+    }
+    return true;
+}
+
+bool Inflater::inflateCompressed()
+{
+    static const uint16_t lengthBase[29] = {
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+        35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const uint8_t lengthExtra[29] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+        3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const uint16_t distanceBase[30] = {
+        1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+        257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static const uint8_t distanceExtra[30] = {
+        0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    auto output = _window.data();
+    while (_write + maxMatch <= windowSize) {
+        const auto symbol = decodeSymbol(_lengths);
+        if (symbol < 256) {
+            if (symbol < 0) {
+                return false;
+            }
+            output[_write++] = uint8_t(symbol);
+            continue;
+        }
+        if (symbol == 256) {
+            _state = State::Header;
+            return true;
+        }
+
+        const auto lengthIndex = symbol - 257;
+        if (lengthIndex >= 29) {
+            return false;
+        }
+        const auto length = size_t(lengthBase[lengthIndex] + takeBits(lengthExtra[lengthIndex]));
+
+        const auto distanceIndex = decodeSymbol(_distances);
+        if (distanceIndex < 0 || distanceIndex >= 30) {
+            return false;
+        }
+        const auto distance = size_t(distanceBase[distanceIndex] + takeBits(distanceExtra[distanceIndex]));
+        if (distance > _write) {
+            return false;
+        }
+
+        auto target = output + _write;
+        const auto source = target - distance;
+        if (distance >= length) {
+            std::memcpy(target, source, length);
+        }
+        else if (distance == 1) {
+            std::memset(target, *source, length);
+        }
+        else {
+            // Overlapping copies repeat the most recent bytes.
+            for (size_t i = 0; i < length; ++i) {
+                target[i] = source[i];
+            }
+        }
+        _write += length;
+    }
+    return true;
+}
+
+/*
+ * Unfiltering writes out = filtered + prediction, where the prediction uses
+ * the reconstructed bytes of the pixel to the left (a), above (b) and above
+ * left (c). The first row is predicted from a row of zeros.
+ */
+
+void unfilterUp(const unsigned char * filtered, const unsigned char * prior, unsigned char * out, size_t size)
+{
+    size_t i = 0;
+#if defined(TYGRA_PNG_SSE2)
+    for (; i + 16 <= size; i += 16) {
+        const auto x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(filtered + i));
+        const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(prior + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_add_epi8(x, b));
+    }
+#endif
+    for (; i < size; ++i) {
+        out[i] = uint8_t(filtered[i] + prior[i]);
+    }
+}
+
+uint8_t paethPredictor(int a, int b, int c)
+{
+    const auto pa = std::abs(b - c);
+    const auto pb = std::abs(a - c);
+    const auto pc = std::abs(a + b - 2 * c);
+    return uint8_t(pa <= pb && pa <= pc ? a : pb <= pc ? b : c);
+}
+
+void unfilterScalar(int type, const unsigned char * filtered, const unsigned char * prior, unsigned char * out,
+                    size_t size, size_t bpp)
+{
+    const auto first = bpp < size ? bpp : size;
+    switch (type) {
+    case 1:
+        std::memcpy(out, filtered, first);
+        for (size_t i = bpp; i < size; ++i) {
+            out[i] = uint8_t(filtered[i] + out[i - bpp]);
+        }
+        break;
+    case 3:
+        for (size_t i = 0; i < first; ++i) {
+            out[i] = uint8_t(filtered[i] + (prior[i] >> 1));
+        }
+        for (size_t i = bpp; i < size; ++i) {
+            out[i] = uint8_t(filtered[i] + ((out[i - bpp] + prior[i]) >> 1));
+        }
+        break;
+    case 4:
+        for (size_t i = 0; i < first; ++i) {
+            out[i] = uint8_t(filtered[i] + prior[i]);
+        }
+        for (size_t i = bpp; i < size; ++i) {
+            out[i] = uint8_t(filtered[i] + paethPredictor(out[i - bpp], prior[i], prior[i - bpp]));
+        }
+        break;
+    }
+}
+
+#if defined(TYGRA_PNG_SSE2)
+
+/*
+ * Sub, Average and Paeth depend on the pixel to the left so they can't be
+ * vectorised along the row. Instead every component of a pixel is handled
+ * at once, which is where most of the work is for 3 and 4 byte pixels.
+ */
+
+template <size_t Bpp>
+__m128i loadPixel(const unsigned char * pixel)
+{
+    int64_t value = 0;
+    std::memcpy(&value, pixel, Bpp);
+    return _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&value));
+}
+
+template <size_t Bpp>
+void storePixel(unsigned char * pixel, __m128i value)
+{
+    int64_t bytes;
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(&bytes), value);
+    std::memcpy(pixel, &bytes, Bpp);
+}
+
+__m128i absolute16(__m128i value)
+{
+    const auto negative = _mm_cmplt_epi16(value, _mm_setzero_si128());
+    return _mm_sub_epi16(_mm_xor_si128(value, negative), negative);
+}
+
+__m128i select(__m128i condition, __m128i whenTrue, __m128i whenFalse)
+{
+    return _mm_or_si128(_mm_and_si128(condition, whenTrue), _mm_andnot_si128(condition, whenFalse));
+}
+
+template <size_t Bpp>
+void unfilterPixels(int type, const unsigned char * filtered, const unsigned char * prior, unsigned char * out,
+                    size_t size)
+{
+    const auto zero = _mm_setzero_si128();
+    auto a = zero;
+    auto c = zero;
+
+    switch (type) {
+    case 1:
+        for (size_t i = 0; i + Bpp <= size; i += Bpp) {
+            a = _mm_add_epi8(a, loadPixel<Bpp>(filtered + i));
+            storePixel<Bpp>(out + i, a);
+        }
+        break;
+    case 3:
+    {
+        // _mm_avg_epu8 rounds up, subtracting the low bit of a ^ b makes it round down.
+        const auto one = _mm_set1_epi8(1);
+        for (size_t i = 0; i + Bpp <= size; i += Bpp) {
+            const auto b = loadPixel<Bpp>(prior + i);
+            auto average = _mm_avg_epu8(a, b);
+            average = _mm_sub_epi8(average, _mm_and_si128(_mm_xor_si128(a, b), one));
+            a = _mm_add_epi8(average, loadPixel<Bpp>(filtered + i));
+            storePixel<Bpp>(out + i, a);
+        }
+        break;
+    }
+    case 4:
+        for (size_t i = 0; i + Bpp <= size; i += Bpp) {
+            const auto b = _mm_unpacklo_epi8(loadPixel<Bpp>(prior + i), zero);
+            const auto x = _mm_unpacklo_epi8(loadPixel<Bpp>(filtered + i), zero);
+
+            auto pa = _mm_sub_epi16(b, c);
+            auto pb = _mm_sub_epi16(a, c);
+            auto pc = _mm_add_epi16(pa, pb);
+            pa = absolute16(pa);
+            pb = absolute16(pb);
+            pc = absolute16(pc);
+
+            const auto smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+            const auto nearest = select(_mm_cmpeq_epi16(smallest, pa), a,
+                                        select(_mm_cmpeq_epi16(smallest, pb), b, c));
+
+            // Adding bytes keeps each 16 bit lane within 0-255 so packing is exact.
+            a = _mm_add_epi8(x, nearest);
+            c = b;
+            storePixel<Bpp>(out + i, _mm_packus_epi16(a, a));
+        }
+        break;
+    }
+}
+
+#endif
+
+void unfilter(int type, const unsigned char * filtered, const unsigned char * prior, unsigned char * out,
+              size_t size, size_t bpp)
+{
+    if (type == 0) {
+        std::memcpy(out, filtered, size);
+        return;
+    }
+    if (type == 2) {
+        unfilterUp(filtered, prior, out, size);
+        return;
+    }
+
+#if defined(TYGRA_PNG_SSE2)
+    switch (bpp) {
+    case 3:
+        unfilterPixels<3>(type, filtered, prior, out, size);
+        return;
+    case 4:
+        unfilterPixels<4>(type, filtered, prior, out, size);
+        return;
+    case 6:
+        unfilterPixels<6>(type, filtered, prior, out, size);
+        return;
+    case 8:
+        unfilterPixels<8>(type, filtered, prior, out, size);
+        return;
+    }
+#endif
+    unfilterScalar(type, filtered, prior, out, size, bpp);
+}
+
+/**
+ * PNG stores 16 bit components big-endian, OpenGL expects native order.
+ */
+void swapBytes16(const unsigned char * row, unsigned char * out, size_t size)
+{
+    size_t i = 0;
+#if defined(TYGRA_PNG_SSE2)
+    for (; i + 16 <= size; i += 16) {
+        const auto x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + i));
+        const auto swapped = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), swapped);
+    }
+#endif
+    for (; i < size; i += 2) {
+        const auto value = uint16_t((row[i] << 8) | row[i + 1]);
+        std::memcpy(out + i, &value, 2);
+    }
+}
+
+} // end anonymous namespace
+
+bool PngDecoder::open(const void * data, size_t size)
+{
+    static const unsigned char signature[8] = { 137, 'P', 'N', 'G', 13, 10, 26, 10 };
+
+    _chunks.clear();
+    _width = _height = _components = 0;
+    _bitDepth = _colourType = 0;
+
+    auto bytes = static_cast<const unsigned char *>(data);
+    if (size < 8 || std::memcmp(bytes, signature, 8) != 0) {
+        return false;
+    }
+
+    auto paletteSize = size_t{ 0 };
+    auto transparent = false;
+    auto headerRead = false;
+
+    for (size_t offset = 8; offset + 12 <= size; ) {
+        const auto length = size_t(readBigEndian(bytes + offset));
+        const auto type = bytes + offset + 4;
+        const auto body = bytes + offset + 8;
+        if (length > size - offset - 12) {
+            return false;
+        }
+        offset += length + 12;
+
+        if (std::memcmp(type, "IHDR", 4) == 0) {
+            if (length != 13) {
+                return false;
+            }
+            _width = readBigEndian(body);
+            _height = readBigEndian(body + 4);
+            _bitDepth = body[8];
+            _colourType = body[9];
+            const auto compression = body[10];
+            const auto filter = body[11];
+            const auto interlace = body[12];
+            if (_width == 0 || _height == 0 || compression != 0 || filter != 0 || interlace != 0) {
+                return false;
+            }
+            headerRead = true;
+        }
+        else if (!headerRead) {
+            return false;
+        }
+        else if (std::memcmp(type, "PLTE", 4) == 0) {
+            paletteSize = length / 3;
+            if (paletteSize > 256 || length % 3 != 0) {
+                return false;
+            }
+            for (size_t i = 0; i < paletteSize; ++i) {
+                _palette[i * 4 + 0] = body[i * 3 + 0];
+                _palette[i * 4 + 1] = body[i * 3 + 1];
+                _palette[i * 4 + 2] = body[i * 3 + 2];
+                _palette[i * 4 + 3] = 255;
+            }
+        }
+        else if (std::memcmp(type, "tRNS", 4) == 0) {
+            // Colour keys of non-palette images are ignored.
+            if (_colourType == 3) {
+                if (length > paletteSize) {
+                    return false;
+                }
+                for (size_t i = 0; i < length; ++i) {
+                    _palette[i * 4 + 3] = body[i];
+                }
+                transparent = true;
+            }
+        }
+        else if (std::memcmp(type, "IDAT", 4) == 0) {
+            _chunks.emplace_back(body, length);
+        }
+        else if (std::memcmp(type, "IEND", 4) == 0) {
+            break;
+        }
+    }
+
+    switch (_colourType) {
+    case 0:
+        _components = 1;
+        break;
+    case 2:
+        _components = 3;
+        break;
+    case 3:
+        _components = transparent ? 4 : 3;
+        break;
+    case 4:
+        _components = 2;
+        break;
+    case 6:
+        _components = 4;
+        break;
+    default:
+        return false;
+    }
+
+    const auto depthSupported = _colourType == 3 ? _bitDepth == 8 : _bitDepth == 8 || _bitDepth == 16;
+    const auto paletteValid = _colourType != 3 || paletteSize > 0;
+    if (!headerRead || !depthSupported || !paletteValid || _chunks.empty()) {
+        _chunks.clear();
+        return false;
+    }
+    return true;
+}
+
+bool PngDecoder::decode(void * destination, size_t pitch, bool bottomRowFirst) const
+{
+    if (_chunks.empty() || pitch < rowSize()) {
+        return false;
+    }
+
+    auto inflater = Inflater{ _chunks };
+    if (!inflater.begin()) {
+        return false;
+    }
+
+    // Each filtered row is preceded by its filter type.
+    const auto samples = _colourType == 3 ? size_t{ 1 } : _components;
+    const auto bpp = samples * (_bitDepth / 8);
+    const auto stride = _width * bpp;
+
+    // Rows are unfiltered into two scratch rows which alternate as the prior row, so the destination is only ever
+    // written. It may be write-combined memory such as a mapped pixel unpack buffer, where reads are very slow.
+    auto scratch = std::vector<unsigned char>(1 + stride * 4, 0);
+    const auto filtered = scratch.data();
+    const auto zeros = filtered + 1 + stride;
+    unsigned char * const raw[2] = { zeros + stride, zeros + stride * 2 };
+    const auto eightBit = _colourType != 3 && _bitDepth == 8;
+
+    auto output = static_cast<unsigned char *>(destination);
+    const unsigned char * prior = zeros;
+    for (size_t y = 0; y < _height; ++y) {
+        if (!inflater.read(filtered, stride + 1) || filtered[0] > 4) {
+            return false;
+        }
+
+        const auto row = output + (bottomRowFirst ? _height - 1 - y : y) * pitch;
+        const auto out = raw[y & 1];
+        unfilter(filtered[0], filtered + 1, prior, out, stride, bpp);
+        prior = out;
+
+        if (eightBit) {
+            std::memcpy(row, out, stride);
+        }
+        else if (_colourType == 3) {
+            for (size_t x = 0; x < _width; ++x) {
+                std::memcpy(row + x * _components, &_palette[out[x] * 4], _components);
+            }
+        }
+        else {
+            swapBytes16(out, row, stride);
+        }
+    }
+    return true;
+}
+
+} // end namespace tygra